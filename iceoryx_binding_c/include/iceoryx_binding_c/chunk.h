@@ -49,4 +49,9 @@ iox_chunk_header_t* iox_chunk_header_from_user_payload(void* const userPayload);
 /// @return const pointer to the chunk-header
 const iox_chunk_header_t* iox_chunk_header_from_user_payload_const(const void* const userPayload);
 
+/// @brief gets the point in time when the chunk was published
+/// @param[in] chunkHeader const pointer to the chunk-header
+/// @return monotonic timestamp in nanoseconds or 0 if the publisher has not enabled publish timestamps
+uint64_t iox_chunk_header_publish_timestamp(const iox_chunk_header_t* const chunkHeader);
+
 #endif
@@ -42,6 +42,10 @@ typedef struct
     /// @brief describes whether a publisher blocks when subscriber queue is full
     ENUM iox_ConsumerTooSlowPolicy subscriberTooSlowPolicy;
 
+    /// @brief The option whether the publish time is stored in the chunk-header of every sent chunk,
+    ///        see iox_chunk_header_publish_timestamp
+    bool publishTimestamp;
+
     /// @brief this value will be set exclusively by `iox_pub_options_init` and is not supposed to be modified otherwise
     uint64_t initCheck;
 } iox_pub_options_t;
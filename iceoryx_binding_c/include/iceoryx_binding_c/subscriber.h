@@ -50,6 +50,10 @@ typedef struct
     ///        not be connected to the publisher.
     bool requirePublisherHistorySupport;
 
+    /// @brief The option whether the latency of received chunks with a publish timestamp is recorded
+    ///        and exported via the port introspection
+    bool recordLatency;
+
     /// @brief this value will be set exclusively by iox_sub_options_init and is not supposed to be modified otherwise
     uint64_t initCheck;
 } iox_sub_options_t;
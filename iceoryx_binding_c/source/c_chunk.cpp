@@ -52,3 +52,8 @@ const iox_chunk_header_t* iox_chunk_header_from_user_payload_const(const void* c
 {
     return reinterpret_cast<const iox_chunk_header_t*>(ChunkHeader::fromUserPayload(userPayload));
 }
+
+uint64_t iox_chunk_header_publish_timestamp(const iox_chunk_header_t* const chunkHeader)
+{
+    return reinterpret_cast<const ChunkHeader*>(chunkHeader)->publishTimestamp();
+}
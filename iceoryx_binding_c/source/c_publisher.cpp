@@ -50,6 +50,7 @@ void iox_pub_options_init(iox_pub_options_t* options)
     options->nodeName = nullptr;
     options->offerOnCreate = publisherOptions.offerOnCreate;
     options->subscriberTooSlowPolicy = cpp2c::consumerTooSlowPolicy(publisherOptions.subscriberTooSlowPolicy);
+    options->publishTimestamp = publisherOptions.publishTimestamp;
 
     options->initCheck = PUBLISHER_OPTIONS_INIT_CHECK_CONSTANT;
 }
@@ -90,6 +91,7 @@ iox_pub_t iox_pub_init(iox_pub_storage_t* self,
         }
         publisherOptions.offerOnCreate = options->offerOnCreate;
         publisherOptions.subscriberTooSlowPolicy = c2cpp::consumerTooSlowPolicy(options->subscriberTooSlowPolicy);
+        publisherOptions.publishTimestamp = options->publishTimestamp;
     }
 
     auto* me = new cpp2c_Publisher();
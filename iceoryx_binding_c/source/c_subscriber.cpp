@@ -64,6 +64,7 @@ void iox_sub_options_init(iox_sub_options_t* options)
     options->subscribeOnCreate = subscriberOptions.subscribeOnCreate;
     options->queueFullPolicy = cpp2c::queueFullPolicy(subscriberOptions.queueFullPolicy);
     options->requirePublisherHistorySupport = false;
+    options->recordLatency = subscriberOptions.recordLatency;
 
     options->initCheck = SUBSCRIBER_OPTIONS_INIT_CHECK_CONSTANT;
 }
@@ -106,6 +107,7 @@ iox_sub_t iox_sub_init(iox_sub_storage_t* self,
         subscriberOptions.subscribeOnCreate = options->subscribeOnCreate;
         subscriberOptions.queueFullPolicy = c2cpp::queueFullPolicy(options->queueFullPolicy);
         subscriberOptions.requiresPublisherHistorySupport = options->requirePublisherHistorySupport;
+        subscriberOptions.recordLatency = options->recordLatency;
     }
 
     // this is required for CycloneDDS to limit the fallout of our change to use the heap for storage
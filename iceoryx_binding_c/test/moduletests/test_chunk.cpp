@@ -159,4 +159,16 @@ TEST_F(Chunk_test, GettingUserHeaderFromConstChunkHeaderWorks)
     EXPECT_THAT(userHeaderStartAddress - chunkStartAddress, Eq(sizeof(ChunkHeader)));
 }
 
+TEST_F(Chunk_test, PublishTimestampOfLoanedChunkIsNotSet)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2040ef49-f2fe-4bf8-bebd-c7ae70465c32");
+    constexpr uint32_t USER_PAYLOAD_SIZE(42U);
+    void* userPayload{nullptr};
+    ASSERT_EQ(iox_pub_loan_chunk(publisher, &userPayload, USER_PAYLOAD_SIZE), AllocationResult_SUCCESS);
+
+    const iox_chunk_header_t* chunkHeader = iox_chunk_header_from_user_payload_const(userPayload);
+
+    EXPECT_THAT(iox_chunk_header_publish_timestamp(chunkHeader), Eq(0U));
+}
+
 } // namespace
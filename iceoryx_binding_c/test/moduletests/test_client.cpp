@@ -67,7 +67,9 @@ class iox_client_test : public Test
         sutPort->m_connectRequested.store(true);
         sutPort->m_connectionState = iox::ConnectionState::CONNECTED;
 
-        sutPort->m_chunkSenderData.m_queues.emplace_back(&serverChunkQueueData);
+        using ChunkDistributor_t = iox::popo::ChunkDistributor<iox::popo::ClientChunkDistributorData_t>;
+        ChunkDistributor_t chunkDistributor(&sutPort->m_chunkSenderData);
+        IOX_DISCARD_RESULT(chunkDistributor.tryAddQueue(&serverChunkQueueData));
     }
 
     void receiveChunk(const int64_t chunkValue = 0)
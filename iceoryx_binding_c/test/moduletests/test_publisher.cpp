@@ -355,6 +355,7 @@ TEST(iox_pub_options_test, publisherOptionsAreInitializedCorrectly)
     sut.nodeName = "Dr.Gonzo";
     sut.offerOnCreate = false;
     sut.subscriberTooSlowPolicy = ConsumerTooSlowPolicy_WAIT_FOR_CONSUMER;
+    sut.publishTimestamp = true;
 
     PublisherOptions options;
     // set offerOnCreate to the opposite of the expected default to check if it gets overwritten to default
@@ -365,6 +366,7 @@ TEST(iox_pub_options_test, publisherOptionsAreInitializedCorrectly)
     EXPECT_EQ(sut.nodeName, nullptr);
     EXPECT_EQ(sut.offerOnCreate, options.offerOnCreate);
     EXPECT_EQ(sut.subscriberTooSlowPolicy, cpp2c::consumerTooSlowPolicy(options.subscriberTooSlowPolicy));
+    EXPECT_EQ(sut.publishTimestamp, options.publishTimestamp);
     EXPECT_TRUE(iox_pub_options_is_initialized(&sut));
 }
 
@@ -434,6 +434,7 @@ TEST(iox_sub_options_test, subscriberOptionsAreInitializedCorrectly)
     sut.nodeName = "Dr.Gonzo";
     sut.subscribeOnCreate = false;
     sut.queueFullPolicy = QueueFullPolicy_BLOCK_PRODUCER;
+    sut.recordLatency = true;
 
     SubscriberOptions options;
     // set subscribeOnCreate to the opposite of the expected default to check if it gets overwritten to default
@@ -445,6 +446,7 @@ TEST(iox_sub_options_test, subscriberOptionsAreInitializedCorrectly)
     EXPECT_EQ(sut.nodeName, nullptr);
     EXPECT_EQ(sut.subscribeOnCreate, options.subscribeOnCreate);
     EXPECT_EQ(sut.queueFullPolicy, cpp2c::queueFullPolicy(options.queueFullPolicy));
+    EXPECT_EQ(sut.recordLatency, options.recordLatency);
     EXPECT_TRUE(iox_sub_options_is_initialized(&sut));
 }
 
@@ -1107,7 +1107,10 @@ TEST_F(iox_ws_test, AttachingServiceDiscoveryEventWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "a8be9cbd-d9b6-45a3-b34f-d58fb864d40d");
     iox_service_discovery_storage_t serviceDiscoveryStorage;
-    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _)).WillOnce(Return(&m_portDataVector[0]));
+    // the first subscriber receives the registry snapshots, the second one the deltas which trigger the event
+    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _))
+        .WillOnce(Return(&m_portDataVector[1]))
+        .WillOnce(Return(&m_portDataVector[0]));
 
     iox_service_discovery_t serviceDiscovery = iox_service_discovery_init(&serviceDiscoveryStorage);
 
@@ -1126,7 +1129,10 @@ TEST_F(iox_ws_test, AttachingServiceDiscoveryEventWithContextDataWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "69515627-1590-4616-8502-975cd9256ecf");
     iox_service_discovery_storage_t serviceDiscoveryStorage;
-    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _)).WillOnce(Return(&m_portDataVector[0]));
+    // the first subscriber receives the registry snapshots, the second one the deltas which trigger the event
+    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _))
+        .WillOnce(Return(&m_portDataVector[1]))
+        .WillOnce(Return(&m_portDataVector[0]));
 
     iox_service_discovery_t serviceDiscovery = iox_service_discovery_init(&serviceDiscoveryStorage);
 
@@ -1153,7 +1159,10 @@ TEST_F(iox_ws_test, NotifyingServiceDiscoveryEventWorks)
     ::testing::Test::RecordProperty("TEST_ID", "945dcf94-4679-469f-aa47-1a87d536da72");
     constexpr uint64_t EVENT_ID = 13;
     iox_service_discovery_storage_t serviceDiscoveryStorage;
-    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _)).WillOnce(Return(&m_portDataVector[0]));
+    // the first subscriber receives the registry snapshots, the second one the deltas which trigger the event
+    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _))
+        .WillOnce(Return(&m_portDataVector[1]))
+        .WillOnce(Return(&m_portDataVector[0]));
 
     iox_service_discovery_t serviceDiscovery = iox_service_discovery_init(&serviceDiscoveryStorage);
 
@@ -1182,7 +1191,10 @@ TEST_F(iox_ws_test, NotifyingServiceDiscoveryEventWithContextDataWorks)
     ::testing::Test::RecordProperty("TEST_ID", "510a0351-afeb-4c0f-a4b6-3032f1f3f831");
     constexpr uint64_t EVENT_ID = 31;
     iox_service_discovery_storage_t serviceDiscoveryStorage;
-    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _)).WillOnce(Return(&m_portDataVector[0]));
+    // the first subscriber receives the registry snapshots, the second one the deltas which trigger the event
+    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _))
+        .WillOnce(Return(&m_portDataVector[1]))
+        .WillOnce(Return(&m_portDataVector[0]));
 
     iox_service_discovery_t serviceDiscovery = iox_service_discovery_init(&serviceDiscoveryStorage);
     uint64_t someContextData = 0U;
@@ -16,9 +16,13 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "base.hpp"
 
+#if defined(__linux__)
+#include <sched.h>
+#endif
 
 void IcePerfBase::preLatencyPerfTestLeader(const uint32_t payloadSizeInBytes) noexcept
 {
+    m_lastSendTimestamp = std::chrono::steady_clock::now();
     sendPerfTopic(payloadSizeInBytes, RunFlag::RUN);
 }
 
@@ -33,24 +37,25 @@ void IcePerfBase::releaseFollower() noexcept
     sendPerfTopic(sizeof(PerfTopic), RunFlag::STOP);
 }
 
-iox::units::Duration IcePerfBase::latencyPerfTestLeader(const uint64_t numRoundTrips) noexcept
+PercentileHistogram IcePerfBase::latencyPerfTestLeader(const uint64_t numRoundTrips) noexcept
 {
-    auto start = std::chrono::steady_clock::now();
+    PercentileHistogram histogram;
 
     // run the performance test
+    constexpr uint64_t TRANSMISSIONS_PER_ROUNDTRIP{2U};
     for (auto i = 0U; i < numRoundTrips; ++i)
     {
         auto perfTopic = receivePerfTopic();
+        auto receiveTimestamp = std::chrono::steady_clock::now();
+        auto roundTripTime =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(receiveTimestamp - m_lastSendTimestamp);
+        histogram.record(static_cast<uint64_t>(roundTripTime.count()) / TRANSMISSIONS_PER_ROUNDTRIP);
+
+        m_lastSendTimestamp = std::chrono::steady_clock::now();
         sendPerfTopic(perfTopic.payloadSize, RunFlag::RUN);
     }
 
-    auto finish = std::chrono::steady_clock::now();
-
-    constexpr uint64_t TRANSMISSIONS_PER_ROUNDTRIP{2U};
-    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start);
-    auto latencyInNanoSeconds =
-        (static_cast<uint64_t>(duration.count()) / (numRoundTrips * TRANSMISSIONS_PER_ROUNDTRIP));
-    return iox::units::Duration::fromNanoseconds(latencyInNanoSeconds);
+    return histogram;
 }
 
 void IcePerfBase::latencyPerfTestFollower() noexcept
@@ -68,3 +73,27 @@ void IcePerfBase::latencyPerfTestFollower() noexcept
         sendPerfTopic(perfTopic.payloadSize, RunFlag::RUN);
     }
 }
+
+bool pinCurrentThreadToCpu(const uint32_t cpu) noexcept
+{
+#if defined(__linux__)
+    if (cpu >= static_cast<uint32_t>(CPU_SETSIZE))
+    {
+        std::cerr << "Could not pin the thread to CPU " << cpu << " since only CPUs below " << CPU_SETSIZE
+                  << " are supported!" << std::endl;
+        return false;
+    }
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(cpu, &cpuSet);
+    if (sched_setaffinity(0, sizeof(cpuSet), &cpuSet) != 0)
+    {
+        std::cerr << "Could not pin the thread to CPU " << cpu << "!" << std::endl;
+        return false;
+    }
+    return true;
+#else
+    std::cerr << "Pinning to CPU " << cpu << " is not supported on this platform and will be skipped!" << std::endl;
+    return false;
+#endif
+}
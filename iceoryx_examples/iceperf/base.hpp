@@ -18,10 +18,9 @@
 #define IOX_EXAMPLES_ICEPERF_BASE_HPP
 
 #include "example_common.hpp"
+#include "percentile_histogram.hpp"
 #include "topic_data.hpp"
 
-#include "iceoryx_hoofs/internal/units/duration.hpp"
-
 #include <chrono>
 #include <iostream>
 
@@ -39,12 +38,23 @@ class IcePerfBase
     void preLatencyPerfTestLeader(const uint32_t payloadSizeInBytes) noexcept;
     void postLatencyPerfTestLeader() noexcept;
     void releaseFollower() noexcept;
-    iox::units::Duration latencyPerfTestLeader(const uint64_t numRoundTrips) noexcept;
+    /// @brief does the ping pong with the follower and records the one-way latency, i.e. half of the round trip time,
+    /// of every single round trip in nanoseconds
+    PercentileHistogram latencyPerfTestLeader(const uint64_t numRoundTrips) noexcept;
     void latencyPerfTestFollower() noexcept;
 
   private:
     virtual void sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept = 0;
     virtual PerfTopic receivePerfTopic() noexcept = 0;
+
+  private:
+    std::chrono::steady_clock::time_point m_lastSendTimestamp;
 };
 
+/// @brief pins the calling thread to the given CPU
+/// @param[in] cpu the index of the CPU to run on
+/// @return true if the affinity could be set, false if the cpu index exceeds CPU_SETSIZE, the affinity could not be set
+///         or the platform does not support it
+bool pinCurrentThreadToCpu(const uint32_t cpu) noexcept;
+
 #endif // IOX_EXAMPLES_ICEPERF_BASE_HPP
@@ -33,6 +33,14 @@ enum class Technology
     UNIX_DOMAIN_SOCKET
 };
 
+enum class WaitStrategy
+{
+    POLLING,
+    WAITSET_ALWAYS_BLOCK,
+    WAITSET_SPIN_THEN_BLOCK,
+    WAITSET_BUSY_POLL
+};
+
 enum class RunFlag
 {
     STOP,
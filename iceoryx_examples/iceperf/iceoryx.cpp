@@ -18,12 +18,41 @@
 #include "iceoryx.hpp"
 
 #include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
 #include <thread>
 
-Iceoryx::Iceoryx(const iox::capro::IdString_t& publisherName, const iox::capro::IdString_t& subscriberName) noexcept
+Iceoryx::Iceoryx(const iox::capro::IdString_t& publisherName,
+                 const iox::capro::IdString_t& subscriberName,
+                 const WaitStrategy waitStrategy) noexcept
     : m_publisher({"IcePerf", publisherName, "C++-API"}, iox::popo::PublisherOptions{1U})
     , m_subscriber({"IcePerf", subscriberName, "C++-API"}, iox::popo::SubscriberOptions{1U, 1U})
 {
+    if (waitStrategy == WaitStrategy::POLLING)
+    {
+        return;
+    }
+
+    iox::popo::WaitStrategy waitSetStrategy;
+    switch (waitStrategy)
+    {
+    case WaitStrategy::WAITSET_SPIN_THEN_BLOCK:
+        waitSetStrategy.mode = iox::popo::WaitMode::SPIN_THEN_BLOCK;
+        break;
+    case WaitStrategy::WAITSET_BUSY_POLL:
+        waitSetStrategy.mode = iox::popo::WaitMode::BUSY_POLL;
+        break;
+    default:
+        waitSetStrategy.mode = iox::popo::WaitMode::ALWAYS_BLOCK;
+        break;
+    }
+
+    m_waitSet.emplace(waitSetStrategy);
+    m_waitSet->attachState(m_subscriber, iox::popo::SubscriberState::HAS_DATA).or_else([](auto) {
+        std::cerr << "Could not attach the subscriber to the WaitSet!" << std::endl;
+        std::exit(EXIT_FAILURE);
+    });
 }
 
 void Iceoryx::initLeader() noexcept
@@ -86,6 +115,10 @@ PerfTopic Iceoryx::receivePerfTopic() noexcept
 
     do
     {
+        if (m_waitSet)
+        {
+            m_waitSet->wait();
+        }
         m_subscriber.take().and_then([&](const void* data) {
             receivedSample = *(static_cast<const PerfTopic*>(data));
             hasReceivedSample = true;
@@ -95,3 +128,77 @@ PerfTopic Iceoryx::receivePerfTopic() noexcept
 
     return receivedSample;
 }
+
+namespace
+{
+iox::capro::ServiceDescription throughputService(const uint32_t publisherIndex) noexcept
+{
+    return {"IcePerf",
+            "Throughput",
+            iox::capro::IdString_t(iox::cxx::TruncateToCapacity, "C++-API-" + std::to_string(publisherIndex))};
+}
+
+class IceoryxThroughputPublisher : public ThroughputPublisher
+{
+  public:
+    explicit IceoryxThroughputPublisher(const uint32_t publisherIndex) noexcept
+        : m_publisher(throughputService(publisherIndex))
+    {
+    }
+
+    void* loan(const uint32_t payloadSizeInBytes) noexcept override
+    {
+        auto loanResult = m_publisher.loan(payloadSizeInBytes);
+        return loanResult.has_error() ? nullptr : loanResult.value();
+    }
+
+    void publish(void* const payload) noexcept override
+    {
+        m_publisher.publish(payload);
+    }
+
+  private:
+    iox::popo::UntypedPublisher m_publisher;
+};
+
+class IceoryxThroughputSubscriber : public ThroughputSubscriber
+{
+  public:
+    explicit IceoryxThroughputSubscriber(const uint32_t publisherIndex) noexcept
+        : m_subscriber(throughputService(publisherIndex),
+                       iox::popo::SubscriberOptions{IcePerfThroughput::SUBSCRIBER_QUEUE_CAPACITY, 0U})
+    {
+    }
+
+    bool isSubscribed() const noexcept override
+    {
+        return m_subscriber.getSubscriptionState() == iox::SubscribeState::SUBSCRIBED;
+    }
+
+    const void* take() noexcept override
+    {
+        auto takeResult = m_subscriber.take();
+        return takeResult.has_error() ? nullptr : takeResult.value();
+    }
+
+    void release(const void* const payload) noexcept override
+    {
+        m_subscriber.release(payload);
+    }
+
+  private:
+    iox::popo::UntypedSubscriber m_subscriber;
+};
+} // namespace
+
+std::unique_ptr<ThroughputPublisher>
+IceoryxThroughput::createThroughputPublisher(const uint32_t publisherIndex) noexcept
+{
+    return std::make_unique<IceoryxThroughputPublisher>(publisherIndex);
+}
+
+std::unique_ptr<ThroughputSubscriber>
+IceoryxThroughput::createThroughputSubscriber(const uint32_t publisherIndex) noexcept
+{
+    return std::make_unique<IceoryxThroughputSubscriber>(publisherIndex);
+}
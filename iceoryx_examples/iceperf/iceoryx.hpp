@@ -18,14 +18,21 @@
 #define IOX_EXAMPLES_ICEPERF_ICEORYX_HPP
 
 #include "base.hpp"
+#include "example_common.hpp"
+#include "throughput.hpp"
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/popo/untyped_publisher.hpp"
 #include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
 
 class Iceoryx : public IcePerfBase
 {
   public:
-    Iceoryx(const iox::capro::IdString_t& publisherName, const iox::capro::IdString_t& subscriberName) noexcept;
+    Iceoryx(const iox::capro::IdString_t& publisherName,
+            const iox::capro::IdString_t& subscriberName,
+            const WaitStrategy waitStrategy = WaitStrategy::POLLING) noexcept;
     void initLeader() noexcept override;
     void initFollower() noexcept override;
     void shutdown() noexcept override;
@@ -37,6 +44,14 @@ class Iceoryx : public IcePerfBase
 
     iox::popo::UntypedPublisher m_publisher;
     iox::popo::UntypedSubscriber m_subscriber;
+    iox::cxx::optional<iox::popo::WaitSet<1U>> m_waitSet;
+};
+
+class IceoryxThroughput : public IcePerfThroughput
+{
+  private:
+    std::unique_ptr<ThroughputPublisher> createThroughputPublisher(const uint32_t publisherIndex) noexcept override;
+    std::unique_ptr<ThroughputSubscriber> createThroughputSubscriber(const uint32_t publisherIndex) noexcept override;
 };
 
 #endif // IOX_EXAMPLES_ICEPERF_ICEORYX_HPP
@@ -17,6 +17,7 @@
 #include "iceoryx_c.hpp"
 
 #include <chrono>
+#include <string>
 #include <thread>
 
 IceoryxC::IceoryxC(const iox::capro::IdString_t& publisherName, const iox::capro::IdString_t& subscriberName) noexcept
@@ -114,3 +115,121 @@ PerfTopic IceoryxC::receivePerfTopic() noexcept
 
     return receivedSample;
 }
+
+namespace
+{
+constexpr const char THROUGHPUT_SERVICE[]{"IcePerf"};
+constexpr const char THROUGHPUT_INSTANCE[]{"Throughput"};
+
+std::string throughputEvent(const uint32_t publisherIndex) noexcept
+{
+    return "C-API-" + std::to_string(publisherIndex);
+}
+
+class IceoryxCThroughputPublisher : public ThroughputPublisher
+{
+  public:
+    explicit IceoryxCThroughputPublisher(const uint32_t publisherIndex) noexcept
+    {
+        iox_pub_options_t publisherOptions;
+        iox_pub_options_init(&publisherOptions);
+        m_publisher = iox_pub_init(&m_publisherStorage,
+                                   THROUGHPUT_SERVICE,
+                                   THROUGHPUT_INSTANCE,
+                                   throughputEvent(publisherIndex).c_str(),
+                                   &publisherOptions);
+    }
+
+    IceoryxCThroughputPublisher(const IceoryxCThroughputPublisher&) = delete;
+    IceoryxCThroughputPublisher(IceoryxCThroughputPublisher&&) = delete;
+    IceoryxCThroughputPublisher& operator=(const IceoryxCThroughputPublisher&) = delete;
+    IceoryxCThroughputPublisher& operator=(IceoryxCThroughputPublisher&&) = delete;
+
+    ~IceoryxCThroughputPublisher() override
+    {
+        iox_pub_deinit(m_publisher);
+    }
+
+    void* loan(const uint32_t payloadSizeInBytes) noexcept override
+    {
+        void* payload{nullptr};
+        if (iox_pub_loan_chunk(m_publisher, &payload, payloadSizeInBytes) != AllocationResult_SUCCESS)
+        {
+            return nullptr;
+        }
+        return payload;
+    }
+
+    void publish(void* const payload) noexcept override
+    {
+        iox_pub_publish_chunk(m_publisher, payload);
+    }
+
+  private:
+    iox_pub_storage_t m_publisherStorage;
+    iox_pub_t m_publisher;
+};
+
+class IceoryxCThroughputSubscriber : public ThroughputSubscriber
+{
+  public:
+    explicit IceoryxCThroughputSubscriber(const uint32_t publisherIndex) noexcept
+    {
+        iox_sub_options_t subscriberOptions;
+        iox_sub_options_init(&subscriberOptions);
+        subscriberOptions.queueCapacity = IcePerfThroughput::SUBSCRIBER_QUEUE_CAPACITY;
+        subscriberOptions.historyRequest = 0U;
+        m_subscriber = iox_sub_init(&m_subscriberStorage,
+                                    THROUGHPUT_SERVICE,
+                                    THROUGHPUT_INSTANCE,
+                                    throughputEvent(publisherIndex).c_str(),
+                                    &subscriberOptions);
+    }
+
+    IceoryxCThroughputSubscriber(const IceoryxCThroughputSubscriber&) = delete;
+    IceoryxCThroughputSubscriber(IceoryxCThroughputSubscriber&&) = delete;
+    IceoryxCThroughputSubscriber& operator=(const IceoryxCThroughputSubscriber&) = delete;
+    IceoryxCThroughputSubscriber& operator=(IceoryxCThroughputSubscriber&&) = delete;
+
+    ~IceoryxCThroughputSubscriber() override
+    {
+        iox_sub_deinit(m_subscriber);
+    }
+
+    bool isSubscribed() const noexcept override
+    {
+        return iox_sub_get_subscription_state(m_subscriber) == SubscribeState_SUBSCRIBED;
+    }
+
+    const void* take() noexcept override
+    {
+        const void* payload{nullptr};
+        if (iox_sub_take_chunk(m_subscriber, &payload) != ChunkReceiveResult_SUCCESS)
+        {
+            return nullptr;
+        }
+        return payload;
+    }
+
+    void release(const void* const payload) noexcept override
+    {
+        iox_sub_release_chunk(m_subscriber, payload);
+    }
+
+  private:
+    iox_sub_storage_t m_subscriberStorage;
+    iox_sub_t m_subscriber;
+};
+} // namespace
+
+std::unique_ptr<ThroughputPublisher>
+IceoryxCThroughput::createThroughputPublisher(const uint32_t publisherIndex) noexcept
+{
+    return std::make_unique<IceoryxCThroughputPublisher>(publisherIndex);
+}
+
+std::unique_ptr<ThroughputSubscriber>
+IceoryxCThroughput::createThroughputSubscriber(const uint32_t publisherIndex) noexcept
+{
+    return std::make_unique<IceoryxCThroughputSubscriber>(publisherIndex);
+}
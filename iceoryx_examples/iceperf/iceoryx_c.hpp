@@ -17,6 +17,8 @@
 #define IOX_EXAMPLES_ICEPERF_ICEORYX_C_HPP
 
 #include "base.hpp"
+#include "throughput.hpp"
+
 #include "iceoryx_posh/capro/service_description.hpp"
 
 extern "C" {
@@ -44,4 +46,11 @@ class IceoryxC : public IcePerfBase
     iox_sub_t m_subscriber;
 };
 
+class IceoryxCThroughput : public IcePerfThroughput
+{
+  private:
+    std::unique_ptr<ThroughputPublisher> createThroughputPublisher(const uint32_t publisherIndex) noexcept override;
+    std::unique_ptr<ThroughputSubscriber> createThroughputSubscriber(const uint32_t publisherIndex) noexcept override;
+};
+
 #endif // IOX_EXAMPLES_ICEPERF_ICEORYX_HPP
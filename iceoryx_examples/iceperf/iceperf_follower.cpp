@@ -84,6 +84,17 @@ int IcePerfFollower::run() noexcept
     m_settings = getSettings(settingsSubscriber);
     //! [get settings from leader]
 
+    if (m_settings.benchmark == Benchmark::THROUGHPUT)
+    {
+        std::cout << "The throughput benchmark runs only in the leader application!" << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    if (m_settings.followerCpu != NO_CPU_PINNING)
+    {
+        pinCurrentThreadToCpu(static_cast<uint32_t>(m_settings.followerCpu));
+    }
+
     //! [create an run technologies]
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::POSIX_MESSAGE_QUEUE)
     {
@@ -109,7 +120,7 @@ int IcePerfFollower::run() noexcept
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_CPP_API)
     {
         std::cout << std::endl << "******      ICEORYX       ********" << std::endl;
-        Iceoryx iceoryx(PUBLISHER, SUBSCRIBER);
+        Iceoryx iceoryx(PUBLISHER, SUBSCRIBER, m_settings.waitStrategy);
         doMeasurement(iceoryx);
     }
 
@@ -26,9 +26,9 @@
 #include "topic_data.hpp"
 #include "uds.hpp"
 
+#include <fstream>
 #include <iomanip>
 #include <iostream>
-#include <vector>
 
 //! [use constants instead of magic values]
 constexpr const char APP_NAME[]{"iceperf-bench-leader"};
@@ -36,8 +36,9 @@ constexpr const char PUBLISHER[]{"Leader"};
 constexpr const char SUBSCRIBER[]{"Follower"};
 //! [use constants instead of magic values]
 
-IcePerfLeader::IcePerfLeader(const PerfSettings settings) noexcept
+IcePerfLeader::IcePerfLeader(const PerfSettings settings, const LeaderSettings leaderSettings) noexcept
     : m_settings(settings)
+    , m_leaderSettings(leaderSettings)
 {
     //! [cleanup outdated resources]
 #ifndef __APPLE__
@@ -48,11 +49,11 @@ IcePerfLeader::IcePerfLeader(const PerfSettings settings) noexcept
 }
 
 //! [do the measurement for a single technology]
-void IcePerfLeader::doMeasurement(IcePerfBase& ipcTechnology) noexcept
+void IcePerfLeader::doMeasurement(IcePerfBase& ipcTechnology, const char* technologyName) noexcept
 {
     ipcTechnology.initLeader();
 
-    std::vector<std::tuple<uint32_t, iox::units::Duration>> latencyMeasurements;
+    std::vector<LatencyResult> latencyResults;
     const std::vector<uint32_t> payloadSizesInKB{1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096};
     std::cout << "Measurement for:";
     const char* separator = " ";
@@ -64,9 +65,9 @@ void IcePerfLeader::doMeasurement(IcePerfBase& ipcTechnology) noexcept
 
         ipcTechnology.preLatencyPerfTestLeader(payloadSizeInBytes);
 
-        auto latency = ipcTechnology.latencyPerfTestLeader(m_settings.numberOfSamples);
+        auto histogram = ipcTechnology.latencyPerfTestLeader(m_settings.numberOfSamples);
 
-        latencyMeasurements.push_back(std::make_tuple(payloadSizeInKB, latency));
+        latencyResults.push_back({technologyName, payloadSizeInKB, std::move(histogram)});
 
         ipcTechnology.postLatencyPerfTestLeader();
     }
@@ -76,28 +77,216 @@ void IcePerfLeader::doMeasurement(IcePerfBase& ipcTechnology) noexcept
 
     ipcTechnology.shutdown();
 
+    constexpr double NANOSECONDS_PER_MICROSECOND{1000.0};
+    auto toMicroseconds = [](const uint64_t nanoseconds) {
+        return static_cast<double>(nanoseconds) / NANOSECONDS_PER_MICROSECOND;
+    };
+
     std::cout << std::endl;
     std::cout << "#### Measurement Result ####" << std::endl;
     std::cout << m_settings.numberOfSamples << " round trips for each payload." << std::endl;
     std::cout << std::endl;
-    std::cout << "| Payload Size [kB] | Average Latency [µs] |" << std::endl;
-    std::cout << "|------------------:|---------------------:|" << std::endl;
-    for (const auto& latencyMeasuement : latencyMeasurements)
+    std::cout << "| Payload Size [kB] | Average [µs] |   p50 [µs] |   p90 [µs] |   p99 [µs] | p99.9 [µs] "
+                 "|   Max [µs] |"
+              << std::endl;
+    std::cout << "|------------------:|-------------:|-----------:|-----------:|-----------:|-----------:"
+                 "|-----------:|"
+              << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    for (const auto& result : latencyResults)
     {
-        auto payloadSizeInKB = std::get<0>(latencyMeasuement);
-        auto latencyInMicroseconds = static_cast<double>(std::get<1>(latencyMeasuement).toNanoseconds()) / 1000.0;
-        std::cout << "| " << std::setw(17) << payloadSizeInKB << " | " << std::setw(20) << std::setprecision(2)
-                  << latencyInMicroseconds << " |" << std::endl;
+        const auto& histogram = result.histogram;
+        std::cout << "| " << std::setw(17) << result.payloadSizeInKB << " | " << std::setw(12)
+                  << histogram.mean() / NANOSECONDS_PER_MICROSECOND << " | " << std::setw(10)
+                  << toMicroseconds(histogram.valueAtPercentile(50.0)) << " | " << std::setw(10)
+                  << toMicroseconds(histogram.valueAtPercentile(90.0)) << " | " << std::setw(10)
+                  << toMicroseconds(histogram.valueAtPercentile(99.0)) << " | " << std::setw(10)
+                  << toMicroseconds(histogram.valueAtPercentile(99.9)) << " | " << std::setw(10)
+                  << toMicroseconds(histogram.max()) << " |" << std::endl;
     }
+    std::cout << std::defaultfloat;
+
+    m_latencyResults.insert(m_latencyResults.end(),
+                            std::make_move_iterator(latencyResults.begin()),
+                            std::make_move_iterator(latencyResults.end()));
 
     std::cout << std::endl;
     std::cout << "Finished!" << std::endl;
 }
 //! [do the measurement for a single technology]
 
+//! [do the throughput measurement for a single technology]
+void IcePerfLeader::doThroughputMeasurement(IcePerfThroughput& ipcTechnology, const char* technologyName) noexcept
+{
+    // leave some room for the subscribers of RouDi and the follower application
+    constexpr uint32_t NUMBER_OF_RESERVED_SUBSCRIBERS{16U};
+    const uint32_t numberOfPublishers = m_leaderSettings.numberOfPublishers;
+
+    std::vector<ThroughputResult> throughputResults;
+    const std::vector<uint32_t> numberOfSubscribersPerPublisher{1, 8, 64, 256};
+    const std::vector<uint32_t> payloadSizesInBytes{128, 1024, 16384, 131072};
+    for (const auto numberOfSubscribers : numberOfSubscribersPerPublisher)
+    {
+        std::cout << "Throughput measurement for " << numberOfSubscribers << " subscriber(s):";
+        if (numberOfSubscribers > iox::MAX_SUBSCRIBERS_PER_PUBLISHER
+            || numberOfPublishers * numberOfSubscribers + NUMBER_OF_RESERVED_SUBSCRIBERS > iox::MAX_SUBSCRIBERS)
+        {
+            std::cout << " [ skipped, too many subscribers ]" << std::endl;
+            continue;
+        }
+
+        const char* separator = " ";
+        for (const auto payloadSizeInBytes : payloadSizesInBytes)
+        {
+            std::cout << separator << payloadSizeInBytes << " B" << std::flush;
+            separator = ", ";
+
+            throughputResults.push_back(ipcTechnology.throughputPerfTest(
+                numberOfPublishers, numberOfSubscribers, payloadSizeInBytes, m_settings.numberOfSamples));
+        }
+        std::cout << std::endl;
+    }
+
+    constexpr double BYTES_PER_MEGABYTE{1024.0 * 1024.0};
+    std::cout << std::endl;
+    std::cout << "#### Throughput Result ####" << std::endl;
+    std::cout << numberOfPublishers << " publisher(s) with " << m_settings.numberOfSamples << " samples each."
+              << std::endl;
+    std::cout << std::endl;
+    std::cout << "| Subscribers | Payload Size [B] | Sent [msg/s] | Sent [MB/s] | Received [msg/s] | Loan [ns] "
+                 "| Publish [ns] | Take [ns] | Lost Samples | Failed Loans |"
+              << std::endl;
+    std::cout << "|------------:|-----------------:|-------------:|------------:|-----------------:|----------:"
+                 "|-------------:|----------:|-------------:|-------------:|"
+              << std::endl;
+    std::cout << std::fixed << std::setprecision(0);
+    for (const auto& result : throughputResults)
+    {
+        std::cout << "| " << std::setw(11) << result.numberOfSubscribersPerPublisher << " | " << std::setw(16)
+                  << result.payloadSizeInBytes << " | " << std::setw(12) << result.sentSamplesPerSecond << " | "
+                  << std::setw(11) << result.sentBytesPerSecond / BYTES_PER_MEGABYTE << " | " << std::setw(16)
+                  << result.receivedSamplesPerSecond << " | " << std::setw(9) << result.meanLoanDurationInNanoseconds
+                  << " | " << std::setw(12) << result.meanPublishDurationInNanoseconds << " | " << std::setw(9)
+                  << result.meanTakeDurationInNanoseconds << " | " << std::setw(12) << result.lostSamples << " | "
+                  << std::setw(12) << result.failedLoans << " |" << std::endl;
+        m_throughputResults.push_back({technologyName, result});
+    }
+    std::cout << std::defaultfloat;
+
+    std::cout << std::endl;
+    std::cout << "Finished!" << std::endl;
+}
+//! [do the throughput measurement for a single technology]
+
+//! [write the results to a file]
+bool IcePerfLeader::writeResults() const noexcept
+{
+    std::ofstream outputFile(m_leaderSettings.outputFile);
+    if (!outputFile.is_open())
+    {
+        std::cerr << "Could not open '" << m_leaderSettings.outputFile << "' to write the results!" << std::endl;
+        return false;
+    }
+
+    // latencies and the loan/publish/take durations are in nanoseconds to not lose precision
+    outputFile << std::fixed << std::setprecision(1);
+    if (m_leaderSettings.outputFormat == OutputFormat::CSV)
+    {
+        // one table per benchmark, separated by an empty line
+        const char* tableSeparator = "";
+        if (!m_latencyResults.empty())
+        {
+            outputFile << "technology,payload_size_kb,round_trips,mean_ns,min_ns,p50_ns,p90_ns,p99_ns,p99_9_ns,"
+                          "max_ns\n";
+            for (const auto& result : m_latencyResults)
+            {
+                const auto& histogram = result.histogram;
+                outputFile << result.technology << "," << result.payloadSizeInKB << "," << histogram.count() << ","
+                           << histogram.mean() << "," << histogram.min() << "," << histogram.valueAtPercentile(50.0)
+                           << "," << histogram.valueAtPercentile(90.0) << "," << histogram.valueAtPercentile(99.0)
+                           << "," << histogram.valueAtPercentile(99.9) << "," << histogram.max() << "\n";
+            }
+            tableSeparator = "\n";
+        }
+        if (!m_throughputResults.empty())
+        {
+            outputFile << tableSeparator
+                       << "technology,publishers,subscribers_per_publisher,payload_size_bytes,sent_samples,"
+                          "received_samples,lost_samples,failed_loans,sent_samples_per_s,sent_bytes_per_s,"
+                          "received_samples_per_s,loan_ns,publish_ns,take_ns\n";
+            for (const auto& technologyResult : m_throughputResults)
+            {
+                const auto& result = technologyResult.result;
+                outputFile << technologyResult.technology << "," << result.numberOfPublishers << ","
+                           << result.numberOfSubscribersPerPublisher << "," << result.payloadSizeInBytes << ","
+                           << result.sentSamples << "," << result.receivedSamples << "," << result.lostSamples << ","
+                           << result.failedLoans << "," << result.sentSamplesPerSecond << ","
+                           << result.sentBytesPerSecond << "," << result.receivedSamplesPerSecond << ","
+                           << result.meanLoanDurationInNanoseconds << "," << result.meanPublishDurationInNanoseconds
+                           << "," << result.meanTakeDurationInNanoseconds << "\n";
+            }
+        }
+    }
+    else
+    {
+        outputFile << "{\n  \"latency\": [";
+        const char* separator = "\n";
+        for (const auto& result : m_latencyResults)
+        {
+            const auto& histogram = result.histogram;
+            outputFile << separator << "    {\"technology\": \"" << result.technology
+                       << "\", \"payload_size_kb\": " << result.payloadSizeInKB
+                       << ", \"round_trips\": " << histogram.count() << ", \"mean_ns\": " << histogram.mean()
+                       << ", \"min_ns\": " << histogram.min() << ", \"p50_ns\": " << histogram.valueAtPercentile(50.0)
+                       << ", \"p90_ns\": " << histogram.valueAtPercentile(90.0)
+                       << ", \"p99_ns\": " << histogram.valueAtPercentile(99.0)
+                       << ", \"p99_9_ns\": " << histogram.valueAtPercentile(99.9)
+                       << ", \"max_ns\": " << histogram.max() << "}";
+            separator = ",\n";
+        }
+        outputFile << "\n  ],\n  \"throughput\": [";
+        separator = "\n";
+        for (const auto& technologyResult : m_throughputResults)
+        {
+            const auto& result = technologyResult.result;
+            outputFile << separator << "    {\"technology\": \"" << technologyResult.technology
+                       << "\", \"publishers\": " << result.numberOfPublishers
+                       << ", \"subscribers_per_publisher\": " << result.numberOfSubscribersPerPublisher
+                       << ", \"payload_size_bytes\": " << result.payloadSizeInBytes
+                       << ", \"sent_samples\": " << result.sentSamples
+                       << ", \"received_samples\": " << result.receivedSamples
+                       << ", \"lost_samples\": " << result.lostSamples << ", \"failed_loans\": " << result.failedLoans
+                       << ", \"sent_samples_per_s\": " << result.sentSamplesPerSecond
+                       << ", \"sent_bytes_per_s\": " << result.sentBytesPerSecond
+                       << ", \"received_samples_per_s\": " << result.receivedSamplesPerSecond
+                       << ", \"loan_ns\": " << result.meanLoanDurationInNanoseconds
+                       << ", \"publish_ns\": " << result.meanPublishDurationInNanoseconds
+                       << ", \"take_ns\": " << result.meanTakeDurationInNanoseconds << "}";
+            separator = ",\n";
+        }
+        outputFile << "\n  ]\n}\n";
+    }
+
+    outputFile.close();
+    if (outputFile.fail())
+    {
+        std::cerr << "Could not write the results to '" << m_leaderSettings.outputFile << "'!" << std::endl;
+        return false;
+    }
+
+    std::cout << "Results written to '" << m_leaderSettings.outputFile << "'" << std::endl;
+    return true;
+}
+//! [write the results to a file]
+
 //! [run all technologies]
 int IcePerfLeader::run() noexcept
 {
+    if (m_leaderSettings.leaderCpu != NO_CPU_PINNING)
+    {
+        pinCurrentThreadToCpu(static_cast<uint32_t>(m_leaderSettings.leaderCpu));
+    }
+
     iox::runtime::PoshRuntime::initRuntime(APP_NAME);
 
     //! [send setting to follower application]
@@ -113,12 +302,16 @@ int IcePerfLeader::run() noexcept
     //! [send setting to follower application]
 
     //! [create an run technologies]
-    if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::POSIX_MESSAGE_QUEUE)
+    const bool isLatencyBenchmarkEnabled = m_settings.benchmark != Benchmark::THROUGHPUT;
+    const bool isThroughputBenchmarkEnabled = m_settings.benchmark != Benchmark::LATENCY;
+
+    if (isLatencyBenchmarkEnabled
+        && (m_settings.technology == Technology::ALL || m_settings.technology == Technology::POSIX_MESSAGE_QUEUE))
     {
 #ifndef __APPLE__
         std::cout << std::endl << "******   MESSAGE QUEUE    ********" << std::endl;
         MQ mq(PUBLISHER, SUBSCRIBER);
-        doMeasurement(mq);
+        doMeasurement(mq, "posix-message-queue");
 #else
         if (m_settings.technology == Technology::POSIX_MESSAGE_QUEUE)
         {
@@ -127,28 +320,57 @@ int IcePerfLeader::run() noexcept
 #endif
     }
 
-    if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::UNIX_DOMAIN_SOCKET)
+    if (isLatencyBenchmarkEnabled
+        && (m_settings.technology == Technology::ALL || m_settings.technology == Technology::UNIX_DOMAIN_SOCKET))
     {
         std::cout << std::endl << "****** UNIX DOMAIN SOCKET ********" << std::endl;
         UDS uds(PUBLISHER, SUBSCRIBER);
-        doMeasurement(uds);
+        doMeasurement(uds, "unix-domain-sockets");
     }
 
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_CPP_API)
     {
         std::cout << std::endl << "******      ICEORYX       ********" << std::endl;
-        Iceoryx iceoryx(PUBLISHER, SUBSCRIBER);
-        doMeasurement(iceoryx);
+        if (isLatencyBenchmarkEnabled)
+        {
+            Iceoryx iceoryx(PUBLISHER, SUBSCRIBER, m_settings.waitStrategy);
+            doMeasurement(iceoryx, "iceoryx-cpp-api");
+        }
+        if (isThroughputBenchmarkEnabled)
+        {
+            IceoryxThroughput iceoryxThroughput;
+            doThroughputMeasurement(iceoryxThroughput, "iceoryx-cpp-api");
+        }
     }
 
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_C_API)
     {
         std::cout << std::endl << "******   ICEORYX C API    ********" << std::endl;
-        IceoryxC iceoryxc(PUBLISHER, SUBSCRIBER);
-        doMeasurement(iceoryxc);
+        if (isLatencyBenchmarkEnabled)
+        {
+            IceoryxC iceoryxc(PUBLISHER, SUBSCRIBER);
+            doMeasurement(iceoryxc, "iceoryx-c-api");
+        }
+        if (isThroughputBenchmarkEnabled)
+        {
+            IceoryxCThroughput iceoryxcThroughput;
+            doThroughputMeasurement(iceoryxcThroughput, "iceoryx-c-api");
+        }
+    }
+
+    if (!isLatencyBenchmarkEnabled
+        && (m_settings.technology == Technology::POSIX_MESSAGE_QUEUE
+            || m_settings.technology == Technology::UNIX_DOMAIN_SOCKET))
+    {
+        std::cout << "The throughput benchmark is only available for the iceoryx APIs!" << std::endl;
     }
     //! [create an run technologies]
 
+    if (!m_leaderSettings.outputFile.empty() && !writeResults())
+    {
+        return EXIT_FAILURE;
+    }
+
     return EXIT_SUCCESS;
 }
 //! [run all technologies]
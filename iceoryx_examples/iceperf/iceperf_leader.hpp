@@ -19,21 +19,58 @@
 
 #include "base.hpp"
 #include "example_common.hpp"
+#include "throughput.hpp"
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 
+#include <string>
+#include <vector>
+
+enum class OutputFormat
+{
+    CSV,
+    JSON
+};
+
+/// @brief settings which only affect the leader and are therefore not sent to the follower
+struct LeaderSettings
+{
+    int32_t leaderCpu{NO_CPU_PINNING};
+    uint32_t numberOfPublishers{1U};
+    std::string outputFile;
+    OutputFormat outputFormat{OutputFormat::CSV};
+};
+
 class IcePerfLeader
 {
   public:
-    IcePerfLeader(const PerfSettings settings) noexcept;
+    IcePerfLeader(const PerfSettings settings, const LeaderSettings leaderSettings) noexcept;
 
     int run() noexcept;
 
   private:
-    void doMeasurement(IcePerfBase& ipcTechnology) noexcept;
+    struct LatencyResult
+    {
+        const char* technology;
+        uint32_t payloadSizeInKB;
+        PercentileHistogram histogram;
+    };
+
+    struct TechnologyThroughputResult
+    {
+        const char* technology;
+        ThroughputResult result;
+    };
+
+    void doMeasurement(IcePerfBase& ipcTechnology, const char* technologyName) noexcept;
+    void doThroughputMeasurement(IcePerfThroughput& ipcTechnology, const char* technologyName) noexcept;
+    bool writeResults() const noexcept;
 
   private:
     const PerfSettings m_settings;
+    const LeaderSettings m_leaderSettings;
+    std::vector<LatencyResult> m_latencyResults;
+    std::vector<TechnologyThroughputResult> m_throughputResults;
 };
 
 #endif // IOX_EXAMPLES_ICEPERF_LEADER_HPP
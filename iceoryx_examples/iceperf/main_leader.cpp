@@ -28,15 +28,22 @@
 int main(int argc, char* argv[])
 {
     PerfSettings settings;
+    LeaderSettings leaderSettings;
 
     constexpr option longOptions[] = {{"help", no_argument, nullptr, 'h'},
                                       {"benchmark", required_argument, nullptr, 'b'},
                                       {"technology", required_argument, nullptr, 't'},
-                                      {"number-of-samples", required_argument, nullptr, 't'},
+                                      {"number-of-samples", required_argument, nullptr, 'n'},
+                                      {"wait-strategy", required_argument, nullptr, 'w'},
+                                      {"number-of-publishers", required_argument, nullptr, 'p'},
+                                      {"output-file", required_argument, nullptr, 'o'},
+                                      {"output-format", required_argument, nullptr, 'f'},
+                                      {"leader-cpu", required_argument, nullptr, 'l'},
+                                      {"follower-cpu", required_argument, nullptr, 'F'},
                                       {nullptr, 0, nullptr, 0}};
 
     // colon after shortOption means it requires an argument, two colons mean optional argument
-    constexpr const char* shortOptions = "hb:t:n:";
+    constexpr const char* shortOptions = "hb:t:n:w:p:o:f:l:F:";
     int32_t index{0};
     int32_t opt{-1};
     while ((opt = getopt_long(argc, argv, shortOptions, longOptions, &index), opt != -1))
@@ -60,6 +67,26 @@ int main(int argc, char* argv[])
             std::cout << "-n, --number-of-samples <N>       Set the number of samples sent in a benchmark round"
                       << std::endl;
             std::cout << "                                  default = '10000'" << std::endl;
+            std::cout << "-w, --wait-strategy <TYPE>        Selects how the iceoryx C++ API waits for samples"
+                      << std::endl;
+            std::cout << "                                  <TYPE> {polling," << std::endl;
+            std::cout << "                                          always-block," << std::endl;
+            std::cout << "                                          spin-then-block," << std::endl;
+            std::cout << "                                          busy-poll}" << std::endl;
+            std::cout << "                                  default = 'polling'" << std::endl;
+            std::cout << "-p, --number-of-publishers <N>    Set the number of concurrent publishers in the throughput"
+                      << std::endl;
+            std::cout << "                                  benchmark" << std::endl;
+            std::cout << "                                  default = '1'" << std::endl;
+            std::cout << "-o, --output-file <PATH>          Writes the latency distribution of all measurements to"
+                      << std::endl;
+            std::cout << "                                  the given file in addition to the console output"
+                      << std::endl;
+            std::cout << "-f, --output-format <FORMAT>      Selects the format of the output file" << std::endl;
+            std::cout << "                                  <FORMAT> {csv, json}" << std::endl;
+            std::cout << "                                  default = 'csv'" << std::endl;
+            std::cout << "-l, --leader-cpu <CPU>            Pins the leader to the given CPU" << std::endl;
+            std::cout << "-F, --follower-cpu <CPU>          Pins the follower to the given CPU" << std::endl;
 
             return EXIT_SUCCESS;
         case 'b':
@@ -77,7 +104,7 @@ int main(int argc, char* argv[])
             }
             else
             {
-                std::cerr << "Options for 'benchmark' are 'all', 'latency' and 'off'!" << std::endl;
+                std::cerr << "Options for 'benchmark' are 'all', 'latency' and 'throughput'!" << std::endl;
                 return EXIT_FAILURE;
             }
             break;
@@ -117,11 +144,84 @@ int main(int argc, char* argv[])
                 return EXIT_FAILURE;
             }
             break;
+        case 'w':
+            if (strcmp(optarg, "polling") == 0)
+            {
+                settings.waitStrategy = WaitStrategy::POLLING;
+            }
+            else if (strcmp(optarg, "always-block") == 0)
+            {
+                settings.waitStrategy = WaitStrategy::WAITSET_ALWAYS_BLOCK;
+            }
+            else if (strcmp(optarg, "spin-then-block") == 0)
+            {
+                settings.waitStrategy = WaitStrategy::WAITSET_SPIN_THEN_BLOCK;
+            }
+            else if (strcmp(optarg, "busy-poll") == 0)
+            {
+                settings.waitStrategy = WaitStrategy::WAITSET_BUSY_POLL;
+            }
+            else
+            {
+                std::cerr << "Options for 'wait-strategy' are 'polling', 'always-block', 'spin-then-block' and "
+                             "'busy-poll'!"
+                          << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'p':
+            if (!iox::cxx::convert::fromString(optarg, leaderSettings.numberOfPublishers)
+                || leaderSettings.numberOfPublishers == 0U)
+            {
+                std::cerr << "Could not parse 'number-of-publishers' paramater!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'o':
+            leaderSettings.outputFile = optarg;
+            break;
+        case 'f':
+            if (strcmp(optarg, "csv") == 0)
+            {
+                leaderSettings.outputFormat = OutputFormat::CSV;
+            }
+            else if (strcmp(optarg, "json") == 0)
+            {
+                leaderSettings.outputFormat = OutputFormat::JSON;
+            }
+            else
+            {
+                std::cerr << "Options for 'output-format' are 'csv' and 'json'!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'l':
+        {
+            uint16_t cpu{0U};
+            if (!iox::cxx::convert::fromString(optarg, cpu))
+            {
+                std::cerr << "Could not parse 'leader-cpu' paramater!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            leaderSettings.leaderCpu = static_cast<int32_t>(cpu);
+            break;
+        }
+        case 'F':
+        {
+            uint16_t cpu{0U};
+            if (!iox::cxx::convert::fromString(optarg, cpu))
+            {
+                std::cerr << "Could not parse 'follower-cpu' paramater!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            settings.followerCpu = static_cast<int32_t>(cpu);
+            break;
+        }
         default:
             return EXIT_FAILURE;
         };
     }
 
-    IcePerfLeader app(settings);
+    IcePerfLeader app(settings, leaderSettings);
     return app.run();
 }
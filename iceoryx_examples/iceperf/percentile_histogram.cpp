@@ -0,0 +1,115 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "percentile_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+constexpr uint32_t PercentileHistogram::SUB_BUCKET_BITS;
+constexpr uint64_t PercentileHistogram::SUB_BUCKET_COUNT;
+constexpr uint64_t PercentileHistogram::SUB_BUCKET_HALF_COUNT;
+constexpr uint64_t PercentileHistogram::NUMBER_OF_BUCKETS;
+
+PercentileHistogram::PercentileHistogram() noexcept
+    : m_counts(NUMBER_OF_BUCKETS, 0U)
+{
+}
+
+uint64_t PercentileHistogram::bucketIndexOf(const uint64_t value) noexcept
+{
+    if (value < SUB_BUCKET_COUNT)
+    {
+        return value;
+    }
+
+    // the shift selects the power of two range; the remaining upper bits are the linear sub-bucket in this range
+    uint64_t shift{1U};
+    while ((value >> shift) >= SUB_BUCKET_COUNT)
+    {
+        ++shift;
+    }
+    return SUB_BUCKET_COUNT + (shift - 1U) * SUB_BUCKET_HALF_COUNT + ((value >> shift) - SUB_BUCKET_HALF_COUNT);
+}
+
+uint64_t PercentileHistogram::highestEquivalentValue(const uint64_t bucketIndex) noexcept
+{
+    if (bucketIndex < SUB_BUCKET_COUNT)
+    {
+        return bucketIndex;
+    }
+
+    const uint64_t shift = (bucketIndex - SUB_BUCKET_COUNT) / SUB_BUCKET_HALF_COUNT + 1U;
+    const uint64_t subBucket = (bucketIndex - SUB_BUCKET_COUNT) % SUB_BUCKET_HALF_COUNT + SUB_BUCKET_HALF_COUNT;
+    // for the topmost bucket this wraps around to the maximum value of uint64_t, which is the intended result
+    return ((subBucket + 1U) << shift) - 1U;
+}
+
+void PercentileHistogram::record(const uint64_t value) noexcept
+{
+    ++m_counts[bucketIndexOf(value)];
+    m_min = (m_count == 0U) ? value : std::min(m_min, value);
+    m_max = std::max(m_max, value);
+    m_sum += static_cast<long double>(value);
+    ++m_count;
+}
+
+uint64_t PercentileHistogram::count() const noexcept
+{
+    return m_count;
+}
+
+uint64_t PercentileHistogram::min() const noexcept
+{
+    return m_min;
+}
+
+uint64_t PercentileHistogram::max() const noexcept
+{
+    return m_max;
+}
+
+double PercentileHistogram::mean() const noexcept
+{
+    if (m_count == 0U)
+    {
+        return 0.0;
+    }
+    return static_cast<double>(m_sum / static_cast<long double>(m_count));
+}
+
+uint64_t PercentileHistogram::valueAtPercentile(const double percentile) const noexcept
+{
+    if (m_count == 0U)
+    {
+        return 0U;
+    }
+
+    const double clampedPercentile = std::min(std::max(percentile, 0.0), 100.0);
+    auto requiredCount = static_cast<uint64_t>(std::ceil(clampedPercentile / 100.0 * static_cast<double>(m_count)));
+    requiredCount = std::max(requiredCount, static_cast<uint64_t>(1U));
+
+    uint64_t accumulatedCount{0U};
+    for (uint64_t bucketIndex = 0U; bucketIndex < NUMBER_OF_BUCKETS; ++bucketIndex)
+    {
+        accumulatedCount += m_counts[bucketIndex];
+        if (accumulatedCount >= requiredCount)
+        {
+            return std::min(highestEquivalentValue(bucketIndex), m_max);
+        }
+    }
+    return m_max;
+}
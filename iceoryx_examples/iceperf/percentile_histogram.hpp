@@ -0,0 +1,70 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_EXAMPLES_ICEPERF_PERCENTILE_HISTOGRAM_HPP
+#define IOX_EXAMPLES_ICEPERF_PERCENTILE_HISTOGRAM_HPP
+
+#include <cstdint>
+#include <vector>
+
+/// @brief Log-linear histogram in the style of HdrHistogram. Values below SUB_BUCKET_COUNT are recorded exactly,
+/// every larger power of two range is split into SUB_BUCKET_COUNT / 2 linear sub-buckets. This bounds the relative
+/// error of a reported value to 1 / (SUB_BUCKET_COUNT / 2) while recording stays a constant time operation without
+/// any allocation.
+class PercentileHistogram
+{
+  public:
+    static constexpr uint32_t SUB_BUCKET_BITS{7U};
+    static constexpr uint64_t SUB_BUCKET_COUNT{1U << SUB_BUCKET_BITS};
+    static constexpr uint64_t SUB_BUCKET_HALF_COUNT{SUB_BUCKET_COUNT / 2U};
+    static constexpr uint64_t NUMBER_OF_BUCKETS{SUB_BUCKET_COUNT + (64U - SUB_BUCKET_BITS) * SUB_BUCKET_HALF_COUNT};
+
+    PercentileHistogram() noexcept;
+
+    /// @brief records a single value
+    /// @param[in] value the value to record, e.g. a latency in nanoseconds
+    void record(const uint64_t value) noexcept;
+
+    /// @brief returns the number of recorded values
+    uint64_t count() const noexcept;
+
+    /// @brief returns the smallest recorded value or 0 if nothing was recorded
+    uint64_t min() const noexcept;
+
+    /// @brief returns the largest recorded value or 0 if nothing was recorded
+    uint64_t max() const noexcept;
+
+    /// @brief returns the exact arithmetic mean of all recorded values or 0 if nothing was recorded
+    double mean() const noexcept;
+
+    /// @brief returns the smallest value for which the given percentage of all recorded values is less or equal
+    /// @param[in] percentile the percentile in the range [0, 100]
+    /// @return the highest value which is equivalent to the bucket of the percentile, capped by max()
+    uint64_t valueAtPercentile(const double percentile) const noexcept;
+
+  private:
+    static uint64_t bucketIndexOf(const uint64_t value) noexcept;
+    static uint64_t highestEquivalentValue(const uint64_t bucketIndex) noexcept;
+
+  private:
+    std::vector<uint64_t> m_counts;
+    uint64_t m_count{0U};
+    uint64_t m_min{0U};
+    uint64_t m_max{0U};
+    // long double to not lose precision when summing up a large number of nanosecond values
+    long double m_sum{0.0};
+};
+
+#endif // IOX_EXAMPLES_ICEPERF_PERCENTILE_HISTOGRAM_HPP
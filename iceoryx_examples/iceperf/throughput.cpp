@@ -0,0 +1,227 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "throughput.hpp"
+#include "topic_data.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+uint64_t elapsedNanoseconds(const Clock::time_point start, const Clock::time_point finish) noexcept
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count());
+}
+
+double perSecond(const uint64_t value, const uint64_t durationInNanoseconds) noexcept
+{
+    constexpr double NANOSECONDS_PER_SECOND{1000000000.0};
+    return (durationInNanoseconds == 0U)
+               ? 0.0
+               : static_cast<double>(value) * NANOSECONDS_PER_SECOND / static_cast<double>(durationInNanoseconds);
+}
+
+double mean(const uint64_t sum, const uint64_t count) noexcept
+{
+    return (count == 0U) ? 0.0 : static_cast<double>(sum) / static_cast<double>(count);
+}
+
+struct PublisherStatistics
+{
+    uint64_t loanDurationInNanoseconds{0U};
+    uint64_t publishDurationInNanoseconds{0U};
+    uint64_t failedLoans{0U};
+    Clock::time_point finish;
+};
+
+struct SubscriberThreadStatistics
+{
+    uint64_t takeDurationInNanoseconds{0U};
+    uint64_t takenSamples{0U};
+    Clock::time_point lastTake;
+};
+} // namespace
+
+ThroughputResult IcePerfThroughput::throughputPerfTest(const uint32_t numberOfPublishers,
+                                                       const uint32_t numberOfSubscribersPerPublisher,
+                                                       const uint32_t payloadSizeInBytes,
+                                                       const uint64_t numberOfSamples) noexcept
+{
+    std::vector<std::unique_ptr<ThroughputPublisher>> publishers;
+    std::vector<std::unique_ptr<ThroughputSubscriber>> subscribers;
+    for (uint32_t publisherIndex = 0U; publisherIndex < numberOfPublishers; ++publisherIndex)
+    {
+        publishers.emplace_back(createThroughputPublisher(publisherIndex));
+        for (uint32_t i = 0U; i < numberOfSubscribersPerPublisher; ++i)
+        {
+            subscribers.emplace_back(createThroughputSubscriber(publisherIndex));
+        }
+    }
+
+    for (const auto& subscriber : subscribers)
+    {
+        while (!subscriber->isSubscribed())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    const auto numberOfSubscriberThreads = static_cast<uint32_t>(
+        std::max(std::min(subscribers.size(), static_cast<size_t>(std::thread::hardware_concurrency())),
+                 static_cast<size_t>(1U)));
+
+    std::atomic<bool> isStarted{false};
+    std::atomic<uint32_t> numberOfRunningPublishers{numberOfPublishers};
+    Clock::time_point start;
+    std::vector<PublisherStatistics> publisherStatistics(numberOfPublishers);
+    std::vector<SubscriberThreadStatistics> subscriberThreadStatistics(numberOfSubscriberThreads);
+    std::vector<uint64_t> receivedSamplesPerSubscriber(subscribers.size(), 0U);
+
+    auto waitForStart = [&] {
+        while (!isStarted.load(std::memory_order_acquire))
+        {
+            std::this_thread::yield();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (uint32_t publisherIndex = 0U; publisherIndex < numberOfPublishers; ++publisherIndex)
+    {
+        threads.emplace_back([&, publisherIndex] {
+            auto& publisher = *publishers[publisherIndex];
+            auto& statistics = publisherStatistics[publisherIndex];
+            waitForStart();
+
+            for (uint64_t sequenceNumber = 0U; sequenceNumber < numberOfSamples; ++sequenceNumber)
+            {
+                void* payload{nullptr};
+                while (payload == nullptr)
+                {
+                    auto loanStart = Clock::now();
+                    payload = publisher.loan(payloadSizeInBytes);
+                    auto loanFinish = Clock::now();
+                    if (payload == nullptr)
+                    {
+                        // all chunks are in use; the subscribers have to release some of them first
+                        ++statistics.failedLoans;
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    statistics.loanDurationInNanoseconds += elapsedNanoseconds(loanStart, loanFinish);
+                }
+
+                static_cast<ThroughputTopic*>(payload)->sequenceNumber = sequenceNumber;
+
+                auto publishStart = Clock::now();
+                publisher.publish(payload);
+                statistics.publishDurationInNanoseconds += elapsedNanoseconds(publishStart, Clock::now());
+            }
+
+            statistics.finish = Clock::now();
+            numberOfRunningPublishers.fetch_sub(1U, std::memory_order_release);
+        });
+    }
+
+    for (uint32_t threadIndex = 0U; threadIndex < numberOfSubscriberThreads; ++threadIndex)
+    {
+        threads.emplace_back([&, threadIndex] {
+            auto& statistics = subscriberThreadStatistics[threadIndex];
+            waitForStart();
+            statistics.lastTake = start;
+
+            bool keepRunning{true};
+            while (keepRunning)
+            {
+                // publish delivers the sample to all subscriber queues before it returns, therefore an empty pass
+                // over all subscribers after the publishers have finished means that all samples were received
+                const bool havePublishersFinished = (numberOfRunningPublishers.load(std::memory_order_acquire) == 0U);
+                bool hasReceivedSamples{false};
+                for (auto index = threadIndex; index < subscribers.size(); index += numberOfSubscriberThreads)
+                {
+                    auto& subscriber = *subscribers[index];
+                    auto takeStart = Clock::now();
+                    auto payload = subscriber.take();
+                    if (payload == nullptr)
+                    {
+                        continue;
+                    }
+                    auto takeFinish = Clock::now();
+                    statistics.takeDurationInNanoseconds += elapsedNanoseconds(takeStart, takeFinish);
+                    statistics.lastTake = takeFinish;
+                    ++statistics.takenSamples;
+                    ++receivedSamplesPerSubscriber[index];
+                    hasReceivedSamples = true;
+                    subscriber.release(payload);
+                }
+                keepRunning = !havePublishersFinished || hasReceivedSamples;
+            }
+        });
+    }
+
+    start = Clock::now();
+    isStarted.store(true, std::memory_order_release);
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ThroughputResult result;
+    result.numberOfPublishers = numberOfPublishers;
+    result.numberOfSubscribersPerPublisher = numberOfSubscribersPerPublisher;
+    result.payloadSizeInBytes = payloadSizeInBytes;
+    result.sentSamples = numberOfPublishers * numberOfSamples;
+
+    uint64_t sendDuration{0U};
+    uint64_t loanDuration{0U};
+    uint64_t publishDuration{0U};
+    for (const auto& statistics : publisherStatistics)
+    {
+        sendDuration = std::max(sendDuration, elapsedNanoseconds(start, statistics.finish));
+        loanDuration += statistics.loanDurationInNanoseconds;
+        publishDuration += statistics.publishDurationInNanoseconds;
+        result.failedLoans += statistics.failedLoans;
+    }
+
+    uint64_t receiveDuration{0U};
+    uint64_t takeDuration{0U};
+    for (const auto& statistics : subscriberThreadStatistics)
+    {
+        receiveDuration = std::max(receiveDuration, elapsedNanoseconds(start, statistics.lastTake));
+        takeDuration += statistics.takeDurationInNanoseconds;
+        result.receivedSamples += statistics.takenSamples;
+    }
+
+    for (const auto receivedSamples : receivedSamplesPerSubscriber)
+    {
+        result.lostSamples += numberOfSamples - receivedSamples;
+    }
+
+    result.sentSamplesPerSecond = perSecond(result.sentSamples, sendDuration);
+    result.sentBytesPerSecond = result.sentSamplesPerSecond * static_cast<double>(payloadSizeInBytes);
+    result.receivedSamplesPerSecond = perSecond(result.receivedSamples, receiveDuration);
+    result.meanLoanDurationInNanoseconds = mean(loanDuration, result.sentSamples);
+    result.meanPublishDurationInNanoseconds = mean(publishDuration, result.sentSamples);
+    result.meanTakeDurationInNanoseconds = mean(takeDuration, result.receivedSamples);
+
+    return result;
+}
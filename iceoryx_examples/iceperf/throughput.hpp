@@ -0,0 +1,103 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_EXAMPLES_ICEPERF_THROUGHPUT_HPP
+#define IOX_EXAMPLES_ICEPERF_THROUGHPUT_HPP
+
+#include <cstdint>
+#include <memory>
+
+/// @brief the publishing side of a throughput measurement
+class ThroughputPublisher
+{
+  public:
+    virtual ~ThroughputPublisher() = default;
+
+    /// @brief loans a chunk with the given payload size
+    /// @return pointer to the payload or nullptr if the loan failed
+    virtual void* loan(const uint32_t payloadSizeInBytes) noexcept = 0;
+
+    /// @brief publishes a payload which was acquired with loan()
+    virtual void publish(void* const payload) noexcept = 0;
+};
+
+/// @brief the receiving side of a throughput measurement
+class ThroughputSubscriber
+{
+  public:
+    virtual ~ThroughputSubscriber() = default;
+
+    /// @brief returns true when the subscriber is connected to its publisher
+    virtual bool isSubscribed() const noexcept = 0;
+
+    /// @brief takes the oldest payload from the queue
+    /// @return pointer to the payload or nullptr if there is no data
+    virtual const void* take() noexcept = 0;
+
+    /// @brief releases a payload which was acquired with take()
+    virtual void release(const void* const payload) noexcept = 0;
+};
+
+struct ThroughputResult
+{
+    uint32_t numberOfPublishers{0U};
+    uint32_t numberOfSubscribersPerPublisher{0U};
+    uint32_t payloadSizeInBytes{0U};
+    uint64_t sentSamples{0U};
+    uint64_t receivedSamples{0U};
+    /// @brief samples which were published but not received by a subscriber, e.g. due to a full queue
+    uint64_t lostSamples{0U};
+    /// @brief loans which failed since all chunks of the mempool were in use
+    uint64_t failedLoans{0U};
+    double sentSamplesPerSecond{0.0};
+    double sentBytesPerSecond{0.0};
+    double receivedSamplesPerSecond{0.0};
+    double meanLoanDurationInNanoseconds{0.0};
+    double meanPublishDurationInNanoseconds{0.0};
+    double meanTakeDurationInNanoseconds{0.0};
+};
+
+/// @brief Technology independent part of the throughput benchmark. Every publisher runs in its own thread and sends
+/// the samples as fast as possible to its subscribers. The subscribers are distributed over one thread per hardware
+/// thread which take the samples in a busy loop. Publishers and subscribers live in the leader process since the
+/// data path through the shared memory is the same as for subscribers in another process and this keeps all the
+/// statistics in one place.
+class IcePerfThroughput
+{
+  public:
+    static constexpr uint64_t SUBSCRIBER_QUEUE_CAPACITY{16U};
+
+    virtual ~IcePerfThroughput() = default;
+
+    /// @brief runs a single throughput measurement
+    /// @param[in] numberOfPublishers the number of publishers which send concurrently
+    /// @param[in] numberOfSubscribersPerPublisher the number of subscribers of every publisher
+    /// @param[in] payloadSizeInBytes the payload size of the samples, must be at least sizeof(ThroughputTopic)
+    /// @param[in] numberOfSamples the number of samples every publisher sends
+    ThroughputResult throughputPerfTest(const uint32_t numberOfPublishers,
+                                        const uint32_t numberOfSubscribersPerPublisher,
+                                        const uint32_t payloadSizeInBytes,
+                                        const uint64_t numberOfSamples) noexcept;
+
+  private:
+    /// @brief creates the publisher with the given index
+    virtual std::unique_ptr<ThroughputPublisher> createThroughputPublisher(const uint32_t publisherIndex) noexcept = 0;
+
+    /// @brief creates a subscriber for the publisher with the given index
+    virtual std::unique_ptr<ThroughputSubscriber>
+    createThroughputSubscriber(const uint32_t publisherIndex) noexcept = 0;
+};
+
+#endif // IOX_EXAMPLES_ICEPERF_THROUGHPUT_HPP
@@ -22,11 +22,15 @@
 #include <cstdint>
 
 //! [topic data definitions]
+constexpr int32_t NO_CPU_PINNING{-1};
+
 struct PerfSettings
 {
     Benchmark benchmark{Benchmark::ALL};
     Technology technology{Technology::ALL};
     uint64_t numberOfSamples{10000U};
+    WaitStrategy waitStrategy{WaitStrategy::POLLING};
+    int32_t followerCpu{NO_CPU_PINNING};
 };
 
 struct PerfTopic
@@ -35,6 +39,11 @@ struct PerfTopic
     uint32_t subPackets{0};
     RunFlag runFlag{RunFlag::RUN};
 };
+
+struct ThroughputTopic
+{
+    uint64_t sequenceNumber{0U};
+};
 //! [topic data definitions]
 
 #endif // IOX_EXAMPLES_ICEPERF_TOPIC_DATA_HPP
@@ -21,4 +21,18 @@ if(NOT IOX_MINIMAL_LOG_LEVEL)
 endif()
 message(STATUS "[i] IOX_MINIMAL_LOG_LEVEL: " ${IOX_MINIMAL_LOG_LEVEL})
 
+if(IOX_ASYNC_LOGGER)
+    set(IOX_ASYNC_LOGGER_VALUE "true")
+else()
+    set(IOX_ASYNC_LOGGER_VALUE "false")
+endif()
+message(STATUS "[i] IOX_ASYNC_LOGGER: " ${IOX_ASYNC_LOGGER_VALUE})
+
+if(IOX_CACHE_LINE_PADDED_QUEUES)
+    set(IOX_CACHE_LINE_PADDED_QUEUES_VALUE "true")
+else()
+    set(IOX_CACHE_LINE_PADDED_QUEUES_VALUE "false")
+endif()
+message(STATUS "[i] IOX_CACHE_LINE_PADDED_QUEUES: " ${IOX_CACHE_LINE_PADDED_QUEUES_VALUE})
+
 message(STATUS "[i] <<<<<<<<<<<<<< End iceoryx_hoofs configuration: >>>>>>>>>>>>>>")
@@ -18,6 +18,7 @@
 #define IOX_HOOFS_CONCURRENT_FIFO_HPP
 
 #include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/internal/concurrent/queue_position.hpp"
 
 #include <atomic>
 
@@ -26,7 +27,9 @@ namespace iox
 namespace concurrent
 {
 /// @brief single pusher single pop'er thread safe fifo
-template <typename ValueType, uint64_t Capacity>
+/// @tparam CacheLinePadded if true, the read and write position are placed on separate cache lines and each side
+///         caches the last observed position of the other side, see QueuePosition
+template <typename ValueType, uint64_t Capacity, bool CacheLinePadded = build::IOX_CACHE_LINE_PADDED_QUEUES>
 class FiFo
 {
   public:
@@ -49,15 +52,12 @@ class FiFo
     /// @brief returns the capacity of the fifo
     static constexpr uint64_t capacity() noexcept;
 
-  private:
-    bool is_full() const noexcept;
-
   private:
     // safe access is guaranteed since the char array is wrapped inside the FiFo class
     // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
     ValueType m_data[Capacity];
-    std::atomic<uint64_t> m_write_pos{0};
-    std::atomic<uint64_t> m_read_pos{0};
+    QueuePosition<uint64_t, CacheLinePadded> m_write_pos{0};
+    QueuePosition<uint64_t, CacheLinePadded> m_read_pos{0};
 };
 
 } // namespace concurrent
@@ -23,14 +23,17 @@ namespace iox
 {
 namespace concurrent
 {
-template <class ValueType, uint64_t Capacity>
-inline bool FiFo<ValueType, Capacity>::push(const ValueType& value) noexcept
+template <class ValueType, uint64_t Capacity, bool CacheLinePadded>
+inline bool FiFo<ValueType, Capacity, CacheLinePadded>::push(const ValueType& value) noexcept
 {
-    if (is_full())
+    auto currentWritePos = m_write_pos.load(std::memory_order_relaxed);
+    // the cached read position is never ahead of the actual one, therefore the fifo can only be full when it looks
+    // full with the cached value; only then the cache line of the consumer is touched
+    if (currentWritePos >= m_write_pos.observedCounterpart(m_read_pos, std::memory_order_acquire) + Capacity
+        && currentWritePos == m_write_pos.refreshCounterpart(m_read_pos, std::memory_order_acquire) + Capacity)
     {
         return false;
     }
-    auto currentWritePos = m_write_pos.load(std::memory_order_relaxed);
     m_data[currentWritePos % Capacity] = value;
 
     // m_write_pos must be increased after writing the new value otherwise
@@ -41,38 +44,33 @@ inline bool FiFo<ValueType, Capacity>::push(const ValueType& value) noexcept
     return true;
 }
 
-template <class ValueType, uint64_t Capacity>
-inline bool FiFo<ValueType, Capacity>::is_full() const noexcept
-{
-    return m_write_pos.load(std::memory_order_relaxed) == m_read_pos.load(std::memory_order_relaxed) + Capacity;
-}
-
-template <class ValueType, uint64_t Capacity>
-inline uint64_t FiFo<ValueType, Capacity>::size() const noexcept
+template <class ValueType, uint64_t Capacity, bool CacheLinePadded>
+inline uint64_t FiFo<ValueType, Capacity, CacheLinePadded>::size() const noexcept
 {
     return m_write_pos.load(std::memory_order_relaxed) - m_read_pos.load(std::memory_order_relaxed);
 }
 
-template <class ValueType, uint64_t Capacity>
-inline constexpr uint64_t FiFo<ValueType, Capacity>::capacity() noexcept
+template <class ValueType, uint64_t Capacity, bool CacheLinePadded>
+inline constexpr uint64_t FiFo<ValueType, Capacity, CacheLinePadded>::capacity() noexcept
 {
     return Capacity;
 }
 
-template <class ValueType, uint64_t Capacity>
-inline bool FiFo<ValueType, Capacity>::empty() const noexcept
+template <class ValueType, uint64_t Capacity, bool CacheLinePadded>
+inline bool FiFo<ValueType, Capacity, CacheLinePadded>::empty() const noexcept
 {
     return m_read_pos.load(std::memory_order_relaxed) == m_write_pos.load(std::memory_order_relaxed);
 }
 
-template <class ValueType, uint64_t Capacity>
-inline cxx::optional<ValueType> FiFo<ValueType, Capacity>::pop() noexcept
+template <class ValueType, uint64_t Capacity, bool CacheLinePadded>
+inline cxx::optional<ValueType> FiFo<ValueType, Capacity, CacheLinePadded>::pop() noexcept
 {
     auto currentReadPos = m_read_pos.load(std::memory_order_acquire);
-    bool isEmpty = (currentReadPos ==
-                    // we are not allowed to use the empty method since we have to sync with
-                    // the producer pop - this is done here
-                    m_write_pos.load(std::memory_order_acquire));
+    // we are not allowed to use the empty method since we have to sync with the producer - this is done here;
+    // the cached write position is never ahead of the actual one and was loaded with acquire semantic, therefore
+    // the producer position needs to be loaded only when the fifo looks empty with the cached value
+    bool isEmpty = (currentReadPos >= m_read_pos.observedCounterpart(m_write_pos, std::memory_order_acquire)
+                    && currentReadPos == m_read_pos.refreshCounterpart(m_write_pos, std::memory_order_acquire));
     if (isEmpty)
     {
         return cxx::nullopt_t();
@@ -21,6 +21,7 @@
 #include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/internal/concurrent/lockfree_queue/buffer.hpp"
 #include "iceoryx_hoofs/internal/concurrent/lockfree_queue/cyclic_index.hpp"
+#include "iceoryx_hoofs/internal/concurrent/queue_position.hpp"
 
 #include <atomic>
 #include <type_traits>
@@ -120,8 +121,11 @@ class IndexQueue
     // NOLINTNEXTLINE(*avoid-c-arrays)
     Cell m_cells[Capacity];
 
-    std::atomic<Index> m_readPosition;
-    std::atomic<Index> m_writePosition;
+    // the positions are contended by all pushing and all popping threads respectively, with enabled
+    // IOX_CACHE_LINE_PADDED_QUEUES they are placed on separate cache lines; the cached counterpart of a QueuePosition
+    // is not used since it is only applicable to a single producer single consumer queue
+    QueuePosition<Index> m_readPosition;
+    QueuePosition<Index> m_writePosition;
 
     /// @brief load the value from m_cells at a position with a given memory order
     /// @param position position to load the value from
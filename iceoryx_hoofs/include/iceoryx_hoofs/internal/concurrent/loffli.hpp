@@ -92,6 +92,20 @@ class LoFFLi
     /// @return true if index is valid or not yet pushed, false otherwise
     bool push(const Index_t index) noexcept;
 
+    /// Pop multiple values from the free-list by unlinking a whole chain with a single compare-and-swap
+    /// @param [out] indices pointer to a memory with at least maxNumberOfIndices elements which receives the indices
+    /// @param [in] maxNumberOfIndices the maximum number of indices to pop
+    /// @return the number of popped indices, which is less than maxNumberOfIndices if the free-list runs empty
+    uint32_t popN(cxx::not_null<Index_t*> indices, const uint32_t maxNumberOfIndices) noexcept;
+
+    /// Push multiple previously poped elements by linking them to a chain which is inserted with a single
+    /// compare-and-swap
+    /// @param [in] indices pointer to the previously poped indices
+    /// @param [in] numberOfIndices the number of indices to push
+    /// @return true if all indices are valid and not yet pushed, false otherwise; the valid indices are pushed
+    ///         regardless of invalid ones
+    bool pushN(cxx::not_null<const Index_t*> indices, const uint32_t numberOfIndices) noexcept;
+
     /// Calculates the required memory size for a free-list
     /// @param [in] capacity is the number of elements of the free-list
     /// @return the required memory size for a free-list with the requested capacity
@@ -0,0 +1,102 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_CONCURRENT_LOFFLI_MAGAZINE_HPP
+#define IOX_HOOFS_CONCURRENT_LOFFLI_MAGAZINE_HPP
+
+#include "iceoryx_hoofs/internal/concurrent/loffli.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace concurrent
+{
+/// @brief Single threaded cache of free indices in front of a shared LoFFLi. Indices are taken from and returned to
+///        the LoFFLi in batches of half the capacity with LoFFLi::popN and LoFFLi::pushN, therefore most calls to pop
+///        and push do not touch the shared head of the LoFFLi and require no atomic read-modify-write operation.
+/// @note The magazine lives in process local memory. Indices which reside in the magazine are treated as in use by
+///       the LoFFLi and are only available to other users of the LoFFLi after a flush. If the owning process
+///       terminates without a flush, these indices are lost.
+/// @note A double free of an index is detected when the index is returned to the LoFFLi, i.e. with a delay.
+/// @tparam Capacity is the maximum number of indices which are cached
+template <uint32_t Capacity>
+class LoFFLiMagazine
+{
+  public:
+    using Index_t = LoFFLi::Index_t;
+
+    static_assert(Capacity >= 2U, "The magazine must be able to hold at least two indices!");
+    static constexpr uint32_t BATCH_SIZE{Capacity / 2U};
+
+    /// @brief Creates a magazine which is not bound to a LoFFLi; pop and push will fail until init is called
+    LoFFLiMagazine() noexcept = default;
+
+    /// @brief Creates a magazine in front of the given free-list
+    /// @param[in] freeList the LoFFLi which is used to refill and flush the magazine
+    explicit LoFFLiMagazine(LoFFLi& freeList) noexcept;
+
+    LoFFLiMagazine(const LoFFLiMagazine&) = delete;
+    LoFFLiMagazine(LoFFLiMagazine&&) = delete;
+    LoFFLiMagazine& operator=(const LoFFLiMagazine&) = delete;
+    LoFFLiMagazine& operator=(LoFFLiMagazine&&) = delete;
+
+    /// @brief Returns all cached indices to the LoFFLi
+    ~LoFFLiMagazine() noexcept;
+
+    /// @brief Binds the magazine to a free-list; cached indices of a previously bound free-list are flushed
+    /// @param[in] freeList the LoFFLi which is used to refill and flush the magazine
+    /// @return false if an index could not be returned to the previous free-list, otherwise true
+    bool init(LoFFLi& freeList) noexcept;
+
+    /// @brief Pops an index from the magazine; if the magazine is empty it is refilled from the LoFFLi
+    /// @param[out] index for an element to use
+    /// @return true if index is valid, false if the magazine and the LoFFLi are empty
+    bool pop(Index_t& index) noexcept;
+
+    /// @brief Pushes a previously popped index into the magazine; if the magazine is full half of it is returned to
+    ///        the LoFFLi
+    /// @param[in] index to a previously popped element
+    /// @return false if the LoFFLi rejected an index which was returned to it, e.g. due to a double free; otherwise
+    ///         true
+    bool push(const Index_t index) noexcept;
+
+    /// @brief Returns all cached indices to the LoFFLi
+    /// @return false if the LoFFLi rejected an index, e.g. due to a double free; otherwise true
+    bool flush() noexcept;
+
+    /// @brief Returns the number of cached indices
+    uint32_t size() const noexcept;
+
+    /// @brief Returns the LoFFLi the magazine is bound to or a nullptr if it is not bound
+    const LoFFLi* freeList() const noexcept;
+
+  private:
+    bool refill() noexcept;
+    bool drain(const uint32_t numberOfIndices) noexcept;
+
+  private:
+    LoFFLi* m_freeList{nullptr};
+    uint32_t m_size{0U};
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) fixed size storage without heap
+    Index_t m_indices[Capacity]{};
+};
+
+} // namespace concurrent
+} // namespace iox
+
+#include "iceoryx_hoofs/internal/concurrent/loffli_magazine.inl"
+
+#endif // IOX_HOOFS_CONCURRENT_LOFFLI_MAGAZINE_HPP
@@ -0,0 +1,134 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_CONCURRENT_LOFFLI_MAGAZINE_INL
+#define IOX_HOOFS_CONCURRENT_LOFFLI_MAGAZINE_INL
+
+#include "iceoryx_hoofs/internal/concurrent/loffli_magazine.hpp"
+
+namespace iox
+{
+namespace concurrent
+{
+template <uint32_t Capacity>
+constexpr uint32_t LoFFLiMagazine<Capacity>::BATCH_SIZE;
+
+template <uint32_t Capacity>
+inline LoFFLiMagazine<Capacity>::LoFFLiMagazine(LoFFLi& freeList) noexcept
+    : m_freeList(&freeList)
+{
+}
+
+template <uint32_t Capacity>
+inline LoFFLiMagazine<Capacity>::~LoFFLiMagazine() noexcept
+{
+    flush();
+}
+
+template <uint32_t Capacity>
+inline bool LoFFLiMagazine<Capacity>::init(LoFFLi& freeList) noexcept
+{
+    auto hasFlushedAllIndices = flush();
+    m_freeList = &freeList;
+    return hasFlushedAllIndices;
+}
+
+template <uint32_t Capacity>
+inline bool LoFFLiMagazine<Capacity>::pop(Index_t& index) noexcept
+{
+    if (m_size == 0U && !refill())
+    {
+        return false;
+    }
+
+    --m_size;
+    index = m_indices[m_size];
+    return true;
+}
+
+template <uint32_t Capacity>
+inline bool LoFFLiMagazine<Capacity>::push(const Index_t index) noexcept
+{
+    if (m_freeList == nullptr)
+    {
+        return false;
+    }
+
+    bool hasReturnedAllIndices{true};
+    if (m_size == Capacity)
+    {
+        hasReturnedAllIndices = drain(BATCH_SIZE);
+    }
+
+    m_indices[m_size] = index;
+    ++m_size;
+    return hasReturnedAllIndices;
+}
+
+template <uint32_t Capacity>
+inline bool LoFFLiMagazine<Capacity>::flush() noexcept
+{
+    return drain(m_size);
+}
+
+template <uint32_t Capacity>
+inline uint32_t LoFFLiMagazine<Capacity>::size() const noexcept
+{
+    return m_size;
+}
+
+template <uint32_t Capacity>
+inline const LoFFLi* LoFFLiMagazine<Capacity>::freeList() const noexcept
+{
+    return m_freeList;
+}
+
+template <uint32_t Capacity>
+inline bool LoFFLiMagazine<Capacity>::refill() noexcept
+{
+    if (m_freeList == nullptr)
+    {
+        return false;
+    }
+
+    m_size = m_freeList->popN(&m_indices[0], BATCH_SIZE);
+    return m_size > 0U;
+}
+
+template <uint32_t Capacity>
+inline bool LoFFLiMagazine<Capacity>::drain(const uint32_t numberOfIndices) noexcept
+{
+    if (m_freeList == nullptr)
+    {
+        return numberOfIndices == 0U;
+    }
+
+    // the oldest indices are returned first, the most recently used ones stay in the magazine since their chunks
+    // are most likely still in the cache of the current core
+    const bool hasReturnedAllIndices = (numberOfIndices == 0U) || m_freeList->pushN(&m_indices[0], numberOfIndices);
+
+    for (uint32_t i = numberOfIndices; i < m_size; ++i)
+    {
+        m_indices[i - numberOfIndices] = m_indices[i];
+    }
+    m_size -= numberOfIndices;
+
+    return hasReturnedAllIndices;
+}
+
+} // namespace concurrent
+} // namespace iox
+
+#endif // IOX_HOOFS_CONCURRENT_LOFFLI_MAGAZINE_INL
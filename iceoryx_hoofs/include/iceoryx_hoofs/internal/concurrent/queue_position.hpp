@@ -0,0 +1,123 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_CONCURRENT_QUEUE_POSITION_HPP
+#define IOX_HOOFS_CONCURRENT_QUEUE_POSITION_HPP
+
+#include "iceoryx_hoofs/iceoryx_hoofs_deployment.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace concurrent
+{
+/// @brief The cache line size which is assumed for the separation of concurrently written queue positions
+constexpr uint64_t CACHE_LINE_SIZE{64U};
+
+/// @brief The read or write position of a lock-free queue. It behaves like a std::atomic<T> and additionally
+///        provides a cache for the last observed position of the other side of a single producer single consumer
+///        queue.
+///        With enabled cache line padding the position and the cache are aligned to and fill a whole CACHE_LINE_SIZE
+///        block. Therefore two positions never share a cache line and the owner of a position can check the cached
+///        counterpart without touching the cache line which is written by the other side.
+///        Without cache line padding the layout is identical to std::atomic<T> and the counterpart is always loaded
+///        directly from the other position.
+/// @note The padded position is over-aligned, the memory of the surrounding object must respect its alignment. This
+///       holds for the shared memory allocations which use alignof; a heap allocation with new does not guarantee it
+///       before C++17.
+/// @note Both sides of a queue must use the same CacheLinePadded value. The cached counterpart is only written by
+///       the owner of the position and is a lower bound of the actual counterpart since queue positions only
+///       increase. It must be reset when the positions are reset.
+template <typename T, bool CacheLinePadded = build::IOX_CACHE_LINE_PADDED_QUEUES>
+class QueuePosition;
+
+template <typename T>
+class QueuePosition<T, false> : public std::atomic<T>
+{
+  public:
+    using std::atomic<T>::atomic;
+    using std::atomic<T>::operator=;
+
+    /// @brief returns the position of the other side
+    /// @param[in] other position of the other side
+    /// @param[in] order memory order which is used to load the other position
+    T observedCounterpart(const QueuePosition& other, const std::memory_order order) const noexcept
+    {
+        return other.load(order);
+    }
+
+    /// @brief loads the position of the other side
+    /// @param[in] other position of the other side
+    /// @param[in] order memory order which is used to load the other position
+    T refreshCounterpart(const QueuePosition& other, const std::memory_order order) noexcept
+    {
+        return other.load(order);
+    }
+
+    /// @brief sets the cached position of the other side, no-op without cache
+    void resetCounterpart(const T) noexcept
+    {
+    }
+};
+
+template <typename T>
+class alignas(CACHE_LINE_SIZE) QueuePosition<T, true> : public std::atomic<T>
+{
+  public:
+    using std::atomic<T>::operator=;
+
+    constexpr QueuePosition() noexcept = default;
+    constexpr QueuePosition(const T position) noexcept
+        : std::atomic<T>(position)
+        , m_counterpart(position)
+    {
+    }
+
+    /// @brief returns the cached position of the other side, it is never ahead of the actual position
+    /// @param[in] other position of the other side, unused
+    /// @param[in] order unused since the cache is written only by the owner of this position
+    T observedCounterpart(const QueuePosition&, const std::memory_order) const noexcept
+    {
+        return m_counterpart.load(std::memory_order_relaxed);
+    }
+
+    /// @brief loads the position of the other side and updates the cache
+    /// @param[in] other position of the other side
+    /// @param[in] order memory order which is used to load the other position
+    T refreshCounterpart(const QueuePosition& other, const std::memory_order order) noexcept
+    {
+        const auto counterpart = other.load(order);
+        m_counterpart.store(counterpart, std::memory_order_relaxed);
+        return counterpart;
+    }
+
+    /// @brief sets the cached position of the other side
+    /// @param[in] counterpart the new value of the cache
+    void resetCounterpart(const T counterpart) noexcept
+    {
+        m_counterpart.store(counterpart, std::memory_order_relaxed);
+    }
+
+  private:
+    std::atomic<T> m_counterpart{};
+    static_assert(2U * sizeof(std::atomic<T>) <= CACHE_LINE_SIZE, "the position must fit into a single cache line");
+};
+
+} // namespace concurrent
+} // namespace iox
+
+#endif // IOX_HOOFS_CONCURRENT_QUEUE_POSITION_HPP
@@ -18,6 +18,7 @@
 #define IOX_HOOFS_CONCURRENT_SOFI_HPP
 
 #include "iceoryx_hoofs/cxx/type_traits.hpp"
+#include "iceoryx_hoofs/internal/concurrent/queue_position.hpp"
 #include "iceoryx_platform/platform_correction.hpp"
 
 #include <atomic>
@@ -42,7 +43,9 @@ namespace concurrent
 ///
 /// @param[in] ValueType        DataType to be stored, must be trivially copyable
 /// @param[in] CapacityValue    Capacity of the SoFi
-template <class ValueType, uint64_t CapacityValue>
+/// @param[in] CacheLinePadded  if true, the read and write position are placed on separate cache lines and each
+///                             side caches the last observed position of the other side, see QueuePosition
+template <class ValueType, uint64_t CapacityValue, bool CacheLinePadded = build::IOX_CACHE_LINE_PADDED_QUEUES>
 class SoFi
 {
     static_assert(std::is_trivially_copyable<ValueType>::value, "SoFi can handle only trivially copyable data types");
@@ -159,8 +162,8 @@ class SoFi
 
     /// @brief the write/read pointers are "atomic pointers" so that they are not
     /// reordered (read or written too late)
-    std::atomic<uint64_t> m_readPosition{0};
-    std::atomic<uint64_t> m_writePosition{0};
+    QueuePosition<uint64_t, CacheLinePadded> m_readPosition{0};
+    QueuePosition<uint64_t, CacheLinePadded> m_writePosition{0};
 };
 
 } // namespace concurrent
@@ -23,14 +23,14 @@ namespace iox
 {
 namespace concurrent
 {
-template <class ValueType, uint64_t CapacityValue>
-uint64_t SoFi<ValueType, CapacityValue>::capacity() const noexcept
+template <class ValueType, uint64_t CapacityValue, bool CacheLinePadded>
+uint64_t SoFi<ValueType, CapacityValue, CacheLinePadded>::capacity() const noexcept
 {
     return m_size - INTERNAL_SIZE_ADD_ON;
 }
 
-template <class ValueType, uint64_t CapacityValue>
-uint64_t SoFi<ValueType, CapacityValue>::size() const noexcept
+template <class ValueType, uint64_t CapacityValue, bool CacheLinePadded>
+uint64_t SoFi<ValueType, CapacityValue, CacheLinePadded>::size() const noexcept
 {
     uint64_t readPosition{0};
     uint64_t writePosition{0};
@@ -44,8 +44,8 @@ uint64_t SoFi<ValueType, CapacityValue>::size() const noexcept
     return writePosition - readPosition;
 }
 
-template <class ValueType, uint64_t CapacityValue>
-bool SoFi<ValueType, CapacityValue>::setCapacity(const uint64_t newSize) noexcept
+template <class ValueType, uint64_t CapacityValue, bool CacheLinePadded>
+bool SoFi<ValueType, CapacityValue, CacheLinePadded>::setCapacity(const uint64_t newSize) noexcept
 {
     uint64_t newInternalSize = newSize + INTERNAL_SIZE_ADD_ON;
     if (empty() && (newInternalSize <= INTERNAL_SOFI_SIZE))
@@ -54,6 +54,8 @@ bool SoFi<ValueType, CapacityValue>::setCapacity(const uint64_t newSize) noexcep
 
         m_readPosition.store(0, std::memory_order_release);
         m_writePosition.store(0, std::memory_order_release);
+        m_readPosition.resetCounterpart(0U);
+        m_writePosition.resetCounterpart(0U);
 
         return true;
     }
@@ -61,8 +63,8 @@ bool SoFi<ValueType, CapacityValue>::setCapacity(const uint64_t newSize) noexcep
     return false;
 }
 
-template <class ValueType, uint64_t CapacityValue>
-bool SoFi<ValueType, CapacityValue>::empty() const noexcept
+template <class ValueType, uint64_t CapacityValue, bool CacheLinePadded>
+bool SoFi<ValueType, CapacityValue, CacheLinePadded>::empty() const noexcept
 {
     uint64_t currentReadPosition{0};
     bool isEmpty{false};
@@ -81,15 +83,16 @@ bool SoFi<ValueType, CapacityValue>::empty() const noexcept
     return isEmpty;
 }
 
-template <class ValueType, uint64_t CapacityValue>
-bool SoFi<ValueType, CapacityValue>::pop(ValueType& valueOut) noexcept
+template <class ValueType, uint64_t CapacityValue, bool CacheLinePadded>
+bool SoFi<ValueType, CapacityValue, CacheLinePadded>::pop(ValueType& valueOut) noexcept
 {
     return popIf(valueOut, [](ValueType) { return true; });
 }
 
-template <class ValueType, uint64_t CapacityValue>
+template <class ValueType, uint64_t CapacityValue, bool CacheLinePadded>
 template <typename Verificator_T>
-inline bool SoFi<ValueType, CapacityValue>::popIf(ValueType& valueOut, const Verificator_T& verificator) noexcept
+inline bool SoFi<ValueType, CapacityValue, CacheLinePadded>::popIf(ValueType& valueOut,
+                                                                   const Verificator_T& verificator) noexcept
 {
     uint64_t currentReadPosition = m_readPosition.load(std::memory_order_acquire);
     uint64_t nextReadPosition{0};
@@ -97,7 +100,10 @@ inline bool SoFi<ValueType, CapacityValue>::popIf(ValueType& valueOut, const Ver
     bool popWasSuccessful{true};
     do
     {
-        if (currentReadPosition == m_writePosition.load(std::memory_order_acquire))
+        // the cached write position is never ahead of the actual one and was loaded with acquire semantic,
+        // therefore the write position needs to be loaded only when the SoFi looks empty with the cached value
+        if (currentReadPosition >= m_readPosition.observedCounterpart(m_writePosition, std::memory_order_acquire)
+            && currentReadPosition == m_readPosition.refreshCounterpart(m_writePosition, std::memory_order_acquire))
         {
             nextReadPosition = currentReadPosition;
             popWasSuccessful = false;
@@ -138,8 +144,8 @@ inline bool SoFi<ValueType, CapacityValue>::popIf(ValueType& valueOut, const Ver
     return popWasSuccessful;
 }
 
-template <class ValueType, uint64_t CapacityValue>
-bool SoFi<ValueType, CapacityValue>::push(const ValueType& valueIn, ValueType& valueOut) noexcept
+template <class ValueType, uint64_t CapacityValue, bool CacheLinePadded>
+bool SoFi<ValueType, CapacityValue, CacheLinePadded>::push(const ValueType& valueIn, ValueType& valueOut) noexcept
 {
     constexpr bool SOFI_OVERFLOW{false};
 
@@ -149,7 +155,14 @@ bool SoFi<ValueType, CapacityValue>::push(const ValueType& valueIn, ValueType& v
     m_data[currentWritePosition % m_size] = valueIn;
     m_writePosition.store(nextWritePosition, std::memory_order_release);
 
-    uint64_t currentReadPosition = m_readPosition.load(std::memory_order_acquire);
+    // the cached read position is never ahead of the actual one, therefore there is a free position for the next
+    // push if there is one with the cached value; only otherwise the cache line of the consumer is touched
+    if (nextWritePosition < m_writePosition.observedCounterpart(m_readPosition, std::memory_order_acquire) + m_size)
+    {
+        return !SOFI_OVERFLOW;
+    }
+
+    uint64_t currentReadPosition = m_writePosition.refreshCounterpart(m_readPosition, std::memory_order_acquire);
 
     // check if there is a free position for the next push
     if (nextWritePosition < currentReadPosition + m_size)
@@ -93,6 +93,24 @@ class UnixDomainSocket : public DesignPattern::Creation<UnixDomainSocket, IpcCha
     /// @return received message. In case of an error, IpcChannelError is returned and msg is empty.
     cxx::expected<std::string, IpcChannelError> timedReceive(const units::Duration& timeout) const noexcept;
 
+    /// @brief try to send the memory regions of an I/O vector as one message for a given timeout duration, the
+    /// regions are gathered by the kernel without an intermediate copy. In contrast to the string based send the
+    /// message is binary and its size is only limited by the operating system.
+    /// @param ioVector the memory regions of the message
+    /// @param ioVectorSize the number of memory regions
+    /// @param timeout for the send operation, a duration of zero blocks until the message was sent
+    /// @return IpcChannelError if error occured
+    cxx::expected<IpcChannelError>
+    timedSend(const iovec* ioVector, const uint32_t ioVectorSize, const units::Duration& timeout) const noexcept;
+
+    /// @brief try to receive a binary message into the provided buffer for a given timeout duration
+    /// @param buffer the memory which receives the message
+    /// @param bufferSize the size of the buffer, the part of a message which exceeds it is discarded
+    /// @param timeout for the receive operation, a duration of zero blocks until a message was received
+    /// @return the size of the received message, in case of an error IpcChannelError is returned
+    cxx::expected<uint64_t, IpcChannelError>
+    timedReceive(void* buffer, const uint64_t bufferSize, const units::Duration& timeout) const noexcept;
+
   private:
     UnixDomainSocket(const IpcChannelName_t& name,
                      const IpcChannelSide channelSide,
@@ -109,6 +127,8 @@ class UnixDomainSocket : public DesignPattern::Creation<UnixDomainSocket, IpcCha
 
     cxx::expected<IpcChannelError> initalizeSocket() noexcept;
 
+    cxx::expected<IpcChannelError> setTimeout(const int32_t option, const units::Duration& timeout) const noexcept;
+
     IpcChannelError convertErrnoToIpcChannelError(const int32_t errnum) const noexcept;
 
     cxx::expected<IpcChannelError> closeFileDescriptor() noexcept;
@@ -21,6 +21,7 @@
 #include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/cxx/vector.hpp"
 
+#include <atomic>
 #include <cassert>
 #include <limits>
 
@@ -45,6 +46,20 @@ class PointerRepository
         ptr_t endPtr{nullptr};
     };
 
+    struct Interval
+    {
+        ptr_t basePtr{nullptr};
+        ptr_t endPtr{nullptr};
+        id_t id{0U};
+    };
+
+    struct LastHit
+    {
+        const PointerRepository* repository{nullptr};
+        uint64_t generation{0U};
+        Interval interval;
+    };
+
     static constexpr id_t MIN_ID{1U};
     static constexpr id_t MAX_ID{CAPACITY - 1U};
 
@@ -98,6 +113,8 @@ class PointerRepository
     /// @brief returns the id for a given pointer ptr
     /// @param[in] ptr is the pointer whose corresponding id is searched for
     /// @return the id the pointer was registered to
+    /// @note the segment of the last lookup is cached per thread, otherwise the segment is searched by a binary
+    /// search over the registered intervals; only overlapping segments require a linear search over all ids
     id_t searchId(ptr_t ptr) const noexcept;
 
   private:
@@ -110,7 +127,23 @@ class PointerRepository
     iox::cxx::vector<Info, CAPACITY> m_info;
     uint64_t m_maxRegistered{0U};
 
+    /// @brief the non-empty segments sorted by their base pointer, used for the binary search in searchId
+    iox::cxx::vector<Interval, CAPACITY> m_intervals;
+    bool m_hasOverlappingIntervals{false};
+
+    /// @brief changes with every registration and unregistration to invalidate the thread local lookup caches
+    std::atomic<uint64_t> m_generation{nextGeneration()};
+
     bool addPointerIfIndexIsFree(const id_t id, const ptr_t ptr, const uint64_t size) noexcept;
+    void addInterval(const Interval& interval) noexcept;
+    void removeInterval(const id_t id) noexcept;
+    void updateOverlapState() noexcept;
+    const Interval* searchInterval(ptr_t ptr) const noexcept;
+    id_t searchIdLinear(ptr_t ptr) const noexcept;
+
+    /// @brief the generations are unique across all repositories, therefore a cache entry of a destroyed
+    /// repository is never valid for a new repository at the same address
+    static uint64_t nextGeneration() noexcept;
 };
 } // namespace rp
 } // namespace iox
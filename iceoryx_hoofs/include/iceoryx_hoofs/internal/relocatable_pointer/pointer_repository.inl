@@ -20,6 +20,8 @@
 
 #include "iceoryx_hoofs/internal/relocatable_pointer/pointer_repository.hpp"
 
+#include <algorithm>
+
 namespace iox
 {
 namespace rp
@@ -65,6 +67,9 @@ inline bool PointerRepository<id_t, ptr_t, CAPACITY>::unregisterPtr(id_t id) noe
         if (m_info[id].basePtr != nullptr)
         {
             m_info[id].basePtr = nullptr;
+            m_info[id].endPtr = nullptr;
+            removeInterval(id);
+            m_generation.store(nextGeneration(), std::memory_order_release);
 
             /// @note do not search for next lower registered index but we could do it here
             return true;
@@ -80,8 +85,12 @@ inline void PointerRepository<id_t, ptr_t, CAPACITY>::unregisterAll() noexcept
     for (auto& info : m_info)
     {
         info.basePtr = nullptr;
+        info.endPtr = nullptr;
     }
     m_maxRegistered = 0U;
+    m_intervals.clear();
+    m_hasOverlappingIntervals = false;
+    m_generation.store(nextGeneration(), std::memory_order_release);
 }
 
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
@@ -101,19 +110,76 @@ inline ptr_t PointerRepository<id_t, ptr_t, CAPACITY>::getBasePtr(id_t id) const
 
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
 inline id_t PointerRepository<id_t, ptr_t, CAPACITY>::searchId(ptr_t ptr) const noexcept
+{
+    // consecutive lookups, e.g. for all chunks of a mempool, usually hit the same segment
+    thread_local static LastHit lastHit;
+
+    const uint64_t generation = m_generation.load(std::memory_order_acquire);
+    if (lastHit.repository == this && lastHit.generation == generation && ptr >= lastHit.interval.basePtr
+        && ptr <= lastHit.interval.endPtr)
+    {
+        return lastHit.interval.id;
+    }
+
+    if (m_hasOverlappingIntervals)
+    {
+        /// @note the binary search cannot determine the lowest id of all segments containing the pointer
+        return searchIdLinear(ptr);
+    }
+
+    const Interval* interval = searchInterval(ptr);
+    if (interval == nullptr)
+    {
+        /// @note treat the pointer as a regular pointer if not found
+        /// by setting id to RAW_POINTER_BEHAVIOUR_ID
+        return RAW_POINTER_BEHAVIOUR_ID;
+    }
+
+    lastHit.repository = this;
+    lastHit.generation = generation;
+    lastHit.interval = *interval;
+    return interval->id;
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline const typename PointerRepository<id_t, ptr_t, CAPACITY>::Interval*
+PointerRepository<id_t, ptr_t, CAPACITY>::searchInterval(ptr_t ptr) const noexcept
+{
+    if (m_intervals.empty())
+    {
+        return nullptr;
+    }
+
+    // the last interval with a base pointer not greater than ptr is the only candidate since they do not overlap;
+    // the search is written without data dependent branches since consecutive lookups of pointers from different
+    // segments would otherwise cause a branch misprediction in almost every step
+    const Interval* candidate = m_intervals.begin();
+    uint64_t remaining = m_intervals.size();
+    while (remaining > 1U)
+    {
+        const uint64_t half = remaining / 2U;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) candidate + half is within m_intervals
+        candidate = (candidate[half].basePtr <= ptr) ? &candidate[half] : candidate;
+        remaining -= half;
+    }
+
+    return (ptr >= candidate->basePtr && ptr <= candidate->endPtr) ? candidate : nullptr;
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline id_t PointerRepository<id_t, ptr_t, CAPACITY>::searchIdLinear(ptr_t ptr) const noexcept
 {
     for (id_t id = 1U; id <= m_maxRegistered; ++id)
     {
         // return first id where the ptr is in the corresponding interval
-        if (ptr >= m_info[id].basePtr && ptr <= m_info[id].endPtr)
+        if (m_info[id].basePtr != nullptr && ptr >= m_info[id].basePtr && ptr <= m_info[id].endPtr)
         {
             return id;
         }
     }
-    /// @note treat the pointer as a regular pointer if not found
-    /// by setting id to RAW_POINTER_BEHAVIOUR_ID
     return RAW_POINTER_BEHAVIOUR_ID;
 }
+
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
 inline bool PointerRepository<id_t, ptr_t, CAPACITY>::addPointerIfIndexIsFree(const id_t id,
                                                                               const ptr_t ptr,
@@ -131,11 +197,64 @@ inline bool PointerRepository<id_t, ptr_t, CAPACITY>::addPointerIfIndexIsFree(co
         {
             m_maxRegistered = id;
         }
+
+        // a segment of size 0 contains no address and is therefore never found by searchId
+        if (size > 0U)
+        {
+            addInterval({m_info[id].basePtr, m_info[id].endPtr, id});
+        }
+        m_generation.store(nextGeneration(), std::memory_order_release);
         return true;
     }
     return false;
 }
 
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline void PointerRepository<id_t, ptr_t, CAPACITY>::addInterval(const Interval& interval) noexcept
+{
+    auto position = std::upper_bound(
+        m_intervals.begin(), m_intervals.end(), interval.basePtr, [](const ptr_t value, const Interval& other) {
+            return value < other.basePtr;
+        });
+    // the capacity of m_intervals equals the one of m_info, therefore emplacing an interval cannot fail
+    m_intervals.emplace(static_cast<uint64_t>(position - m_intervals.begin()), interval);
+    updateOverlapState();
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline void PointerRepository<id_t, ptr_t, CAPACITY>::removeInterval(const id_t id) noexcept
+{
+    auto interval = std::find_if(
+        m_intervals.begin(), m_intervals.end(), [id](const Interval& other) { return other.id == id; });
+    if (interval != m_intervals.end())
+    {
+        m_intervals.erase(interval);
+        updateOverlapState();
+    }
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline void PointerRepository<id_t, ptr_t, CAPACITY>::updateOverlapState() noexcept
+{
+    // the intervals are sorted by their base pointer, therefore it is sufficient to compare neighbours
+    m_hasOverlappingIntervals = false;
+    for (uint64_t i = 1U; i < m_intervals.size(); ++i)
+    {
+        if (m_intervals[i].basePtr <= m_intervals[i - 1U].endPtr)
+        {
+            m_hasOverlappingIntervals = true;
+            return;
+        }
+    }
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline uint64_t PointerRepository<id_t, ptr_t, CAPACITY>::nextGeneration() noexcept
+{
+    static std::atomic<uint64_t> generation{0U};
+    return generation.fetch_add(1U, std::memory_order_relaxed) + 1U;
+}
+
 } // namespace rp
 } // namespace iox
 
@@ -0,0 +1,165 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_LOG_BUILDING_BLOCKS_ASYNC_LOGGER_HPP
+#define IOX_HOOFS_LOG_BUILDING_BLOCKS_ASYNC_LOGGER_HPP
+
+#include "iceoryx_hoofs/internal/concurrent/fifo.hpp"
+#include "iceoryx_hoofs/log/building_blocks/console_logger.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace iox
+{
+namespace log
+{
+/// @brief A logger which takes the formatting of the timestamp and the output to the console off the logging threads.
+/// Each logging thread writes its log messages as binary records into its own single producer single consumer ring
+/// and a background thread formats and prints them. A full ring or more logging threads than rings lead to dropped
+/// log messages instead of blocking the logging thread; the number of dropped log messages is counted and reported.
+/// A thread without a ring tries to acquire one again after IDLE_PERIOD. Fatal log messages are printed by the logging
+/// thread itself before it continues since a fatal error is usually followed by the termination of the process.
+/// @note The log messages of one thread keep their order but the log messages of different threads might interleave
+/// differently than with the ConsoleLogger
+class AsyncLogger : public ConsoleLogger
+{
+  public:
+    /// @brief maximum number of threads which can log concurrently; the ring of a terminated thread is reused
+    static constexpr uint32_t MAX_NUMBER_OF_LOGGING_THREADS{32U};
+    /// @brief number of log messages a thread can log before the background thread has to catch up
+    static constexpr uint64_t RING_CAPACITY{16U};
+    /// @brief maximum size of a single log message without the header; longer messages are truncated
+    static constexpr uint32_t MAX_MESSAGE_SIZE{1024U};
+    /// @brief the period in which the background thread checks the rings when there is nothing to print
+    static constexpr std::chrono::milliseconds IDLE_PERIOD{10};
+    /// @brief the maximum time the destructor waits for the log messages to be printed
+    static constexpr std::chrono::milliseconds FLUSH_TIMEOUT{500};
+
+    ~AsyncLogger() override;
+
+    AsyncLogger(const AsyncLogger&) = delete;
+    AsyncLogger(AsyncLogger&&) = delete;
+
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+    AsyncLogger& operator=(AsyncLogger&&) = delete;
+
+    /// @brief Obtain the number of log messages which were dropped since the logger was created
+    /// @return the number of dropped log messages
+    uint64_t numberOfDroppedLogMessages() const noexcept;
+
+  protected:
+    AsyncLogger() noexcept;
+
+    void
+    createLogMessageHeader(const char* file, const int line, const char* function, LogLevel logLevel) noexcept override;
+
+    void flush() noexcept override;
+
+    /// @brief Writes a formatted log message; this is called from the background thread and for fatal log messages
+    /// concurrently from the logging thread
+    /// @param[in] logMessage is the null terminated log message including the header
+    virtual void output(const char* logMessage) noexcept;
+
+    /// @brief Prints the pending log messages, bounded by FLUSH_TIMEOUT, and stops the background thread
+    /// @note A derived class which overrides 'output' must call this in its destructor
+    void stop() noexcept;
+
+  private:
+    struct Record
+    {
+        timespec timestamp{0, 0};
+        LogLevel logLevel{LogLevel::OFF};
+        uint32_t messageSize{0U};
+        // NOLINTJUSTIFICATION safe access is guaranteed since the char array is wrapped inside the struct
+        // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+        char message[MAX_MESSAGE_SIZE + 1U];
+    };
+
+    enum class RingState : uint8_t
+    {
+        FREE,
+        IN_USE,
+        RELEASED
+    };
+
+    struct ThreadLocalRing;
+
+    struct Ring
+    {
+        std::atomic<RingState> state{RingState::FREE};
+        concurrent::FiFo<Record, RING_CAPACITY> records;
+        /// the thread which uses the ring, guarded by the registration mutex
+        ThreadLocalRing* owner{nullptr};
+    };
+
+    /// @brief Acquires a ring for the calling thread on its first log message and releases it when the thread
+    /// terminates. The logger unregisters it when the logger is destroyed before the thread terminates.
+    struct ThreadLocalRing
+    {
+        ThreadLocalRing() noexcept = default;
+        ~ThreadLocalRing() noexcept;
+
+        ThreadLocalRing(const ThreadLocalRing&) = delete;
+        ThreadLocalRing(ThreadLocalRing&&) = delete;
+
+        ThreadLocalRing& operator=(const ThreadLocalRing&) = delete;
+        ThreadLocalRing& operator=(ThreadLocalRing&&) = delete;
+
+        /// @brief releases the ring to the background thread which prints the remaining records
+        /// @note the registration mutex must be locked
+        void releaseRing() noexcept;
+
+        AsyncLogger* logger{nullptr};
+        Ring* ring{nullptr};
+        timespec timestamp{0, 0};
+        LogLevel logLevel{LogLevel::OFF};
+        /// a thread which did not get a ring does not try again before this point in time
+        std::chrono::steady_clock::time_point nextRingAcquisition;
+    };
+
+    static ThreadLocalRing& getThreadLocalRing() noexcept;
+
+    /// @brief guards the link between the rings and the thread local data in both directions; it is only locked
+    /// when a thread logs with a logger for the first time, when a thread terminates and when a logger is destroyed
+    static std::mutex& registrationMutex() noexcept;
+
+    void registerThreadLocalRing(ThreadLocalRing& data) noexcept;
+    void unregisterThreadLocalRings() noexcept;
+
+    Ring* acquireRing() noexcept;
+    void printFatalLogMessage(const Ring* ring, const Record& record) noexcept;
+    void run() noexcept;
+    bool printPendingRecords() noexcept;
+    void printDroppedLogMessages() noexcept;
+    void print(const Record& record) noexcept;
+
+  private:
+    // NOLINTJUSTIFICATION safe access is guaranteed since the array is only accessed via a range based for loop
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    Ring m_rings[MAX_NUMBER_OF_LOGGING_THREADS];
+    std::atomic<uint64_t> m_droppedLogMessages{0U};
+    uint64_t m_reportedDroppedLogMessages{0U};
+    std::atomic<bool> m_keepRunning{true};
+    std::thread m_backgroundThread;
+};
+
+} // namespace log
+} // namespace iox
+
+#endif // IOX_HOOFS_LOG_BUILDING_BLOCKS_ASYNC_LOGGER_HPP
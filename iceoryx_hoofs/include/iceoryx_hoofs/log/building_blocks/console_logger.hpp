@@ -20,6 +20,7 @@
 
 #include "iceoryx_hoofs/iceoryx_hoofs_types.hpp"
 #include "iceoryx_hoofs/log/building_blocks/logformat.hpp"
+#include "iceoryx_platform/time.hpp"
 
 #include <atomic>
 #include <cstdint>
@@ -60,6 +61,21 @@ class ConsoleLogger
 
     virtual void flush() noexcept;
 
+    /// @brief Obtains the timestamp which is used for the log message header
+    /// @return the current wall clock time or a zero timestamp if the clock is not available
+    static timespec currentTimestamp() noexcept;
+
+    /// @brief Writes the log message header with the timestamp and the log level into a buffer
+    /// @param[in] buffer to write the null terminated header to
+    /// @param[in] nullTerminatedBufferSize is the size of the buffer including the null termination
+    /// @param[in] timestamp is the time the log message was created
+    /// @param[in] logLevel is the log level of the log message
+    /// @return the number of characters written without the null termination
+    static uint32_t formatLogMessageHeader(char* buffer,
+                                           const uint32_t nullTerminatedBufferSize,
+                                           const timespec& timestamp,
+                                           const LogLevel logLevel) noexcept;
+
     LogBuffer getLogBuffer() const noexcept;
 
     void assumeFlushed() noexcept;
@@ -29,15 +29,20 @@
 #define IOX_HOOFS_LOG_LOGGER_HPP
 
 #include "iceoryx_hoofs/iceoryx_hoofs_deployment.hpp"
+#include "iceoryx_hoofs/log/building_blocks/async_logger.hpp"
 #include "iceoryx_hoofs/log/building_blocks/console_logger.hpp"
 #include "iceoryx_hoofs/log/building_blocks/logger.hpp"
 
+#include <type_traits>
+
 namespace iox
 {
 namespace log
 {
-using Logger = internal::Logger<ConsoleLogger>;
-using TestingLoggerBase = internal::Logger<ConsoleLogger>;
+/// @brief The logger building block is selected with the 'IOX_ASYNC_LOGGER' cmake option
+using LoggerBase = std::conditional_t<build::IOX_ASYNC_LOGGER, AsyncLogger, ConsoleLogger>;
+using Logger = internal::Logger<LoggerBase>;
+using TestingLoggerBase = internal::Logger<LoggerBase>;
 
 /// @todo iox-#1345 make this a option a cmake argument and use via a compile define
 /// @brief If set to true, the IOX_LOG macro will ignore the the configured log level and forward all messages to the
@@ -110,5 +110,119 @@ bool LoFFLi::push(const Index_t index) noexcept
     return true;
 }
 
+uint32_t LoFFLi::popN(cxx::not_null<Index_t*> indices, const uint32_t maxNumberOfIndices) noexcept
+{
+    Index_t* const poppedIndices = indices;
+    if (maxNumberOfIndices == 0U || !m_nextFreeIndex)
+    {
+        return 0U;
+    }
+
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+    uint32_t numberOfIndices{0U};
+
+    do
+    {
+        // the chain is stable as long as the head is unchanged since every modification of the free-list alters
+        // the aba counter of the head; a chain read from a concurrently modified free-list is discarded by the CAS
+        numberOfIndices = 0U;
+        Index_t current = oldHead.indexToNextFreeIndex;
+        while (numberOfIndices < maxNumberOfIndices && current < m_size)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit of index set by m_size
+            current = m_nextFreeIndex.get()[current];
+            ++numberOfIndices;
+        }
+
+        if (numberOfIndices == 0U)
+        {
+            return 0U;
+        }
+
+        newHead.indexToNextFreeIndex = current;
+        newHead.abaCounter = oldHead.abaCounter + 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    /// the chain is owned exclusively after a successful CAS and can be traversed again without synchronization
+    Index_t current = oldHead.indexToNextFreeIndex;
+    for (uint32_t i = 0U; i < numberOfIndices; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) limited by maxNumberOfIndices
+        poppedIndices[i] = current;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit of index set by m_size
+        auto next = m_nextFreeIndex.get()[current];
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit of index set by m_size
+        m_nextFreeIndex.get()[current] = m_invalidIndex;
+        current = next;
+    }
+
+    /// we need to synchronize m_nextFreeIndex with push so that we can perform a validation
+    /// check right before push to avoid double free's
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return numberOfIndices;
+}
+
+bool LoFFLi::pushN(cxx::not_null<const Index_t*> indices, const uint32_t numberOfIndices) noexcept
+{
+    const Index_t* const indicesToPush = indices;
+    /// we synchronize with m_nextFreeIndex in pop to perform the validity check
+    std::atomic_thread_fence(std::memory_order_release);
+
+    if (!m_nextFreeIndex)
+    {
+        return false;
+    }
+
+    /// link all valid indices to a chain; every linked index is immediately marked as not in use anymore, therefore
+    /// a duplicate within the provided indices is detected like a double free
+    bool areAllIndicesValid{true};
+    Index_t first{m_invalidIndex};
+    Index_t last{m_invalidIndex};
+    for (uint32_t i = 0U; i < numberOfIndices; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) limited by numberOfIndices
+        const Index_t index = indicesToPush[i];
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by capacity
+        if (index >= m_size || m_nextFreeIndex.get()[index] != m_invalidIndex)
+        {
+            areAllIndicesValid = false;
+            continue;
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by capacity
+        m_nextFreeIndex.get()[index] = m_size;
+        if (first == m_invalidIndex)
+        {
+            first = index;
+        }
+        else
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by capacity
+            m_nextFreeIndex.get()[last] = index;
+        }
+        last = index;
+    }
+
+    if (first == m_invalidIndex)
+    {
+        return areAllIndicesValid;
+    }
+
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+
+    do
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by capacity
+        m_nextFreeIndex.get()[last] = oldHead.indexToNextFreeIndex;
+        newHead.indexToNextFreeIndex = first;
+        newHead.abaCounter = oldHead.abaCounter + 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    return areAllIndicesValid;
+}
+
 } // namespace concurrent
 } // namespace iox
@@ -0,0 +1,302 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/log/building_blocks/async_logger.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+namespace iox
+{
+namespace log
+{
+constexpr uint32_t AsyncLogger::MAX_NUMBER_OF_LOGGING_THREADS;
+constexpr uint64_t AsyncLogger::RING_CAPACITY;
+constexpr uint32_t AsyncLogger::MAX_MESSAGE_SIZE;
+constexpr std::chrono::milliseconds AsyncLogger::IDLE_PERIOD;
+constexpr std::chrono::milliseconds AsyncLogger::FLUSH_TIMEOUT;
+
+AsyncLogger::AsyncLogger() noexcept
+    : m_backgroundThread(&AsyncLogger::run, this)
+{
+}
+
+AsyncLogger::~AsyncLogger()
+{
+    stop();
+    unregisterThreadLocalRings();
+}
+
+void AsyncLogger::stop() noexcept
+{
+    m_keepRunning.store(false, std::memory_order_relaxed);
+    if (m_backgroundThread.joinable())
+    {
+        m_backgroundThread.join();
+    }
+}
+
+AsyncLogger::ThreadLocalRing::~ThreadLocalRing() noexcept
+{
+    std::lock_guard<std::mutex> lock(registrationMutex());
+    releaseRing();
+}
+
+void AsyncLogger::ThreadLocalRing::releaseRing() noexcept
+{
+    if (ring != nullptr)
+    {
+        // the background thread prints the remaining records and frees the ring afterwards
+        ring->owner = nullptr;
+        ring->state.store(RingState::RELEASED, std::memory_order_release);
+        ring = nullptr;
+    }
+    logger = nullptr;
+}
+
+AsyncLogger::ThreadLocalRing& AsyncLogger::getThreadLocalRing() noexcept
+{
+    thread_local static ThreadLocalRing data;
+    return data;
+}
+
+std::mutex& AsyncLogger::registrationMutex() noexcept
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+void AsyncLogger::registerThreadLocalRing(ThreadLocalRing& data) noexcept
+{
+    std::lock_guard<std::mutex> lock(registrationMutex());
+    // the previous logger of this thread is still alive, otherwise it would have reset the data
+    data.releaseRing();
+    data.logger = this;
+    data.ring = acquireRing();
+    if (data.ring != nullptr)
+    {
+        data.ring->owner = &data;
+    }
+    else
+    {
+        // the rings of terminated threads are freed by the background thread, it does not check them more often
+        data.nextRingAcquisition = std::chrono::steady_clock::now() + IDLE_PERIOD;
+    }
+}
+
+void AsyncLogger::unregisterThreadLocalRings() noexcept
+{
+    // threads which logged with this logger and are still running must not access the rings anymore
+    std::lock_guard<std::mutex> lock(registrationMutex());
+    for (auto& ring : m_rings)
+    {
+        if (ring.owner != nullptr)
+        {
+            ring.owner->logger = nullptr;
+            ring.owner->ring = nullptr;
+            ring.owner = nullptr;
+        }
+    }
+}
+
+uint64_t AsyncLogger::numberOfDroppedLogMessages() const noexcept
+{
+    return m_droppedLogMessages.load(std::memory_order_relaxed);
+}
+
+void AsyncLogger::createLogMessageHeader(const char* file,
+                                         const int line,
+                                         const char* function,
+                                         LogLevel logLevel) noexcept
+{
+    /// @todo iox-#1345 add an option to also print file, line and function
+    static_cast<void>(file);
+    static_cast<void>(line);
+    static_cast<void>(function);
+
+    // only the raw timestamp is taken here; the conversion to the local time is done by the background thread
+    auto& data = getThreadLocalRing();
+    data.timestamp = currentTimestamp();
+    data.logLevel = logLevel;
+    assumeFlushed();
+}
+
+void AsyncLogger::flush() noexcept
+{
+    auto& data = getThreadLocalRing();
+    if (data.logger != this
+        || (data.ring == nullptr && std::chrono::steady_clock::now() >= data.nextRingAcquisition))
+    {
+        registerThreadLocalRing(data);
+    }
+
+    if (data.ring == nullptr && data.logLevel != LogLevel::FATAL)
+    {
+        m_droppedLogMessages.fetch_add(1U, std::memory_order_relaxed);
+        assumeFlushed();
+        return;
+    }
+
+    const auto logBuffer = getLogBuffer();
+    Record record;
+    record.timestamp = data.timestamp;
+    record.logLevel = data.logLevel;
+    record.messageSize =
+        (logBuffer.writeIndex < MAX_MESSAGE_SIZE) ? static_cast<uint32_t>(logBuffer.writeIndex) : MAX_MESSAGE_SIZE;
+    memcpy(&record.message[0], logBuffer.buffer, record.messageSize);
+    // NOLINTJUSTIFICATION messageSize is limited to MAX_MESSAGE_SIZE and the array has space for the null termination
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+    record.message[record.messageSize] = 0;
+
+    if (record.logLevel == LogLevel::FATAL)
+    {
+        printFatalLogMessage(data.ring, record);
+    }
+    else if (!data.ring->records.push(record))
+    {
+        m_droppedLogMessages.fetch_add(1U, std::memory_order_relaxed);
+    }
+    assumeFlushed();
+}
+
+void AsyncLogger::printFatalLogMessage(const Ring* ring, const Record& record) noexcept
+{
+    // the previous log messages of this thread are printed first unless the background thread does not catch up
+    if (ring != nullptr)
+    {
+        auto flushDeadline = std::chrono::steady_clock::now() + FLUSH_TIMEOUT;
+        while (!ring->records.empty() && m_keepRunning.load(std::memory_order_relaxed)
+               && std::chrono::steady_clock::now() < flushDeadline)
+        {
+            std::this_thread::yield();
+        }
+    }
+    print(record);
+}
+
+AsyncLogger::Ring* AsyncLogger::acquireRing() noexcept
+{
+    for (auto& ring : m_rings)
+    {
+        auto expected = RingState::FREE;
+        if (ring.state.compare_exchange_strong(expected, RingState::IN_USE, std::memory_order_acq_rel))
+        {
+            return &ring;
+        }
+    }
+    return nullptr;
+}
+
+void AsyncLogger::run() noexcept
+{
+    while (m_keepRunning.load(std::memory_order_relaxed))
+    {
+        if (!printPendingRecords())
+        {
+            printDroppedLogMessages();
+            std::this_thread::sleep_for(IDLE_PERIOD);
+        }
+    }
+
+    // the logging threads might still be active; the flush is therefore bounded to not block the shutdown
+    auto flushDeadline = std::chrono::steady_clock::now() + FLUSH_TIMEOUT;
+    while (printPendingRecords() && std::chrono::steady_clock::now() < flushDeadline)
+    {
+    }
+    printDroppedLogMessages();
+}
+
+bool AsyncLogger::printPendingRecords() noexcept
+{
+    bool hasPrinted{false};
+    for (auto& ring : m_rings)
+    {
+        auto state = ring.state.load(std::memory_order_acquire);
+        if (state == RingState::FREE)
+        {
+            continue;
+        }
+
+        // a ring contains at most RING_CAPACITY records per round to not starve the other rings
+        for (uint64_t i = 0U; i < RING_CAPACITY; ++i)
+        {
+            auto record = ring.records.pop();
+            if (!record.has_value())
+            {
+                break;
+            }
+            print(record.value());
+            hasPrinted = true;
+        }
+
+        // the thread which owned the ring has terminated and cannot push anymore
+        if (state == RingState::RELEASED && ring.records.empty())
+        {
+            ring.state.store(RingState::FREE, std::memory_order_release);
+        }
+    }
+    return hasPrinted;
+}
+
+void AsyncLogger::printDroppedLogMessages() noexcept
+{
+    auto droppedLogMessages = m_droppedLogMessages.load(std::memory_order_relaxed);
+    if (droppedLogMessages == m_reportedDroppedLogMessages)
+    {
+        return;
+    }
+
+    Record record;
+    record.timestamp = currentTimestamp();
+    record.logLevel = LogLevel::WARN;
+    // NOLINTJUSTIFICATION snprintf required to populate char array; array bounds are taken into account
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+    auto retVal = snprintf(&record.message[0],
+                           MAX_MESSAGE_SIZE + 1U,
+                           "%llu log messages were dropped by the AsyncLogger",
+                           static_cast<unsigned long long>(droppedLogMessages - m_reportedDroppedLogMessages));
+    record.messageSize = (retVal < 0) ? 0U : static_cast<uint32_t>(retVal);
+    m_reportedDroppedLogMessages = droppedLogMessages;
+    print(record);
+}
+
+void AsyncLogger::print(const Record& record) noexcept
+{
+    constexpr uint32_t HEADER_SIZE{128U};
+    constexpr uint32_t NULL_TERMINATED_OUTPUT_SIZE{HEADER_SIZE + MAX_MESSAGE_SIZE + 1U};
+    // NOLINTJUSTIFICATION required for formatting the output in one piece; array bounds are taken into account
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    char logMessage[NULL_TERMINATED_OUTPUT_SIZE];
+
+    auto headerSize = formatLogMessageHeader(&logMessage[0], HEADER_SIZE, record.timestamp, record.logLevel);
+    // NOLINTJUSTIFICATION the header is at most HEADER_SIZE - 1 characters and the message fits into the remainder
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+    memcpy(&logMessage[headerSize], &record.message[0], record.messageSize + 1U);
+
+    output(&logMessage[0]);
+}
+
+void AsyncLogger::output(const char* logMessage) noexcept
+{
+    if (std::puts(logMessage) < 0)
+    {
+        /// @todo iox-#1345 printing to the console failed; call the error handler after the error handler refactoring
+        /// was merged
+    }
+}
+
+} // namespace log
+} // namespace iox
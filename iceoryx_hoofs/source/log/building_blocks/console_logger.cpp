@@ -47,10 +47,7 @@ void ConsoleLogger::setLogLevel(const LogLevel logLevel) noexcept
     m_activeLogLevel.store(logLevel, std::memory_order_relaxed);
 }
 
-void ConsoleLogger::createLogMessageHeader(const char* file,
-                                           const int line,
-                                           const char* function,
-                                           LogLevel logLevel) noexcept
+timespec ConsoleLogger::currentTimestamp() noexcept
 {
     timespec timestamp{0, 0};
     if (clock_gettime(CLOCK_REALTIME, &timestamp) != 0)
@@ -58,7 +55,32 @@ void ConsoleLogger::createLogMessageHeader(const char* file,
         timestamp = {0, 0};
         // intentionally do nothing since a timestamp from 01.01.1970 already indicates  an issue with the clock
     }
+    return timestamp;
+}
+
+void ConsoleLogger::createLogMessageHeader(const char* file,
+                                           const int line,
+                                           const char* function,
+                                           LogLevel logLevel) noexcept
+{
+    /// @todo iox-#1345 do we also want to always log the iceoryx version and commit sha? Maybe do that only in
+    /// `initLogger` with LogDebug
+
+    /// @todo iox-#1345 add an option to also print file, line and function
+    unused(file);
+    unused(line);
+    unused(function);
 
+    auto& data = getThreadLocalData();
+    data.bufferWriteIndex = formatLogMessageHeader(
+        &data.buffer[0], ThreadLocalData::NULL_TERMINATED_BUFFER_SIZE, currentTimestamp(), logLevel);
+}
+
+uint32_t ConsoleLogger::formatLogMessageHeader(char* buffer,
+                                               const uint32_t nullTerminatedBufferSize,
+                                               const timespec& timestamp,
+                                               const LogLevel logLevel) noexcept
+{
     time_t time = timestamp.tv_sec;
 
 /// @todo iox-#1345 since this will be part of the platform at one point, we might not be able to handle this via the
@@ -103,20 +125,12 @@ void ConsoleLogger::createLogMessageHeader(const char* file,
     constexpr auto MILLISECS_PER_SECOND{1000};
     auto milliseconds = static_cast<int32_t>(timestamp.tv_nsec % MILLISECS_PER_SECOND);
 
-    /// @todo iox-#1345 do we also want to always log the iceoryx version and commit sha? Maybe do that only in
-    /// `initLogger` with LogDebug
-
-    /// @todo iox-#1345 add an option to also print file, line and function
-    unused(file);
-    unused(line);
-    unused(function);
-
     constexpr const char* COLOR_GRAY{"\033[0;90m"};
     constexpr const char* COLOR_RESET{"\033[m"};
     // NOLINTJUSTIFICATION snprintf required to populate char array so that it can be flushed in one piece
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
-    auto retVal = snprintf(&getThreadLocalData().buffer[0],
-                           ThreadLocalData::NULL_TERMINATED_BUFFER_SIZE,
+    auto retVal = snprintf(buffer,
+                           nullTerminatedBufferSize,
                            "%s%s.%03d %s%s%s: ",
                            COLOR_GRAY,
                            &timestampString[0],
@@ -129,22 +143,19 @@ void ConsoleLogger::createLogMessageHeader(const char* file,
         /// @todo iox-#1345 this path should never be reached since we ensured the correct encoding of the character
         /// conversion specifier; nevertheless, we might want to call the error handler after the error handler
         /// refactoring was merged
+        return 0U;
     }
-    else
+
+    auto stringSizeToLog = static_cast<uint32_t>(retVal);
+    if (stringSizeToLog < nullTerminatedBufferSize)
     {
-        auto stringSizeToLog = static_cast<uint32_t>(retVal);
-        if (stringSizeToLog <= ThreadLocalData::BUFFER_SIZE)
-        {
-            getThreadLocalData().bufferWriteIndex = stringSizeToLog;
-        }
-        else
-        {
-            /// @todo iox-#1345 currently the buffer is large enough that this does not happen but once the file or
-            /// function will also be printed, they might be too long to fit into the buffer and will be truncated; once
-            /// that feature is implemented, we need to take care of it
-            getThreadLocalData().bufferWriteIndex = ThreadLocalData::BUFFER_SIZE;
-        }
+        return stringSizeToLog;
     }
+
+    /// @todo iox-#1345 currently the buffer is large enough that this does not happen but once the file or
+    /// function will also be printed, they might be too long to fit into the buffer and will be truncated; once
+    /// that feature is implemented, we need to take care of it
+    return nullTerminatedBufferSize - 1U;
 }
 
 void ConsoleLogger::flush() noexcept
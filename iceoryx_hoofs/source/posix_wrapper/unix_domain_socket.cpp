@@ -228,15 +228,10 @@ cxx::expected<IpcChannelError> UnixDomainSocket::timedSend(const std::string& ms
         return cxx::error<IpcChannelError>(IpcChannelError::INTERNAL_LOGIC_ERROR);
     }
 
-    auto tv = timeout.timeval();
-    auto setsockoptCall = posixCall(iox_setsockopt)(m_sockfd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv))
-                              .failureReturnValue(ERROR_CODE)
-                              .ignoreErrnos(EWOULDBLOCK)
-                              .evaluate();
-
-    if (setsockoptCall.has_error())
+    auto setTimeoutResult = setTimeout(SO_SNDTIMEO, timeout);
+    if (setTimeoutResult.has_error())
     {
-        return cxx::error<IpcChannelError>(convertErrnoToIpcChannelError(setsockoptCall.get_error().errnum));
+        return setTimeoutResult;
     }
     auto sendCall = posixCall(iox_sendto)(m_sockfd, msg.c_str(), msg.size() + NULL_TERMINATOR_SIZE, 0, nullptr, 0)
                         .failureReturnValue(ERROR_CODE)
@@ -269,15 +264,10 @@ UnixDomainSocket::timedReceive(const units::Duration& timeout) const noexcept
         return cxx::error<IpcChannelError>(IpcChannelError::INTERNAL_LOGIC_ERROR);
     }
 
-    auto tv = timeout.timeval();
-    auto setsockoptCall = posixCall(iox_setsockopt)(m_sockfd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv))
-                              .failureReturnValue(ERROR_CODE)
-                              .ignoreErrnos(EWOULDBLOCK)
-                              .evaluate();
-
-    if (setsockoptCall.has_error())
+    auto setTimeoutResult = setTimeout(SO_RCVTIMEO, timeout);
+    if (setTimeoutResult.has_error())
     {
-        return cxx::error<IpcChannelError>(convertErrnoToIpcChannelError(setsockoptCall.get_error().errnum));
+        return cxx::error<IpcChannelError>(setTimeoutResult.get_error());
     }
     // NOLINTJUSTIFICATION needed for recvfrom
     // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
@@ -296,6 +286,83 @@ UnixDomainSocket::timedReceive(const units::Duration& timeout) const noexcept
     return cxx::success<std::string>(message);
 }
 
+cxx::expected<IpcChannelError> UnixDomainSocket::timedSend(const iovec* ioVector,
+                                                           const uint32_t ioVectorSize,
+                                                           const units::Duration& timeout) const noexcept
+{
+    if (IpcChannelSide::SERVER == m_channelSide)
+    {
+        std::cerr << "sending on server side not supported for unix domain socket \"" << m_name << "\"" << std::endl;
+        return cxx::error<IpcChannelError>(IpcChannelError::INTERNAL_LOGIC_ERROR);
+    }
+
+    auto setTimeoutResult = setTimeout(SO_SNDTIMEO, timeout);
+    if (setTimeoutResult.has_error())
+    {
+        return setTimeoutResult;
+    }
+
+    msghdr message{};
+    // NOLINTJUSTIFICATION the I/O vector is only read by sendmsg, msghdr lacks the const qualifier for historic reasons
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    message.msg_iov = const_cast<iovec*>(ioVector);
+    message.msg_iovlen = static_cast<decltype(message.msg_iovlen)>(ioVectorSize);
+
+    auto sendCall = posixCall(iox_sendmsg)(m_sockfd, &message, 0)
+                        .failureReturnValue(ERROR_CODE)
+                        .suppressErrorMessagesForErrnos(EAGAIN, EWOULDBLOCK, ECONNREFUSED, ENOENT)
+                        .evaluate();
+
+    if (sendCall.has_error())
+    {
+        return cxx::error<IpcChannelError>(convertErrnoToIpcChannelError(sendCall.get_error().errnum));
+    }
+    return cxx::success<void>();
+}
+
+cxx::expected<uint64_t, IpcChannelError>
+UnixDomainSocket::timedReceive(void* buffer, const uint64_t bufferSize, const units::Duration& timeout) const noexcept
+{
+    if (IpcChannelSide::CLIENT == m_channelSide)
+    {
+        std::cerr << "receiving on client side not supported for unix domain socket \"" << m_name << "\"" << std::endl;
+        return cxx::error<IpcChannelError>(IpcChannelError::INTERNAL_LOGIC_ERROR);
+    }
+
+    auto setTimeoutResult = setTimeout(SO_RCVTIMEO, timeout);
+    if (setTimeoutResult.has_error())
+    {
+        return cxx::error<IpcChannelError>(setTimeoutResult.get_error());
+    }
+
+    auto recvCall = posixCall(iox_recvfrom)(m_sockfd, buffer, bufferSize, 0, nullptr, nullptr)
+                        .failureReturnValue(ERROR_CODE)
+                        .suppressErrorMessagesForErrnos(EAGAIN, EWOULDBLOCK)
+                        .evaluate();
+
+    if (recvCall.has_error())
+    {
+        return cxx::error<IpcChannelError>(convertErrnoToIpcChannelError(recvCall.get_error().errnum));
+    }
+    return cxx::success<uint64_t>(static_cast<uint64_t>(recvCall->value));
+}
+
+cxx::expected<IpcChannelError> UnixDomainSocket::setTimeout(const int32_t option,
+                                                            const units::Duration& timeout) const noexcept
+{
+    auto tv = timeout.timeval();
+    auto setsockoptCall = posixCall(iox_setsockopt)(m_sockfd, SOL_SOCKET, option, &tv, sizeof(tv))
+                              .failureReturnValue(ERROR_CODE)
+                              .ignoreErrnos(EWOULDBLOCK)
+                              .evaluate();
+
+    if (setsockoptCall.has_error())
+    {
+        return cxx::error<IpcChannelError>(convertErrnoToIpcChannelError(setsockoptCall.get_error().errnum));
+    }
+    return cxx::success<void>();
+}
+
 cxx::expected<IpcChannelError> UnixDomainSocket::initalizeSocket() noexcept
 {
     // initialize the sockAddr data structure with the provided name
@@ -478,6 +545,11 @@ IpcChannelError UnixDomainSocket::convertErrnoToIpcChannelError(const int32_t er
         // no error message needed since this is a normal use case
         return IpcChannelError::NO_SUCH_CHANNEL;
     }
+    case EMSGSIZE:
+    {
+        std::cerr << "message too long for unix domain socket \"" << m_name << "\"" << std::endl;
+        return IpcChannelError::MESSAGE_TOO_LONG;
+    }
     case ECONNRESET:
     {
         std::cerr << "connection was reset by peer for \"" << m_name << "\"" << std::endl;
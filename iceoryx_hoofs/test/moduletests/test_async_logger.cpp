@@ -0,0 +1,262 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/log/building_blocks/async_logger.hpp"
+#include "iceoryx_hoofs/testing/barrier.hpp"
+
+#include "test.hpp"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using iox::log::AsyncLogger;
+using iox::log::LogLevel;
+
+class LoggerSUT : public AsyncLogger
+{
+  public:
+    LoggerSUT() noexcept = default;
+
+    ~LoggerSUT() override
+    {
+        AsyncLogger::stop();
+    }
+
+    LoggerSUT(const LoggerSUT&) = delete;
+    LoggerSUT(LoggerSUT&&) = delete;
+    LoggerSUT& operator=(const LoggerSUT&) = delete;
+    LoggerSUT& operator=(LoggerSUT&&) = delete;
+
+    void log(const LogLevel logLevel, const std::string& message) noexcept
+    {
+        createLogMessageHeader("file", 42, "function", logLevel);
+        logString(message.c_str());
+        flush();
+    }
+
+    using AsyncLogger::stop;
+
+    std::vector<std::string> logMessages() noexcept
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_logMessages;
+    }
+
+  private:
+    void output(const char* logMessage) noexcept override
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_logMessages.emplace_back(logMessage);
+    }
+
+    std::mutex m_mutex;
+    std::vector<std::string> m_logMessages;
+};
+
+TEST(AsyncLogger_test, LogMessagesOfOneThreadArePrintedInOrderWithHeader)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6e45e316-1f53-4355-adf0-392cc70cee3e");
+    LoggerSUT sut;
+
+    for (uint64_t i = 0U; i < AsyncLogger::RING_CAPACITY; ++i)
+    {
+        sut.log(LogLevel::WARN, "hypnotoad " + std::to_string(i));
+    }
+    sut.stop();
+
+    auto logMessages = sut.logMessages();
+    ASSERT_THAT(logMessages.size(), Eq(AsyncLogger::RING_CAPACITY));
+    for (uint64_t i = 0U; i < AsyncLogger::RING_CAPACITY; ++i)
+    {
+        EXPECT_THAT(logMessages[i], HasSubstr(iox::log::logLevelDisplayText(LogLevel::WARN)));
+        EXPECT_THAT(logMessages[i], EndsWith("hypnotoad " + std::to_string(i)));
+    }
+    EXPECT_THAT(sut.numberOfDroppedLogMessages(), Eq(0U));
+}
+
+TEST(AsyncLogger_test, StopPrintsPendingLogMessages)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e24f58c8-7c35-4753-8e4f-bf28e75a22b5");
+    LoggerSUT sut;
+
+    sut.log(LogLevel::ERROR, "all glory to the hypnotoad");
+    sut.stop();
+
+    auto logMessages = sut.logMessages();
+    ASSERT_THAT(logMessages.size(), Eq(1U));
+    EXPECT_THAT(logMessages[0], EndsWith("all glory to the hypnotoad"));
+}
+
+TEST(AsyncLogger_test, TooLongLogMessageIsTruncated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6f399cab-a762-41df-b3d4-65cd6e0779fd");
+    LoggerSUT sut;
+
+    const std::string message(AsyncLogger::MAX_MESSAGE_SIZE + 100U, 'x');
+    sut.log(LogLevel::INFO, message);
+    sut.stop();
+
+    auto logMessages = sut.logMessages();
+    ASSERT_THAT(logMessages.size(), Eq(1U));
+    EXPECT_THAT(logMessages[0], EndsWith(std::string(AsyncLogger::MAX_MESSAGE_SIZE, 'x')));
+    EXPECT_THAT(logMessages[0], Not(HasSubstr(std::string(AsyncLogger::MAX_MESSAGE_SIZE + 1U, 'x'))));
+}
+
+TEST(AsyncLogger_test, FatalLogMessageIsPrintedAfterThePreviousLogMessagesBeforeLoggingReturns)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dbb5507f-b6cb-4ba0-b8e1-14682e4b1182");
+    LoggerSUT sut;
+
+    sut.log(LogLevel::INFO, "hypnotoad");
+    sut.log(LogLevel::FATAL, "all glory to the hypnotoad");
+
+    // a fatal error is usually followed by terminate, therefore nothing else is waited for
+    auto logMessages = sut.logMessages();
+    ASSERT_THAT(logMessages.size(), Eq(2U));
+    EXPECT_THAT(logMessages[0], EndsWith("hypnotoad"));
+    EXPECT_THAT(logMessages[1], HasSubstr(iox::log::logLevelDisplayText(LogLevel::FATAL)));
+    EXPECT_THAT(logMessages[1], EndsWith("all glory to the hypnotoad"));
+}
+
+TEST(AsyncLogger_test, LoggingFromMoreThreadsThanRingsDropsAndReportsLogMessages)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "23236024-b715-460e-ba2a-af5adda6d93a");
+    constexpr uint32_t NUMBER_OF_THREADS{AsyncLogger::MAX_NUMBER_OF_LOGGING_THREADS + 1U};
+    LoggerSUT sut;
+
+    // all threads keep their ring until every thread has logged; therefore exactly one thread does not get a ring
+    Barrier allThreadsLogged{NUMBER_OF_THREADS};
+    Barrier releaseThreads{1U};
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0U; i < NUMBER_OF_THREADS; ++i)
+    {
+        threads.emplace_back([&] {
+            sut.log(LogLevel::INFO, "hypnotoad");
+            allThreadsLogged.notify();
+            releaseThreads.wait();
+        });
+    }
+    allThreadsLogged.wait();
+    releaseThreads.notify();
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    sut.stop();
+
+    EXPECT_THAT(sut.numberOfDroppedLogMessages(), Eq(1U));
+    auto logMessages = sut.logMessages();
+    ASSERT_THAT(logMessages.size(), Eq(AsyncLogger::MAX_NUMBER_OF_LOGGING_THREADS + 1U));
+    uint32_t numberOfDropReports{0U};
+    for (const auto& logMessage : logMessages)
+    {
+        if (logMessage.find("1 log messages were dropped") != std::string::npos)
+        {
+            ++numberOfDropReports;
+        }
+    }
+    EXPECT_THAT(numberOfDropReports, Eq(1U));
+}
+
+TEST(AsyncLogger_test, ThreadWithoutRingAcquiresARingWhichWasFreedInTheMeantime)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "287ddf1f-8e43-42ed-9514-dd80087c3cae");
+    constexpr uint32_t NUMBER_OF_THREADS{AsyncLogger::MAX_NUMBER_OF_LOGGING_THREADS};
+    LoggerSUT sut;
+
+    Barrier allThreadsLogged{NUMBER_OF_THREADS};
+    Barrier releaseThreads{1U};
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0U; i < NUMBER_OF_THREADS; ++i)
+    {
+        threads.emplace_back([&] {
+            sut.log(LogLevel::INFO, "hypnotoad");
+            allThreadsLogged.notify();
+            releaseThreads.wait();
+        });
+    }
+    allThreadsLogged.wait();
+
+    // all rings are in use
+    sut.log(LogLevel::INFO, "dropped hypnotoad");
+    EXPECT_THAT(sut.numberOfDroppedLogMessages(), Eq(1U));
+
+    releaseThreads.notify();
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    // the background thread frees the rings of the terminated threads after it printed their log messages
+    std::this_thread::sleep_for(AsyncLogger::IDLE_PERIOD * 10);
+
+    sut.log(LogLevel::INFO, "all glory to the hypnotoad");
+    sut.stop();
+
+    EXPECT_THAT(sut.numberOfDroppedLogMessages(), Eq(1U));
+    auto logMessages = sut.logMessages();
+    ASSERT_THAT(logMessages.empty(), Eq(false));
+    EXPECT_THAT(logMessages.back(), EndsWith("all glory to the hypnotoad"));
+}
+
+TEST(AsyncLogger_test, ThreadWhichLoggedWithADestroyedLoggerAcquiresANewRing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "704fcd26-90de-470b-a956-c485da172ff4");
+    // the second logger is created in the memory of the first one; a ring which was not unregistered when the first
+    // logger was destroyed would therefore still look valid
+    using Storage = std::aligned_storage<sizeof(LoggerSUT), alignof(LoggerSUT)>::type;
+    std::unique_ptr<Storage> storage(new Storage);
+    auto* destroyedLogger = new (storage.get()) LoggerSUT;
+    destroyedLogger->log(LogLevel::INFO, "hypnotoad");
+    destroyedLogger->~LoggerSUT();
+
+    auto& sut = *new (storage.get()) LoggerSUT;
+    sut.log(LogLevel::INFO, "all glory to the hypnotoad");
+
+    // this thread holds a ring, therefore one of the other threads does not get one
+    constexpr uint32_t NUMBER_OF_THREADS{AsyncLogger::MAX_NUMBER_OF_LOGGING_THREADS};
+    Barrier allThreadsLogged{NUMBER_OF_THREADS};
+    Barrier releaseThreads{1U};
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0U; i < NUMBER_OF_THREADS; ++i)
+    {
+        threads.emplace_back([&] {
+            sut.log(LogLevel::INFO, "hypnotoad");
+            allThreadsLogged.notify();
+            releaseThreads.wait();
+        });
+    }
+    allThreadsLogged.wait();
+    releaseThreads.notify();
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    sut.stop();
+
+    EXPECT_THAT(sut.numberOfDroppedLogMessages(), Eq(1U));
+    auto logMessages = sut.logMessages();
+    ASSERT_THAT(logMessages.empty(), Eq(false));
+    EXPECT_THAT(logMessages[0], EndsWith("all glory to the hypnotoad"));
+    sut.~LoggerSUT();
+}
+
+} // namespace
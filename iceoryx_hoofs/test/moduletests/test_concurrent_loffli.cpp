@@ -219,4 +219,91 @@ TYPED_TEST(LoFFLi_test, PushToUninitializedLoFFLi)
     decltype(this->m_loffli) loFFLi;
     EXPECT_THAT(loFFLi.push(0), Eq(false));
 }
+TYPED_TEST(LoFFLi_test, PopNAcquiresRequestedNumberOfIndices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "357d3e13-0f24-414a-9852-4eedb0bccc75");
+    constexpr uint32_t NUMBER_OF_INDICES{Size - 1U};
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) needed for LoFFLi::popN
+    uint32_t indices[Size]{0};
+
+    EXPECT_THAT(this->m_loffli.popN(&indices[0], NUMBER_OF_INDICES), Eq(NUMBER_OF_INDICES));
+
+    for (uint32_t i = 0; i < NUMBER_OF_INDICES; i++)
+    {
+        EXPECT_THAT(indices[i], Eq(i));
+    }
+    uint32_t index{0};
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(true));
+    EXPECT_THAT(index, Eq(Size - 1U));
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(false));
+}
+
+TYPED_TEST(LoFFLi_test, PopNAcquiresOnlyAvailableIndices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1b17527e-2fb3-4af3-86db-548c3865d50d");
+    uint32_t index{0};
+    this->m_loffli.pop(index);
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) needed for LoFFLi::popN
+    uint32_t indices[2U * Size]{0};
+
+    EXPECT_THAT(this->m_loffli.popN(&indices[0], 2U * Size), Eq(Size - 1U));
+    EXPECT_THAT(this->m_loffli.popN(&indices[0], 2U * Size), Eq(0U));
+}
+
+TYPED_TEST(LoFFLi_test, PopNFromUninitializedLoFFLiFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f83b8f98-cc6c-4f8d-b606-73f09c4c51b0");
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) needed for LoFFLi::popN
+    uint32_t indices[Size]{0};
+
+    decltype(this->m_loffli) loFFLi;
+    EXPECT_THAT(loFFLi.popN(&indices[0], Size), Eq(0U));
+}
+
+TYPED_TEST(LoFFLi_test, PushNReturnsAllIndicesToTheLoFFLi)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7a2bc9b4-7363-471f-97ce-9f9dac2a8b7d");
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) needed for LoFFLi::popN
+    uint32_t indices[Size]{0};
+    ASSERT_THAT(this->m_loffli.popN(&indices[0], Size), Eq(Size));
+    std::reverse(&indices[0], &indices[Size]);
+
+    EXPECT_THAT(this->m_loffli.pushN(&indices[0], Size), Eq(true));
+
+    std::vector<uint32_t> useListPoped;
+    uint32_t index{0};
+    while (this->m_loffli.pop(index))
+    {
+        useListPoped.push_back(index);
+    }
+    EXPECT_THAT(useListPoped, Eq(std::vector<uint32_t>(&indices[0], &indices[Size])));
+}
+
+TYPED_TEST(LoFFLi_test, PushNWithDuplicateIndexFailsButPushesTheValidIndices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1b2056b1-7f01-4e47-9613-ddbb9c9e07b0");
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) needed for LoFFLi::popN
+    uint32_t indices[Size]{0};
+    ASSERT_THAT(this->m_loffli.popN(&indices[0], 2U), Eq(2U));
+    indices[2] = indices[0];
+
+    EXPECT_THAT(this->m_loffli.pushN(&indices[0], 3U), Eq(false));
+
+    uint32_t numberOfFreeIndices{0};
+    uint32_t index{0};
+    while (this->m_loffli.pop(index))
+    {
+        ++numberOfFreeIndices;
+    }
+    EXPECT_THAT(numberOfFreeIndices, Eq(Size));
+}
+
+TYPED_TEST(LoFFLi_test, PushNWithOutOfBoundIndexFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4d6e0f8d-2265-4928-a5da-b6a1f7a71d1e");
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) needed for LoFFLi::pushN
+    uint32_t indices[2]{Size, Size + 42};
+
+    EXPECT_THAT(this->m_loffli.pushN(&indices[0], 2U), Eq(false));
+}
 } // namespace
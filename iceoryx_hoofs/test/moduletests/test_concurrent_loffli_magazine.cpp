@@ -0,0 +1,188 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/concurrent/loffli_magazine.hpp"
+#include "test.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using iox::concurrent::LoFFLi;
+using iox::concurrent::LoFFLiMagazine;
+
+constexpr uint32_t Size{64};
+constexpr uint32_t MagazineCapacity{8};
+
+class LoFFLiMagazine_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        m_loffli.init(&m_memoryLoFFLi[0], Size);
+    }
+
+    std::vector<uint32_t> popAllFromLoFFLi()
+    {
+        std::vector<uint32_t> indices;
+        uint32_t index{0};
+        while (m_loffli.pop(index))
+        {
+            indices.push_back(index);
+        }
+        return indices;
+    }
+
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) needed for LoFFLi::init
+    LoFFLi::Index_t m_memoryLoFFLi[LoFFLi::requiredIndexMemorySize(Size)]{0};
+    LoFFLi m_loffli;
+    LoFFLiMagazine<MagazineCapacity> sut{m_loffli};
+};
+
+TEST_F(LoFFLiMagazine_test, PopFromUnboundMagazineFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ffc29490-1729-44d2-bb37-790a08b30751");
+    LoFFLiMagazine<MagazineCapacity> unboundMagazine;
+    uint32_t index{0};
+
+    EXPECT_FALSE(unboundMagazine.pop(index));
+    EXPECT_FALSE(unboundMagazine.push(index));
+    EXPECT_THAT(unboundMagazine.freeList(), Eq(nullptr));
+}
+
+TEST_F(LoFFLiMagazine_test, PopRefillsMagazineWithHalfOfItsCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "edcf192e-f3f1-42ab-8db8-01c1f99a8b51");
+    uint32_t index{0};
+
+    ASSERT_TRUE(sut.pop(index));
+
+    EXPECT_THAT(sut.size(), Eq(LoFFLiMagazine<MagazineCapacity>::BATCH_SIZE - 1U));
+    EXPECT_THAT(popAllFromLoFFLi().size(), Eq(Size - LoFFLiMagazine<MagazineCapacity>::BATCH_SIZE));
+}
+
+TEST_F(LoFFLiMagazine_test, PopAcquiresEveryIndexOfTheLoFFLiExactlyOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1725742e-c146-4e85-8e95-b4dd589aa847");
+    std::vector<uint32_t> indices;
+    uint32_t index{0};
+    while (sut.pop(index))
+    {
+        indices.push_back(index);
+    }
+
+    ASSERT_THAT(indices.size(), Eq(Size));
+    std::sort(indices.begin(), indices.end());
+    for (uint32_t i = 0; i < Size; ++i)
+    {
+        EXPECT_THAT(indices[i], Eq(i));
+    }
+}
+
+TEST_F(LoFFLiMagazine_test, PushIntoFullMagazineReturnsHalfOfItsCapacityToTheLoFFLi)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "014df874-de35-42f4-960f-cfcc28385673");
+    auto indices = popAllFromLoFFLi();
+
+    for (uint32_t i = 0; i < MagazineCapacity; ++i)
+    {
+        EXPECT_TRUE(sut.push(indices[i]));
+    }
+    EXPECT_THAT(sut.size(), Eq(MagazineCapacity));
+    EXPECT_THAT(popAllFromLoFFLi().size(), Eq(0U));
+
+    EXPECT_TRUE(sut.push(indices[MagazineCapacity]));
+
+    EXPECT_THAT(sut.size(), Eq(MagazineCapacity - LoFFLiMagazine<MagazineCapacity>::BATCH_SIZE + 1U));
+    auto returnedIndices = popAllFromLoFFLi();
+    std::sort(returnedIndices.begin(), returnedIndices.end());
+    constexpr uint32_t BATCH_SIZE{LoFFLiMagazine<MagazineCapacity>::BATCH_SIZE};
+    std::vector<uint32_t> oldestIndices(indices.begin(), indices.begin() + BATCH_SIZE);
+    std::sort(oldestIndices.begin(), oldestIndices.end());
+    EXPECT_THAT(returnedIndices, Eq(oldestIndices));
+}
+
+TEST_F(LoFFLiMagazine_test, PopReturnsMostRecentlyPushedIndex)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "56128149-e013-4be2-a10d-784a1957e69e");
+    uint32_t index{0};
+    ASSERT_TRUE(sut.pop(index));
+    uint32_t otherIndex{0};
+    ASSERT_TRUE(sut.pop(otherIndex));
+
+    EXPECT_TRUE(sut.push(index));
+    uint32_t poppedIndex{0};
+    ASSERT_TRUE(sut.pop(poppedIndex));
+
+    EXPECT_THAT(poppedIndex, Eq(index));
+}
+
+TEST_F(LoFFLiMagazine_test, FlushReturnsAllCachedIndicesToTheLoFFLi)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f12945f8-d98d-41ca-8f44-a761a5ee9277");
+    uint32_t index{0};
+    ASSERT_TRUE(sut.pop(index));
+    EXPECT_TRUE(sut.push(index));
+
+    EXPECT_TRUE(sut.flush());
+
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_THAT(popAllFromLoFFLi().size(), Eq(Size));
+}
+
+TEST_F(LoFFLiMagazine_test, DestructorReturnsAllCachedIndicesToTheLoFFLi)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "55c56a58-3ca8-42a7-b21a-677f5de302c8");
+    {
+        LoFFLiMagazine<MagazineCapacity> magazine{m_loffli};
+        uint32_t index{0};
+        ASSERT_TRUE(magazine.pop(index));
+        EXPECT_TRUE(magazine.push(index));
+    }
+
+    EXPECT_THAT(popAllFromLoFFLi().size(), Eq(Size));
+}
+
+TEST_F(LoFFLiMagazine_test, DoubleFreeIsDetectedWhenIndicesAreReturnedToTheLoFFLi)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9e34fa4c-249e-4421-9c30-28475408591f");
+    uint32_t index{0};
+    ASSERT_TRUE(sut.pop(index));
+    EXPECT_TRUE(sut.push(index));
+    EXPECT_TRUE(sut.push(index));
+
+    EXPECT_FALSE(sut.flush());
+}
+
+TEST_F(LoFFLiMagazine_test, InitFlushesTheCachedIndicesToThePreviousLoFFLi)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "71b2bc1a-df5c-49d9-99fc-781ec8d93510");
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) needed for LoFFLi::init
+    LoFFLi::Index_t memoryOtherLoFFLi[LoFFLi::requiredIndexMemorySize(Size)]{0};
+    LoFFLi otherLoFFLi;
+    otherLoFFLi.init(&memoryOtherLoFFLi[0], Size);
+    uint32_t index{0};
+    ASSERT_TRUE(sut.pop(index));
+
+    EXPECT_TRUE(sut.init(otherLoFFLi));
+
+    EXPECT_THAT(sut.freeList(), Eq(&otherLoFFLi));
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_THAT(popAllFromLoFFLi().size(), Eq(Size - 1U));
+}
+} // namespace
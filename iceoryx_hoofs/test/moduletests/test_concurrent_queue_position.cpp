@@ -0,0 +1,190 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_hoofs/internal/concurrent/fifo.hpp"
+#include "iceoryx_hoofs/internal/concurrent/queue_position.hpp"
+#include "iceoryx_hoofs/internal/concurrent/sofi.hpp"
+#include "test.hpp"
+
+#include <cstdint>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::concurrent;
+
+constexpr bool PADDED{true};
+constexpr bool NOT_PADDED{false};
+
+TEST(QueuePosition_test, PositionWithoutPaddingHasLayoutOfAtomic)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7c074342-d892-4ee5-9fc5-f2fc5bc1440a");
+    EXPECT_THAT(sizeof(QueuePosition<uint64_t, NOT_PADDED>), Eq(sizeof(std::atomic<uint64_t>)));
+    EXPECT_THAT(alignof(QueuePosition<uint64_t, NOT_PADDED>), Eq(alignof(std::atomic<uint64_t>)));
+}
+
+TEST(QueuePosition_test, PositionWithPaddingOccupiesOneCacheLine)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c299fdcb-bb9c-40f6-8dd4-7d197dcc7818");
+    EXPECT_THAT(sizeof(QueuePosition<uint64_t, PADDED>), Eq(CACHE_LINE_SIZE));
+    EXPECT_THAT(alignof(QueuePosition<uint64_t, PADDED>), Eq(CACHE_LINE_SIZE));
+}
+
+TEST(QueuePosition_test, CounterpartWithoutPaddingIsAlwaysTheActualPosition)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1b603e3e-78cc-4a3d-8d42-cfd9dae14401");
+    QueuePosition<uint64_t, NOT_PADDED> sut{0U};
+    QueuePosition<uint64_t, NOT_PADDED> other{0U};
+
+    other.store(73U);
+
+    EXPECT_THAT(sut.observedCounterpart(other, std::memory_order_relaxed), Eq(73U));
+    EXPECT_THAT(sut.refreshCounterpart(other, std::memory_order_relaxed), Eq(73U));
+}
+
+TEST(QueuePosition_test, CounterpartWithPaddingIsCachedUntilRefresh)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f41e25a9-0373-4cf3-a7f7-f12e03fbf4d4");
+    QueuePosition<uint64_t, PADDED> sut{0U};
+    QueuePosition<uint64_t, PADDED> other{0U};
+
+    other.store(73U);
+    EXPECT_THAT(sut.observedCounterpart(other, std::memory_order_relaxed), Eq(0U));
+
+    EXPECT_THAT(sut.refreshCounterpart(other, std::memory_order_relaxed), Eq(73U));
+    other.store(74U);
+    EXPECT_THAT(sut.observedCounterpart(other, std::memory_order_relaxed), Eq(73U));
+    EXPECT_THAT(sut.load(), Eq(0U));
+}
+
+TEST(QueuePosition_test, ResetCounterpartOverwritesTheCache)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f8e580a5-d852-461e-ad52-37529d4a379f");
+    QueuePosition<uint64_t, PADDED> sut{0U};
+    QueuePosition<uint64_t, PADDED> other{42U};
+
+    sut.refreshCounterpart(other, std::memory_order_relaxed);
+    sut.resetCounterpart(0U);
+
+    EXPECT_THAT(sut.observedCounterpart(other, std::memory_order_relaxed), Eq(0U));
+}
+
+TEST(QueuePosition_test, QueuesWithoutPaddingKeepTheirSharedMemoryLayout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b56dd5c8-c5be-4fd5-9499-52fe22cf56ad");
+    constexpr uint64_t CAPACITY{10U};
+    EXPECT_THAT(sizeof(FiFo<uint64_t, CAPACITY, NOT_PADDED>), Eq((CAPACITY + 2U) * sizeof(uint64_t)));
+    // SoFi has one additional internal element and stores its size
+    EXPECT_THAT(sizeof(SoFi<uint64_t, CAPACITY, NOT_PADDED>), Eq((CAPACITY + 1U + 3U) * sizeof(uint64_t)));
+}
+
+TEST(QueuePosition_test, QueuesWithPaddingSeparateTheirPositionsByACacheLine)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5986ade2-c84b-445b-834c-49838cb80123");
+    constexpr uint64_t CAPACITY{10U};
+    // the data is followed by the positions which start at the next cache line
+    constexpr uint64_t FIFO_DATA_SIZE{CAPACITY * sizeof(uint64_t)};
+    constexpr uint64_t SOFI_DATA_SIZE{(CAPACITY + 1U + 1U) * sizeof(uint64_t)};
+    auto cacheLinesOf = [](const uint64_t size) { return (size + CACHE_LINE_SIZE - 1U) / CACHE_LINE_SIZE; };
+
+    EXPECT_THAT(alignof(FiFo<uint64_t, CAPACITY, PADDED>), Eq(CACHE_LINE_SIZE));
+    EXPECT_THAT(sizeof(FiFo<uint64_t, CAPACITY, PADDED>), Eq((cacheLinesOf(FIFO_DATA_SIZE) + 2U) * CACHE_LINE_SIZE));
+    EXPECT_THAT(alignof(SoFi<uint64_t, CAPACITY, PADDED>), Eq(CACHE_LINE_SIZE));
+    EXPECT_THAT(sizeof(SoFi<uint64_t, CAPACITY, PADDED>), Eq((cacheLinesOf(SOFI_DATA_SIZE) + 2U) * CACHE_LINE_SIZE));
+}
+
+template <bool CacheLinePadded>
+void fillAndDrainFiFoRepeatedly()
+{
+    constexpr uint64_t CAPACITY{7U};
+    constexpr uint64_t NUMBER_OF_ROUNDS{5U};
+    FiFo<uint64_t, CAPACITY, CacheLinePadded> sut;
+    uint64_t pushCounter{0U};
+    uint64_t popCounter{0U};
+
+    for (uint64_t round = 0U; round < NUMBER_OF_ROUNDS; ++round)
+    {
+        // pop only some values per round to move the positions across the capacity boundary
+        while (sut.push(pushCounter))
+        {
+            ++pushCounter;
+        }
+        EXPECT_THAT(sut.size(), Eq(CAPACITY));
+        for (uint64_t i = 0U; i <= round % CAPACITY; ++i)
+        {
+            auto value = sut.pop();
+            ASSERT_TRUE(value.has_value());
+            EXPECT_THAT(*value, Eq(popCounter++));
+        }
+    }
+
+    for (auto value = sut.pop(); value.has_value(); value = sut.pop())
+    {
+        EXPECT_THAT(*value, Eq(popCounter++));
+    }
+    EXPECT_THAT(popCounter, Eq(pushCounter));
+    EXPECT_TRUE(sut.empty());
+}
+
+TEST(QueuePosition_test, FiFoDetectsFullAndEmptyWithAndWithoutPadding)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e0769d64-fb9b-4abd-b43e-efe9602af9e9");
+    fillAndDrainFiFoRepeatedly<NOT_PADDED>();
+    fillAndDrainFiFoRepeatedly<PADDED>();
+}
+
+template <bool CacheLinePadded>
+void overflowAndDrainSoFiRepeatedly()
+{
+    constexpr uint64_t CAPACITY{5U};
+    constexpr uint64_t NUMBER_OF_PUSHES{3U * CAPACITY};
+    SoFi<uint64_t, CAPACITY, CacheLinePadded> sut;
+
+    uint64_t expectedOverflowValue{0U};
+    for (uint64_t i = 0U; i < NUMBER_OF_PUSHES; ++i)
+    {
+        uint64_t overflowValue{0U};
+        if (!sut.push(i, overflowValue))
+        {
+            EXPECT_THAT(overflowValue, Eq(expectedOverflowValue++));
+        }
+    }
+
+    uint64_t value{0U};
+    uint64_t expectedValue{NUMBER_OF_PUSHES - CAPACITY};
+    while (sut.pop(value))
+    {
+        EXPECT_THAT(value, Eq(expectedValue++));
+    }
+    EXPECT_THAT(expectedValue, Eq(NUMBER_OF_PUSHES));
+
+    // after draining the cached positions must not prevent new pushes or report stale data
+    uint64_t overflowValue{0U};
+    EXPECT_TRUE(sut.push(NUMBER_OF_PUSHES, overflowValue));
+    ASSERT_TRUE(sut.pop(value));
+    EXPECT_THAT(value, Eq(NUMBER_OF_PUSHES));
+    EXPECT_FALSE(sut.pop(value));
+}
+
+TEST(QueuePosition_test, SoFiOverflowsAndDrainsWithAndWithoutPadding)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6bdc07b1-dcfb-48de-8664-f44d17a27cfe");
+    overflowAndDrainSoFiRepeatedly<NOT_PADDED>();
+    overflowAndDrainSoFiRepeatedly<PADDED>();
+}
+
+} // namespace
@@ -0,0 +1,152 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/relocatable_pointer/pointer_repository.hpp"
+
+#include "test.hpp"
+
+#include <cstdint>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::rp;
+
+constexpr uint64_t NUMBER_OF_SEGMENTS{50U};
+constexpr uint64_t SEGMENT_SIZE{64U};
+constexpr uint64_t REPOSITORY_CAPACITY{100U};
+
+using Repository = PointerRepository<uint64_t, void*, REPOSITORY_CAPACITY>;
+
+class PointerRepository_test : public Test
+{
+  public:
+    void* address(const uint64_t segment, const uint64_t offset = 0U) noexcept
+    {
+        // NOLINTJUSTIFICATION Used only for test purposes
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        return &memory[segment * SEGMENT_SIZE + offset];
+    }
+
+    Repository sut;
+
+    // NOLINTJUSTIFICATION Used only for test purposes
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays)
+    uint8_t memory[NUMBER_OF_SEGMENTS * SEGMENT_SIZE]{0U};
+};
+
+TEST_F(PointerRepository_test, SearchIdFindsSegmentsRegisteredInAnyOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4cbf5e76-d4aa-4c37-85d5-b2226579ca47");
+    // the ids are registered in reverse order of the addresses to ensure the lookup does not depend on the ids
+    for (uint64_t segment = 0U; segment < NUMBER_OF_SEGMENTS; ++segment)
+    {
+        ASSERT_TRUE(sut.registerPtrWithId(NUMBER_OF_SEGMENTS - segment, address(segment), SEGMENT_SIZE));
+    }
+
+    for (uint64_t segment = 0U; segment < NUMBER_OF_SEGMENTS; ++segment)
+    {
+        EXPECT_THAT(sut.searchId(address(segment)), Eq(NUMBER_OF_SEGMENTS - segment));
+        EXPECT_THAT(sut.searchId(address(segment, SEGMENT_SIZE / 2U)), Eq(NUMBER_OF_SEGMENTS - segment));
+        EXPECT_THAT(sut.searchId(address(segment, SEGMENT_SIZE - 1U)), Eq(NUMBER_OF_SEGMENTS - segment));
+    }
+}
+
+TEST_F(PointerRepository_test, SearchIdReturnsRawPointerIdForPointerOutsideOfAllSegments)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c01424f9-49bc-45a1-8a44-0875ec32bfde");
+    ASSERT_TRUE(sut.registerPtrWithId(1U, address(1U), SEGMENT_SIZE));
+    ASSERT_TRUE(sut.registerPtrWithId(2U, address(3U), SEGMENT_SIZE));
+
+    EXPECT_THAT(sut.searchId(address(0U)), Eq(Repository::RAW_POINTER_BEHAVIOUR_ID));
+    EXPECT_THAT(sut.searchId(address(2U)), Eq(Repository::RAW_POINTER_BEHAVIOUR_ID));
+    EXPECT_THAT(sut.searchId(address(4U)), Eq(Repository::RAW_POINTER_BEHAVIOUR_ID));
+}
+
+TEST_F(PointerRepository_test, SearchIdDoesNotFindSegmentRegisteredWithSizeZero)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "71095522-b146-46e3-a114-274812cd6398");
+    ASSERT_TRUE(sut.registerPtrWithId(1U, address(1U), 0U));
+
+    EXPECT_THAT(sut.searchId(address(1U)), Eq(Repository::RAW_POINTER_BEHAVIOUR_ID));
+}
+
+TEST_F(PointerRepository_test, SearchIdDoesNotReturnCachedSegmentAfterUnregistration)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2817292c-0527-4589-9f41-227201c82451");
+    ASSERT_TRUE(sut.registerPtrWithId(1U, address(1U), SEGMENT_SIZE));
+    ASSERT_THAT(sut.searchId(address(1U)), Eq(1U));
+
+    ASSERT_TRUE(sut.unregisterPtr(1U));
+
+    EXPECT_THAT(sut.searchId(address(1U)), Eq(Repository::RAW_POINTER_BEHAVIOUR_ID));
+}
+
+TEST_F(PointerRepository_test, SearchIdReturnsNewIdAfterSegmentIsRegisteredWithAnotherId)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0ceaceb9-d50a-4426-958e-723ac2b50172");
+    ASSERT_TRUE(sut.registerPtrWithId(1U, address(1U), SEGMENT_SIZE));
+    ASSERT_THAT(sut.searchId(address(1U)), Eq(1U));
+
+    ASSERT_TRUE(sut.unregisterPtr(1U));
+    ASSERT_TRUE(sut.registerPtrWithId(7U, address(1U), SEGMENT_SIZE));
+
+    EXPECT_THAT(sut.searchId(address(1U)), Eq(7U));
+}
+
+TEST_F(PointerRepository_test, SearchIdDoesNotReturnCachedSegmentAfterUnregisterAll)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b2a97403-e4a0-4b48-89da-ebe799b6cdbd");
+    ASSERT_TRUE(sut.registerPtrWithId(1U, address(1U), SEGMENT_SIZE));
+    ASSERT_THAT(sut.searchId(address(1U)), Eq(1U));
+
+    sut.unregisterAll();
+
+    EXPECT_THAT(sut.searchId(address(1U)), Eq(Repository::RAW_POINTER_BEHAVIOUR_ID));
+}
+
+TEST_F(PointerRepository_test, SearchIdReturnsLowestIdForOverlappingSegments)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7301d8c4-51e6-4dd5-a167-9f08a0ee3898");
+    ASSERT_TRUE(sut.registerPtrWithId(5U, address(0U), 4U * SEGMENT_SIZE));
+    ASSERT_TRUE(sut.registerPtrWithId(2U, address(1U), SEGMENT_SIZE));
+    ASSERT_TRUE(sut.registerPtrWithId(9U, address(6U), SEGMENT_SIZE));
+
+    EXPECT_THAT(sut.searchId(address(0U)), Eq(5U));
+    EXPECT_THAT(sut.searchId(address(1U)), Eq(2U));
+    EXPECT_THAT(sut.searchId(address(2U)), Eq(5U));
+    EXPECT_THAT(sut.searchId(address(6U)), Eq(9U));
+    EXPECT_THAT(sut.searchId(address(5U)), Eq(Repository::RAW_POINTER_BEHAVIOUR_ID));
+
+    ASSERT_TRUE(sut.unregisterPtr(5U));
+
+    EXPECT_THAT(sut.searchId(address(0U)), Eq(Repository::RAW_POINTER_BEHAVIOUR_ID));
+    EXPECT_THAT(sut.searchId(address(1U)), Eq(2U));
+    EXPECT_THAT(sut.searchId(address(2U)), Eq(Repository::RAW_POINTER_BEHAVIOUR_ID));
+}
+
+TEST_F(PointerRepository_test, CachedSegmentOfOneRepositoryIsNotUsedByAnotherRepository)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a1022000-5479-42e2-a12b-84ab0b55d079");
+    Repository otherRepository;
+    ASSERT_TRUE(sut.registerPtrWithId(1U, address(1U), SEGMENT_SIZE));
+    ASSERT_TRUE(otherRepository.registerPtrWithId(3U, address(1U), SEGMENT_SIZE));
+
+    EXPECT_THAT(sut.searchId(address(1U)), Eq(1U));
+    EXPECT_THAT(otherRepository.searchId(address(1U)), Eq(3U));
+    EXPECT_THAT(sut.searchId(address(1U)), Eq(1U));
+}
+} // namespace
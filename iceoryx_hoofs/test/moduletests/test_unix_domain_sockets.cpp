@@ -23,8 +23,10 @@
 
 #include "test.hpp"
 
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <cstring>
 #include <thread>
 
 namespace
@@ -397,6 +399,63 @@ TEST_F(UnixDomainSocket_test, UnableToSendTooLongMessageWithTimedSend)
     unableToSendTooLongMessage([&](auto& msg) { return client.timedSend(msg, 1_ms); });
 }
 
+TEST_F(UnixDomainSocket_test, SuccessfulCommunicationOfIoVectorWithTimedSendAndTimedReceive)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b5775352-73af-4dea-a454-acb2f66d393b");
+    const std::string header{"header"};
+    const std::array<uint8_t, 4U> binaryData{0U, 1U, 0U, 255U};
+    const std::string trailer{"trailer"};
+    std::array<iovec, 3U> ioVector;
+    ioVector[0U].iov_base = const_cast<char*>(header.data());
+    ioVector[0U].iov_len = header.size();
+    ioVector[1U].iov_base = const_cast<uint8_t*>(binaryData.data());
+    ioVector[1U].iov_len = binaryData.size();
+    ioVector[2U].iov_base = const_cast<char*>(trailer.data());
+    ioVector[2U].iov_len = trailer.size();
+
+    ASSERT_FALSE(client.timedSend(ioVector.data(), static_cast<uint32_t>(ioVector.size()), 1_ms).has_error());
+
+    std::array<uint8_t, 64U> buffer{};
+    auto receivedSize = server.timedReceive(buffer.data(), buffer.size(), 1_ms);
+    ASSERT_FALSE(receivedSize.has_error());
+    ASSERT_THAT(*receivedSize, Eq(header.size() + binaryData.size() + trailer.size()));
+    EXPECT_THAT(std::memcmp(buffer.data(), header.data(), header.size()), Eq(0));
+    EXPECT_THAT(std::memcmp(&buffer[header.size()], binaryData.data(), binaryData.size()), Eq(0));
+    EXPECT_THAT(std::memcmp(&buffer[header.size() + binaryData.size()], trailer.data(), trailer.size()), Eq(0));
+}
+
+TEST_F(UnixDomainSocket_test, TimedReceiveIntoBufferTruncatesLargerMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "38b60c5b-2ff9-4d80-a84d-dba463402e12");
+    std::string message(128U, 'x');
+    iovec ioVector{const_cast<char*>(message.data()), message.size()};
+    ASSERT_FALSE(client.timedSend(&ioVector, 1U, 1_ms).has_error());
+
+    std::array<uint8_t, 16U> buffer{};
+    auto receivedSize = server.timedReceive(buffer.data(), buffer.size(), 1_ms);
+    ASSERT_FALSE(receivedSize.has_error());
+    EXPECT_THAT(*receivedSize, Eq(buffer.size()));
+}
+
+TEST_F(UnixDomainSocket_test, TimedSendOfIoVectorOnServerLeadsToError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "60360e9b-92dd-472f-99f9-6aadc13b4053");
+    std::string message{"hypnotoad"};
+    iovec ioVector{const_cast<char*>(message.data()), message.size()};
+    auto result = server.timedSend(&ioVector, 1U, 1_ms);
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(IpcChannelError::INTERNAL_LOGIC_ERROR));
+}
+
+TEST_F(UnixDomainSocket_test, TimedReceiveIntoBufferOnClientLeadsToError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "02f53ba8-5238-4997-97d0-c1464f8a2efe");
+    std::array<uint8_t, 16U> buffer{};
+    auto result = client.timedReceive(buffer.data(), buffer.size(), 1_ms);
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(IpcChannelError::INTERNAL_LOGIC_ERROR));
+}
+
 // the current contract of the unix domain socket is that a server can only receive
 // and the client can only send
 void receivingOnClientLeadsToError(const receiveCall_t& receive)
@@ -431,6 +490,23 @@ TIMING_TEST_F(UnixDomainSocket_test, TimedReceiveBlocks, Repeat(5), [&] {
     TIMING_TEST_EXPECT_TRUE(msg.get_error() == IpcChannelError::TIMEOUT);
 })
 
+TEST_F(UnixDomainSocket_test, TimedSendOfIoVectorToFullSocketLeadsToTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "eeba876c-84f7-4632-ab60-d09ed87ef5df");
+    constexpr uint64_t MAX_NUMBER_OF_MESSAGES{100000U};
+    std::string message(1024U, 'x');
+    iovec ioVector{const_cast<char*>(message.data()), message.size()};
+
+    // nobody receives, therefore the socket is eventually full and the sender is blocked until the timeout
+    cxx::expected<IpcChannelError> result = cxx::success<>();
+    for (uint64_t i = 0U; i < MAX_NUMBER_OF_MESSAGES && !result.has_error(); ++i)
+    {
+        result = client.timedSend(&ioVector, 1U, 1_ms);
+    }
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(IpcChannelError::TIMEOUT));
+}
+
 TIMING_TEST_F(UnixDomainSocket_test, TimedReceiveBlocksUntilMessageIsReceived, Repeat(5), [&] {
     ::testing::Test::RecordProperty("TEST_ID", "76df3d40-d420-4c5f-b82a-3bf8b684a21b");
     std::string message = "asdasda";
@@ -0,0 +1,119 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/relocatable_pointer/pointer_repository.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using Repository = iox::rp::PointerRepository<uint64_t, void*>;
+
+constexpr uint64_t SEGMENT_SIZE{1024U * 1024U};
+constexpr uintptr_t FIRST_SEGMENT_ADDRESS{0x100000000U};
+constexpr uint64_t NUMBER_OF_LOOKUPS{10000000U};
+
+/// @brief the addresses are never dereferenced, therefore no memory needs to be mapped for the segments
+void* address(const uint64_t segment, const uint64_t offset) noexcept
+{
+    // NOLINTJUSTIFICATION the lookup only compares addresses
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast, performance-no-int-to-ptr)
+    return reinterpret_cast<void*>(FIRST_SEGMENT_ADDRESS + segment * SEGMENT_SIZE + offset);
+}
+
+/// @brief the lookup as it was done before the interval table, for comparison
+uint64_t searchIdLinear(const std::vector<std::pair<void*, void*>>& segments, void* ptr) noexcept
+{
+    for (uint64_t id = 1U; id < segments.size(); ++id)
+    {
+        if (ptr >= segments[id].first && ptr <= segments[id].second)
+        {
+            return id;
+        }
+    }
+    return 0U;
+}
+
+/// @brief creates pseudo random pointers into the segments, the same sequence is used for all lookup variants
+std::vector<void*> createPointers(const uint64_t numberOfSegments, const bool sameSegment)
+{
+    constexpr uint64_t NUMBER_OF_POINTERS{4096U};
+    std::vector<void*> pointers;
+    pointers.reserve(NUMBER_OF_POINTERS);
+    uint64_t state{42U};
+    for (uint64_t i = 0U; i < NUMBER_OF_POINTERS; ++i)
+    {
+        state = state * 6364136223846793005U + 1442695040888963407U;
+        const uint64_t segment = sameSegment ? numberOfSegments - 1U : (state >> 33U) % numberOfSegments;
+        pointers.push_back(address(segment, (state >> 11U) % SEGMENT_SIZE));
+    }
+    return pointers;
+}
+
+template <typename Lookup>
+double measureNanosecondsPerLookup(const std::vector<void*>& pointers, const Lookup& lookup)
+{
+    uint64_t idSum{0U};
+    const auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0U; i < NUMBER_OF_LOOKUPS; ++i)
+    {
+        idSum += lookup(pointers[i % pointers.size()]);
+    }
+    const auto duration = std::chrono::steady_clock::now() - start;
+
+    // the sum is printed to prevent the compiler from removing the lookups
+    if (idSum == 0U)
+    {
+        std::cerr << "no segment was found" << std::endl;
+    }
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count())
+           / static_cast<double>(NUMBER_OF_LOOKUPS);
+}
+
+int main()
+{
+    std::cout << "lookup time per pointer [ns]" << std::endl;
+    std::cout << std::setw(10) << "segments" << std::setw(16) << "linear" << std::setw(16) << "random segment"
+              << std::setw(16) << "same segment" << std::endl;
+
+    for (const uint64_t numberOfSegments : {1U, 2U, 5U, 10U, 20U, 50U, 100U})
+    {
+        // the repository is too large for the stack
+        auto repository = std::make_unique<Repository>();
+        std::vector<std::pair<void*, void*>> segments(numberOfSegments + 1U, {nullptr, nullptr});
+        for (uint64_t segment = 0U; segment < numberOfSegments; ++segment)
+        {
+            const uint64_t id = segment + 1U;
+            repository->registerPtrWithId(id, address(segment, 0U), SEGMENT_SIZE);
+            segments[id] = {address(segment, 0U), address(segment, SEGMENT_SIZE - 1U)};
+        }
+
+        const auto randomPointers = createPointers(numberOfSegments, false);
+        const auto sameSegmentPointers = createPointers(numberOfSegments, true);
+        auto repositoryLookup = [&](void* ptr) { return repository->searchId(ptr); };
+
+        std::cout << std::setw(10) << numberOfSegments << std::fixed << std::setprecision(2) << std::setw(16)
+                  << measureNanosecondsPerLookup(randomPointers,
+                                                 [&](void* ptr) { return searchIdLinear(segments, ptr); })
+                  << std::setw(16) << measureNanosecondsPerLookup(randomPointers, repositoryLookup) << std::setw(16)
+                  << measureNanosecondsPerLookup(sameSegmentPointers, repositoryLookup) << std::endl;
+    }
+
+    return 0;
+}
@@ -543,6 +543,75 @@ TEST_F(SoFiStress, PushAndPopFromNonOverflowingNonEmptySoFi)
     std::cout << "push & pop counter: " << pushCounter << std::endl;
 }
 
+/// @brief This is a before/after benchmark for the cache line separation of the read and write position.
+///
+/// The pusher continuously pushes consecutive values into a small SoFi and the popper continuously pops. Both run on
+/// different CPUs if possible. The same scenario is performed with a SoFi which uses the shared memory layout without
+/// cache line padding and one with padding and cached positions. The number of popped values is printed for both;
+/// it is not checked since it depends heavily on the machine, only the order of the popped values is verified.
+template <bool CacheLinePadded>
+uint64_t measurePoppedValues(const std::chrono::milliseconds duration,
+                             bool (*setCpuAffinity)(unsigned int, std::thread::native_handle_type))
+{
+    iox::concurrent::SoFi<SoFiData, 16, CacheLinePadded> sofi;
+    std::atomic<bool> stopThreads{false};
+    uint64_t numberOfPoppedValues{0U};
+
+    auto pushThread = std::thread([&] {
+        SoFiData pushCounter{0};
+        while (!stopThreads.load(std::memory_order_relaxed))
+        {
+            SoFiData valOut{INVALID_SOFI_DATA};
+            sofi.push(pushCounter++, valOut);
+        }
+    });
+
+    auto popThread = std::thread([&] {
+        SoFiData lastValue{INVALID_SOFI_DATA};
+        while (!stopThreads.load(std::memory_order_relaxed))
+        {
+            SoFiData valOut{INVALID_SOFI_DATA};
+            if (sofi.pop(valOut))
+            {
+                // values might be lost due to overflow but they must be popped in the order they were pushed
+                EXPECT_THAT(valOut, Gt(lastValue));
+                lastValue = valOut;
+                ++numberOfPoppedValues;
+            }
+        }
+    });
+
+    if (std::thread::hardware_concurrency() > 1)
+    {
+        EXPECT_TRUE(setCpuAffinity(0, pushThread.native_handle())) << "Could not run thread on specified CPU!";
+        EXPECT_TRUE(setCpuAffinity(std::thread::hardware_concurrency() - 1U, popThread.native_handle()))
+            << "Could not run thread on specified CPU!";
+    }
+
+    std::this_thread::sleep_for(duration);
+    stopThreads = true;
+
+    pushThread.join();
+    popThread.join();
+
+    return numberOfPoppedValues;
+}
+
+TEST_F(SoFiStress, BenchmarkPushAndPopWithAndWithoutCacheLinePadding)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "750f9e95-4a26-451f-816b-50e0c0d4cf88");
+    const auto duration = STRESS_TIME / 2;
+
+    const auto poppedWithoutPadding = measurePoppedValues<false>(duration, &SoFiStress::setCpuAffinity);
+    const auto poppedWithPadding = measurePoppedValues<true>(duration, &SoFiStress::setCpuAffinity);
+
+    EXPECT_THAT(poppedWithoutPadding, Gt(0U));
+    EXPECT_THAT(poppedWithPadding, Gt(0U));
+
+    std::cout << "popped values without cache line padding: " << poppedWithoutPadding << std::endl;
+    std::cout << "popped values with cache line padding   : " << poppedWithPadding << std::endl;
+}
+
 int main(int argc, char* argv[])
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,212 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/testing/test.hpp"
+
+#include "iceoryx_hoofs/internal/concurrent/loffli.hpp"
+#include "iceoryx_hoofs/internal/concurrent/loffli_magazine.hpp"
+using namespace ::testing;
+
+#include "iceoryx_hoofs/testing/barrier.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using iox::concurrent::LoFFLi;
+using iox::concurrent::LoFFLiMagazine;
+
+constexpr uint32_t NUMBER_OF_INDICES{4096U};
+constexpr uint32_t MAGAZINE_CAPACITY{16U};
+/// @brief number of indices every thread holds at once, similar to a publisher with a few loaned chunks
+constexpr uint32_t INDICES_PER_ITERATION{4U};
+constexpr std::chrono::milliseconds MEASUREMENT_DURATION{500};
+
+/// @brief Direct access to the LoFFLi without a magazine, used as the baseline
+class DirectAccess
+{
+  public:
+    explicit DirectAccess(LoFFLi& freeList)
+        : m_freeList(freeList)
+    {
+    }
+
+    bool pop(LoFFLi::Index_t& index)
+    {
+        return m_freeList.pop(index);
+    }
+
+    bool push(const LoFFLi::Index_t index)
+    {
+        return m_freeList.push(index);
+    }
+
+  private:
+    LoFFLi& m_freeList;
+};
+
+using MagazineAccess = LoFFLiMagazine<MAGAZINE_CAPACITY>;
+
+struct StressResult
+{
+    uint64_t operations{0U};
+    bool hasOwnershipViolation{false};
+    bool hasRejectedIndex{false};
+};
+
+/// @brief Every thread pops INDICES_PER_ITERATION indices, marks them as owned and returns them afterwards. An index
+/// which is owned by two threads at the same time is reported as ownership violation.
+template <typename Access>
+void popAndPush(LoFFLi& freeList,
+                std::vector<std::atomic<bool>>& isOwned,
+                Barrier& barrier,
+                std::atomic<bool>& keepRunning,
+                StressResult& result)
+{
+    Access access(freeList);
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) fixed size test buffer
+    LoFFLi::Index_t indices[INDICES_PER_ITERATION];
+
+    barrier.notify();
+    barrier.wait();
+
+    while (keepRunning.load(std::memory_order_relaxed))
+    {
+        uint32_t numberOfPoppedIndices{0U};
+        for (; numberOfPoppedIndices < INDICES_PER_ITERATION; ++numberOfPoppedIndices)
+        {
+            if (!access.pop(indices[numberOfPoppedIndices]))
+            {
+                break;
+            }
+            if (isOwned[indices[numberOfPoppedIndices]].exchange(true, std::memory_order_relaxed))
+            {
+                result.hasOwnershipViolation = true;
+            }
+        }
+
+        for (uint32_t i = 0U; i < numberOfPoppedIndices; ++i)
+        {
+            isOwned[indices[i]].store(false, std::memory_order_relaxed);
+            if (!access.push(indices[i]))
+            {
+                result.hasRejectedIndex = true;
+            }
+        }
+
+        result.operations += 2U * numberOfPoppedIndices;
+    }
+}
+
+template <typename Access>
+double runStressTest(const uint32_t numberOfThreads)
+{
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) needed for LoFFLi::init
+    std::unique_ptr<LoFFLi::Index_t[]> memory(new LoFFLi::Index_t[LoFFLi::requiredIndexMemorySize(NUMBER_OF_INDICES)]);
+    LoFFLi freeList;
+    freeList.init(memory.get(), NUMBER_OF_INDICES);
+
+    std::vector<std::atomic<bool>> isOwned(NUMBER_OF_INDICES);
+    for (auto& flag : isOwned)
+    {
+        flag.store(false);
+    }
+
+    Barrier barrier(numberOfThreads + 1U);
+    std::atomic<bool> keepRunning{true};
+    std::vector<StressResult> results(numberOfThreads);
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0U; i < numberOfThreads; ++i)
+    {
+        threads.emplace_back(popAndPush<Access>,
+                             std::ref(freeList),
+                             std::ref(isOwned),
+                             std::ref(barrier),
+                             std::ref(keepRunning),
+                             std::ref(results[i]));
+    }
+
+    barrier.notify();
+    barrier.wait();
+    auto start = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for(MEASUREMENT_DURATION);
+    keepRunning = false;
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    auto duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    uint64_t operations{0U};
+    for (const auto& result : results)
+    {
+        EXPECT_FALSE(result.hasOwnershipViolation);
+        EXPECT_FALSE(result.hasRejectedIndex);
+        operations += result.operations;
+    }
+
+    // all magazines are flushed when the threads terminate, therefore every index must be back in the LoFFLi
+    uint32_t numberOfFreeIndices{0U};
+    LoFFLi::Index_t index{0U};
+    while (freeList.pop(index))
+    {
+        ++numberOfFreeIndices;
+    }
+    EXPECT_THAT(numberOfFreeIndices, Eq(NUMBER_OF_INDICES));
+
+    return static_cast<double>(operations) / duration;
+}
+
+/// @brief powers of two up to the number of hardware threads and the number of hardware threads itself
+std::vector<uint32_t> numberOfThreadsToMeasure()
+{
+    const uint32_t maxNumberOfThreads = std::max(1U, std::thread::hardware_concurrency());
+    std::vector<uint32_t> numberOfThreads;
+    for (uint32_t n = 1U; n < maxNumberOfThreads; n *= 2U)
+    {
+        numberOfThreads.push_back(n);
+    }
+    numberOfThreads.push_back(maxNumberOfThreads);
+    return numberOfThreads;
+}
+
+/// @brief Compares the throughput of pop/push operations with and without a magazine for 1 to N threads, where N is
+/// the number of hardware threads. The result is printed as table; the test fails only on a misbehavior.
+TEST(LoFFLiMagazineStressTest, ThroughputScalesWithNumberOfThreads)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a678232d-cd23-400f-9e6b-9c889dc93edc");
+
+    std::cout << std::setw(10) << "threads" << std::setw(20) << "LoFFLi [Mop/s]" << std::setw(20)
+              << "magazine [Mop/s]" << std::setw(10) << "speedup" << std::endl;
+
+    for (auto numberOfThreads : numberOfThreadsToMeasure())
+    {
+        auto directThroughput = runStressTest<DirectAccess>(numberOfThreads);
+        auto magazineThroughput = runStressTest<MagazineAccess>(numberOfThreads);
+
+        std::cout << std::setw(10) << numberOfThreads << std::setw(20) << std::fixed << std::setprecision(2)
+                  << directThroughput / 1.0e6 << std::setw(20) << magazineThroughput / 1.0e6 << std::setw(10)
+                  << magazineThroughput / directThroughput << std::endl;
+    }
+}
+} // namespace
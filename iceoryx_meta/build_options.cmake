@@ -27,6 +27,8 @@ option(CCACHE "Use ccache when it's available" ON)
 option(COVERAGE "Build iceoryx with gcov flags" OFF)
 option(DOWNLOAD_TOML_LIB "Download cpptoml via the CMake ExternalProject module" ON)
 option(EXAMPLES "Build all iceoryx examples" OFF)
+option(IOX_ASYNC_LOGGER "Print the log messages in a background thread instead of the logging thread" OFF)
+option(IOX_CACHE_LINE_PADDED_QUEUES "Place the positions of the lock-free queues on separate cache lines, changes the shared memory layout" OFF)
 option(INTROSPECTION "Builds the introspection client which requires the ncurses library with an activated terminfo feature" OFF)
 option(ONE_TO_MANY_ONLY "Restricts communication to 1:n pattern" OFF)
 set(IOX_PLATFORM_PATH "" CACHE PATH "Overrides integrated platform detection and uses provided custom path")
@@ -84,6 +86,8 @@ function(show_config_options)
   message("          EXAMPLES.............................: " ${EXAMPLES})
   message("          INTROSPECTION........................: " ${INTROSPECTION})
   message("          ONE_TO_MANY_ONLY ....................: " ${ONE_TO_MANY_ONLY})
+  message("          IOX_ASYNC_LOGGER.....................: " ${IOX_ASYNC_LOGGER})
+  message("          IOX_CACHE_LINE_PADDED_QUEUES.........: " ${IOX_CACHE_LINE_PADDED_QUEUES})
   message("          IOX_PLATFORM_PATH....................: " ${IOX_PLATFORM_PATH})
   message("          ROUDI_ENVIRONMENT....................: " ${ROUDI_ENVIRONMENT} ${ROUDI_ENV_HINT})
   message("          SANITIZE.............................: " ${SANITIZE})
@@ -21,3 +21,9 @@ int iox_open(const char* pathname, int flags, mode_t mode)
 {
     return open(pathname, flags, mode);
 }
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_posix_fallocate(int fd, off_t offset, off_t len)
+{
+    return posix_fallocate(fd, offset, len);
+}
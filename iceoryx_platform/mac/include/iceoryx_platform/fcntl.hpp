@@ -21,4 +21,8 @@
 
 int iox_open(const char* pathname, int flags, mode_t mode);
 
+/// @brief allocates the disk space of a file region, the file is extended if required
+/// @return 0 on success, otherwise the error number; errno is not set
+int iox_posix_fallocate(int fd, off_t offset, off_t len);
+
 #endif // IOX_HOOFS_MAC_PLATFORM_FCNTL_HPP
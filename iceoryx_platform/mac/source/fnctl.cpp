@@ -16,7 +16,41 @@
 
 #include "iceoryx_platform/fcntl.hpp"
 
+#include <cerrno>
+#include <sys/stat.h>
+#include <unistd.h>
+
 int iox_open(const char* pathname, int flags, mode_t mode)
 {
     return open(pathname, flags, mode);
 }
+
+int iox_posix_fallocate(int fd, off_t offset, off_t len)
+{
+    // macOS has no posix_fallocate, the space is preallocated with F_PREALLOCATE and the file is extended afterwards
+    struct stat fileStatus;
+    if (fstat(fd, &fileStatus) == -1)
+    {
+        return errno;
+    }
+    const off_t requiredSize = offset + len;
+    if (requiredSize <= fileStatus.st_size)
+    {
+        return 0;
+    }
+
+    fstore_t store{F_ALLOCATECONTIG | F_ALLOCATEALL, F_PEOFPOSMODE, 0, requiredSize - fileStatus.st_size, 0};
+    if (fcntl(fd, F_PREALLOCATE, &store) == -1)
+    {
+        store.fst_flags = F_ALLOCATEALL;
+        if (fcntl(fd, F_PREALLOCATE, &store) == -1)
+        {
+            return errno;
+        }
+    }
+    if (ftruncate(fd, requiredSize) == -1)
+    {
+        return errno;
+    }
+    return 0;
+}
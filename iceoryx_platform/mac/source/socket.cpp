@@ -63,6 +63,18 @@ iox_sendto(int sockfd, const void* buf, size_t len, int flags, const struct sock
     return sentBytes;
 }
 
+ssize_t iox_sendmsg(int sockfd, const struct msghdr* msg, int flags)
+{
+    auto timeout = getTimeoutOfSocket(sockfd, SO_SNDTIMEO);
+    ssize_t sentBytes = sendmsg(sockfd, msg, flags);
+    if (sentBytes <= 0 && timeout.tv_sec != 0 && timeout.tv_usec != 0)
+    {
+        sleepFor(timeout);
+        return sendmsg(sockfd, msg, flags);
+    }
+    return sentBytes;
+}
+
 ssize_t iox_recvfrom(int sockfd, void* buf, size_t len, int flags, struct sockaddr* src_addr, socklen_t* addrlen)
 {
     auto timeout = getTimeoutOfSocket(sockfd, SO_RCVTIMEO);
@@ -25,6 +25,7 @@ int iox_socket(int domain, int type, int protocol);
 int iox_setsockopt(int sockfd, int level, int optname, const void* optval, socklen_t optlen);
 ssize_t
 iox_sendto(int sockfd, const void* buf, size_t len, int flags, const struct sockaddr* dest_addr, socklen_t addrlen);
+ssize_t iox_sendmsg(int sockfd, const struct msghdr* msg, int flags);
 ssize_t iox_recvfrom(int sockfd, void* buf, size_t len, int flags, struct sockaddr* src_addr, socklen_t* addrlen);
 int iox_connect(int sockfd, const struct sockaddr* addr, socklen_t addrlen);
 int iox_closesocket(int sockfd);
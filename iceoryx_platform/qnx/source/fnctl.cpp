@@ -20,3 +20,8 @@ int iox_open(const char* pathname, int flags, mode_t mode)
 {
     return open(pathname, flags, mode);
 }
+
+int iox_posix_fallocate(int fd, off_t offset, off_t len)
+{
+    return posix_fallocate(fd, offset, len);
+}
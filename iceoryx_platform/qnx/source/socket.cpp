@@ -38,6 +38,11 @@ iox_sendto(int sockfd, const void* buf, size_t len, int flags, const struct sock
     return sendto(sockfd, buf, len, flags, dest_addr, addrlen);
 }
 
+ssize_t iox_sendmsg(int sockfd, const struct msghdr* msg, int flags)
+{
+    return sendmsg(sockfd, msg, flags);
+}
+
 ssize_t iox_recvfrom(int sockfd, void* buf, size_t len, int flags, struct sockaddr* src_addr, socklen_t* addrlen)
 {
     return recvfrom(sockfd, buf, len, flags, src_addr, addrlen);
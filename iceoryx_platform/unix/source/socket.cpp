@@ -42,6 +42,12 @@ iox_sendto(int sockfd, const void* buf, size_t len, int flags, const struct sock
     return sendto(sockfd, buf, len, flags, dest_addr, addrlen);
 }
 
+// NOLINTNEXTLINE(readability-identifier-naming)
+ssize_t iox_sendmsg(int sockfd, const struct msghdr* msg, int flags)
+{
+    return sendmsg(sockfd, msg, flags);
+}
+
 // NOLINTNEXTLINE(readability-identifier-naming,readability-function-size)
 ssize_t iox_recvfrom(int sockfd, void* buf, size_t len, int flags, struct sockaddr* src_addr, socklen_t* addrlen)
 {
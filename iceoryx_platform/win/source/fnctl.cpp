@@ -16,6 +16,7 @@
 
 #include "iceoryx_platform/fcntl.hpp"
 #include "iceoryx_platform/handle_translator.hpp"
+#include "iceoryx_platform/unistd.hpp"
 #include "iceoryx_platform/win32_errorHandling.hpp"
 
 int iox_open(const char* pathname, int flags, mode_t mode)
@@ -39,3 +40,8 @@ int iox_open(const char* pathname, int flags, mode_t mode)
 
     return HandleTranslator::getInstance().add(handle);
 }
+
+int iox_posix_fallocate(int fd, off_t offset, off_t len)
+{
+    return ftruncate(fd, offset + len);
+}
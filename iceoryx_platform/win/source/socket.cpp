@@ -42,6 +42,12 @@ iox_sendto(int sockfd, const void* buf, size_t len, int flags, const struct sock
     return 0;
 }
 
+ssize_t iox_sendmsg(int sockfd, const struct msghdr* msg, int flags)
+{
+    fprintf(stderr, "%s is not implemented in windows!\n", __PRETTY_FUNCTION__);
+    return 0;
+}
+
 ssize_t iox_recvfrom(int sockfd, void* buf, size_t len, int flags, struct sockaddr* src_addr, socklen_t* addrlen)
 {
     fprintf(stderr, "%s is not implemented in windows!\n", __PRETTY_FUNCTION__);
@@ -58,11 +58,14 @@ enum class Interfaces : uint16_t
     MTA,
     /// @brief Robot Operating System 1
     ROS1,
+    /// @brief Another iceoryx domain, i.e. a RouDi with a different unique RouDi ID on the same host
+    ICEORYX,
     /// @brief End of enum
     INTERFACE_END
 };
 
-constexpr const char* INTERFACE_NAMES[] = {"INTERNAL", "ESOC", "SOMEIP", "AMQP", "DDS", "SIGNAL", "MTA", "ROS1", "END"};
+constexpr const char* INTERFACE_NAMES[] = {
+    "INTERNAL", "ESOC", "SOMEIP", "AMQP", "MQTT", "DDS", "SIGNAL", "MTA", "ROS1", "ICEORYX", "END"};
 
 /// @brief Scope of a service description
 enum class Scope : uint16_t
@@ -46,6 +46,8 @@ namespace iox
     error(POSH__RUNTIME_ROUDI_REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE) \
     error(POSH__RUNTIME_ROUDI_REQUEST_SERVER_INVALID_RESPONSE) \
     error(POSH__RUNTIME_ROUDI_REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE) \
+    error(POSH__RUNTIME_ROUDI_REQUEST_PORTS_INVALID_RESPONSE) \
+    error(POSH__RUNTIME_ROUDI_REQUEST_PORTS_WRONG_IPC_MESSAGE_RESPONSE) \
     error(POSH__RUNTIME_ROUDI_REQUEST_CONDITION_VARIABLE_INVALID_RESPONSE) \
     error(POSH__RUNTIME_ROUDI_REQUEST_CONDITION_VARIABLE_WRONG_IPC_MESSAGE_RESPONSE) \
     error(POSH__RUNTIME_ROUDI_GET_MW_INTERFACE_INVALID_RESPONSE) \
@@ -78,6 +80,7 @@ namespace iox
     error(POPO__BASE_SERVER_OVERRIDING_WITH_EVENT_SINCE_HAS_REQUEST_OR_REQUEST_RECEIVED_ALREADY_ATTACHED) \
     error(POPO__BASE_SERVER_OVERRIDING_WITH_STATE_SINCE_HAS_REQUEST_OR_REQUEST_RECEIVED_ALREADY_ATTACHED) \
     error(POPO__CHUNK_QUEUE_POPPER_CHUNK_WITH_INCOMPATIBLE_CHUNK_HEADER_VERSION) \
+    error(POPO__CHUNK_QUEUE_DATA_FAILED_TO_CREATE_SEMAPHORE) \
     error(POPO__CHUNK_DISTRIBUTOR_OVERFLOW_OF_QUEUE_CONTAINER) \
     error(POPO__CHUNK_DISTRIBUTOR_CLEANUP_DEADLOCK_BECAUSE_BAD_APPLICATION_TERMINATION) \
     error(POPO__CHUNK_SENDER_INVALID_CHUNK_TO_FREE_FROM_USER) \
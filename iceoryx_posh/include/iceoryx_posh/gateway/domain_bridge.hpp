@@ -0,0 +1,98 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_GW_DOMAIN_BRIDGE_HPP
+#define IOX_POSH_GW_DOMAIN_BRIDGE_HPP
+
+#include "iceoryx_hoofs/internal/posix_wrapper/ipc_channel.hpp"
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace gw
+{
+/// @brief The name of the unix domain socket which connects the sender and the receiver of a bridge
+using BridgeName_t = IpcChannelName_t;
+
+/// @brief The interface of the bridge gateways if none is specified. Sender and receiver of both directions must use
+/// the same interface, otherwise a received service would be sent back to the domain it came from.
+constexpr capro::Interfaces DEFAULT_BRIDGE_INTERFACE{capro::Interfaces::ICEORYX};
+
+/// @brief The size of the largest message on the socket of a bridge, samples which do not fit into a message together
+/// with the headers are split into SAMPLE_FRAGMENT messages
+constexpr uint64_t MAX_BRIDGE_MESSAGE_SIZE{64U * 1024U};
+
+/// @brief The maximum number of samples which are batched into one message
+constexpr uint32_t MAX_BRIDGE_SAMPLES_PER_MESSAGE{32U};
+
+/// @brief The maximum number of services a sender announces at the same time
+constexpr uint64_t MAX_BRIDGED_SERVICES{MAX_CHANNEL_NUMBER};
+
+enum class BridgeMessageType : uint16_t
+{
+    /// @brief the header is followed by the serialized service description of the service index
+    OFFER = 1U,
+    /// @brief the service index is no longer used
+    STOP_OFFER = 2U,
+    /// @brief the header is followed by samples of the service index, every sample consists of a BridgeSampleHeader,
+    /// the user-header and the user-payload
+    SAMPLES = 3U,
+    /// @brief the header is followed by a BridgeSampleHeader and a part of the user-header and user-payload of a
+    /// sample which does not fit into one message; the fragments of a sample are sent in order and without other
+    /// messages of the same service index in between
+    SAMPLE_FRAGMENT = 4U
+};
+
+/// @brief The header of every message on the socket of a bridge. Every message is a datagram, the parts of a message
+/// are not aligned and are therefore copied out of the message by the receiver.
+struct BridgeMessageHeader
+{
+    /// @brief "IOXB" in little endian byte order
+    static constexpr uint32_t MAGIC{0x42584F49U};
+    /// @brief must be incremented for each incompatible change of the message format
+    static constexpr uint16_t PROTOCOL_VERSION{2U};
+
+    uint32_t magic{MAGIC};
+    uint16_t protocolVersion{PROTOCOL_VERSION};
+    BridgeMessageType type{BridgeMessageType::SAMPLES};
+    /// @brief the index which was assigned to the service by the OFFER message of the sender
+    uint16_t serviceIndex{0U};
+    /// @brief is changed by every OFFER of the sender, the receiver discards samples of a service index which were
+    /// sent before it was assigned to another service
+    uint16_t generation{0U};
+    uint32_t numberOfSamples{0U};
+};
+
+/// @brief Precedes the user-header and the user-payload of every sample in a SAMPLES message
+struct BridgeSampleHeader
+{
+    uint32_t userPayloadSize{0U};
+    uint32_t userPayloadAlignment{0U};
+    uint32_t userHeaderSize{0U};
+    /// @brief the position of a SAMPLE_FRAGMENT in the concatenation of user-header and user-payload, 0 in SAMPLES
+    uint32_t fragmentOffset{0U};
+};
+
+/// @brief The largest part of a sample which is sent with one SAMPLE_FRAGMENT message
+constexpr uint64_t MAX_BRIDGE_FRAGMENT_SIZE{MAX_BRIDGE_MESSAGE_SIZE - sizeof(BridgeMessageHeader)
+                                            - sizeof(BridgeSampleHeader)};
+
+} // namespace gw
+} // namespace iox
+
+#endif // IOX_POSH_GW_DOMAIN_BRIDGE_HPP
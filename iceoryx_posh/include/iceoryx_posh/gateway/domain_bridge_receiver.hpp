@@ -0,0 +1,144 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_GW_DOMAIN_BRIDGE_RECEIVER_HPP
+#define IOX_POSH_GW_DOMAIN_BRIDGE_RECEIVER_HPP
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/unix_domain_socket.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/gateway/channel.hpp"
+#include "iceoryx_posh/gateway/domain_bridge.hpp"
+#include "iceoryx_posh/gateway/gateway_config.hpp"
+#include "iceoryx_posh/gateway/gateway_generic.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+
+#include <array>
+#include <atomic>
+#include <thread>
+
+namespace iox
+{
+namespace gw
+{
+/// @brief The external terminal of a receiver channel, the samples arrive via the socket of the receiver
+struct BridgeReceiverTerminal
+{
+    BridgeReceiverTerminal(const capro::IdString_t&, const capro::IdString_t&, const capro::IdString_t&) noexcept
+    {
+    }
+};
+
+using BridgeReceiverChannel = Channel<popo::UntypedPublisher, BridgeReceiverTerminal>;
+
+/// @brief The gateway of a bridge in the domain the services are sent to. It receives the messages of a
+/// DomainBridgeSender from a unix domain socket and publishes the samples with a publisher per announced service.
+/// Every sample is copied once from the socket into a loaned chunk, the fragments of a large sample are copied into the
+/// same chunk which is published with the last fragment. A receiver which falls behind leaves the messages in the
+/// socket, this blocks the sender until it drops them.
+class DomainBridgeReceiver : public GatewayGeneric<BridgeReceiverChannel>
+{
+  public:
+    /// @brief Creates a receiver and the unix domain socket the sender connects to
+    /// @param[in] bridgeName the name of the unix domain socket
+    /// @param[in] publisherOptions the options of the publishers, e.g. the history capacity
+    /// @param[in] interface the interface of the gateway, it must be the interface of the senders in this domain
+    DomainBridgeReceiver(const BridgeName_t& bridgeName,
+                         const popo::PublisherOptions& publisherOptions = {},
+                         const capro::Interfaces interface = DEFAULT_BRIDGE_INTERFACE) noexcept;
+
+    /// @brief Stops the gateway threads before the socket is closed
+    ~DomainBridgeReceiver() noexcept override;
+
+    DomainBridgeReceiver(const DomainBridgeReceiver&) = delete;
+    DomainBridgeReceiver(DomainBridgeReceiver&&) = delete;
+    DomainBridgeReceiver& operator=(const DomainBridgeReceiver&) = delete;
+    DomainBridgeReceiver& operator=(DomainBridgeReceiver&&) = delete;
+
+    /// @brief Starts the gateway threads and the thread which receives the messages of the sender
+    void runMultithreaded() noexcept override;
+
+    /// @brief Stops the gateway threads and the receive thread
+    void shutdown() noexcept override;
+
+    /// @brief Restricts the bridge to the configured services, without configured services all announced services are
+    /// published. Must be called before the gateway is started.
+    /// @param[in] config the services to publish, e.g. parsed by the TomlGatewayConfigParser
+    void loadConfiguration(const config::GatewayConfig& config) noexcept override;
+
+    /// @brief The channels of a receiver are created by the announcements of the sender, the discovery of this domain
+    /// is not required
+    void discover(const capro::CaproMessage& msg) noexcept override;
+
+    /// @brief The samples are published when they are received, there is nothing to forward periodically
+    void forward(const BridgeReceiverChannel& channel) noexcept override;
+
+    /// @brief Receives one message of the sender and processes it, is called repeatedly by the receive thread
+    /// @param[in] timeout the longest time to wait for a message
+    virtual void receive(const units::Duration& timeout) noexcept;
+
+    /// @brief The number of samples which were received and published
+    /// @return the number of published samples
+    uint64_t numberOfPublishedSamples() const noexcept;
+
+    /// @brief The number of samples which were received but could not be published, e.g. because their service is
+    /// not published in this domain or no chunk could be loaned
+    /// @return the number of dropped samples
+    uint64_t numberOfDroppedSamples() const noexcept;
+
+  private:
+    /// @brief the state of a service index of the sender
+    struct AnnouncedService
+    {
+        cxx::optional<BridgeReceiverChannel> channel;
+        /// @brief the generation of the OFFER, messages of other generations were sent for a previous service
+        uint16_t generation{0U};
+        /// @brief the loaned chunk of a fragmented sample whose fragments are not yet completely received
+        void* fragmentedUserPayload{nullptr};
+        uint64_t receivedFragmentSize{0U};
+    };
+
+    bool isPublished(const capro::ServiceDescription& service) const noexcept;
+    void process(const uint64_t messageSize) noexcept;
+    void offer(const BridgeMessageHeader& messageHeader,
+               const uint8_t* serializedService,
+               const uint64_t size) noexcept;
+    void stopOffer(const uint16_t serviceIndex) noexcept;
+    /// @brief the service of the index if the message was sent for it, i.e. it has the generation of the OFFER
+    cxx::optional<AnnouncedService*> announcedServiceOf(const BridgeMessageHeader& messageHeader) noexcept;
+    void publish(const BridgeMessageHeader& messageHeader, const uint64_t messageSize) noexcept;
+    void publishFragment(const BridgeMessageHeader& messageHeader, const uint64_t messageSize) noexcept;
+    /// @brief releases the chunk of a fragmented sample whose remaining fragments will not arrive
+    void discardFragmentedSample(AnnouncedService& announcedService) noexcept;
+
+    cxx::vector<capro::ServiceDescription, MAX_GATEWAY_SERVICES> m_servicesToPublish;
+    popo::PublisherOptions m_publisherOptions;
+    posix::UnixDomainSocket m_socket;
+    /// the announced services, the position is the service index; only used by the receive thread
+    cxx::vector<AnnouncedService, MAX_BRIDGED_SERVICES> m_announcedServices;
+    std::array<uint8_t, MAX_BRIDGE_MESSAGE_SIZE> m_receiveBuffer;
+    std::thread m_receiveThread;
+
+    std::atomic<uint64_t> m_numberOfPublishedSamples{0U};
+    std::atomic<uint64_t> m_numberOfDroppedSamples{0U};
+};
+
+} // namespace gw
+} // namespace iox
+
+#endif // IOX_POSH_GW_DOMAIN_BRIDGE_RECEIVER_HPP
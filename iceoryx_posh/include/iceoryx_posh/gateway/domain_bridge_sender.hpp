@@ -0,0 +1,223 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_GW_DOMAIN_BRIDGE_SENDER_HPP
+#define IOX_POSH_GW_DOMAIN_BRIDGE_SENDER_HPP
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/unix_domain_socket.hpp"
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/gateway/channel.hpp"
+#include "iceoryx_posh/gateway/domain_bridge.hpp"
+#include "iceoryx_posh/gateway/gateway_config.hpp"
+#include "iceoryx_posh/gateway/gateway_generic.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace iox
+{
+namespace gw
+{
+/// @brief The external terminal of a sender channel, it refers to the service index which is announced to the receiver
+struct BridgeSenderTerminal
+{
+    BridgeSenderTerminal(const capro::IdString_t&, const capro::IdString_t&, const capro::IdString_t&) noexcept
+    {
+    }
+
+    /// @brief is set when the channel is added and reset when it is discarded, guarded by the mutex of the sender
+    cxx::optional<uint16_t> serviceIndex;
+    /// @brief the generation of the OFFER which announced the service index, guarded by the mutex of the sender
+    uint16_t generation{0U};
+
+    static constexpr uint64_t NOT_ANNOUNCED{0U};
+    /// @brief the connection on which the OFFER was sent or is sent by the forwarding thread of the channel, guarded
+    /// by the mutex of the sender
+    uint64_t announcedConnectionNumber{NOT_ANNOUNCED};
+};
+
+using BridgeSenderChannel = Channel<popo::UntypedSubscriber, BridgeSenderTerminal>;
+
+/// @brief The gateway of a bridge in the domain the services come from. It subscribes to the offered publisher
+/// services and sends their samples over a unix domain socket to a DomainBridgeReceiver, which runs with a runtime of
+/// another RouDi domain and publishes the samples there. Small samples are batched into one message and every message
+/// is gathered by the kernel directly from the chunks in the shared memory.
+///
+/// Samples which do not fit into one message are split into fragments of MAX_BRIDGE_FRAGMENT_SIZE and reassembled by
+/// the receiver in a loaned chunk.
+///
+/// Nothing is sent while the mutex of the sender is held, the mutex only guards the connection and the announced
+/// services. A service is announced with an OFFER by the forwarding thread of its channel before the first samples on
+/// a connection. When the receiver falls behind the sender blocks on the socket and stops taking samples, the
+/// subscriber queues of the sender fill up. With QueueFullPolicy::BLOCK_PRODUCER in the subscriber options this blocks
+/// the publishers, but only publishers with ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER are bridged then, and the sender
+/// waits as long as it runs. With the default options the queues discard their oldest samples and a message which
+/// cannot be sent within MAX_SEND_DURATION is dropped. All messages are dropped while no receiver is connected.
+class DomainBridgeSender : public GatewayGeneric<BridgeSenderChannel>
+{
+  public:
+    /// @brief Creates a sender which waits for samples with ForwardingMode::EVENT_DRIVEN. The connection to the
+    /// receiver is established with the first message and reestablished when the receiver was restarted.
+    /// @param[in] bridgeName the name of the unix domain socket of the receiver
+    /// @param[in] subscriberOptions the options of the subscribers, e.g. the queue capacity and full policy
+    /// @param[in] interface the interface of the gateway, services which are offered via this interface, i.e. which
+    /// were received from another domain, are not sent
+    DomainBridgeSender(const BridgeName_t& bridgeName,
+                       const popo::SubscriberOptions& subscriberOptions = {},
+                       const capro::Interfaces interface = DEFAULT_BRIDGE_INTERFACE) noexcept;
+
+    /// @brief Stops the gateway threads before the socket is closed
+    ~DomainBridgeSender() noexcept override;
+
+    DomainBridgeSender(const DomainBridgeSender&) = delete;
+    DomainBridgeSender(DomainBridgeSender&&) = delete;
+    DomainBridgeSender& operator=(const DomainBridgeSender&) = delete;
+    DomainBridgeSender& operator=(DomainBridgeSender&&) = delete;
+
+    /// @brief Restricts the bridge to the configured services, without configured services all publisher services
+    /// except the ones of RouDi are sent. Must be called before the gateway is started.
+    /// @param[in] config the services to send, e.g. parsed by the TomlGatewayConfigParser
+    void loadConfiguration(const config::GatewayConfig& config) noexcept override;
+
+    void discover(const capro::CaproMessage& msg) noexcept override;
+
+    void forward(const BridgeSenderChannel& channel) noexcept override;
+
+    /// @brief The number of samples which were sent to the receiver
+    /// @return the number of sent samples
+    uint64_t numberOfSentSamples() const noexcept;
+
+    /// @brief The number of samples which were taken but could not be sent
+    /// @return the number of dropped samples
+    uint64_t numberOfDroppedSamples() const noexcept;
+
+    /// @brief The longest time a message waits for space in the socket before it is dropped, unless the subscriber
+    /// options use QueueFullPolicy::BLOCK_PRODUCER
+    static constexpr units::Duration MAX_SEND_DURATION{1_s};
+
+  private:
+    /// @brief everything a forwarding thread requires to send the samples of a channel without holding the mutex
+    struct Route
+    {
+        std::shared_ptr<posix::UnixDomainSocket> socket;
+        uint64_t connectionNumber{BridgeSenderTerminal::NOT_ANNOUNCED};
+        uint16_t serviceIndex{0U};
+        uint16_t generation{0U};
+        /// @brief the OFFER of the service is sent before the next message
+        bool isAnnouncementRequired{false};
+        std::string serializedService;
+    };
+
+    struct AnnouncedService
+    {
+        /// @brief is sent with every OFFER
+        std::string serializedService;
+    };
+
+    /// @brief the samples of one channel which are sent as one message, the I/O vector refers to the headers of the
+    /// batch and to the user-headers and user-payloads in the shared memory
+    struct Batch
+    {
+        static constexpr uint32_t MAX_IO_VECTOR_SIZE{1U + 3U * MAX_BRIDGE_SAMPLES_PER_MESSAGE};
+
+        Batch() noexcept;
+        Batch(const Batch&) = delete;
+        Batch(Batch&&) = delete;
+        Batch& operator=(const Batch&) = delete;
+        Batch& operator=(Batch&&) = delete;
+        ~Batch() noexcept = default;
+
+        void clear() noexcept;
+        bool isEmpty() const noexcept;
+        /// @brief checks whether a sample of the given size fits into the message
+        bool hasSpaceFor(const uint64_t sampleSize) const noexcept;
+        void add(const mepoo::ChunkHeader& chunkHeader) noexcept;
+        void append(const void* data, const uint64_t size) noexcept;
+
+        BridgeMessageHeader messageHeader;
+        std::array<BridgeSampleHeader, MAX_BRIDGE_SAMPLES_PER_MESSAGE> sampleHeaders;
+        std::array<const void*, MAX_BRIDGE_SAMPLES_PER_MESSAGE> userPayloads;
+        std::array<iovec, MAX_IO_VECTOR_SIZE> ioVector;
+        uint32_t ioVectorSize{0U};
+        uint64_t messageSize{0U};
+    };
+
+    bool isBridged(const capro::ServiceDescription& service) const noexcept;
+
+    /// @brief the size of a sample in a message including its BridgeSampleHeader
+    static uint64_t sampleSize(const mepoo::ChunkHeader& chunkHeader) noexcept;
+    /// @brief sends the batch and releases its samples afterwards
+    void send(Batch& batch, const BridgeSenderChannel& channel) noexcept;
+    /// @brief sends a sample which does not fit into one message as SAMPLE_FRAGMENT messages and releases it
+    void sendFragmented(const mepoo::ChunkHeader& chunkHeader, const BridgeSenderChannel& channel) noexcept;
+    /// @brief copies the connection and the service index of the channel, connects to the receiver if required
+    /// @return the route or nullopt when the channel was discarded or no receiver is connected
+    cxx::optional<Route> routeOf(const BridgeSenderChannel& channel) noexcept;
+    /// @brief sends a message and the pending OFFER of the route without holding the mutex, reconnects to the
+    /// receiver once if it was restarted
+    bool sendMessage(const BridgeSenderChannel& channel,
+                     Route& route,
+                     const iovec* ioVector,
+                     const uint32_t ioVectorSize) noexcept;
+    /// @brief sends the OFFER of the route if it is required
+    cxx::expected<posix::IpcChannelError> announce(Route& route) const noexcept;
+
+    /// @note the following methods require the mutex to be locked
+    void offer(const capro::ServiceDescription& service) noexcept;
+    /// @return the route of the STOP_OFFER if the receiver knows the service
+    cxx::optional<Route> stopOffer(const capro::ServiceDescription& service) noexcept;
+    /// @brief copies the connection and the service index of the channel into the route and claims the OFFER for the
+    /// forwarding thread if the service is not yet announced on the connection
+    /// @return false if the channel was discarded
+    bool updateRoute(const BridgeSenderChannel& channel, Route& route) noexcept;
+    /// @brief connects to the receiver, the services are announced again on the new connection
+    bool connect() noexcept;
+    void disconnect() noexcept;
+
+    /// @brief sends a message over the given connection, blocks while the socket is full and the subscriber options
+    /// use QueueFullPolicy::BLOCK_PRODUCER, otherwise at most MAX_SEND_DURATION
+    cxx::expected<posix::IpcChannelError>
+    trySend(const posix::UnixDomainSocket& socket, const iovec* ioVector, const uint32_t ioVectorSize) const noexcept;
+
+    cxx::vector<capro::ServiceDescription, MAX_GATEWAY_SERVICES> m_servicesToBridge;
+    BridgeName_t m_bridgeName;
+    popo::SubscriberOptions m_subscriberOptions;
+
+    /// guards the socket, the announced services and the service indices of the channels but not the sending itself
+    std::mutex m_mutex;
+    /// is shared with the forwarding threads which send over it, a reconnect replaces it while they may still use it
+    std::shared_ptr<posix::UnixDomainSocket> m_socket;
+    /// the announced services, the position is the service index
+    cxx::vector<cxx::optional<AnnouncedService>, MAX_BRIDGED_SERVICES> m_announcedServices;
+    /// is incremented with every connection, the services are announced once per connection
+    uint64_t m_connectionNumber{BridgeSenderTerminal::NOT_ANNOUNCED};
+    uint16_t m_nextGeneration{0U};
+
+    std::atomic<uint64_t> m_numberOfSentSamples{0U};
+    std::atomic<uint64_t> m_numberOfDroppedSamples{0U};
+};
+
+} // namespace gw
+} // namespace iox
+
+#endif // IOX_POSH_GW_DOMAIN_BRIDGE_SENDER_HPP
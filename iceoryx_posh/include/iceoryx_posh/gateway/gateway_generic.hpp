@@ -22,6 +22,7 @@
 #include "iceoryx_hoofs/cxx/function_ref.hpp"
 #include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/cxx/string.hpp"
+#include "iceoryx_hoofs/cxx/type_traits.hpp"
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_hoofs/internal/concurrent/smart_lock.hpp"
 #include "iceoryx_hoofs/internal/units/duration.hpp"
@@ -30,9 +31,15 @@
 #include "iceoryx_posh/gateway/gateway_config.hpp"
 #include "iceoryx_posh/iceoryx_posh_config.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/popo/user_trigger.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+#include "iceoryx_posh/runtime/service_discovery.hpp"
 
 #include <atomic>
+#include <memory>
+#include <mutex>
 #include <thread>
+#include <type_traits>
 
 namespace iox
 {
@@ -47,6 +54,17 @@ enum class GatewayError : uint8_t
     NONEXISTANT_CHANNEL
 };
 
+/// @brief defines how the gateway decides when to forward the data of its channels
+enum class ForwardingMode : uint8_t
+{
+    /// @brief a single thread calls forward for every channel once per forwarding period
+    POLLING,
+    /// @brief the channels are distributed over a pool of threads; channels whose iceoryx terminal provides hasData,
+    /// i.e. subscribers, are attached to a WaitSet and forwarded as soon as data arrives, all other channels are
+    /// polled by their thread once per forwarding period; discovery runs when the service registry changes
+    EVENT_DRIVEN
+};
+
 ///
 /// @brief A reference generic gateway implementation.
 /// @details This class can be extended to quickly implement any type of gateway, only custom initialization,
@@ -68,8 +86,16 @@ class GatewayGeneric : public gateway_t
     GatewayGeneric(GatewayGeneric&&) = delete;
     GatewayGeneric& operator=(GatewayGeneric&&) = delete;
 
-    void runMultithreaded() noexcept;
-    void shutdown() noexcept;
+    ///
+    /// @brief runMultithreaded Starts the discovery and forwarding threads.
+    /// @note Implementations with additional threads start them after the threads of the GatewayGeneric.
+    ///
+    virtual void runMultithreaded() noexcept;
+    ///
+    /// @brief shutdown Stops and joins the threads of the gateway.
+    /// @note Implementations with additional threads stop them after the threads of the GatewayGeneric.
+    ///
+    virtual void shutdown() noexcept;
 
     ///
     /// @brief loadConfiguration Load the provided configuration.
@@ -84,15 +110,29 @@ class GatewayGeneric : public gateway_t
     ///
     /// @brief forward Forward data between the two terminals of the channel used by the implementation.
     /// @param channel The channel to propogate data across.
+    /// @note With ForwardingMode::EVENT_DRIVEN this is called concurrently for different channels but never
+    /// concurrently for the same channel. A channel that was attached to a WaitSet is forwarded again as long as its
+    /// subscriber has data, therefore forward should take at least one sample.
     ///
     virtual void forward(const channel_t& channel) noexcept = 0;
 
     uint64_t getNumberOfChannels() const noexcept;
 
   protected:
+    ///
+    /// @param interface The interface whose CaPro messages the gateway receives.
+    /// @param discoveryPeriod With ForwardingMode::POLLING the period of the discovery, with
+    /// ForwardingMode::EVENT_DRIVEN the longest time between two discovery runs without a registry change.
+    /// @param forwardingPeriod The period in which channels that are not event driven are forwarded.
+    /// @param forwardingMode Defines whether the channels are polled or forwarded on data arrival.
+    /// @param numberOfForwardingThreads The number of threads the channels are distributed over with
+    /// ForwardingMode::EVENT_DRIVEN, it is limited to MAX_GATEWAY_FORWARDING_THREADS.
+    ///
     GatewayGeneric(capro::Interfaces interface,
                    units::Duration discoveryPeriod = 1000_ms,
-                   units::Duration forwardingPeriod = 50_ms) noexcept;
+                   units::Duration forwardingPeriod = 50_ms,
+                   ForwardingMode forwardingMode = ForwardingMode::POLLING,
+                   uint32_t numberOfForwardingThreads = 1U) noexcept;
 
     ///
     /// @brief addChannel Creates a channel for the given service and stores a copy of it in an internal collection for
@@ -137,19 +177,84 @@ class GatewayGeneric : public gateway_t
     ///
     cxx::expected<GatewayError> discardChannel(const capro::ServiceDescription& service) noexcept;
 
+    ///
+    /// @brief isRunning Indicates whether the gateway threads are running, e.g. to abort a blocking operation in
+    /// forward when the gateway is shut down.
+    /// @return true between runMultithreaded and shutdown, otherwise false
+    ///
+    bool isRunning() const noexcept;
+
   private:
+    /// @brief channels with an iceoryx terminal that provides hasData can be attached to a WaitSet
+    template <typename T, typename = void>
+    struct IsAttachable : std::false_type
+    {
+    };
+    template <typename T>
+    struct IsAttachable<T, cxx::void_t<decltype(std::declval<T&>().hasData())>> : std::true_type
+    {
+    };
+    using IceoryxTerminal_t = typename std::decay_t<decltype(*std::declval<channel_t&>().getIceoryxTerminal())>;
+    static constexpr bool IS_ATTACHABLE = IsAttachable<IceoryxTerminal_t>::value;
+
+    /// @brief a thread of the forwarding pool together with the channels it is responsible for
+    struct ForwardingWorker
+    {
+        struct WorkerChannel
+        {
+            channel_t channel;
+            bool isAttached{false};
+            bool isStale{false};
+        };
+
+        /// copies of the channels, they keep the terminals alive until they are detached from the WaitSet
+        cxx::vector<WorkerChannel, MAX_CHANNEL_NUMBER> channels;
+        popo::WaitSet<> waitSet;
+        popo::UserTrigger wakeUpTrigger;
+        uint64_t channelGeneration{0U};
+        std::chrono::steady_clock::time_point lastPolling;
+        std::thread thread;
+    };
+
+    /// @brief the service discovery whose registry changes wake up the discovery thread
+    struct DiscoveryTrigger
+    {
+        runtime::ServiceDiscovery serviceDiscovery;
+        popo::WaitSet<2U> waitSet;
+        popo::UserTrigger wakeUpTrigger;
+    };
+
     ConcurrentChannelVector m_channels;
 
     std::atomic_bool m_isRunning{false};
 
     units::Duration m_discoveryPeriod;
     units::Duration m_forwardingPeriod;
+    ForwardingMode m_forwardingMode;
+    uint32_t m_numberOfForwardingThreads;
 
     std::thread m_discoveryThread;
     std::thread m_forwardingThread;
 
+    /// is increased whenever a channel is added or discarded, the workers compare it to adopt their channels
+    std::atomic<uint64_t> m_channelGeneration{0U};
+    std::unique_ptr<DiscoveryTrigger> m_discoveryTrigger;
+    cxx::vector<std::unique_ptr<ForwardingWorker>, MAX_GATEWAY_FORWARDING_THREADS> m_forwardingWorkers;
+
     void forwardingLoop() noexcept;
     void discoveryLoop() noexcept;
+    void eventDrivenDiscoveryLoop() noexcept;
+    void forwardingWorkerLoop(ForwardingWorker& worker, const uint64_t workerIndex) noexcept;
+
+    /// @brief attaches the new channels of a worker and detaches the discarded ones
+    void updateChannelsOfWorker(ForwardingWorker& worker, const uint64_t workerIndex) noexcept;
+    uint64_t workerIndexOf(const capro::ServiceDescription& service) const noexcept;
+    void wakeUpForwardingWorkers() noexcept;
+
+    bool attachChannel(ForwardingWorker& worker, channel_t& channel, std::true_type) noexcept;
+    bool attachChannel(ForwardingWorker& worker, channel_t& channel, std::false_type) noexcept;
+    void detachChannel(ForwardingWorker& worker, channel_t& channel, std::true_type) noexcept;
+    void detachChannel(ForwardingWorker& worker, channel_t& channel, std::false_type) noexcept;
 };
 
 } // namespace gw
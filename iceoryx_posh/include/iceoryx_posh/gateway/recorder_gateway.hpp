@@ -0,0 +1,111 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_GW_RECORDER_GATEWAY_HPP
+#define IOX_POSH_GW_RECORDER_GATEWAY_HPP
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/gateway/channel.hpp"
+#include "iceoryx_posh/gateway/gateway_config.hpp"
+#include "iceoryx_posh/gateway/gateway_generic.hpp"
+#include "iceoryx_posh/gateway/recording.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+
+#include <atomic>
+
+namespace iox
+{
+namespace gw
+{
+/// @brief The external terminal of a recorder channel, it refers to the service in the recording
+struct RecordedServiceTerminal
+{
+    RecordedServiceTerminal(const capro::IdString_t&, const capro::IdString_t&, const capro::IdString_t&) noexcept
+    {
+    }
+
+    /// @brief is set with the first forwarding of the channel
+    cxx::optional<RecordingWriter::ServiceIndex_t> serviceIndex;
+};
+
+using RecorderChannel = Channel<popo::UntypedSubscriber, RecordedServiceTerminal>;
+
+/// @brief A gateway which appends the chunks of the offered publisher services to a recording, see RecordingWriter.
+/// The subscribers of the recorder discard their oldest chunks when the recorder falls behind, therefore the
+/// publishers are never blocked by the recorder.
+class RecorderGateway : public GatewayGeneric<RecorderChannel>
+{
+  public:
+    /// @brief The interface of a recorder if none is specified; its purpose is the closest to recording
+    static constexpr capro::Interfaces DEFAULT_INTERFACE{capro::Interfaces::MTA};
+
+    /// @brief Creates a recorder which waits for chunks with ForwardingMode::EVENT_DRIVEN
+    /// @param[in] recordingPath the path of the segment files of the recording without the segment index suffix
+    /// @param[in] segmentSize the size of a segment file
+    /// @param[in] interface the interface of the gateway, services which are offered via this interface are not
+    /// recorded
+    RecorderGateway(const RecordingPath_t& recordingPath,
+                    const uint64_t segmentSize = RecordingWriter::DEFAULT_SEGMENT_SIZE,
+                    const capro::Interfaces interface = DEFAULT_INTERFACE) noexcept;
+
+    /// @brief Stops the gateway threads before the recording is closed
+    ~RecorderGateway() noexcept override;
+
+    RecorderGateway(const RecorderGateway&) = delete;
+    RecorderGateway(RecorderGateway&&) = delete;
+    RecorderGateway& operator=(const RecorderGateway&) = delete;
+    RecorderGateway& operator=(RecorderGateway&&) = delete;
+
+    /// @brief Restricts the recording to the configured services, without configured services all publisher services
+    /// except the ones of RouDi are recorded. Must be called before the gateway is started.
+    /// @param[in] config the services to record
+    void loadConfiguration(const config::GatewayConfig& config) noexcept override;
+
+    void discover(const capro::CaproMessage& msg) noexcept override;
+
+    void forward(const RecorderChannel& channel) noexcept override;
+
+    /// @brief The number of recorded chunks
+    /// @return the number of chunks which were appended to the recording
+    uint64_t numberOfRecordedChunks() const noexcept;
+
+    /// @brief The number of chunks which were received but could not be recorded, e.g. because the disk is full
+    /// @return the number of dropped chunks
+    uint64_t numberOfDroppedChunks() const noexcept;
+
+    /// @brief The number of times a subscriber of the recorder has lost chunks because the recorder fell behind
+    /// @return the number of detected losses
+    uint64_t numberOfLossEvents() const noexcept;
+
+  private:
+    void record(const RecordedServiceTerminal& recordedService,
+                const RecorderChannel& channel,
+                const mepoo::ChunkHeader& chunkHeader) noexcept;
+    bool isRecorded(const capro::ServiceDescription& service) const noexcept;
+
+    cxx::vector<capro::ServiceDescription, MAX_GATEWAY_SERVICES> m_servicesToRecord;
+    RecordingWriter m_writer;
+    std::atomic<uint64_t> m_numberOfDroppedChunks{0U};
+    std::atomic<uint64_t> m_numberOfLossEvents{0U};
+    std::atomic<bool> m_hasWriteError{false};
+};
+
+} // namespace gw
+} // namespace iox
+
+#endif // IOX_POSH_GW_RECORDER_GATEWAY_HPP
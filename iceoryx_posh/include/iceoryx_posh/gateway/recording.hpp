@@ -0,0 +1,275 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_GW_RECORDING_HPP
+#define IOX_POSH_GW_RECORDING_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/cxx/string.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/memory_map.hpp"
+#include "iceoryx_platform/platform_settings.hpp"
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace iox
+{
+namespace gw
+{
+enum class RecordingError : uint8_t
+{
+    FILE_ACCESS_FAILED,
+    DISK_SPACE_ALLOCATION_FAILED,
+    MEMORY_MAPPING_FAILED,
+    INVALID_FORMAT,
+    INCOMPATIBLE_CHUNK_HEADER_VERSION,
+    RECORD_TOO_LARGE,
+    TOO_MANY_SERVICES,
+    UNKNOWN_SERVICE,
+    END_OF_RECORDING
+};
+
+/// @brief converts RecordingError into a string literal
+/// @return string literal of the RecordingError value
+const char* asStringLiteral(const RecordingError error) noexcept;
+
+/// @brief The header at the beginning of every segment file of a recording. A recording consists of the segment files
+/// '<basePath>.0', '<basePath>.1', ... which are self-contained, i.e. every segment defines the services it refers to.
+struct RecordingSegmentHeader
+{
+    /// @brief "IOXREC" followed by two zero bytes in little endian byte order
+    static constexpr uint64_t MAGIC{0x0000434552584F49U};
+    /// @brief must be incremented for each incompatible change of the recording format
+    static constexpr uint32_t FORMAT_VERSION{1U};
+
+    uint64_t magic{MAGIC};
+    uint32_t formatVersion{FORMAT_VERSION};
+    uint8_t chunkHeaderVersion{mepoo::ChunkHeader::CHUNK_HEADER_VERSION};
+    uint8_t reserved8{0U};
+    uint16_t reserved16{0U};
+    uint64_t segmentIndex{0U};
+    /// @brief the number of bytes of the segment including this header which contain records; 0 when the segment was
+    /// not closed orderly, in this case the records end at the first record with size 0
+    uint64_t usedSize{0U};
+};
+
+enum class RecordType : uint16_t
+{
+    /// @brief the unused remainder of a segment is zero filled, therefore a record with this type ends the segment
+    END_OF_SEGMENT = 0U,
+    /// @brief the length of the serialized service description as uint64_t followed by the serialized service
+    /// description of the service index
+    SERVICE = 1U,
+    /// @brief the used part of a chunk, i.e. the ChunkHeader followed by the user-header and the user-payload
+    CHUNK = 2U
+};
+
+/// @brief The header of every record of a segment
+struct RecordHeader
+{
+    /// @brief records start at multiples of this alignment, therefore a recorded ChunkHeader is properly aligned
+    static constexpr uint32_t ALIGNMENT{alignof(mepoo::ChunkHeader)};
+
+    /// @brief the size of the record including this header and the padding to the next record
+    uint32_t size{0U};
+    RecordType type{RecordType::END_OF_SEGMENT};
+    /// @brief the index of the service which was defined by a SERVICE record in the same segment
+    uint16_t serviceIndex{0U};
+    /// @brief the publish timestamp of the chunk or, if the publisher does not add timestamps, the time the chunk was
+    /// recorded; both are taken from the clock of 'mepoo::ChunkHeader::publishTimestampNow'
+    uint64_t timestamp{0U};
+};
+
+/// @brief The maximum number of services in a recording
+constexpr uint64_t MAX_RECORDED_SERVICES{MAX_CHANNEL_NUMBER};
+
+using RecordingPath_t = cxx::string<platform::IOX_MAX_PATH_LENGTH>;
+
+/// @brief Appends chunks to a recording. The segments are memory-mapped files of a fixed size, a chunk is copied
+/// directly from the shared memory into the page cache and the kernel writes the segments back in large sequential
+/// blocks. The disk space of a segment is allocated when the segment is created, a full disk is therefore reported by
+/// write with RecordingError::DISK_SPACE_ALLOCATION_FAILED instead of a SIGBUS on the access of the mapping. A
+/// background thread creates the next segment and closes the previous one, a write which fills a segment only swaps
+/// the segments. The methods are thread-safe, a write reserves the space of its records under the lock but copies the
+/// chunk without it, therefore concurrent writes of large chunks do not serialize on the copy.
+class RecordingWriter
+{
+  public:
+    using ServiceIndex_t = uint16_t;
+
+    static constexpr uint64_t DEFAULT_SEGMENT_SIZE{256U * 1024U * 1024U};
+    static constexpr uint64_t MIN_SEGMENT_SIZE{4096U};
+
+    /// @brief Creates a writer, the first segment is created with the first chunk
+    /// @param[in] basePath the path of the segment files without the segment index suffix
+    /// @param[in] segmentSize the size of a segment file, a larger segment reduces the number of files and mappings;
+    /// it is at least MIN_SEGMENT_SIZE
+    RecordingWriter(const RecordingPath_t& basePath, const uint64_t segmentSize = DEFAULT_SEGMENT_SIZE) noexcept;
+
+    /// @brief Closes the last segment and truncates it to the used size, a prepared next segment is removed
+    ~RecordingWriter() noexcept;
+
+    RecordingWriter(const RecordingWriter&) = delete;
+    RecordingWriter(RecordingWriter&&) = delete;
+    RecordingWriter& operator=(const RecordingWriter&) = delete;
+    RecordingWriter& operator=(RecordingWriter&&) = delete;
+
+    /// @brief Adds a service to the recording, the service is written to a segment with its first chunk
+    /// @param[in] service the service to add
+    /// @return the index of the service, for a service which was added before the same index is returned
+    cxx::expected<ServiceIndex_t, RecordingError> addService(const capro::ServiceDescription& service) noexcept;
+
+    /// @brief Appends the used part of a chunk to the recording
+    /// @param[in] serviceIndex the index of the service the chunk was received from
+    /// @param[in] chunkHeader the ChunkHeader of the chunk to record
+    /// @return an error if the chunk could not be recorded
+    cxx::expected<RecordingError> write(const ServiceIndex_t serviceIndex,
+                                        const mepoo::ChunkHeader& chunkHeader) noexcept;
+
+    /// @brief The number of recorded chunks
+    /// @return the number of chunks which were written successfully
+    uint64_t numberOfChunks() const noexcept;
+
+    /// @brief The number of bytes of all records
+    /// @return the number of bytes which were written to the segments
+    uint64_t numberOfBytes() const noexcept;
+
+  private:
+    struct RecordedService
+    {
+        capro::ServiceDescription service;
+        std::string serializedService;
+        bool isDefinedInSegment{false};
+    };
+
+    /// @brief a created and memory-mapped segment file
+    struct Segment
+    {
+        Segment(const uint64_t index, const int32_t fileDescriptor, posix::MemoryMap&& memoryMap) noexcept;
+
+        uint64_t index{0U};
+        int32_t fileDescriptor{-1};
+        posix::MemoryMap memoryMap;
+    };
+
+    /// @note requires the mutex to be locked, it is unlocked while waiting for the preparation of the next segment or
+    /// for the pending copies into a full segment
+    cxx::expected<RecordingError> reserve(std::unique_lock<std::mutex>& lock, const uint64_t size) noexcept;
+    /// @note requires the mutex to be locked
+    void activateSegment(Segment&& segment) noexcept;
+    /// @brief creates the file of a segment, allocates its disk space and maps it; does not access any member which
+    /// is guarded by the mutex
+    cxx::expected<Segment, RecordingError> createSegment(const uint64_t segmentIndex) const noexcept;
+    /// @brief truncates the segment to the used size which is stored in its header and closes it
+    void closeSegment(Segment& segment) const noexcept;
+    /// @brief closes the segment and removes its file, e.g. a prepared segment which was not used
+    void removeSegment(Segment& segment) const noexcept;
+    /// @brief the loop of the segment preparation thread
+    void prepareSegments() noexcept;
+    void* appendRecord(const uint64_t size,
+                       const RecordType type,
+                       const ServiceIndex_t serviceIndex,
+                       const uint64_t timestamp) noexcept;
+
+    RecordingPath_t m_basePath;
+    uint64_t m_segmentSize{DEFAULT_SEGMENT_SIZE};
+
+    mutable std::mutex m_mutex;
+    cxx::vector<RecordedService, MAX_RECORDED_SERVICES> m_services;
+    cxx::optional<Segment> m_segment;
+    /// the segment after the current one, created by the preparation thread
+    cxx::optional<Segment> m_nextSegment;
+    /// a full segment which is closed by the preparation thread
+    cxx::optional<Segment> m_segmentToClose;
+    uint64_t m_segmentIndex{0U};
+    uint64_t m_position{0U};
+    /// the preparation of a segment is attempted only once, a failure is reported by the write which requires it;
+    /// the first segment is created by the first write, therefore 0 means that no segment was prepared
+    uint64_t m_lastPreparedSegmentIndex{0U};
+    bool m_isPreparingSegment{false};
+    bool m_isStopped{false};
+    /// signals the preparation thread that it has work and the writers that a preparation finished
+    std::condition_variable m_segmentPreparationCondition;
+    std::thread m_segmentPreparationThread;
+    /// the number of chunks which are copied into the current segment without the mutex; the used size of a segment
+    /// is stored and the segment is closed only when all of them finished
+    uint64_t m_numberOfPendingCopies{0U};
+    /// signals that the last pending copy finished
+    std::condition_variable m_pendingCopiesCondition;
+    uint64_t m_numberOfChunks{0U};
+    uint64_t m_numberOfBytes{0U};
+};
+
+/// @brief A chunk of a recording
+struct RecordedChunk
+{
+    RecordingWriter::ServiceIndex_t serviceIndex{0U};
+    uint64_t timestamp{0U};
+    /// @brief points into the memory-mapped segment and is valid until the next call of RecordingReader::next
+    const mepoo::ChunkHeader* chunkHeader{nullptr};
+};
+
+/// @brief Reads the chunks of a recording in the order they were recorded. The segments are memory-mapped, therefore
+/// a chunk is not copied before it is used.
+class RecordingReader
+{
+  public:
+    /// @brief Creates a reader, the first segment is opened with the first call of next
+    /// @param[in] basePath the path of the segment files without the segment index suffix
+    explicit RecordingReader(const RecordingPath_t& basePath) noexcept;
+
+    ~RecordingReader() noexcept;
+
+    RecordingReader(const RecordingReader&) = delete;
+    RecordingReader(RecordingReader&&) = delete;
+    RecordingReader& operator=(const RecordingReader&) = delete;
+    RecordingReader& operator=(RecordingReader&&) = delete;
+
+    /// @brief Reads the next chunk
+    /// @return the next chunk, RecordingError::END_OF_RECORDING when all chunks were read or an error when the
+    /// recording is corrupted
+    cxx::expected<RecordedChunk, RecordingError> next() noexcept;
+
+    /// @brief The service of a service index
+    /// @param[in] serviceIndex the service index of a chunk which was returned by next
+    /// @return the service of the service index
+    const capro::ServiceDescription& service(const RecordingWriter::ServiceIndex_t serviceIndex) const noexcept;
+
+  private:
+    cxx::expected<RecordingError> openSegment(const uint64_t segmentIndex) noexcept;
+    void closeSegment() noexcept;
+
+    RecordingPath_t m_basePath;
+    cxx::vector<cxx::optional<capro::ServiceDescription>, MAX_RECORDED_SERVICES> m_services;
+    int32_t m_fileDescriptor{-1};
+    cxx::optional<posix::MemoryMap> m_segment;
+    uint64_t m_segmentIndex{0U};
+    uint64_t m_position{0U};
+    uint64_t m_endOfRecords{0U};
+    bool m_isFinished{false};
+};
+
+} // namespace gw
+} // namespace iox
+
+#endif // IOX_POSH_GW_RECORDING_HPP
@@ -0,0 +1,84 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_GW_REPLAYER_HPP
+#define IOX_POSH_GW_REPLAYER_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_posh/gateway/recording.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace gw
+{
+enum class ReplayTiming : uint8_t
+{
+    /// @brief the chunks are published with the time intervals between their recorded timestamps
+    ORIGINAL,
+    /// @brief the chunks are published without waiting
+    AS_FAST_AS_POSSIBLE
+};
+
+/// @brief Republishes the chunks of a recording which was created by the RecorderGateway. A publisher is created for
+/// each service of the recording when its first chunk is replayed. The publishers stop offering when the next replay
+/// starts or the replayer is destroyed.
+class Replayer
+{
+  public:
+    /// @brief Creates a replayer
+    /// @param[in] publisherOptions the options of the publishers, e.g. a history for subscribers which are not yet
+    /// connected when the first chunks are replayed
+    explicit Replayer(const popo::PublisherOptions& publisherOptions = popo::PublisherOptions()) noexcept;
+
+    Replayer(const Replayer&) = delete;
+    Replayer(Replayer&&) = delete;
+    Replayer& operator=(const Replayer&) = delete;
+    Replayer& operator=(Replayer&&) = delete;
+    ~Replayer() noexcept = default;
+
+    /// @brief Republishes the chunks of a recording, returns when all chunks are replayed or the replay is stopped
+    /// @param[in] recordingPath the path of the segment files of the recording without the segment index suffix
+    /// @param[in] timing whether the original timing is reproduced
+    /// @return the number of replayed chunks or an error if the recording could not be read
+    cxx::expected<uint64_t, RecordingError> replay(const RecordingPath_t& recordingPath,
+                                                   const ReplayTiming timing) noexcept;
+
+    /// @brief Stops a replay which is running in another thread
+    void stop() noexcept;
+
+  private:
+    popo::UntypedPublisher& publisherOf(const RecordingReader& reader,
+                                        const RecordingWriter::ServiceIndex_t serviceIndex) noexcept;
+    bool waitUntil(const uint64_t timestamp) noexcept;
+
+    popo::PublisherOptions m_publisherOptions;
+    cxx::vector<cxx::optional<popo::UntypedPublisher>, MAX_RECORDED_SERVICES> m_publishers;
+    std::atomic<bool> m_isStopRequested{false};
+    ReplayTiming m_timing{ReplayTiming::AS_FAST_AS_POSSIBLE};
+    uint64_t m_firstTimestamp{0U};
+    uint64_t m_startTime{0U};
+};
+
+} // namespace gw
+} // namespace iox
+
+#endif // IOX_POSH_GW_REPLAYER_HPP
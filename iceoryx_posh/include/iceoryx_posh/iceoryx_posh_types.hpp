@@ -60,17 +60,25 @@ constexpr uint32_t MAX_SUBSCRIBERS_PER_PUBLISHER = build::IOX_MAX_SUBSCRIBERS_PE
 constexpr uint32_t MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY =
     build::IOX_MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY;
 constexpr uint64_t MAX_PUBLISHER_HISTORY = build::IOX_MAX_PUBLISHER_HISTORY;
+/// maximum time a publisher which is blocked by a full subscriber queue sleeps before it checks the queue again
+constexpr units::Duration DEFAULT_WAIT_FOR_CONSUMER_TIMEOUT{units::Duration::fromMilliseconds(10U)};
 // Subscriber
 constexpr uint32_t MAX_SUBSCRIBERS = build::IOX_MAX_SUBSCRIBERS;
 constexpr uint32_t MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY =
     build::IOX_MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY;
 constexpr uint32_t MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY;
+/// number of power-of-two buckets of the optional subscriber latency histogram; bucket 'i' counts latencies in
+/// [2^i, 2^(i+1)) nanoseconds and the last bucket additionally collects everything above
+constexpr uint32_t NUMBER_OF_LATENCY_HISTOGRAM_BUCKETS{32U};
 // Introspection is using the following publisherPorts, which reduced the number of ports available for the user
 // 1x publisherPort mempool introspection
 // 1x publisherPort process introspection
 // 3x publisherPort port introspection
 constexpr uint32_t PUBLISHERS_RESERVED_FOR_INTROSPECTION = 5;
-constexpr uint32_t PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY = 1;
+// The service registry is using the following publisherPorts
+// 1x publisherPort whole registry
+// 1x publisherPort registry deltas
+constexpr uint32_t PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY = 2;
 constexpr uint32_t NUMBER_OF_INTERNAL_PUBLISHERS =
     PUBLISHERS_RESERVED_FOR_INTROSPECTION + PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY;
 /// With MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY we couple the maximum number of
@@ -83,6 +91,7 @@ constexpr uint32_t MAX_INTERFACE_NUMBER = build::IOX_MAX_INTERFACE_NUMBER;
 constexpr uint32_t MAX_INTERFACE_CAPRO_FIFO_SIZE = MAX_PUBLISHERS;
 constexpr uint32_t MAX_CHANNEL_NUMBER = MAX_PUBLISHERS + MAX_SUBSCRIBERS;
 constexpr uint32_t MAX_GATEWAY_SERVICES = 2 * MAX_CHANNEL_NUMBER;
+constexpr uint32_t MAX_GATEWAY_FORWARDING_THREADS = 16U;
 // Client
 constexpr uint32_t MAX_CLIENTS = build::IOX_MAX_SUBSCRIBERS; /// @todo
 constexpr uint32_t MAX_REQUESTS_ALLOCATED_SIMULTANEOUSLY = 4U;
@@ -94,6 +103,8 @@ constexpr uint32_t MAX_CLIENTS_PER_SERVER = 256U;
 constexpr uint32_t MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY = 4U;
 constexpr uint32_t MAX_RESPONSES_ALLOCATED_SIMULTANEOUSLY = MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY;
 constexpr uint32_t MAX_REQUEST_QUEUE_CAPACITY = 1024;
+// Runtime
+constexpr uint32_t MAX_PORTS_PER_BATCH = 128U;
 // Waitset
 namespace popo
 {
@@ -136,6 +147,11 @@ constexpr uint32_t MAX_FINDSERVICE_RESULT_SIZE = SERVICE_REGISTRY_CAPACITY;
 constexpr const char SERVICE_DISCOVERY_SERVICE_NAME[] = "ServiceDiscovery";
 constexpr const char SERVICE_DISCOVERY_INSTANCE_NAME[] = "RouDi_ID";
 constexpr const char SERVICE_DISCOVERY_EVENT_NAME[] = "ServiceRegistry";
+constexpr const char SERVICE_DISCOVERY_DELTA_EVENT_NAME[] = "ServiceRegistryDelta";
+/// RouDi publishes every modification of the service registry as delta and the whole registry after at most this
+/// number of deltas. With a delta history and queue capacity of the same size a late joining or lagging runtime always
+/// finds a registry from which it can continue with the deltas.
+constexpr uint64_t SERVICE_REGISTRY_SNAPSHOT_INTERVAL = MAX_PUBLISHER_HISTORY;
 
 // Nodes
 constexpr uint32_t MAX_NODE_NUMBER = 1000U;
@@ -0,0 +1,41 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_CAPRO_SERVICE_DESCRIPTION_HASH_HPP
+#define IOX_POSH_CAPRO_SERVICE_DESCRIPTION_HASH_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace capro
+{
+/// @brief Continues a FNV-1a hash with the characters of a string of a service description
+/// @param[in] value string which is hashed
+/// @param[in] hash result of the previous strings, the default starts a new hash
+/// @return the hash including the string
+uint64_t hashIdString(const IdString_t& value, const uint64_t hash = 14695981039346656037U) noexcept;
+
+/// @brief Hashes the strings which are compared by ServiceDescription::operator==
+/// @param[in] service to hash
+/// @return the hash of the service, instance and event string
+uint64_t hashServiceDescription(const ServiceDescription& service) noexcept;
+
+} // namespace capro
+} // namespace iox
+
+#endif // IOX_POSH_CAPRO_SERVICE_DESCRIPTION_HASH_HPP
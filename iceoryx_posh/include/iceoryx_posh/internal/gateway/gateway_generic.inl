@@ -23,6 +23,8 @@
 #include "iceoryx_posh/gateway/gateway_generic.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 
+#include <algorithm>
+
 // ================================================== Public ================================================== //
 
 namespace iox
@@ -39,14 +41,51 @@ template <typename channel_t, typename gateway_t>
 inline void GatewayGeneric<channel_t, gateway_t>::runMultithreaded() noexcept
 {
     m_isRunning.store(true);
-    m_discoveryThread = std::thread([this] { this->discoveryLoop(); });
-    m_forwardingThread = std::thread([this] { this->forwardingLoop(); });
+    if (m_forwardingMode == ForwardingMode::POLLING)
+    {
+        m_discoveryThread = std::thread([this] { this->discoveryLoop(); });
+        m_forwardingThread = std::thread([this] { this->forwardingLoop(); });
+        return;
+    }
+
+    // the WaitSets require a runtime, therefore they are only created when the event driven mode is used
+    m_discoveryTrigger.reset(new DiscoveryTrigger);
+    m_discoveryTrigger->waitSet
+        .attachEvent(m_discoveryTrigger->serviceDiscovery, runtime::ServiceDiscoveryEvent::SERVICE_REGISTRY_CHANGED)
+        .or_else([](auto) { LogWarn() << "Discovery falls back to polling since the WaitSet is full"; });
+    m_discoveryTrigger->waitSet.attachEvent(m_discoveryTrigger->wakeUpTrigger).or_else([](auto) {
+        LogWarn() << "Discovery cannot be woken up on shutdown since the WaitSet is full";
+    });
+
+    for (uint64_t i = 0U; i < m_numberOfForwardingThreads; ++i)
+    {
+        m_forwardingWorkers.emplace_back(new ForwardingWorker);
+        auto& worker = *m_forwardingWorkers.back();
+        worker.waitSet.attachEvent(worker.wakeUpTrigger).or_else([](auto) {
+            LogWarn() << "Forwarding thread cannot be woken up since the WaitSet is full";
+        });
+        // differs from every generation, the worker adopts its channels immediately
+        worker.channelGeneration = m_channelGeneration.load() - 1U;
+    }
+
+    m_discoveryThread = std::thread([this] { this->eventDrivenDiscoveryLoop(); });
+    for (uint64_t i = 0U; i < m_forwardingWorkers.size(); ++i)
+    {
+        auto& worker = *m_forwardingWorkers[i];
+        worker.thread = std::thread([this, &worker, i] { this->forwardingWorkerLoop(worker, i); });
+    }
 }
 
 template <typename channel_t, typename gateway_t>
 inline void GatewayGeneric<channel_t, gateway_t>::shutdown() noexcept
 {
     m_isRunning.store(false);
+    if (m_discoveryTrigger)
+    {
+        m_discoveryTrigger->wakeUpTrigger.trigger();
+    }
+    wakeUpForwardingWorkers();
+
     if (m_discoveryThread.joinable())
     {
         m_discoveryThread.join();
@@ -55,6 +94,17 @@ inline void GatewayGeneric<channel_t, gateway_t>::shutdown() noexcept
     {
         m_forwardingThread.join();
     }
+    for (auto& worker : m_forwardingWorkers)
+    {
+        if (worker->thread.joinable())
+        {
+            worker->thread.join();
+        }
+    }
+
+    // the workers hold copies of the channels, they are released together with the WaitSets
+    m_forwardingWorkers.clear();
+    m_discoveryTrigger.reset();
 }
 
 template <typename channel_t, typename gateway_t>
@@ -68,11 +118,23 @@ inline uint64_t GatewayGeneric<channel_t, gateway_t>::getNumberOfChannels() cons
 template <typename channel_t, typename gateway_t>
 inline GatewayGeneric<channel_t, gateway_t>::GatewayGeneric(capro::Interfaces interface,
                                                             units::Duration discoveryPeriod,
-                                                            units::Duration forwardingPeriod) noexcept
+                                                            units::Duration forwardingPeriod,
+                                                            ForwardingMode forwardingMode,
+                                                            uint32_t numberOfForwardingThreads) noexcept
     : gateway_t(interface)
     , m_discoveryPeriod(discoveryPeriod)
     , m_forwardingPeriod(forwardingPeriod)
+    , m_forwardingMode(forwardingMode)
+    , m_numberOfForwardingThreads(std::max(1U, std::min(numberOfForwardingThreads, MAX_GATEWAY_FORWARDING_THREADS)))
 {
+    if (m_numberOfForwardingThreads != numberOfForwardingThreads)
+    {
+        LogWarn() << "The number of forwarding threads is limited to " << m_numberOfForwardingThreads;
+    }
+    if (m_forwardingMode == ForwardingMode::EVENT_DRIVEN && !IS_ATTACHABLE)
+    {
+        LogWarn() << "The iceoryx terminals of the gateway cannot be attached to a WaitSet, the channels are polled";
+    }
 }
 
 template <typename channel_t, typename gateway_t>
@@ -111,6 +173,8 @@ GatewayGeneric<channel_t, gateway_t>::addChannel(const capro::ServiceDescription
         {
             auto channel = result.value();
             m_channels->push_back(channel);
+            m_channelGeneration.fetch_add(1U);
+            wakeUpForwardingWorkers();
             return cxx::success<channel_t>(channel);
         }
     }
@@ -156,6 +220,8 @@ GatewayGeneric<channel_t, gateway_t>::discardChannel(const capro::ServiceDescrip
     if (channel != guardedVector->end())
     {
         guardedVector->erase(channel);
+        m_channelGeneration.fetch_add(1U);
+        wakeUpForwardingWorkers();
         return cxx::success<void>();
     }
     else
@@ -164,6 +230,12 @@ GatewayGeneric<channel_t, gateway_t>::discardChannel(const capro::ServiceDescrip
     }
 }
 
+template <typename channel_t, typename gateway_t>
+inline bool GatewayGeneric<channel_t, gateway_t>::isRunning() const noexcept
+{
+    return m_isRunning.load();
+}
+
 // ================================================== Private ================================================== //
 
 template <typename channel_t, typename gateway_t>
@@ -192,6 +264,180 @@ inline void GatewayGeneric<channel_t, gateway_t>::forwardingLoop() noexcept
     };
 }
 
+template <typename channel_t, typename gateway_t>
+inline void GatewayGeneric<channel_t, gateway_t>::eventDrivenDiscoveryLoop() noexcept
+{
+    while (m_isRunning.load(std::memory_order_relaxed))
+    {
+        capro::CaproMessage msg;
+        while (this->getCaProMessage(msg))
+        {
+            discover(msg);
+        }
+        // the period is a fallback for CaPro messages which arrive after the registry change was announced
+        m_discoveryTrigger->waitSet.timedWait(m_discoveryPeriod);
+    }
+}
+
+template <typename channel_t, typename gateway_t>
+inline void GatewayGeneric<channel_t, gateway_t>::forwardingWorkerLoop(ForwardingWorker& worker,
+                                                                       const uint64_t workerIndex) noexcept
+{
+    worker.lastPolling = std::chrono::steady_clock::now();
+    while (m_isRunning.load(std::memory_order_relaxed))
+    {
+        if (worker.channelGeneration != m_channelGeneration.load())
+        {
+            updateChannelsOfWorker(worker, workerIndex);
+        }
+
+        auto notifications = worker.waitSet.timedWait(m_forwardingPeriod);
+        for (auto& notification : notifications)
+        {
+            if (notification->doesOriginateFrom(&worker.wakeUpTrigger))
+            {
+                continue;
+            }
+            for (auto& workerChannel : worker.channels)
+            {
+                if (workerChannel.isAttached
+                    && notification->doesOriginateFrom(workerChannel.channel.getIceoryxTerminal().get()))
+                {
+                    forward(workerChannel.channel);
+                    break;
+                }
+            }
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        if (now - worker.lastPolling >= std::chrono::nanoseconds(m_forwardingPeriod.toNanoseconds()))
+        {
+            worker.lastPolling = now;
+            for (auto& workerChannel : worker.channels)
+            {
+                if (!workerChannel.isAttached)
+                {
+                    forward(workerChannel.channel);
+                }
+            }
+        }
+    }
+}
+
+template <typename channel_t, typename gateway_t>
+inline void GatewayGeneric<channel_t, gateway_t>::updateChannelsOfWorker(ForwardingWorker& worker,
+                                                                         const uint64_t workerIndex) noexcept
+{
+    auto guardedVector = m_channels.getScopeGuard();
+    // read while holding the lock, a later change of the channels increases the generation again
+    worker.channelGeneration = m_channelGeneration.load();
+
+    for (auto& workerChannel : worker.channels)
+    {
+        workerChannel.isStale = true;
+    }
+
+    for (auto channel = guardedVector->begin(); channel != guardedVector->end(); ++channel)
+    {
+        const auto service = channel->getServiceDescription();
+        if (workerIndexOf(service) != workerIndex)
+        {
+            continue;
+        }
+
+        auto knownChannel = std::find_if(worker.channels.begin(), worker.channels.end(), [&](const auto& entry) {
+            return entry.channel.getServiceDescription() == service;
+        });
+        if (knownChannel != worker.channels.end())
+        {
+            knownChannel->isStale = false;
+            continue;
+        }
+
+        worker.channels.push_back(typename ForwardingWorker::WorkerChannel{*channel, false, false});
+        auto& newChannel = worker.channels.back();
+        newChannel.isAttached =
+            attachChannel(worker, newChannel.channel, std::integral_constant<bool, IS_ATTACHABLE>{});
+    }
+
+    for (auto workerChannel = worker.channels.begin(); workerChannel != worker.channels.end();)
+    {
+        if (workerChannel->isStale)
+        {
+            if (workerChannel->isAttached)
+            {
+                detachChannel(worker, workerChannel->channel, std::integral_constant<bool, IS_ATTACHABLE>{});
+            }
+            // the following elements are moved forward, the iterator points to the next element
+            worker.channels.erase(workerChannel);
+        }
+        else
+        {
+            ++workerChannel;
+        }
+    }
+}
+
+template <typename channel_t, typename gateway_t>
+inline uint64_t
+GatewayGeneric<channel_t, gateway_t>::workerIndexOf(const capro::ServiceDescription& service) const noexcept
+{
+    // the assignment depends only on the service, therefore it is stable while channels come and go
+    uint64_t hash{0U};
+    for (const auto* id : {&service.getServiceIDString(), &service.getInstanceIDString(), &service.getEventIDString()})
+    {
+        for (uint64_t i = 0U; i < id->size(); ++i)
+        {
+            hash = hash * 31U + static_cast<uint8_t>(id->c_str()[i]);
+        }
+    }
+    return hash % m_forwardingWorkers.size();
+}
+
+template <typename channel_t, typename gateway_t>
+inline void GatewayGeneric<channel_t, gateway_t>::wakeUpForwardingWorkers() noexcept
+{
+    for (auto& worker : m_forwardingWorkers)
+    {
+        worker->wakeUpTrigger.trigger();
+    }
+}
+
+template <typename channel_t, typename gateway_t>
+inline bool GatewayGeneric<channel_t, gateway_t>::attachChannel(ForwardingWorker& worker,
+                                                                channel_t& channel,
+                                                                std::true_type) noexcept
+{
+    auto terminal = channel.getIceoryxTerminal();
+    return !worker.waitSet.attachState(*terminal, popo::SubscriberState::HAS_DATA)
+                .or_else([&](auto) {
+                    LogWarn() << "The WaitSet of the forwarding thread is full, the channel for "
+                              << channel.getServiceDescription() << " is polled";
+                })
+                .has_error();
+}
+
+template <typename channel_t, typename gateway_t>
+inline bool
+GatewayGeneric<channel_t, gateway_t>::attachChannel(ForwardingWorker&, channel_t&, std::false_type) noexcept
+{
+    return false;
+}
+
+template <typename channel_t, typename gateway_t>
+inline void GatewayGeneric<channel_t, gateway_t>::detachChannel(ForwardingWorker& worker,
+                                                                channel_t& channel,
+                                                                std::true_type) noexcept
+{
+    worker.waitSet.detachState(*channel.getIceoryxTerminal(), popo::SubscriberState::HAS_DATA);
+}
+
+template <typename channel_t, typename gateway_t>
+inline void
+GatewayGeneric<channel_t, gateway_t>::detachChannel(ForwardingWorker&, channel_t&, std::false_type) noexcept
+{
+}
+
 } // namespace gw
 } // namespace iox
 
@@ -0,0 +1,70 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_MEPOO_CHUNK_BATCH_RELEASER_HPP
+#define IOX_POSH_MEPOO_CHUNK_BATCH_RELEASER_HPP
+
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief Collects chunks whose last reference is dropped and returns them to their mempools in batches, i.e. with
+/// one operation on the free-list of each affected mempool instead of one per chunk. Intended for cleanup paths which
+/// release many chunks at once, like the removal of the ports of a terminated process.
+/// @note Like the SharedChunk, the ChunkBatchReleaser is not thread safe
+class ChunkBatchReleaser
+{
+  public:
+    /// @brief number of chunks which are collected before they are returned to the mempools
+    static constexpr uint32_t CAPACITY{32U};
+
+    ChunkBatchReleaser() noexcept = default;
+    ChunkBatchReleaser(const ChunkBatchReleaser&) = delete;
+    ChunkBatchReleaser(ChunkBatchReleaser&&) = delete;
+    ChunkBatchReleaser& operator=(const ChunkBatchReleaser&) = delete;
+    ChunkBatchReleaser& operator=(ChunkBatchReleaser&&) = delete;
+
+    /// @brief returns all collected chunks to their mempools
+    ~ChunkBatchReleaser() noexcept;
+
+    /// @brief Drops the reference of the SharedChunk; if it was the last one, the chunk is collected for the release
+    /// @param[in] chunk the SharedChunk to release
+    void release(SharedChunk&& chunk) noexcept;
+
+    /// @brief returns all collected chunks to their mempools
+    void flush() noexcept;
+
+  private:
+    struct Entry
+    {
+        MemPool* m_memPool{nullptr};
+        const void* m_chunk{nullptr};
+    };
+
+    /// every chunk occupies two entries, one for the chunk itself and one for its ChunkManagement
+    cxx::vector<Entry, 2U * CAPACITY> m_entries;
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_CHUNK_BATCH_RELEASER_HPP
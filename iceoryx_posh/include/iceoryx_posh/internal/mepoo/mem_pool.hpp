@@ -22,6 +22,7 @@
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/mepoo/thread_local_chunk_cache.hpp"
 
 #include <atomic>
 #include <cstdint>
@@ -44,6 +45,9 @@ struct MemPoolInfo
     uint32_t m_chunkSize{0};
 };
 
+/// @brief Fixed size chunk allocator in shared memory based on a lock-free free-list of chunk indices
+/// @note If the ThreadLocalChunkCache is enabled for the calling thread, getChunk and freeChunk are served from a
+/// thread local magazine and the usage statistics are updated in batches
 class MemPool
 {
   public:
@@ -69,9 +73,31 @@ class MemPool
 
     void freeChunk(const void* chunk) noexcept;
 
+    /// @brief Acquires multiple chunks with as few operations on the free-list as possible
+    /// @param[out] chunks pointer to a memory with at least numberOfChunks elements which receives the chunks
+    /// @param[in] numberOfChunks the number of chunks to acquire
+    /// @return the number of acquired chunks, which is less than numberOfChunks if the mempool runs empty
+    /// @note bypasses the ThreadLocalChunkCache
+    uint32_t getChunks(void** chunks, const uint32_t numberOfChunks) noexcept;
+
+    /// @brief Releases multiple chunks with as few operations on the free-list as possible
+    /// @param[in] chunks pointer to the chunks to release, all of them must belong to this mempool
+    /// @param[in] numberOfChunks the number of chunks to release
+    /// @note bypasses the ThreadLocalChunkCache
+    void freeChunks(const void* const* chunks, const uint32_t numberOfChunks) noexcept;
+
   private:
+    friend class ThreadLocalChunkCache;
+
+    bool popChunkIndex(uint32_t& index) noexcept;
+    bool pushChunkIndex(const uint32_t index) noexcept;
+    void applyPendingUsedChunks(const int64_t pendingUsedChunks) noexcept;
     void adjustMinFree() noexcept;
     bool isMultipleOfAlignment(const uint32_t value) const noexcept;
+    uint32_t indexOfChunk(const void* chunk) const noexcept;
+
+    /// number of indices which are transferred with a single batch operation on the free-list
+    static constexpr uint32_t INDEX_BATCH_SIZE{32U};
 
     rp::RelativePointer<uint8_t> m_rawMemory;
 
@@ -81,7 +107,9 @@ class MemPool
     uint32_t m_numberOfChunks{0U};
 
     /// @todo: put this into one struct and in a separate class in concurrent.
-    std::atomic<uint32_t> m_usedChunks{0U};
+    /// signed balance since a ThreadLocalChunkCache accounts its loans with a delay, a chunk which is released by
+    /// another thread can therefore be subtracted before it was added
+    std::atomic<int64_t> m_usedChunks{0};
     std::atomic<uint32_t> m_minFree{0U};
     /// @todo: end
 
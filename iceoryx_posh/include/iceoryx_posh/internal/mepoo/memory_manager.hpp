@@ -18,11 +18,13 @@
 #define IOX_POSH_MEPOO_MEMORY_MANAGER_HPP
 
 #include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
 
 #include <cstdint>
 #include <limits>
@@ -39,8 +41,6 @@ class LogStream;
 }
 namespace mepoo
 {
-struct MePooConfig;
-
 class MemoryManager
 {
     using MaxChunkPayloadSize_t = cxx::range<uint32_t, 1, std::numeric_limits<uint32_t>::max() - sizeof(ChunkHeader)>;
@@ -67,8 +67,16 @@ class MemoryManager
     /// @brief Obtains a chunk from the mempools
     /// @param[in] chunkSettings for the requested chunk
     /// @return a SharedChunk if successful, otherwise a MemoryManager::Error
+    /// @note the best fitting mempool is selected via a size-class index in constant time; if it is exhausted and the
+    /// MemPoolSpillPolicy::SPILL_TO_LARGER_MEMPOOLS was configured, the next larger mempools are tried
     cxx::expected<SharedChunk, Error> getChunk(const ChunkSettings& chunkSettings) noexcept;
 
+    /// @brief Determines the mempool which served a chunk obtained from this MemoryManager
+    /// @param[in] chunk which was acquired with getChunk
+    /// @return the index of the mempool the chunk belongs to, cxx::nullopt if the chunk is invalid or does not fit
+    /// to any mempool
+    cxx::optional<uint32_t> getMemPoolIndex(const SharedChunk& chunk) const noexcept;
+
     uint32_t getNumberOfMemPools() const noexcept;
 
     MemPoolInfo getMemPoolInfo(const uint32_t index) const noexcept;
@@ -78,8 +86,16 @@ class MemoryManager
     static uint64_t requiredFullMemorySize(const MePooConfig& mePooConfig) noexcept;
 
   private:
+    /// @brief one size class per power of two of a uint32_t chunk size and an additional one for a chunk size of zero
+    static constexpr uint32_t NUMBER_OF_SIZE_CLASSES{std::numeric_limits<uint32_t>::digits + 1U};
+
     static uint32_t sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t size) noexcept;
 
+    /// @brief size class 0 contains only the chunk size 0, size class n contains the chunk sizes [2^(n-1), 2^n)
+    static uint32_t sizeClassOf(const uint32_t chunkSize) noexcept;
+    void generateSizeClassIndex() noexcept;
+    uint32_t bestFittingMemPoolIndex(const uint32_t requiredChunkSize) const noexcept;
+
     void printMemPoolVector(log::LogStream& log) const noexcept;
     void addMemPool(posix::Allocator& managementAllocator,
                     posix::Allocator& chunkMemoryAllocator,
@@ -90,6 +106,11 @@ class MemoryManager
   private:
     bool m_denyAddMemPool{false};
     uint32_t m_totalNumberOfChunks{0};
+    MemPoolSpillPolicy m_spillPolicy{MemPoolSpillPolicy::BEST_FIT_ONLY};
+
+    /// @brief maps a size class to the index of the first mempool with a chunk size of at least the lower bound of the
+    /// size class; an index equal to the number of mempools means that no mempool is large enough
+    uint32_t m_sizeClassIndex[NUMBER_OF_SIZE_CLASSES]{}; // NOLINT(cppcoreguidelines-avoid-c-arrays)
 
     cxx::vector<MemPool, MAX_NUMBER_OF_MEMPOOLS> m_memPoolVector;
     cxx::vector<MemPool, 1> m_chunkManagementPool;
@@ -17,13 +17,16 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_DISTRIBUTOR_HPP
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_DISTRIBUTOR_HPP
 
+#include "iceoryx_hoofs/cxx/deadline_timer.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/internal/cxx/adaptive_wait.hpp"
 #include "iceoryx_hoofs/internal/cxx/unique_id.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_batch_releaser.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
 
+#include <chrono>
 #include <thread>
 
 namespace iox
@@ -36,6 +39,13 @@ enum class ChunkDistributorError
     QUEUE_NOT_IN_CONTAINER
 };
 
+/// @brief Maximum time the removal of a queue keeps waking up the producers which are blocked by the full queue
+constexpr units::Duration BLOCKED_PRODUCER_WAKE_UP_TIMEOUT{units::Duration::fromMilliseconds(100U)};
+
+/// @brief Number of times the removal of a queue yields to let running deliveries finish before the release of the
+/// queue is deferred to the next call of releaseRemovedQueues
+constexpr uint64_t GRACE_PERIOD_YIELDS_ON_REMOVAL{1000U};
+
 /// @brief The ChunkDistributor is the low layer building block to send SharedChunks to a dynamic number of ChunkQueus.
 /// Together with the ChunkQueuePusher, the ChunkDistributor builds the infrastructure to exchange memory chunks between
 /// different data producers and consumers that could be located in different processes. Besides a modifiable container
@@ -59,6 +69,19 @@ enum class ChunkDistributorError
 /// container to cleanup could be in an inconsistent state as the application was hard terminated while changing it.
 /// We would need a container like the UsedChunkList to have one that is robust against such inconsistencies....
 /// A perfect job for our future selves
+///
+/// deliverToAllStoredQueues does not take the lock for the fan-out. It works on a copy of the stored queues which is
+/// protected by a sequence lock and only updated by the (locked) methods which add or remove queues. A removed queue
+/// is only released after a grace period, i.e. when no delivery which could still see the removed queue is in
+/// progress. The grace period never ends on a timeout; if it does not end shortly after the removal, the release is
+/// deferred to releaseRemovedQueues, which RouDi calls cyclically. A delivery of a terminated process would block the
+/// grace period forever, therefore all queues are released when the distributor is cleaned up. Each stored or not yet
+/// released queue is counted in ChunkQueueData::m_numberOfDistributorReferences, its owner must not destroy it before
+/// this counter is zero.
+///
+/// If a queue with QueueFullPolicy::BLOCK_PRODUCER is full and the ConsumerTooSlowPolicy is WAIT_FOR_CONSUMER, the
+/// delivery sleeps until the consumer signals free space via the semaphore in the ChunkQueueData or the wait for
+/// consumer timeout expires. The time spent blocked is accumulated and can be queried with getTimeWaitedForConsumers.
 template <typename ChunkDistributorDataType>
 class ChunkDistributor
 {
@@ -92,6 +115,11 @@ class ChunkDistributor
     /// @brief Delete all the stored chunk queues
     void removeAllQueues() noexcept;
 
+    /// @brief Releases the removed queues whose grace period is over and starts the grace period for the ones removed
+    /// in the meantime
+    /// @return true if all removed queues are released, otherwise false
+    bool releaseRemovedQueues() noexcept;
+
     /// @brief Get the information whether there are any stored chunk queues
     /// @return true if there are stored chunk queues, false if not
     bool hasStoredQueues() const noexcept;
@@ -136,15 +164,85 @@ class ChunkDistributor
     /// @brief Clears the chunk history
     void clearHistory() noexcept;
 
-    /// @brief cleanup the used shrared memory chunks
+    /// @brief cleanup the used shrared memory chunks and release all queues, must only be called when no delivery can
+    /// happen anymore, i.e. the port of the distributor is destroyed
     void cleanup() noexcept;
 
+    /// @brief Get the accumulated time the deliveries were blocked by full queues of consumers with
+    /// QueueFullPolicy::BLOCK_PRODUCER
+    /// @return the time waited for consumers
+    units::Duration getTimeWaitedForConsumers() const noexcept;
+
   protected:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
     bool pushToQueue(cxx::not_null<ChunkQueueData_t* const> queue, mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Updates the lock-free readable copy of the stored queues, the lock must be held by the caller
+    void publishQueueSnapshot() noexcept;
+
+    /// @brief Releases the queues of a finished grace period and starts the next one if queues are waiting for it, the
+    /// lock must be held by the caller
+    /// @return true if all removed queues are released, otherwise false
+    bool tryToFinishGracePeriod() noexcept;
+
+    /// @brief Hands the reference of a removed queue over to the next grace period, the lock must be held by the caller
+    /// @param[in] queue the queue to release after the next grace period
+    /// @return false if there is no space left to store the queue, otherwise true
+    bool awaitGracePeriod(const rp::RelativePointer<ChunkQueueData_t>& queue) noexcept;
+
+    /// @brief Gives the running deliveries a short time to finish before the release of the removed queues is
+    /// deferred, the lock must be held by the caller
+    void waitBrieflyForGracePeriod() noexcept;
+
+    /// @brief Releases all stored and removed queues regardless of the grace period and frees the notifier slots the
+    /// deliveries of this distributor occupy in them, the lock must be held by the caller
+    void releaseAllQueues() noexcept;
+
+    /// @brief Sleeps until the consumer of the queue signals free space or the wait for consumer timeout expires
+    /// @param[in] queue the full queue; the caller must have registered as blocked producer while holding the lock,
+    /// the registration is released by this method
+    void waitForSpaceInQueue(ChunkQueueData_t& queue) noexcept;
+
+    /// @brief Wakes up the producers which are blocked by a removed queue and waits until they left the queue, the
+    /// lock must be held by the caller
+    /// @param[in] queue the removed queue
+    void wakeUpBlockedProducers(ChunkQueueData_t& queue) noexcept;
+
+    /// @brief Adds the time since blockedSince to the time waited for consumers
+    /// @param[in] blockedSince the point in time when the delivery was blocked
+    void addTimeWaitedForConsumers(const std::chrono::steady_clock::time_point blockedSince) noexcept;
+
+    /// @brief Reads a consistent copy of the stored queues without taking the lock
+    /// @param[out] queues the container which receives the pointers to the stored queues
+    /// @return the sequence number of the copy which was read
+    uint64_t readQueueSnapshot(typename MemberType_t::QueuePointerContainer_t& queues) const noexcept;
+
+    /// @brief Adds the chunk to the history and delivers it to the queues which were added after the copy of the
+    /// queues the lock-free delivery used was read; they received the history before the chunk was part of it
+    /// @param[in] chunk the delivered chunk
+    /// @param[in] snapshotSequenceNumber the sequence number returned by readQueueSnapshot
+    /// @param[in] deliveredQueues the queues of the copy the chunk was delivered to
+    /// @return the number of added queues the chunk was delivered to
+    uint64_t addToHistoryAndDeliverToAddedQueues(
+        mepoo::SharedChunk chunk,
+        const uint64_t snapshotSequenceNumber,
+        const typename MemberType_t::QueuePointerContainer_t& deliveredQueues) noexcept;
+
+    /// @brief Adds the chunk to the history and removes the oldest one if the history is full, the lock must be held
+    /// by the caller
+    /// @param[in] chunk to add to the chunk history
+    void pushToHistory(mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief Registers a lock-free delivery in the current epoch
+    /// @return the epoch which must be passed to leaveLockFreeDelivery
+    uint64_t enterLockFreeDelivery() noexcept;
+
+    /// @brief Unregisters a lock-free delivery
+    /// @param[in] epoch the epoch returned by enterLockFreeDelivery
+    void leaveLockFreeDelivery(const uint64_t epoch) noexcept;
+
   private:
     MemberType_t* m_chunkDistrubutorDataPtr{nullptr};
 };
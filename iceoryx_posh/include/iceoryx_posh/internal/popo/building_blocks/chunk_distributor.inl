@@ -64,6 +64,7 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(cxx::not_null<ChunkQueue
             // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we checked the capacity, so
             // pushing will be fine
             getMembers()->m_queues.push_back(rp::RelativePointer<ChunkQueueData_t>(queueToAdd));
+            getMembers()->m_queues.back()->m_numberOfDistributorReferences.fetch_add(1U, std::memory_order_relaxed);
 
             const auto currChunkHistorySize = getMembers()->m_history.size();
 
@@ -82,6 +83,9 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(cxx::not_null<ChunkQueue
                 pushToQueue(queueToAdd, getMembers()->m_history[i].cloneToSharedChunk());
             }
 
+            // the queue becomes visible for lock-free deliveries after the history was delivered to keep the order
+            publishQueueSnapshot();
+
             return cxx::success<void>();
         }
         else
@@ -104,17 +108,28 @@ inline cxx::expected<ChunkDistributorError> ChunkDistributor<ChunkDistributorDat
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
     const auto iter = std::find(getMembers()->m_queues.begin(), getMembers()->m_queues.end(), queueToRemove);
-    if (iter != getMembers()->m_queues.end())
+    if (iter == getMembers()->m_queues.end())
     {
-        // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we don't use iter any longer so return value can be ignored
-        getMembers()->m_queues.erase(iter);
-
-        return cxx::success<void>();
+        return cxx::error<ChunkDistributorError>(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
     }
-    else
+
+    IOX_DISCARD_RESULT(tryToFinishGracePeriod());
+    if (!awaitGracePeriod(*iter))
     {
-        return cxx::error<ChunkDistributorError>(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
+        // a delivery which does not finish blocks the grace period; the queue stays stored since it could neither be
+        // released safely nor be forgotten
+        errorHandler(PoshError::POPO__CHUNK_DISTRIBUTOR_OVERFLOW_OF_QUEUE_CONTAINER, ErrorLevel::MODERATE);
+        return cxx::error<ChunkDistributorError>(ChunkDistributorError::QUEUE_CONTAINER_OVERFLOW);
     }
+
+    ChunkQueueData_t* removedQueue = iter->get();
+    // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we don't use iter any longer so return value can be ignored
+    getMembers()->m_queues.erase(iter);
+    publishQueueSnapshot();
+    wakeUpBlockedProducers(*removedQueue);
+    waitBrieflyForGracePeriod();
+
+    return cxx::success<void>();
 }
 
 template <typename ChunkDistributorDataType>
@@ -122,7 +137,34 @@ inline void ChunkDistributor<ChunkDistributorDataType>::removeAllQueues() noexce
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    getMembers()->m_queues.clear();
+    IOX_DISCARD_RESULT(tryToFinishGracePeriod());
+    auto& queues = getMembers()->m_queues;
+    typename MemberType_t::QueuePointerContainer_t removedQueues;
+    while (!queues.empty() && awaitGracePeriod(queues.back()))
+    {
+        removedQueues.emplace_back(queues.back().get());
+        queues.pop_back();
+    }
+    if (!queues.empty())
+    {
+        // see tryRemoveQueue
+        errorHandler(PoshError::POPO__CHUNK_DISTRIBUTOR_OVERFLOW_OF_QUEUE_CONTAINER, ErrorLevel::MODERATE);
+    }
+    publishQueueSnapshot();
+
+    for (auto queue : removedQueues)
+    {
+        wakeUpBlockedProducers(*queue);
+    }
+    waitBrieflyForGracePeriod();
+}
+
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::releaseRemovedQueues() noexcept
+{
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+
+    return tryToFinishGracePeriod();
 }
 
 template <typename ChunkDistributorDataType>
@@ -137,17 +179,20 @@ template <typename ChunkDistributorDataType>
 inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept
 {
     uint64_t numberOfQueuesTheChunkWasDeliveredTo{0U};
-    typename ChunkDistributorDataType::QueueContainer_t remainingQueues;
+    // the fan-out does not take the lock and therefore neither stalls nor is stalled by (un)subscriptions; the
+    // delivery stays registered while it is blocked, this way a queue it waits for is not released either
+    const auto epoch = enterLockFreeDelivery();
+    typename ChunkDistributorDataType::QueuePointerContainer_t queues;
+    const auto snapshotSequenceNumber = readQueueSnapshot(queues);
+    typename ChunkDistributorDataType::QueuePointerContainer_t remainingQueues;
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
-
         bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
         // send to all the queues
-        for (auto& queue : getMembers()->m_queues)
+        for (auto queue : queues)
         {
             bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
 
-            if (pushToQueue(queue.get(), chunk))
+            if (pushToQueue(queue, chunk))
             {
                 ++numberOfQueuesTheChunkWasDeliveredTo;
             }
@@ -160,58 +205,69 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQu
                 else
                 {
                     ++numberOfQueuesTheChunkWasDeliveredTo;
-                    ChunkQueuePusher_t(queue.get()).lostAChunk();
+                    ChunkQueuePusher_t(queue).lostAChunk();
+                    getMembers()->m_numberOfLostChunks.add();
                 }
             }
         }
     }
 
-    // busy waiting until every queue is served
-    cxx::internal::adaptive_wait adaptiveWait;
+    if (remainingQueues.empty())
+    {
+        leaveLockFreeDelivery(epoch);
+        numberOfQueuesTheChunkWasDeliveredTo +=
+            addToHistoryAndDeliverToAddedQueues(chunk, snapshotSequenceNumber, queues);
+        return numberOfQueuesTheChunkWasDeliveredTo;
+    }
+
+    // sleep until the consumers of the blocking queues signal that space became available
+    const auto blockedSince = std::chrono::steady_clock::now();
     while (!remainingQueues.empty())
     {
-        adaptiveWait.wait();
+        ChunkQueueData_t* queueToWaitFor{nullptr};
         {
-            // create intersection of current queues and remainingQueues
-            // reason: it is possible that since the last iteration some subscriber have already unsubscribed
-            //          and without this intersection we would deliver to dead queues
             typename MemberType_t::LockGuard_t lock(*getMembers());
-            typename ChunkDistributorDataType::QueueContainer_t queueIntersection(remainingQueues.size());
-            auto greaterThan = [](rp::RelativePointer<ChunkQueueData_t>& a,
-                                  rp::RelativePointer<ChunkQueueData_t>& b) -> bool {
-                return reinterpret_cast<uint64_t>(a.get()) > reinterpret_cast<uint64_t>(b.get());
-            };
-            std::sort(getMembers()->m_queues.begin(), getMembers()->m_queues.end(), greaterThan);
-            std::sort(remainingQueues.begin(), remainingQueues.end(), greaterThan);
-
-            auto iter = std::set_intersection(getMembers()->m_queues.begin(),
-                                              getMembers()->m_queues.end(),
-                                              remainingQueues.begin(),
-                                              remainingQueues.end(),
-                                              queueIntersection.begin(),
-                                              greaterThan);
-            queueIntersection.resize(static_cast<uint64_t>(iter - queueIntersection.begin()));
-            remainingQueues = queueIntersection;
-
-            // deliver to remaining queues
-            for (uint64_t i = remainingQueues.size() - 1U; !remainingQueues.empty(); --i)
+
+            // it is possible that some subscribers have unsubscribed in the meantime and without this check we would
+            // deliver to dead queues
+            const auto& queues = getMembers()->m_queues;
+            for (uint64_t i = remainingQueues.size(); i > 0U; --i)
             {
-                if (pushToQueue(remainingQueues[i].get(), chunk))
+                auto* queue = remainingQueues[i - 1U];
+                const bool isStillStored =
+                    std::any_of(queues.begin(), queues.end(), [&](const rp::RelativePointer<ChunkQueueData_t>& q) {
+                        return q.get() == queue;
+                    });
+                const bool wasDelivered = isStillStored && pushToQueue(queue, chunk);
+                if (wasDelivered)
                 {
-                    remainingQueues.erase(remainingQueues.begin() + i);
                     ++numberOfQueuesTheChunkWasDeliveredTo;
                 }
-
-                // don't move this up since the for loop counts downwards and the algorithm would break
-                if (i == 0U)
+                if (!isStillStored || wasDelivered)
                 {
-                    break;
+                    // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we don't use the returned iterator
+                    remainingQueues.erase(remainingQueues.begin() + (i - 1U));
                 }
             }
+
+            if (!remainingQueues.empty())
+            {
+                // the queue cannot be removed while the lock is held, therefore the producer must register itself
+                // before releasing the lock to be woken up by the removal
+                queueToWaitFor = remainingQueues.front();
+                queueToWaitFor->m_numberOfBlockedProducers.fetch_add(1U, std::memory_order_seq_cst);
+            }
+        }
+
+        if (queueToWaitFor != nullptr)
+        {
+            waitForSpaceInQueue(*queueToWaitFor);
         }
     }
+    leaveLockFreeDelivery(epoch);
+    addTimeWaitedForConsumers(blockedSince);
 
-    addToHistoryWithoutDelivery(chunk);
+    numberOfQueuesTheChunkWasDeliveredTo += addToHistoryAndDeliverToAddedQueues(chunk, snapshotSequenceNumber, queues);
 
     return numberOfQueuesTheChunkWasDeliveredTo;
 }
@@ -220,7 +276,227 @@ template <typename ChunkDistributorDataType>
 inline bool ChunkDistributor<ChunkDistributorDataType>::pushToQueue(cxx::not_null<ChunkQueueData_t* const> queue,
                                                                     mepoo::SharedChunk chunk) noexcept
 {
-    return ChunkQueuePusher_t(queue).push(chunk);
+    return ChunkQueuePusher_t(queue).push(chunk, getMembers()->m_notifierId);
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::publishQueueSnapshot() noexcept
+{
+    auto& members = *getMembers();
+    const auto sequenceNumber = members.m_queueSnapshotSequenceNumber.load(std::memory_order_relaxed);
+
+    // an odd sequence number signals readers that the copy is modified
+    members.m_queueSnapshotSequenceNumber.store(sequenceNumber + 1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    const auto numberOfQueues = members.m_queues.size();
+    for (uint64_t i = 0U; i < numberOfQueues; ++i)
+    {
+        const auto& queue = members.m_queues[i];
+        /// @todo #1196 Unify types to uint64_t
+        members.m_queueSnapshot[i].store(
+            rp::RelativePointerData(static_cast<rp::RelativePointerData::identifier_t>(queue.getId()),
+                                    queue.getOffset()),
+            std::memory_order_relaxed);
+    }
+    members.m_queueSnapshotSize.store(numberOfQueues, std::memory_order_relaxed);
+
+    members.m_queueSnapshotSequenceNumber.store(sequenceNumber + 2U, std::memory_order_release);
+}
+
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::tryToFinishGracePeriod() noexcept
+{
+    auto& members = *getMembers();
+    while (true)
+    {
+        if (members.m_isGracePeriodInProgress)
+        {
+            if (members.m_activeLockFreeDeliveries[members.m_gracePeriodEpoch % 2U].load(std::memory_order_seq_cst)
+                != 0U)
+            {
+                return false;
+            }
+            for (auto& queue : members.m_queuesInGracePeriod)
+            {
+                queue->m_numberOfDistributorReferences.fetch_sub(1U, std::memory_order_release);
+            }
+            members.m_queuesInGracePeriod.clear();
+            members.m_isGracePeriodInProgress = false;
+        }
+
+        if (members.m_queuesAwaitingGracePeriod.empty())
+        {
+            return true;
+        }
+
+        // deliveries which start after the epoch change use the current copy of the queues; only the ones registered
+        // in the previous epoch could still use a removed queue
+        members.m_queuesInGracePeriod = members.m_queuesAwaitingGracePeriod;
+        members.m_queuesAwaitingGracePeriod.clear();
+        members.m_gracePeriodEpoch = members.m_lockFreeDeliveryEpoch.fetch_add(1U, std::memory_order_seq_cst);
+        members.m_isGracePeriodInProgress = true;
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::awaitGracePeriod(
+    const rp::RelativePointer<ChunkQueueData_t>& queue) noexcept
+{
+    auto& awaitingQueues = getMembers()->m_queuesAwaitingGracePeriod;
+    const auto isAlreadyAwaiting =
+        std::any_of(awaitingQueues.begin(),
+                    awaitingQueues.end(),
+                    [&](const rp::RelativePointer<ChunkQueueData_t>& q) { return q.get() == queue.get(); });
+    if (isAlreadyAwaiting)
+    {
+        // the pending release also covers this removal since the grace period did not start yet
+        queue->m_numberOfDistributorReferences.fetch_sub(1U, std::memory_order_release);
+        return true;
+    }
+
+    if (awaitingQueues.size() >= awaitingQueues.capacity())
+    {
+        return false;
+    }
+    // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we checked the capacity
+    awaitingQueues.push_back(queue);
+    return true;
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::waitBrieflyForGracePeriod() noexcept
+{
+    for (uint64_t i = 0U; i < GRACE_PERIOD_YIELDS_ON_REMOVAL; ++i)
+    {
+        if (tryToFinishGracePeriod())
+        {
+            return;
+        }
+        std::this_thread::yield();
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::releaseAllQueues() noexcept
+{
+    auto& members = *getMembers();
+    for (auto queues : {&members.m_queues, &members.m_queuesInGracePeriod, &members.m_queuesAwaitingGracePeriod})
+    {
+        for (auto& queue : *queues)
+        {
+            // a delivery of a terminated process could have left its notifier slot occupied; a queue the delivery
+            // could have pushed to is not released before the cleanup
+            ChunkQueuePusher_t(queue.get()).freeNotifierSlots(members.m_notifierId);
+            queue->m_numberOfDistributorReferences.fetch_sub(1U, std::memory_order_release);
+        }
+        queues->clear();
+    }
+    members.m_isGracePeriodInProgress = false;
+    publishQueueSnapshot();
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::waitForSpaceInQueue(ChunkQueueData_t& queue) noexcept
+{
+    // the queue is checked again after the registration since the consumer signals only registered producers
+    if (queue.m_spaceAvailableSemaphore.has_value() && queue.m_queue.size() >= queue.m_queue.capacity())
+    {
+        // a timeout or a corrupted semaphore just lead to another delivery attempt
+        IOX_DISCARD_RESULT(queue.m_spaceAvailableSemaphore->timedWait(getMembers()->m_waitForConsumerTimeout));
+    }
+    queue.m_numberOfBlockedProducers.fetch_sub(1U, std::memory_order_release);
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::wakeUpBlockedProducers(ChunkQueueData_t& queue) noexcept
+{
+    cxx::DeadlineTimer timeout{BLOCKED_PRODUCER_WAKE_UP_TIMEOUT};
+    cxx::internal::adaptive_wait adaptiveWait;
+    while (queue.m_numberOfBlockedProducers.load(std::memory_order_acquire) != 0U)
+    {
+        if (!queue.m_spaceAvailableSemaphore.has_value() || timeout.hasExpired())
+        {
+            // producers of other distributors which are blocked by this queue re-register themselves, they are
+            // woken up when the queue is removed from their distributor
+            return;
+        }
+        IOX_DISCARD_RESULT(queue.m_spaceAvailableSemaphore->post());
+        adaptiveWait.wait();
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::addTimeWaitedForConsumers(
+    const std::chrono::steady_clock::time_point blockedSince) noexcept
+{
+    const auto blockedDuration = std::chrono::steady_clock::now() - blockedSince;
+    getMembers()->m_timeWaitedForConsumersInNanoseconds.fetch_add(
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(blockedDuration).count()),
+        std::memory_order_relaxed);
+}
+
+template <typename ChunkDistributorDataType>
+inline units::Duration ChunkDistributor<ChunkDistributorDataType>::getTimeWaitedForConsumers() const noexcept
+{
+    return units::Duration::fromNanoseconds(
+        getMembers()->m_timeWaitedForConsumersInNanoseconds.load(std::memory_order_relaxed));
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::readQueueSnapshot(
+    typename MemberType_t::QueuePointerContainer_t& queues) const noexcept
+{
+    const auto& members = *getMembers();
+    while (true)
+    {
+        const auto sequenceNumber = members.m_queueSnapshotSequenceNumber.load(std::memory_order_acquire);
+        if (sequenceNumber % 2U != 0U)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        queues.clear();
+        const auto numberOfQueues =
+            std::min(members.m_queueSnapshotSize.load(std::memory_order_relaxed), queues.capacity());
+        for (uint64_t i = 0U; i < numberOfQueues; ++i)
+        {
+            const auto queue = members.m_queueSnapshot[i].load(std::memory_order_relaxed);
+            queues.emplace_back(
+                rp::RelativePointer<ChunkQueueData_t>::getPtr(rp::segment_id_t{queue.id()}, queue.offset()));
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (members.m_queueSnapshotSequenceNumber.load(std::memory_order_relaxed) == sequenceNumber)
+        {
+            return sequenceNumber;
+        }
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::enterLockFreeDelivery() noexcept
+{
+    auto& members = *getMembers();
+    while (true)
+    {
+        const auto epoch = members.m_lockFreeDeliveryEpoch.load(std::memory_order_seq_cst);
+        members.m_activeLockFreeDeliveries[epoch % 2U].fetch_add(1U, std::memory_order_seq_cst);
+
+        // if the epoch changed in the meantime, the writer might already wait for the other slot
+        if (members.m_lockFreeDeliveryEpoch.load(std::memory_order_seq_cst) == epoch)
+        {
+            return epoch;
+        }
+        members.m_activeLockFreeDeliveries[epoch % 2U].fetch_sub(1U, std::memory_order_seq_cst);
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::leaveLockFreeDelivery(const uint64_t epoch) noexcept
+{
+    getMembers()->m_activeLockFreeDeliveries[epoch % 2U].fetch_sub(1U, std::memory_order_release);
 }
 
 template <typename ChunkDistributorDataType>
@@ -229,37 +505,71 @@ ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const cxx::UniqueId u
                                                            const uint32_t lastKnownQueueIndex,
                                                            mepoo::SharedChunk chunk IOX_MAYBE_UNUSED) noexcept
 {
+    // registered like a lock-free delivery, this way a queue the delivery waits for is not released
+    const auto epoch = enterLockFreeDelivery();
     bool retry{false};
+    bool wasBlocked{false};
+    std::chrono::steady_clock::time_point blockedSince;
     do
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
+        ChunkQueueData_t* queueToWaitFor{nullptr};
+        {
+            typename MemberType_t::LockGuard_t lock(*getMembers());
 
-        auto queueIndex = getQueueIndex(uniqueQueueId, lastKnownQueueIndex);
+            auto queueIndex = getQueueIndex(uniqueQueueId, lastKnownQueueIndex);
 
-        if (!queueIndex.has_value())
-        {
-            return cxx::error<ChunkDistributorError>(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
-        }
+            if (!queueIndex.has_value())
+            {
+                leaveLockFreeDelivery(epoch);
+                if (wasBlocked)
+                {
+                    addTimeWaitedForConsumers(blockedSince);
+                }
+                return cxx::error<ChunkDistributorError>(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
+            }
 
-        auto& queue = getMembers()->m_queues[queueIndex.value()];
+            auto& queue = getMembers()->m_queues[queueIndex.value()];
 
-        bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+            bool willWaitForConsumer =
+                getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
 
-        bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
+            bool isBlockingQueue =
+                (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
 
-        retry = false;
-        if (!pushToQueue(queue.get(), chunk))
-        {
-            if (isBlockingQueue)
-            {
-                retry = true;
-            }
-            else
+            retry = false;
+            if (!pushToQueue(queue.get(), chunk))
             {
-                ChunkQueuePusher_t(queue.get()).lostAChunk();
+                if (isBlockingQueue)
+                {
+                    retry = true;
+                    if (!wasBlocked)
+                    {
+                        wasBlocked = true;
+                        blockedSince = std::chrono::steady_clock::now();
+                    }
+                    // register while the lock is held, see deliverToAllStoredQueues
+                    queueToWaitFor = queue.get();
+                    queueToWaitFor->m_numberOfBlockedProducers.fetch_add(1U, std::memory_order_seq_cst);
+                }
+                else
+                {
+                    ChunkQueuePusher_t(queue.get()).lostAChunk();
+                    getMembers()->m_numberOfLostChunks.add();
+                }
             }
         }
+
+        if (queueToWaitFor != nullptr)
+        {
+            waitForSpaceInQueue(*queueToWaitFor);
+        }
     } while (retry);
+    leaveLockFreeDelivery(epoch);
+
+    if (wasBlocked)
+    {
+        addTimeWaitedForConsumers(blockedSince);
+    }
 
     return cxx::success<>();
 }
@@ -293,21 +603,72 @@ ChunkDistributor<ChunkDistributorDataType>::getQueueIndex(const cxx::UniqueId un
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::addToHistoryWithoutDelivery(mepoo::SharedChunk chunk) noexcept
 {
+    // the history capacity is constant, without history the lock is not required
+    if (0u < getMembers()->m_historyCapacity)
+    {
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+
+        pushToHistory(chunk);
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::pushToHistory(mepoo::SharedChunk chunk) noexcept
+{
+    if (getMembers()->m_history.size() >= getMembers()->m_historyCapacity)
+    {
+        auto chunkToRemove = getMembers()->m_history.begin();
+        chunkToRemove->releaseToSharedChunk();
+        // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we are not iterating here, so return value can be ignored
+        getMembers()->m_history.erase(chunkToRemove);
+    }
+    // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we ensured that there is space in the
+    // history, so return value can be ignored
+    getMembers()->m_history.push_back(chunk);
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::addToHistoryAndDeliverToAddedQueues(
+    mepoo::SharedChunk chunk,
+    const uint64_t snapshotSequenceNumber,
+    const typename MemberType_t::QueuePointerContainer_t& deliveredQueues) noexcept
+{
+    // without history a queue which is added during the delivery behaves as if it was added after it
+    if (0u == getMembers()->m_historyCapacity)
+    {
+        return 0U;
+    }
+
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    if (0u < getMembers()->m_historyCapacity)
+    // the copy changes with every added or removed queue; a queue which was added after the lock-free delivery read
+    // the copy got neither the chunk nor a history containing it and therefore receives the chunk here
+    uint64_t numberOfQueuesTheChunkWasDeliveredTo{0U};
+    if (getMembers()->m_queueSnapshotSequenceNumber.load(std::memory_order_relaxed) != snapshotSequenceNumber)
     {
-        if (getMembers()->m_history.size() >= getMembers()->m_historyCapacity)
+        for (auto& queue : getMembers()->m_queues)
         {
-            auto chunkToRemove = getMembers()->m_history.begin();
-            chunkToRemove->releaseToSharedChunk();
-            // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we are not iterating here, so return value can be ignored
-            getMembers()->m_history.erase(chunkToRemove);
+            const bool wasDelivered =
+                std::find(deliveredQueues.begin(), deliveredQueues.end(), queue.get()) != deliveredQueues.end();
+            if (!wasDelivered)
+            {
+                if (pushToQueue(queue.get(), chunk))
+                {
+                    ++numberOfQueuesTheChunkWasDeliveredTo;
+                }
+                else
+                {
+                    // like the history in tryAddQueue, the chunk is not waited for
+                    ChunkQueuePusher_t(queue.get()).lostAChunk();
+                    getMembers()->m_numberOfLostChunks.add();
+                }
+            }
         }
-        // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we ensured that there is space in the
-        // history, so return value can be ignored
-        getMembers()->m_history.push_back(chunk);
     }
+
+    pushToHistory(chunk);
+
+    return numberOfQueuesTheChunkWasDeliveredTo;
 }
 
 template <typename ChunkDistributorDataType>
@@ -329,9 +690,10 @@ inline void ChunkDistributor<ChunkDistributorDataType>::clearHistory() noexcept
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
+    mepoo::ChunkBatchReleaser chunkReleaser;
     for (auto& unmanagedChunk : getMembers()->m_history)
     {
-        unmanagedChunk.releaseToSharedChunk();
+        chunkReleaser.release(unmanagedChunk.releaseToSharedChunk());
     }
 
     getMembers()->m_history.clear();
@@ -343,6 +705,7 @@ inline void ChunkDistributor<ChunkDistributorDataType>::cleanup() noexcept
     if (getMembers()->tryLock())
     {
         clearHistory();
+        releaseAllQueues();
         getMembers()->unlock();
     }
     else
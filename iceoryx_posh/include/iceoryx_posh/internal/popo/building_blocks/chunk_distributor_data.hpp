@@ -19,15 +19,19 @@
 
 #include "iceoryx_hoofs/cxx/algorithm.hpp"
 #include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_hoofs/internal/cxx/unique_id.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/mutex.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
+#include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer_data.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/single_writer_counter.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <mutex>
 
@@ -44,13 +48,38 @@ struct ChunkDistributorData : public LockingPolicy
     using ChunkQueueData_t = typename ChunkQueuePusherType::MemberType_t;
     using ChunkDistributorDataProperties_t = ChunkDistributorDataProperties;
 
-    ChunkDistributorData(const ConsumerTooSlowPolicy policy, const uint64_t historyCapacity = 0u) noexcept;
+    ChunkDistributorData(const ConsumerTooSlowPolicy policy,
+                         const uint64_t historyCapacity = 0u,
+                         const units::Duration waitForConsumerTimeout = DEFAULT_WAIT_FOR_CONSUMER_TIMEOUT) noexcept;
 
     const uint64_t m_historyCapacity;
 
     using QueueContainer_t =
         cxx::vector<rp::RelativePointer<ChunkQueueData_t>, ChunkDistributorDataProperties_t::MAX_QUEUES>;
     QueueContainer_t m_queues;
+    using QueuePointerContainer_t = cxx::vector<ChunkQueueData_t*, ChunkDistributorDataProperties_t::MAX_QUEUES>;
+
+    /// @brief Read-mostly copy of m_queues which is used to deliver chunks without taking the lock. It is only written
+    /// while the lock is held and protected by a sequence lock, i.e. the sequence number is odd while the copy is
+    /// modified. Readers register themselves in the slot of the current epoch of m_activeLockFreeDeliveries, which
+    /// allows the writer to wait until no reader uses a removed queue anymore.
+    std::atomic<uint64_t> m_queueSnapshotSequenceNumber{0U};
+    std::atomic<uint64_t> m_queueSnapshotSize{0U};
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) must be trivially relocatable in shm
+    std::atomic<rp::RelativePointerData> m_queueSnapshot[ChunkDistributorDataProperties_t::MAX_QUEUES];
+    std::atomic<uint64_t> m_lockFreeDeliveryEpoch{0U};
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) must be trivially relocatable in shm
+    std::atomic<uint64_t> m_activeLockFreeDeliveries[2]{{0U}, {0U}};
+
+    /// @brief Removed queues which a lock-free delivery might still use. The ones in m_queuesInGracePeriod are released
+    /// when the deliveries registered in the slot of m_gracePeriodEpoch are finished, the ones in
+    /// m_queuesAwaitingGracePeriod were removed after this grace period started and wait for the next one.
+    QueueContainer_t m_queuesInGracePeriod;
+    QueueContainer_t m_queuesAwaitingGracePeriod;
+    bool m_isGracePeriodInProgress{false};
+    uint64_t m_gracePeriodEpoch{0U};
+    /// @brief Identifies the pushes of this distributor in the notifier slots of the queues
+    const uint64_t m_notifierId{static_cast<uint64_t>(cxx::UniqueId())};
 
     /// @todo If we would make the ChunkDistributor lock-free, can we than extend the UsedChunkList to
     /// be like a ring buffer and use this for the history? This would be needed to be able to safely cleanup.
@@ -60,6 +89,10 @@ struct ChunkDistributorData : public LockingPolicy
         cxx::vector<mepoo::ShmSafeUnmanagedChunk, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY>;
     HistoryContainer_t m_history;
     const ConsumerTooSlowPolicy m_consumerTooSlowPolicy;
+    const units::Duration m_waitForConsumerTimeout;
+    std::atomic<uint64_t> m_timeWaitedForConsumersInNanoseconds{0U};
+    /// @brief number of chunks which were dropped from the queues of consumers which did not keep up
+    SingleWriterCounter m_numberOfLostChunks;
 };
 
 } // namespace popo
@@ -32,10 +32,13 @@ constexpr T min(const T left, const T right) noexcept
 
 template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
 inline ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, ChunkQueuePusherType>::ChunkDistributorData(
-    const ConsumerTooSlowPolicy policy, const uint64_t historyCapacity) noexcept
+    const ConsumerTooSlowPolicy policy,
+    const uint64_t historyCapacity,
+    const units::Duration waitForConsumerTimeout) noexcept
     : LockingPolicy()
     , m_historyCapacity(min(historyCapacity, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY))
     , m_consumerTooSlowPolicy(policy)
+    , m_waitForConsumerTimeout(waitForConsumerTimeout)
 {
     if (m_historyCapacity != historyCapacity)
     {
@@ -17,8 +17,10 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_DATA_HPP
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_DATA_HPP
 
+#include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/cxx/variant_queue.hpp"
 #include "iceoryx_hoofs/internal/cxx/unique_id.hpp"
+#include "iceoryx_hoofs/posix_wrapper/unnamed_semaphore.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
@@ -26,12 +28,22 @@
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 
+#include <atomic>
+#include <limits>
 #include <mutex>
 
 namespace iox
 {
 namespace popo
 {
+/// @brief Maximum number of producers which notify the condition variable of a chunk queue at the same time, further
+/// producers wait until a slot becomes free
+constexpr uint64_t MAX_NUMBER_OF_ACTIVE_NOTIFIERS{8U};
+/// @brief Marks a free slot in ChunkQueueData::m_activeNotifiers
+constexpr uint64_t NO_NOTIFIER{0U};
+/// @brief Identifies a notifier which cannot be freed by RouDi, e.g. a producer without ChunkDistributor
+constexpr uint64_t ANONYMOUS_NOTIFIER{std::numeric_limits<uint64_t>::max()};
+
 template <typename ChunkQueueDataProperties, typename LockingPolicy>
 struct ChunkQueueData : public LockingPolicy
 {
@@ -46,10 +58,30 @@ struct ChunkQueueData : public LockingPolicy
     static constexpr uint64_t MAX_CAPACITY = ChunkQueueDataProperties_t::MAX_QUEUE_CAPACITY;
     cxx::VariantQueue<mepoo::ShmSafeUnmanagedChunk, MAX_CAPACITY> m_queue;
     std::atomic_bool m_queueHasLostChunks{false};
+    /// @brief number of chunks which were dropped because the queue was full; with multiple producers there are
+    /// multiple writers, therefore this is no SingleWriterCounter, it is only written on overflow anyway
+    std::atomic<uint64_t> m_numberOfLostChunks{0U};
 
     rp::RelativePointer<ConditionVariableData> m_conditionVariableDataPtr;
     cxx::optional<uint64_t> m_conditionVariableNotificationIndex;
+    /// @brief Guards m_conditionVariableDataPtr and m_conditionVariableNotificationIndex for the lock-free notification
+    /// in ChunkQueuePusher::push; the pointer and index are only valid to read when this is true
+    std::atomic_bool m_isConditionVariableSet{false};
+    /// @brief Ids of the pushers which currently notify the condition variable, the condition variable is only detached
+    /// after all of them are finished. The slot of a pusher whose process terminated while notifying is freed by RouDi
+    /// with the cleanup of the ChunkDistributor the pusher belongs to.
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) must be trivially relocatable in shm
+    std::atomic<uint64_t> m_activeNotifiers[MAX_NUMBER_OF_ACTIVE_NOTIFIERS];
     const QueueFullPolicy m_queueFullPolicy;
+
+    /// @brief Signals producers which are blocked by a full queue that space became available; only created with
+    /// QueueFullPolicy::BLOCK_PRODUCER
+    cxx::optional<posix::UnnamedSemaphore> m_spaceAvailableSemaphore;
+    /// @brief Number of producers which wait on m_spaceAvailableSemaphore, the consumer only posts if it is non-zero
+    std::atomic<uint64_t> m_numberOfBlockedProducers{0U};
+    /// @brief Number of chunk distributors which store the queue or did not yet release it after its removal; the
+    /// queue must not be destroyed before this is zero
+    std::atomic<uint64_t> m_numberOfDistributorReferences{0U};
 };
 
 } // namespace popo
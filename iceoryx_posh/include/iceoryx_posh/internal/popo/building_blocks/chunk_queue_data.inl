@@ -27,6 +27,20 @@ inline ChunkQueueData<ChunkQueueProperties, LockingPolicy>::ChunkQueueData(
     : m_queue(queueType)
     , m_queueFullPolicy(policy)
 {
+    for (auto& activeNotifier : m_activeNotifiers)
+    {
+        activeNotifier.store(NO_NOTIFIER, std::memory_order_relaxed);
+    }
+    if (m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER)
+    {
+        posix::UnnamedSemaphoreBuilder()
+            .initialValue(0U)
+            .isInterProcessCapable(true)
+            .create(m_spaceAvailableSemaphore)
+            .or_else([](auto) {
+                errorHandler(PoshError::POPO__CHUNK_QUEUE_DATA_FAILED_TO_CREATE_SEMAPHORE, ErrorLevel::FATAL);
+            });
+    }
 }
 
 } // namespace popo
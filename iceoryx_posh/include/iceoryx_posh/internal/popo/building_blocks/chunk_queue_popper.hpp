@@ -19,6 +19,8 @@
 
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/internal/cxx/adaptive_wait.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_batch_releaser.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
@@ -92,11 +94,23 @@ class ChunkQueuePopper
     /// @return true if condition variable is set, false if not
     bool isConditionVariableSet() const noexcept;
 
+    /// @brief Returns the information whether a chunk distributor stores the queue or did not yet release it after
+    /// its removal
+    /// @return true if the queue is referenced and must not be destroyed, false if not
+    bool isReferencedByDistributors() const noexcept;
+
   protected:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
   private:
+    /// @brief wakes up a producer which is blocked by the full queue, if there is one
+    void signalSpaceAvailable() noexcept;
+
+    /// @brief detaches the condition variable from the pushers and waits until no pusher notifies it anymore
+    /// @note must be called while holding the lock
+    void detachConditionVariable() noexcept;
+
     MemberType_t* m_chunkQueueDataPtr;
 };
 
@@ -53,6 +53,8 @@ inline cxx::optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::t
     // check if queue had an element that was poped and return if so
     if (retVal.has_value())
     {
+        signalSpaceAvailable();
+
         auto chunk = retVal.value().releaseToSharedChunk();
 
         auto receivedChunkHeaderVersion = chunk.getChunkHeader()->chunkHeaderVersion();
@@ -116,11 +118,25 @@ inline uint64_t ChunkQueuePopper<ChunkQueueDataType>::getMaximumCapacity() const
 template <typename ChunkQueueDataType>
 inline void ChunkQueuePopper<ChunkQueueDataType>::clear() noexcept
 {
+    mepoo::ChunkBatchReleaser chunkReleaser;
     while (auto maybeUnmanagedChunk = getMembers()->m_queue.pop())
     {
-        // AXIVION Next Construct AutosarC++19_03-A0.1.2 : d'tor of SharedChunk will release the memory, so RAII has the
-        // side effect here and return value does not need to be evaluated
-        maybeUnmanagedChunk.value().releaseToSharedChunk();
+        chunkReleaser.release(maybeUnmanagedChunk.value().releaseToSharedChunk());
+    }
+    signalSpaceAvailable();
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePopper<ChunkQueueDataType>::signalSpaceAvailable() noexcept
+{
+    // pairs with the registration of the blocked producer which checks the queue again after the registration; either
+    // the producer sees the free space or the consumer sees the blocked producer
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (getMembers()->m_numberOfBlockedProducers.load(std::memory_order_relaxed) > 0U
+        && getMembers()->m_spaceAvailableSemaphore.has_value())
+    {
+        // a failing post only delays the producer until its timeout expires
+        IOX_DISCARD_RESULT(getMembers()->m_spaceAvailableSemaphore->post());
     }
 }
 
@@ -130,8 +146,11 @@ inline void ChunkQueuePopper<ChunkQueueDataType>::setConditionVariable(Condition
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
+    // a pusher could still notify the previous condition variable while it is replaced
+    detachConditionVariable();
     getMembers()->m_conditionVariableDataPtr = &conditionVariableDataRef;
     getMembers()->m_conditionVariableNotificationIndex.emplace(notificationIndex);
+    getMembers()->m_isConditionVariableSet.store(true, std::memory_order_release);
 }
 
 template <typename ChunkQueueDataType>
@@ -139,14 +158,48 @@ inline void ChunkQueuePopper<ChunkQueueDataType>::unsetConditionVariable() noexc
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    getMembers()->m_conditionVariableDataPtr = nullptr;
-    getMembers()->m_conditionVariableNotificationIndex.reset();
+    detachConditionVariable();
 }
 
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePopper<ChunkQueueDataType>::isConditionVariableSet() const noexcept
 {
-    return getMembers()->m_conditionVariableDataPtr.operator bool();
+    return getMembers()->m_isConditionVariableSet.load(std::memory_order_relaxed);
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePopper<ChunkQueueDataType>::isReferencedByDistributors() const noexcept
+{
+    return getMembers()->m_numberOfDistributorReferences.load(std::memory_order_acquire) != 0U;
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePopper<ChunkQueueDataType>::detachConditionVariable() noexcept
+{
+    auto& members = *getMembers();
+    if (!members.m_isConditionVariableSet.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    // pairs with the registration in ChunkQueuePusher::push; either the pusher sees the detached condition variable or
+    // the detach sees the active notifier and waits for it
+    members.m_isConditionVariableSet.store(false, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // there is no timeout since a notifier could still access the condition variable; the slot of a notifier which
+    // terminated is freed by RouDi with the cleanup of its ChunkDistributor
+    cxx::internal::adaptive_wait adaptiveWait;
+    for (auto& activeNotifier : members.m_activeNotifiers)
+    {
+        while (activeNotifier.load(std::memory_order_acquire) != NO_NOTIFIER)
+        {
+            adaptiveWait.wait();
+        }
+    }
+
+    members.m_conditionVariableDataPtr = nullptr;
+    members.m_conditionVariableNotificationIndex.reset();
 }
 
 } // namespace popo
@@ -23,6 +23,9 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 
+#include <atomic>
+#include <thread>
+
 namespace iox
 {
 namespace popo
@@ -47,17 +50,26 @@ class ChunkQueuePusher
 
     /// @brief push a new chunk to the chunk queue
     /// @param[in] shared chunk object
+    /// @param[in] notifierId identifies the producer while it notifies the condition variable, see
+    /// freeNotifierSlots
     /// @return false if a queue overflow occurred, otherwise true
-    bool push(mepoo::SharedChunk chunk) noexcept;
+    bool push(mepoo::SharedChunk chunk, const uint64_t notifierId = ANONYMOUS_NOTIFIER) noexcept;
 
     /// @brief tell the queue that it lost a chunk (e.g. because push failed and there will be no retry)
     void lostAChunk() noexcept;
 
+    /// @brief frees the notifier slots of a producer which terminated while notifying the condition variable; must
+    /// only be called when the producer cannot push anymore
+    /// @param[in] notifierId the id the producer passed to push
+    void freeNotifierSlots(const uint64_t notifierId) noexcept;
+
   protected:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
   private:
+    std::atomic<uint64_t>& registerAsActiveNotifier(const uint64_t notifierId) noexcept;
+
     MemberType_t* m_chunkQueueDataPtr{nullptr};
 };
 
@@ -44,7 +44,8 @@ ChunkQueuePusher<ChunkQueueDataType>::getMembers() noexcept
 }
 
 template <typename ChunkQueueDataType>
-inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk) noexcept
+inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk,
+                                                       const uint64_t notifierId) noexcept
 {
     auto pushRet = getMembers()->m_queue.push(chunk);
     bool hasQueueOverflow = false;
@@ -57,15 +58,17 @@ inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk)
         hasQueueOverflow = true;
     }
 
+    // the registration as active notifier replaces the lock; pairs with the detach in
+    // ChunkQueuePopper::unsetConditionVariable which waits until all active notifiers are finished
+    auto& members = *getMembers();
+    auto& activeNotifier = registerAsActiveNotifier(notifierId);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (members.m_isConditionVariableSet.load(std::memory_order_acquire))
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
-        if (getMembers()->m_conditionVariableDataPtr)
-        {
-            ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
-                              *getMembers()->m_conditionVariableNotificationIndex)
-                .notify();
-        }
+        ConditionNotifier(*members.m_conditionVariableDataPtr.get(), *members.m_conditionVariableNotificationIndex)
+            .notify();
     }
+    activeNotifier.store(NO_NOTIFIER, std::memory_order_release);
 
     return !hasQueueOverflow;
 }
@@ -74,6 +77,40 @@ template <typename ChunkQueueDataType>
 inline void ChunkQueuePusher<ChunkQueueDataType>::lostAChunk() noexcept
 {
     getMembers()->m_queueHasLostChunks.store(true, std::memory_order_relaxed);
+    getMembers()->m_numberOfLostChunks.fetch_add(1U, std::memory_order_relaxed);
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::freeNotifierSlots(const uint64_t notifierId) noexcept
+{
+    for (auto& activeNotifier : getMembers()->m_activeNotifiers)
+    {
+        auto expectedNotifierId = notifierId;
+        IOX_DISCARD_RESULT(activeNotifier.compare_exchange_strong(
+            expectedNotifierId, NO_NOTIFIER, std::memory_order_release, std::memory_order_relaxed));
+    }
+}
+
+template <typename ChunkQueueDataType>
+inline std::atomic<uint64_t>&
+ChunkQueuePusher<ChunkQueueDataType>::registerAsActiveNotifier(const uint64_t notifierId) noexcept
+{
+    auto& activeNotifiers = getMembers()->m_activeNotifiers;
+    while (true)
+    {
+        for (auto& activeNotifier : activeNotifiers)
+        {
+            auto expectedNotifierId = NO_NOTIFIER;
+            if (activeNotifier.load(std::memory_order_relaxed) == NO_NOTIFIER
+                && activeNotifier.compare_exchange_strong(
+                    expectedNotifierId, notifierId, std::memory_order_relaxed, std::memory_order_relaxed))
+            {
+                return activeNotifier;
+            }
+        }
+        // all slots are used by notifiers which finish shortly or by terminated ones which are freed by RouDi
+        std::this_thread::yield();
+    }
 }
 
 } // namespace popo
@@ -91,6 +91,8 @@ class ChunkReceiver : public ChunkQueuePopper<typename ChunkReceiverDataType::Ch
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
+
+    void recordLatency(const mepoo::ChunkHeader& chunkHeader) noexcept;
 };
 
 } // namespace popo
@@ -84,6 +84,11 @@ ChunkReceiver<ChunkReceiverDataType>::tryGet() noexcept
         // if the application holds too many chunks, don't provide more
         if (getMembers()->m_chunksInUse.insert(sharedChunk))
         {
+            getMembers()->m_numberOfReceivedChunks.add();
+            if (getMembers()->m_recordLatency)
+            {
+                recordLatency(*sharedChunk.getChunkHeader());
+            }
             return cxx::success<const mepoo::ChunkHeader*>(
                 const_cast<const mepoo::ChunkHeader*>(sharedChunk.getChunkHeader()));
         }
@@ -97,6 +102,19 @@ ChunkReceiver<ChunkReceiverDataType>::tryGet() noexcept
     return cxx::error<ChunkReceiveResult>(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
 }
 
+template <typename ChunkReceiverDataType>
+inline void ChunkReceiver<ChunkReceiverDataType>::recordLatency(const mepoo::ChunkHeader& chunkHeader) noexcept
+{
+    const auto publishTimestamp = chunkHeader.publishTimestamp();
+    // chunks from publishers without enabled publish timestamp are ignored
+    if (publishTimestamp == 0U)
+    {
+        return;
+    }
+    const auto now = mepoo::ChunkHeader::publishTimestampNow();
+    getMembers()->m_latencyHistogram.record((now > publishTimestamp) ? now - publishTimestamp : 0U);
+}
+
 template <typename ChunkReceiverDataType>
 inline void ChunkReceiver<ChunkReceiverDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
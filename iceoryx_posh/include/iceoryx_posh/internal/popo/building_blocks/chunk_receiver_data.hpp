@@ -21,6 +21,8 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/single_writer_counter.hpp"
 #include "iceoryx_posh/internal/popo/used_chunk_list.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 
@@ -33,7 +35,8 @@ struct ChunkReceiverData : public ChunkQueueDataType
 {
     explicit ChunkReceiverData(const cxx::VariantQueueTypes queueType,
                                const QueueFullPolicy queueFullPolicy,
-                               const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
+                               const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo(),
+                               const bool recordLatency = false) noexcept;
 
     using ChunkQueueData_t = ChunkQueueDataType;
 
@@ -44,6 +47,13 @@ struct ChunkReceiverData : public ChunkQueueDataType
     /// has to return one to not brake the contract. This is aligned with AUTOSAR Adaptive ara::com
     static constexpr uint32_t MAX_CHUNKS_IN_USE = MaxChunksHeldSimultaneously + 1U;
     UsedChunkList<MAX_CHUNKS_IN_USE> m_chunksInUse;
+
+    /// if set, the latency of every taken chunk with a publish timestamp is recorded in m_latencyHistogram
+    const bool m_recordLatency;
+    LatencyHistogram m_latencyHistogram;
+
+    /// number of chunks taken by the user, sampled by the port introspection
+    SingleWriterCounter m_numberOfReceivedChunks;
 };
 
 } // namespace popo
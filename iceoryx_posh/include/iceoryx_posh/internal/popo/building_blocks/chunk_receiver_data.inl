@@ -25,9 +25,11 @@ template <uint32_t MaxChunksHeldSimultaneously, typename ChunkQueueDataType>
 inline ChunkReceiverData<MaxChunksHeldSimultaneously, ChunkQueueDataType>::ChunkReceiverData(
     const cxx::VariantQueueTypes queueType,
     const QueueFullPolicy queueFullPolicy,
-    const mepoo::MemoryInfo& memoryInfo) noexcept
+    const mepoo::MemoryInfo& memoryInfo,
+    const bool recordLatency) noexcept
     : ChunkQueueDataType(queueFullPolicy, queueType)
     , m_memoryInfo(memoryInfo)
+    , m_recordLatency(recordLatency)
 {
 }
 
@@ -111,6 +111,7 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
         mepoo::ChunkSettings::create(userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
     if (chunkSettingsResult.has_error())
     {
+        getMembers()->m_numberOfLoanFailures.add();
         return cxx::error<AllocationError>(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
     }
 
@@ -134,6 +135,7 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
         }
         else
         {
+            getMembers()->m_numberOfLoanFailures.add();
             return cxx::error<AllocationError>(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
         }
     }
@@ -158,11 +160,13 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
             {
                 // release the allocated chunk
                 chunk = nullptr;
+                getMembers()->m_numberOfLoanFailures.add();
                 return cxx::error<AllocationError>(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
             }
         }
         else
         {
+            getMembers()->m_numberOfLoanFailures.add();
             /// @todo iox-#1012 use cxx::error<E2>::from(E1); once available
             return cxx::error<AllocationError>(cxx::into<AllocationError>(getChunkResult.get_error()));
         }
@@ -262,6 +266,13 @@ inline bool ChunkSender<ChunkSenderDataType>::getChunkReadyForSend(const mepoo::
     if (getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
     {
         chunk.getChunkHeader()->setSequenceNumber(getMembers()->m_sequenceNumber++);
+        if (getMembers()->m_publishTimestamp)
+        {
+            chunk.getChunkHeader()->setPublishTimestamp(mepoo::ChunkHeader::publishTimestampNow());
+        }
+        getMembers()->m_numberOfSentChunks.add();
+        getMembers()->m_sentUserPayloadBytes.add(chunk.getChunkHeader()->userPayloadSize());
+        getMembers()->m_lastSentChunkSize.store(chunk.getChunkHeader()->chunkSize(), std::memory_order_relaxed);
         return true;
     }
     else
@@ -22,9 +22,12 @@
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/single_writer_counter.hpp"
 #include "iceoryx_posh/internal/popo/used_chunk_list.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 
+#include <atomic>
+
 namespace iox
 {
 namespace popo
@@ -35,7 +38,9 @@ struct ChunkSenderData : public ChunkDistributorDataType
     explicit ChunkSenderData(cxx::not_null<mepoo::MemoryManager* const> memoryManager,
                              const ConsumerTooSlowPolicy consumerTooSlowPolicy,
                              const uint64_t historyCapacity = 0U,
-                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
+                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo(),
+                             const units::Duration waitForConsumerTimeout = DEFAULT_WAIT_FOR_CONSUMER_TIMEOUT,
+                             const bool publishTimestamp = false) noexcept;
 
     using ChunkDistributorData_t = ChunkDistributorDataType;
 
@@ -43,7 +48,14 @@ struct ChunkSenderData : public ChunkDistributorDataType
     mepoo::MemoryInfo m_memoryInfo;
     UsedChunkList<MaxChunksAllocatedSimultaneously> m_chunksInUse;
     mepoo::SequenceNumber_t m_sequenceNumber{0U};
+    const bool m_publishTimestamp;
     mepoo::ShmSafeUnmanagedChunk m_lastChunkUnmanaged;
+
+    /// counters of the data path which are sampled by the port introspection to compute the throughput
+    SingleWriterCounter m_numberOfSentChunks;
+    SingleWriterCounter m_sentUserPayloadBytes;
+    SingleWriterCounter m_numberOfLoanFailures;
+    std::atomic<uint32_t> m_lastSentChunkSize{0U};
 };
 
 } // namespace popo
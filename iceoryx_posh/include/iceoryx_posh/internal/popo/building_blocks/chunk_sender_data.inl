@@ -26,10 +26,13 @@ inline ChunkSenderData<MaxChunksAllocatedSimultaneously, ChunkDistributorDataTyp
     cxx::not_null<mepoo::MemoryManager* const> memoryManager,
     const ConsumerTooSlowPolicy consumerTooSlowPolicy,
     const uint64_t historyCapacity,
-    const mepoo::MemoryInfo& memoryInfo) noexcept
-    : ChunkDistributorDataType(consumerTooSlowPolicy, historyCapacity)
+    const mepoo::MemoryInfo& memoryInfo,
+    const units::Duration waitForConsumerTimeout,
+    const bool publishTimestamp) noexcept
+    : ChunkDistributorDataType(consumerTooSlowPolicy, historyCapacity, waitForConsumerTimeout)
     , m_memoryMgr(memoryManager)
     , m_memoryInfo(memoryInfo)
+    , m_publishTimestamp(publishTimestamp)
 {
 }
 
@@ -20,6 +20,7 @@
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
+#include "iceoryx_posh/popo/wait_strategy.hpp"
 
 namespace iox
 {
@@ -31,7 +32,11 @@ class ConditionListener
   public:
     using NotificationVector_t = cxx::vector<cxx::BestFittingType_t<MAX_NUMBER_OF_NOTIFIERS>, MAX_NUMBER_OF_NOTIFIERS>;
 
-    explicit ConditionListener(ConditionVariableData& condVarData) noexcept;
+    /// @brief creates a ConditionListener
+    /// @param[in] condVarData the condition variable to wait on
+    /// @param[in] waitStrategy defines if and how long wait() and timedWait() poll before blocking
+    explicit ConditionListener(ConditionVariableData& condVarData,
+                               const WaitStrategy& waitStrategy = WaitStrategy()) noexcept;
     ~ConditionListener() noexcept = default;
     ConditionListener(const ConditionListener& rhs) = delete;
     ConditionListener(ConditionListener&& rhs) noexcept = delete;
@@ -69,14 +74,23 @@ class ConditionListener
     ConditionVariableData* getMembers() noexcept;
 
   private:
-    void resetUnchecked(const uint64_t index) noexcept;
+    /// @brief polls for a notification according to the wait strategy
+    /// @param[in] hasDeadlineExpired returns true when the poll has to be stopped since the wait timed out
+    /// @return true if a notification arrived or destroy() was called, false if the caller has to block
+    bool spinUntilNotified(const cxx::function_ref<bool()>& hasDeadlineExpired) noexcept;
+    /// @brief collects and resets all active notifications in ascending order, the effort is proportional to the
+    ///        number of active notifications and not to the number of possible notifiers
+    void collectActiveNotifications(NotificationVector_t& activeNotifications) noexcept;
+    static uint64_t countTrailingZeros(const uint64_t value) noexcept;
     void resetSemaphore() noexcept;
 
-    NotificationVector_t waitImpl(const cxx::function_ref<bool()>& waitCall) noexcept;
+    NotificationVector_t waitImpl(const cxx::function_ref<bool()>& hasDeadlineExpired,
+                                  const cxx::function_ref<bool()>& waitCall) noexcept;
 
   private:
     ConditionVariableData* m_condVarDataPtr{nullptr};
     std::atomic_bool m_toBeDestroyed{false};
+    WaitStrategy m_waitStrategy;
 };
 
 } // namespace popo
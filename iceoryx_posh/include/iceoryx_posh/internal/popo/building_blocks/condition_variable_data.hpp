@@ -29,6 +29,10 @@ namespace popo
 {
 struct ConditionVariableData
 {
+    static constexpr uint64_t NOTIFICATION_WORD_WIDTH{64U};
+    static constexpr uint64_t NUMBER_OF_NOTIFICATION_WORDS{
+        (MAX_NUMBER_OF_NOTIFIERS + NOTIFICATION_WORD_WIDTH - 1U) / NOTIFICATION_WORD_WIDTH};
+
     ConditionVariableData() noexcept;
     explicit ConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
@@ -38,11 +42,32 @@ struct ConditionVariableData
     ConditionVariableData& operator=(ConditionVariableData&& rhs) = delete;
     ~ConditionVariableData() noexcept = default;
 
+    /// @brief returns the position of the notification word which contains the bit for the provided notifier index
+    /// @param[in] index of the notifier
+    /// @return index into m_activeNotifications
+    static uint64_t notificationWordIndex(const uint64_t index) noexcept;
+
+    /// @brief returns the mask of the bit which represents the provided notifier index in its notification word
+    /// @param[in] index of the notifier
+    /// @return mask with exactly one bit set
+    static uint64_t notificationBitMask(const uint64_t index) noexcept;
+
+    /// @brief checks if the notifier with the provided index has an active notification
+    /// @param[in] index of the notifier
+    /// @return true if the notification is active, otherwise false
+    bool isNotificationActive(const uint64_t index) const noexcept;
+
     cxx::optional<posix::UnnamedSemaphore> m_semaphore;
     RuntimeName_t m_runtimeName;
     std::atomic_bool m_toBeDestroyed{false};
-    std::atomic_bool m_activeNotifications[MAX_NUMBER_OF_NOTIFIERS];
+    /// @brief bitset of the active notifications, the notifier with index i is represented by the bit
+    ///        notificationBitMask(i) in the word m_activeNotifications[notificationWordIndex(i)]
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) shared memory compatible fixed size bitset
+    std::atomic<uint64_t> m_activeNotifications[NUMBER_OF_NOTIFICATION_WORDS];
     std::atomic_bool m_wasNotified{false};
+    /// @brief Number of listeners which are about to wait or wait on m_semaphore, notifiers post the semaphore only if
+    /// it is non-zero and therefore do not make a system call as long as the listener is busy
+    std::atomic<uint64_t> m_numberOfSleepingListeners{0U};
 };
 
 } // namespace popo
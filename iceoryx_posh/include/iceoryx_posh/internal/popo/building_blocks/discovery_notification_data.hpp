@@ -0,0 +1,61 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFICATION_DATA_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFICATION_DATA_HPP
+
+#include "iceoryx_hoofs/concurrent/lockfree_queue.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+
+#include <atomic>
+
+namespace iox
+{
+namespace popo
+{
+enum class DiscoveryPortKind : uint8_t
+{
+    PUBLISHER,
+    SUBSCRIBER,
+    CLIENT,
+    SERVER
+};
+
+/// @brief Identifies a port which requested a state change by its kind and its position in the port pool of RouDi
+struct DirtyPort
+{
+    DiscoveryPortKind kind{DiscoveryPortKind::PUBLISHER};
+    uint64_t index{0U};
+};
+
+/// @brief Shared memory part of the event driven discovery. A port pushes itself into m_dirtyPorts when the user
+///        requests a state change, e.g. offer, subscribe, connect or destroy, and notifies RouDi via the condition
+///        variable. RouDi then handles only these ports instead of waiting for the next cyclic discovery.
+struct DiscoveryNotificationData
+{
+    /// @brief every port is at most once in the queue; only entries of already destroyed ports can exceed this
+    static constexpr uint64_t CAPACITY{MAX_PUBLISHERS + MAX_SUBSCRIBERS + MAX_CLIENTS + MAX_SERVERS};
+
+    concurrent::LockFreeQueue<DirtyPort, CAPACITY> m_dirtyPorts;
+    /// @brief set when a port could not be pushed into m_dirtyPorts; RouDi does a full discovery in this case
+    std::atomic_bool m_hasLostNotifications{false};
+    ConditionVariableData m_conditionVariableData;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFICATION_DATA_HPP
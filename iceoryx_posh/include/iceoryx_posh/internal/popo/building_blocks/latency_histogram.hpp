@@ -0,0 +1,80 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/single_writer_counter.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Histogram with power-of-two nanosecond buckets which is placed in shared memory to record the latency
+///        between publishing and taking a chunk. It is written by the single thread owning the subscriber and read
+///        concurrently by the port introspection, therefore all members are relaxed atomics without any
+///        read-modify-write operation on the hot path. Readers get a consistent view per value but not across
+///        values, which is sufficient for monitoring purposes.
+class LatencyHistogram
+{
+  public:
+    static constexpr uint32_t NUMBER_OF_BUCKETS{NUMBER_OF_LATENCY_HISTOGRAM_BUCKETS};
+
+    LatencyHistogram() noexcept = default;
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram(LatencyHistogram&&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(LatencyHistogram&&) = delete;
+    ~LatencyHistogram() noexcept = default;
+
+    /// @brief records a latency sample
+    /// @param[in] latencyInNanoseconds the latency to record
+    /// @attention must only be called by a single thread at a time
+    void record(const uint64_t latencyInNanoseconds) noexcept;
+
+    /// @brief returns the number of recorded samples
+    uint64_t sampleCount() const noexcept;
+
+    /// @brief returns the sum of all recorded latencies in nanoseconds
+    uint64_t sumInNanoseconds() const noexcept;
+
+    /// @brief returns the largest recorded latency in nanoseconds
+    uint64_t maxInNanoseconds() const noexcept;
+
+    /// @brief returns the number of samples in a bucket
+    /// @param[in] index of the bucket, must be smaller than NUMBER_OF_BUCKETS
+    /// @return the number of samples in the bucket or 0 if the index is out of range
+    uint64_t bucket(const uint32_t index) const noexcept;
+
+    /// @brief returns the bucket in which a latency is counted, i.e. floor(log2(latency)) limited to the last bucket
+    /// @param[in] latencyInNanoseconds the latency for which the bucket shall be determined
+    /// @return index of the bucket
+    static uint32_t bucketIndex(const uint64_t latencyInNanoseconds) noexcept;
+
+  private:
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) fixed size storage in shared memory
+    SingleWriterCounter m_buckets[NUMBER_OF_BUCKETS];
+    SingleWriterCounter m_sampleCount;
+    SingleWriterCounter m_sumInNanoseconds;
+    SingleWriterCounter m_maxInNanoseconds;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
@@ -0,0 +1,62 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_SINGLE_WRITER_COUNTER_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_SINGLE_WRITER_COUNTER_HPP
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Monotonic counter which is placed in shared memory to count events on the data path of a port, e.g. sent
+///        chunks. It is written by the single thread owning the port and read concurrently by the port introspection.
+///        Since there is only one writer, the increment is a relaxed load followed by a relaxed store which avoids
+///        the locked instruction of a read-modify-write operation.
+class SingleWriterCounter
+{
+  public:
+    SingleWriterCounter() noexcept = default;
+    SingleWriterCounter(const SingleWriterCounter&) = delete;
+    SingleWriterCounter(SingleWriterCounter&&) = delete;
+    SingleWriterCounter& operator=(const SingleWriterCounter&) = delete;
+    SingleWriterCounter& operator=(SingleWriterCounter&&) = delete;
+    ~SingleWriterCounter() noexcept = default;
+
+    /// @brief increases the counter
+    /// @param[in] value by which the counter is increased
+    /// @attention must only be called by a single thread at a time
+    void add(const uint64_t value = 1U) noexcept;
+
+    /// @brief increases the counter to a value if it is smaller, e.g. to track a maximum
+    /// @param[in] value to which the counter is increased
+    /// @attention must only be called by a single thread at a time
+    void raiseTo(const uint64_t value) noexcept;
+
+    /// @brief returns the current value of the counter, can be called concurrently to add
+    uint64_t value() const noexcept;
+
+  private:
+    std::atomic<uint64_t> m_value{0U};
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/building_blocks/single_writer_counter.inl"
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_SINGLE_WRITER_COUNTER_HPP
@@ -0,0 +1,46 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_SINGLE_WRITER_COUNTER_INL
+#define IOX_POSH_POPO_BUILDING_BLOCKS_SINGLE_WRITER_COUNTER_INL
+
+#include "iceoryx_posh/internal/popo/building_blocks/single_writer_counter.hpp"
+
+namespace iox
+{
+namespace popo
+{
+inline void SingleWriterCounter::add(const uint64_t value) noexcept
+{
+    m_value.store(m_value.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+inline void SingleWriterCounter::raiseTo(const uint64_t value) noexcept
+{
+    if (value > m_value.load(std::memory_order_relaxed))
+    {
+        m_value.store(value, std::memory_order_relaxed);
+    }
+}
+
+inline uint64_t SingleWriterCounter::value() const noexcept
+{
+    return m_value.load(std::memory_order_relaxed);
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_SINGLE_WRITER_COUNTER_INL
@@ -83,6 +83,10 @@ class BasePort
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
+    /// @brief Informs RouDi that the port has a pending state change which must be discovered. The port is pushed
+    ///        at most once into the dirty port queue until RouDi handled it.
+    void notifyDiscovery() noexcept;
+
   private:
     MemberType_t* m_basePortDataPtr;
 };
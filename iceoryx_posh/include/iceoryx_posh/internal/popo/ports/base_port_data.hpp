@@ -21,6 +21,7 @@
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/capro/capro_message.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notification_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/unique_port_id.hpp"
 
 #include <atomic>
@@ -54,6 +55,13 @@ struct BasePortData
     NodeName_t m_nodeName;
     UniquePortId m_uniqueId;
     std::atomic_bool m_toBeDestroyed{false};
+
+    /// @brief set by RouDi when the port is added to the port pool; stays a nullptr for ports which are not
+    ///        discovered via the port pool, they are only handled by the cyclic discovery
+    rp::RelativePointer<DiscoveryNotificationData> m_discoveryNotificationDataPtr;
+    DirtyPort m_dirtyPort;
+    /// @brief prevents that a port is pushed multiple times into the dirty port queue before RouDi handled it
+    std::atomic_bool m_isDiscoveryNotificationPending{false};
 };
 
 } // namespace popo
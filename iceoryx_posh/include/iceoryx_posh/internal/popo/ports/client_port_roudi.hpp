@@ -70,6 +70,15 @@ class ClientPortRouDi : public BasePort
     /// @attention Contract is that user process is no more running when cleanup is called
     void releaseAllChunks() noexcept;
 
+    /// @brief Returns the information whether a chunk distributor might still deliver to the queue of the port
+    /// @return true if the port must not be destroyed yet, false if not
+    bool isChunkQueueInUse() const noexcept;
+
+    /// @brief Releases the removed queues for which no delivery is in progress anymore, see
+    /// ChunkDistributor::releaseRemovedQueues
+    /// @return true if all removed queues are released, otherwise false
+    bool releaseRemovedQueues() noexcept;
+
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
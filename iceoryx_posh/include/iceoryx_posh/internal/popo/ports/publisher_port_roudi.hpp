@@ -63,6 +63,11 @@ class PublisherPortRouDi : public BasePort
     /// Caution: Contract is that user process is no more running when cleanup is called
     void releaseAllChunks() noexcept;
 
+    /// @brief Releases the removed queues for which no delivery is in progress anymore, see
+    /// ChunkDistributor::releaseRemovedQueues
+    /// @return true if all removed queues are released, otherwise false
+    bool releaseRemovedQueues() noexcept;
+
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
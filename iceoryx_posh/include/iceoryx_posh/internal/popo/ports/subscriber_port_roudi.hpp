@@ -63,6 +63,10 @@ class SubscriberPortRouDi : public BasePort
     /// Caution: Contract is that user process is no more running when cleanup is called
     void releaseAllChunks() noexcept;
 
+    /// @brief Returns the information whether a chunk distributor might still deliver to the queue of the port
+    /// @return true if the port must not be destroyed yet, false if not
+    bool isChunkQueueInUse() const noexcept;
+
   protected:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
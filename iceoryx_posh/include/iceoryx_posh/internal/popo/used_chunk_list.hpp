@@ -17,6 +17,7 @@
 #ifndef IOX_POSH_POPO_USED_CHUNK_LIST_HPP
 #define IOX_POSH_POPO_USED_CHUNK_LIST_HPP
 
+#include "iceoryx_posh/internal/mepoo/chunk_batch_releaser.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
@@ -107,12 +107,13 @@ void UsedChunkList<Capacity>::cleanup() noexcept
 {
     m_synchronizer.test_and_set(std::memory_order_acquire);
 
+    mepoo::ChunkBatchReleaser chunkReleaser;
     for (auto& data : m_listData)
     {
         if (!data.isLogicalNullptr())
         {
             // release ownership by creating a SharedChunk
-            data.releaseToSharedChunk();
+            chunkReleaser.release(data.releaseToSharedChunk());
         }
     }
 
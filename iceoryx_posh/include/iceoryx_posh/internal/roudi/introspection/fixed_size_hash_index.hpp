@@ -0,0 +1,193 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_INTROSPECTION_FIXED_SIZE_HASH_INDEX_HPP
+#define IOX_POSH_ROUDI_INTROSPECTION_FIXED_SIZE_HASH_INDEX_HPP
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @details maps 64 bit keys to indices of a FixedSizeContainer without heap allocation
+/// the keys are stored in an open addressing table with linear probing which has at least
+/// twice the capacity, erase shifts the following entries back, therefore no tombstones
+/// are left behind and the lookup cost does not degrade over time
+/// @note the keys are mixed before they are used, sequential keys like UniquePortIds are fine
+template <uint32_t Capacity>
+class FixedSizeHashIndex
+{
+  public:
+    using Key_t = uint64_t;
+    using Index_t = int32_t;
+    static constexpr Index_t NOT_AN_ELEMENT = -1;
+
+    /// @brief adds a key with its index
+    /// @param[in] key to be added
+    /// @param[in] index associated with the key, must not be negative
+    /// @return false if the key is already present, the index is negative or the capacity is exhausted, true otherwise
+    bool insert(const Key_t key, const Index_t index) noexcept
+    {
+        if (index < 0 || m_size >= Capacity)
+        {
+            return false;
+        }
+
+        uint32_t slot = homeSlot(key);
+        for (; !isEmpty(slot); slot = nextSlot(slot))
+        {
+            if (m_slots[slot].key == key)
+            {
+                return false;
+            }
+        }
+
+        m_slots[slot].key = key;
+        m_slots[slot].index = index;
+        ++m_size;
+        return true;
+    }
+
+    /// @brief replaces the index of an already present key
+    /// @param[in] key to be updated
+    /// @param[in] index new index of the key, must not be negative
+    /// @return false if the key is not present or the index is negative, true otherwise
+    bool assign(const Key_t key, const Index_t index) noexcept
+    {
+        auto slot = findSlot(key);
+        if (index < 0 || slot == NUMBER_OF_SLOTS)
+        {
+            return false;
+        }
+
+        m_slots[slot].index = index;
+        return true;
+    }
+
+    /// @brief looks up the index of a key
+    /// @param[in] key to be looked up
+    /// @return the index of the key or NOT_AN_ELEMENT if the key is not present
+    Index_t find(const Key_t key) const noexcept
+    {
+        auto slot = findSlot(key);
+        return (slot == NUMBER_OF_SLOTS) ? NOT_AN_ELEMENT : m_slots[slot].index;
+    }
+
+    /// @brief removes a key
+    /// @param[in] key to be removed
+    /// @return false if the key was not present, true otherwise
+    bool erase(const Key_t key) noexcept
+    {
+        auto emptiedSlot = findSlot(key);
+        if (emptiedSlot == NUMBER_OF_SLOTS)
+        {
+            return false;
+        }
+
+        // move every entry of the probe sequence behind the removed one back which would not be found anymore
+        for (uint32_t slot = nextSlot(emptiedSlot); !isEmpty(slot); slot = nextSlot(slot))
+        {
+            auto home = homeSlot(m_slots[slot].key);
+            auto distanceToHome = (slot - home) & SLOT_MASK;
+            auto distanceToEmptiedSlot = (slot - emptiedSlot) & SLOT_MASK;
+            if (distanceToHome >= distanceToEmptiedSlot)
+            {
+                m_slots[emptiedSlot] = m_slots[slot];
+                emptiedSlot = slot;
+            }
+        }
+
+        m_slots[emptiedSlot].index = NOT_AN_ELEMENT;
+        --m_size;
+        return true;
+    }
+
+    uint32_t size() const noexcept
+    {
+        return m_size;
+    }
+
+  private:
+    static constexpr uint32_t numberOfSlots() noexcept
+    {
+        uint32_t slots{1U};
+        while (slots < 2U * Capacity)
+        {
+            slots *= 2U;
+        }
+        return slots;
+    }
+
+    static constexpr uint32_t NUMBER_OF_SLOTS = numberOfSlots();
+    static constexpr uint32_t SLOT_MASK = NUMBER_OF_SLOTS - 1U;
+
+    static uint32_t homeSlot(Key_t key) noexcept
+    {
+        // finalizer of splitmix64, spreads sequential keys over the whole table
+        key ^= key >> 30U;
+        key *= 0xbf58476d1ce4e5b9U;
+        key ^= key >> 27U;
+        key *= 0x94d049bb133111ebU;
+        key ^= key >> 31U;
+        return static_cast<uint32_t>(key) & SLOT_MASK;
+    }
+
+    static uint32_t nextSlot(const uint32_t slot) noexcept
+    {
+        return (slot + 1U) & SLOT_MASK;
+    }
+
+    bool isEmpty(const uint32_t slot) const noexcept
+    {
+        return m_slots[slot].index == NOT_AN_ELEMENT;
+    }
+
+    uint32_t findSlot(const Key_t key) const noexcept
+    {
+        for (uint32_t slot = homeSlot(key); !isEmpty(slot); slot = nextSlot(slot))
+        {
+            if (m_slots[slot].key == key)
+            {
+                return slot;
+            }
+        }
+        return NUMBER_OF_SLOTS;
+    }
+
+    struct Slot
+    {
+        Key_t key{0U};
+        Index_t index{NOT_AN_ELEMENT};
+    };
+
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) fixed size storage without heap allocation
+    Slot m_slots[NUMBER_OF_SLOTS];
+    uint32_t m_size{0U};
+};
+
+template <uint32_t Capacity>
+constexpr typename FixedSizeHashIndex<Capacity>::Index_t FixedSizeHashIndex<Capacity>::NOT_AN_ELEMENT;
+
+template <uint32_t Capacity>
+constexpr uint32_t FixedSizeHashIndex<Capacity>::NUMBER_OF_SLOTS;
+
+template <uint32_t Capacity>
+constexpr uint32_t FixedSizeHashIndex<Capacity>::SLOT_MASK;
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_INTROSPECTION_FIXED_SIZE_HASH_INDEX_HPP
@@ -18,6 +18,7 @@
 #define IOX_POSH_ROUDI_INTROSPECTION_PORT_INTROSPECTION_HPP
 
 #include "fixed_size_container.hpp"
+#include "fixed_size_hash_index.hpp"
 #include "iceoryx_hoofs/cxx/function.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/internal/concurrent/periodic_task.hpp"
@@ -29,8 +30,7 @@
 
 #include <atomic>
 #include <mutex>
-
-#include <map>
+#include <type_traits>
 
 namespace iox
 {
@@ -60,7 +60,8 @@ class PortIntrospection
       private:
         /// internal helper classes
 
-        struct ConnectionInfo;
+        using Index_t = int32_t;
+        static constexpr Index_t NOT_AN_ELEMENT{-1};
 
         struct PublisherInfo
         {
@@ -68,45 +69,40 @@ class PortIntrospection
             {
             }
 
-            PublisherInfo(typename PublisherPort::MemberType_t& portData) noexcept
-                : portData(&portData)
-                , process(portData.m_runtimeName)
-                , service(portData.m_serviceDescription)
-                , node(portData.m_nodeName)
-            {
-            }
+            PublisherInfo(typename PublisherPort::MemberType_t& portData) noexcept;
+
+            bool hasService(const capro::ServiceDescription& service) const noexcept;
 
             typename PublisherPort::MemberType_t* portData{nullptr};
-            RuntimeName_t process;
-            capro::ServiceDescription service;
-            NodeName_t node;
+            /// the entry of the port topic, it is assembled once since it does not change while the port exists
+            PublisherPortData topicData;
+            uint64_t serviceHash{0U};
+
+            /// position of topicData in the kept port topic
+            uint64_t topicEntry{0U};
 
+            /// neighbours in the list of publishers whose services have the same hash
+            Index_t previousWithSameService{NOT_AN_ELEMENT};
+            Index_t nextWithSameService{NOT_AN_ELEMENT};
+
+            /// counter values of the previous throughput sample, the rates are computed from the difference
             using TimePointNs_t = mepoo::TimePointNs_t;
             using DurationNs_t = mepoo::DurationNs_t;
-            TimePointNs_t m_sequenceNumberTimestamp{DurationNs_t(0)};
-            mepoo::SequenceNumber_t m_sequenceNumber{0U};
-
-            /// map from indices to object pointers
-            std::map<int, ConnectionInfo*> connectionMap;
-            int index{-1};
+            TimePointNs_t m_throughputSampleTimestamp{DurationNs_t(0)};
+            uint64_t m_numberOfSentChunksAtThroughputSample{0U};
+            uint64_t m_sentUserPayloadBytesAtThroughputSample{0U};
         };
 
         struct SubscriberInfo
         {
             SubscriberInfo() noexcept = default;
 
-            SubscriberInfo(typename SubscriberPort::MemberType_t& portData) noexcept
-                : portData(&portData)
-                , process(portData.m_runtimeName)
-                , service(portData.m_serviceDescription)
-                , node(portData.m_nodeName)
-            {
-            }
+            SubscriberInfo(typename SubscriberPort::MemberType_t& portData) noexcept;
 
             typename SubscriberPort::MemberType_t* portData{nullptr};
-            RuntimeName_t process;
-            capro::ServiceDescription service;
-            NodeName_t node;
+            /// the entry of the port topic, it is assembled once since it does not change while the port exists
+            SubscriberPortData topicData;
+            uint64_t serviceHash{0U};
         };
 
         struct ConnectionInfo
@@ -129,10 +125,19 @@ class PortIntrospection
             PublisherInfo* publisherInfo{nullptr};
             ConnectionState state{ConnectionState::DEFAULT};
 
+            /// position of subscriberInfo.topicData in the kept port topic
+            uint64_t topicEntry{0U};
+
+            /// neighbours in the list of connections whose services have the same hash
+            Index_t previousWithSameService{NOT_AN_ELEMENT};
+            Index_t nextWithSameService{NOT_AN_ELEMENT};
+
             bool isConnected() const noexcept
             {
                 return publisherInfo && state == ConnectionState::CONNECTED;
             }
+
+            bool hasService(const capro::ServiceDescription& service) const noexcept;
         };
 
       public:
@@ -180,6 +185,9 @@ class PortIntrospection
         /// @param[out] topic data structure to be prepared for sending
         void prepareTopic(PortIntrospectionTopic& topic) noexcept;
 
+        /// @brief prepare the throughput topic by sampling the data path counters of all tracked publisher ports
+        /// @param[out] topic data structure to be prepared for sending
+        /// @note the rates refer to the time since the previous call, they are zero for the first sample of a port
         void prepareTopic(PortThroughputIntrospectionTopic& topic) noexcept;
 
         void prepareTopic(SubscriberPortChangingIntrospectionFieldTopic& topic) noexcept;
@@ -213,21 +221,71 @@ class PortIntrospection
       private:
         using PublisherContainer = FixedSizeContainer<PublisherInfo, MAX_PUBLISHERS>;
         using ConnectionContainer = FixedSizeContainer<ConnectionInfo, MAX_SUBSCRIBERS>;
-
-        /// @brief inner map maps from unique port IDs to indices in the PublisherContainer
-        std::map<capro::ServiceDescription, std::map<popo::UniquePortId, typename PublisherContainer::Index_t>>
-            m_publisherMap;
-
-        /// inner map maps from unique port IDs to indices in the ConnectionContainer
-        std::map<capro::ServiceDescription, std::map<popo::UniquePortId, typename ConnectionContainer::Index_t>>
-            m_connectionMap;
-
-        /// @note we avoid allocating the objects on the heap but can still use a map
-        /// to locate/remove them fast(er)
+        static_assert(std::is_same<typename PublisherContainer::Index_t, Index_t>::value, "index types must match");
+        static_assert(std::is_same<typename ConnectionContainer::Index_t, Index_t>::value, "index types must match");
+
+        /// @brief hash of the id strings of a service, it is the key of the service indices
+        static uint64_t serviceHash(const capro::ServiceDescription& service) noexcept;
+
+        /// @brief adds an entry in front of the list of entries whose services have the same hash
+        template <typename Container, typename ServiceIndex>
+        static void linkByService(Container& container,
+                                  ServiceIndex& serviceIndex,
+                                  const Index_t index,
+                                  const uint64_t hash) noexcept;
+
+        /// @brief removes an entry from the list of entries whose services have the same hash
+        template <typename Container, typename ServiceIndex>
+        static void unlinkByService(Container& container,
+                                    ServiceIndex& serviceIndex,
+                                    const Index_t index,
+                                    const uint64_t hash) noexcept;
+
+        /// @brief appends the topic data of a newly added entry to the kept port topic
+        /// @return the position of the topic data in the kept port topic
+        template <typename TopicList, typename EntryOwners, typename TopicData>
+        static uint64_t addTopicEntry(TopicList& topicList,
+                                      EntryOwners& entryOwners,
+                                      const TopicData& topicData,
+                                      const Index_t index) noexcept;
+
+        /// @brief removes the topic data of an entry from the kept port topic, the last entry takes its place
+        template <typename TopicList, typename EntryOwners, typename Container>
+        static void removeTopicEntry(TopicList& topicList,
+                                     EntryOwners& entryOwners,
+                                     Container& container,
+                                     const Index_t index) noexcept;
+
+        /// @brief calls a function for every entry with the given service, the newest entry comes first
+        template <typename Container, typename ServiceIndex, typename Callable>
+        static void forEachWithService(Container& container,
+                                       const ServiceIndex& serviceIndex,
+                                       const capro::ServiceDescription& service,
+                                       const Callable& callable) noexcept;
+
+        /// @note we avoid allocating the objects on the heap, the containers hold the entries and the
+        /// hash indices below locate them by unique port id or by service without a search
         /// max number needs to be a compile time constant
         PublisherContainer m_publisherContainer;
         ConnectionContainer m_connectionContainer;
 
+        /// maps the unique port ids to indices in the containers
+        FixedSizeHashIndex<MAX_PUBLISHERS> m_publisherIdIndex;
+        FixedSizeHashIndex<MAX_SUBSCRIBERS> m_connectionIdIndex;
+
+        /// maps service hashes to the first entry of a list linked via previous/nextWithSameService,
+        /// different services can share a hash therefore the service of every list entry has to be checked
+        FixedSizeHashIndex<MAX_PUBLISHERS> m_publisherServiceIndex;
+        FixedSizeHashIndex<MAX_SUBSCRIBERS> m_connectionServiceIndex;
+
+        /// the port topic is kept up to date when a port is added or removed, a send only copies it into the
+        /// loaned chunk; a sent chunk cannot be reused since subscribers and the history may still hold it
+        PortIntrospectionTopic m_portTopic;
+
+        /// container indices of the entries of the kept port topic, the other topics use the same order
+        cxx::vector<Index_t, MAX_PUBLISHERS> m_publisherOfTopicEntry;
+        cxx::vector<Index_t, MAX_SUBSCRIBERS> m_connectionOfTopicEntry;
+
         std::atomic<bool> m_newData;
         std::mutex m_mutex;
     };
@@ -175,57 +175,225 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::stop() noexcept
 }
 
 template <typename PublisherPort, typename SubscriberPort>
-inline bool PortIntrospection<PublisherPort, SubscriberPort>::PortData::updateConnectionState(
-    const capro::CaproMessage& message) noexcept
+constexpr typename PortIntrospection<PublisherPort, SubscriberPort>::PortData::Index_t
+    PortIntrospection<PublisherPort, SubscriberPort>::PortData::NOT_AN_ELEMENT;
+
+template <typename PublisherPort, typename SubscriberPort>
+inline PortIntrospection<PublisherPort, SubscriberPort>::PortData::PublisherInfo::PublisherInfo(
+    typename PublisherPort::MemberType_t& portData) noexcept
+    : portData(&portData)
+    , serviceHash(PortData::serviceHash(portData.m_serviceDescription))
+{
+    const auto& service = portData.m_serviceDescription;
+    topicData.m_publisherPortID = static_cast<uint64_t>(portData.m_uniqueId);
+    topicData.m_sourceInterface = service.getSourceInterface();
+    topicData.m_name = portData.m_runtimeName;
+    topicData.m_node = portData.m_nodeName;
+    topicData.m_caproInstanceID = service.getInstanceIDString();
+    topicData.m_caproServiceID = service.getServiceIDString();
+    topicData.m_caproEventMethodID = service.getEventIDString();
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline bool PortIntrospection<PublisherPort, SubscriberPort>::PortData::PublisherInfo::hasService(
+    const capro::ServiceDescription& service) const noexcept
 {
-    const capro::ServiceDescription& service = message.m_serviceDescription;
-    capro::CaproMessageType messageType = message.m_type;
+    return topicData.m_caproServiceID == service.getServiceIDString()
+           && topicData.m_caproInstanceID == service.getInstanceIDString()
+           && topicData.m_caproEventMethodID == service.getEventIDString();
+}
 
-    std::lock_guard<std::mutex> lock(m_mutex);
+template <typename PublisherPort, typename SubscriberPort>
+inline PortIntrospection<PublisherPort, SubscriberPort>::PortData::SubscriberInfo::SubscriberInfo(
+    typename SubscriberPort::MemberType_t& portData) noexcept
+    : portData(&portData)
+    , serviceHash(PortData::serviceHash(portData.m_serviceDescription))
+{
+    const auto& service = portData.m_serviceDescription;
+    topicData.m_name = portData.m_runtimeName;
+    topicData.m_node = portData.m_nodeName;
+    topicData.m_caproInstanceID = service.getInstanceIDString();
+    topicData.m_caproServiceID = service.getServiceIDString();
+    topicData.m_caproEventMethodID = service.getEventIDString();
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline bool PortIntrospection<PublisherPort, SubscriberPort>::PortData::ConnectionInfo::hasService(
+    const capro::ServiceDescription& service) const noexcept
+{
+    const auto& topicData = subscriberInfo.topicData;
+    return topicData.m_caproServiceID == service.getServiceIDString()
+           && topicData.m_caproInstanceID == service.getInstanceIDString()
+           && topicData.m_caproEventMethodID == service.getEventIDString();
+}
 
-    auto iter = m_connectionMap.find(service);
-    if (iter == m_connectionMap.end())
+template <typename PublisherPort, typename SubscriberPort>
+inline uint64_t PortIntrospection<PublisherPort, SubscriberPort>::PortData::serviceHash(
+    const capro::ServiceDescription& service) noexcept
+{
+    // FNV-1a, the terminating zeros separate the id strings
+    constexpr uint64_t FNV_OFFSET_BASIS{14695981039346656037U};
+    constexpr uint64_t FNV_PRIME{1099511628211U};
+
+    uint64_t hash{FNV_OFFSET_BASIS};
+    for (const auto* id : {&service.getServiceIDString(), &service.getInstanceIDString(), &service.getEventIDString()})
     {
-        return false; // no corresponding capro Id ...
+        const char* character = id->c_str();
+        for (uint64_t i = 0U; i <= id->size(); ++i)
+        {
+            hash ^= static_cast<uint8_t>(character[i]);
+            hash *= FNV_PRIME;
+        }
     }
+    return hash;
+}
 
-    auto& innerConnectionMap = iter->second;
+template <typename PublisherPort, typename SubscriberPort>
+template <typename Container, typename ServiceIndex>
+inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::linkByService(Container& container,
+                                                                                    ServiceIndex& serviceIndex,
+                                                                                    const Index_t index,
+                                                                                    const uint64_t hash) noexcept
+{
+    auto& entry = container[index];
+    entry.previousWithSameService = NOT_AN_ELEMENT;
+    entry.nextWithSameService = serviceIndex.find(hash);
 
-    for (auto& pair : innerConnectionMap)
+    if (entry.nextWithSameService == NOT_AN_ELEMENT)
     {
-        auto& connection = m_connectionContainer[pair.second];
-        connection.state = getNextState<iox::build::CommunicationPolicy>(connection.state, messageType);
+        serviceIndex.insert(hash, index);
     }
+    else
+    {
+        container[entry.nextWithSameService].previousWithSameService = index;
+        serviceIndex.assign(hash, index);
+    }
+}
 
-    setNew(true);
-    return true;
+template <typename PublisherPort, typename SubscriberPort>
+template <typename Container, typename ServiceIndex>
+inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::unlinkByService(Container& container,
+                                                                                      ServiceIndex& serviceIndex,
+                                                                                      const Index_t index,
+                                                                                      const uint64_t hash) noexcept
+{
+    auto& entry = container[index];
+    if (entry.nextWithSameService != NOT_AN_ELEMENT)
+    {
+        container[entry.nextWithSameService].previousWithSameService = entry.previousWithSameService;
+    }
+
+    if (entry.previousWithSameService != NOT_AN_ELEMENT)
+    {
+        container[entry.previousWithSameService].nextWithSameService = entry.nextWithSameService;
+    }
+    else if (entry.nextWithSameService != NOT_AN_ELEMENT)
+    {
+        serviceIndex.assign(hash, entry.nextWithSameService);
+    }
+    else
+    {
+        serviceIndex.erase(hash);
+    }
+
+    entry.previousWithSameService = NOT_AN_ELEMENT;
+    entry.nextWithSameService = NOT_AN_ELEMENT;
 }
 
 template <typename PublisherPort, typename SubscriberPort>
-inline bool PortIntrospection<PublisherPort, SubscriberPort>::PortData::updateSubscriberConnectionState(
-    const capro::CaproMessage& message, const popo::UniquePortId& id) noexcept
+template <typename TopicList, typename EntryOwners, typename TopicData>
+inline uint64_t PortIntrospection<PublisherPort, SubscriberPort>::PortData::addTopicEntry(TopicList& topicList,
+                                                                                        EntryOwners& entryOwners,
+                                                                                        const TopicData& topicData,
+                                                                                        const Index_t index) noexcept
+{
+    // the owners and the topic lists have the same capacity as the containers, therefore this cannot fail
+    topicList.emplace_back(topicData);
+    entryOwners.emplace_back(index);
+    return topicList.size() - 1U;
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+template <typename TopicList, typename EntryOwners, typename Container>
+inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::removeTopicEntry(TopicList& topicList,
+                                                                                       EntryOwners& entryOwners,
+                                                                                       Container& container,
+                                                                                       const Index_t index) noexcept
+{
+    const uint64_t entry = container[index].topicEntry;
+    const uint64_t lastEntry = topicList.size() - 1U;
+    if (entry != lastEntry)
+    {
+        topicList[entry] = topicList[lastEntry];
+        entryOwners[entry] = entryOwners[lastEntry];
+        container[entryOwners[entry]].topicEntry = entry;
+    }
+    topicList.pop_back();
+    entryOwners.pop_back();
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+template <typename Container, typename ServiceIndex, typename Callable>
+inline void
+PortIntrospection<PublisherPort, SubscriberPort>::PortData::forEachWithService(Container& container,
+                                                                              const ServiceIndex& serviceIndex,
+                                                                              const capro::ServiceDescription& service,
+                                                                              const Callable& callable) noexcept
+{
+    for (auto index = serviceIndex.find(serviceHash(service)); index != NOT_AN_ELEMENT;
+         index = container[index].nextWithSameService)
+    {
+        auto& entry = container[index];
+        if (entry.hasService(service))
+        {
+            callable(entry);
+        }
+    }
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline bool PortIntrospection<PublisherPort, SubscriberPort>::PortData::updateConnectionState(
+    const capro::CaproMessage& message) noexcept
 {
     const capro::ServiceDescription& service = message.m_serviceDescription;
     capro::CaproMessageType messageType = message.m_type;
 
     std::lock_guard<std::mutex> lock(m_mutex);
 
-    auto iter = m_connectionMap.find(service);
-    if (iter == m_connectionMap.end())
+    bool hasConnection{false};
+    forEachWithService(m_connectionContainer, m_connectionServiceIndex, service, [&](ConnectionInfo& connection) {
+        connection.state = getNextState<iox::build::CommunicationPolicy>(connection.state, messageType);
+        hasConnection = true;
+    });
+
+    if (!hasConnection)
     {
         return false; // no corresponding capro Id ...
     }
 
-    auto& innerConnectionMap = iter->second;
+    setNew(true);
+    return true;
+}
 
-    auto iterInnerMap = innerConnectionMap.find(id);
-    if (iterInnerMap == innerConnectionMap.end())
+template <typename PublisherPort, typename SubscriberPort>
+inline bool PortIntrospection<PublisherPort, SubscriberPort>::PortData::updateSubscriberConnectionState(
+    const capro::CaproMessage& message, const popo::UniquePortId& id) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto connectionIndex = m_connectionIdIndex.find(static_cast<uint64_t>(id));
+    if (connectionIndex == NOT_AN_ELEMENT)
     {
         return false;
     }
 
-    auto& connection = m_connectionContainer[iterInnerMap->second];
-    connection.state = getNextState<iox::build::CommunicationPolicy>(connection.state, messageType);
+    auto& connection = m_connectionContainer[connectionIndex];
+    if (!connection.hasService(message.m_serviceDescription))
+    {
+        return false; // no corresponding capro Id ...
+    }
+
+    connection.state = getNextState<iox::build::CommunicationPolicy>(connection.state, message.m_type);
 
     setNew(true);
     return true;
@@ -237,55 +405,30 @@ inline bool PortIntrospection<PublisherPort, SubscriberPort>::PortData::addPubli
 {
     std::lock_guard<std::mutex> lock(m_mutex);
 
-    auto service = port.m_serviceDescription;
-    auto uniqueId = port.m_uniqueId;
-
-    auto index = m_publisherContainer.add(PublisherInfo(port));
-    if (index < 0)
+    const auto uniqueId = static_cast<uint64_t>(port.m_uniqueId);
+    if (m_publisherIdIndex.find(uniqueId) != NOT_AN_ELEMENT)
     {
         return false;
     }
 
-    auto iter = m_publisherMap.find(service);
-    if (iter == m_publisherMap.end())
-    {
-        // service is new, create new map
-        std::map<popo::UniquePortId, typename PublisherContainer::Index_t> innerPublisherMap;
-        innerPublisherMap.insert(std::make_pair(uniqueId, index));
-        m_publisherMap.insert(std::make_pair(service, innerPublisherMap));
-    }
-    else
+    auto index = m_publisherContainer.add(PublisherInfo(port));
+    if (index < 0)
     {
-        // service exists, add new entry
-        auto& innerPublisherMap = iter->second;
-        auto iter = innerPublisherMap.find(uniqueId);
-        if (iter == innerPublisherMap.end())
-        {
-            innerPublisherMap.insert(std::make_pair(uniqueId, index));
-        }
-        else
-        {
-            return false;
-        }
+        return false;
     }
 
-    // connect publisher to all subscribers with the same Id
+    // the index has the same capacity as the container, therefore this cannot fail
+    m_publisherIdIndex.insert(uniqueId, index);
     PublisherInfo* publisher = m_publisherContainer.get(index);
+    linkByService(m_publisherContainer, m_publisherServiceIndex, index, publisher->serviceHash);
+    publisher->topicEntry =
+        addTopicEntry(m_portTopic.m_publisherList, m_publisherOfTopicEntry, publisher->topicData, index);
 
-    // find corresponding subscribers
-    auto connIter = m_connectionMap.find(service);
-    if (connIter != m_connectionMap.end())
-    {
-        auto& innerConnectionMap = connIter->second;
-        for (auto& pair : innerConnectionMap)
-        {
-            auto& connection = m_connectionContainer[pair.second];
-            if (service == connection.subscriberInfo.service)
-            {
-                connection.publisherInfo = publisher;
-            }
-        }
-    }
+    // connect publisher to all subscribers with the same Id
+    forEachWithService(
+        m_connectionContainer, m_connectionServiceIndex, port.m_serviceDescription, [&](ConnectionInfo& connection) {
+            connection.publisherInfo = publisher;
+        });
 
     setNew(true);
     return true;
@@ -297,52 +440,35 @@ inline bool PortIntrospection<PublisherPort, SubscriberPort>::PortData::addSubsc
 {
     std::lock_guard<std::mutex> lock(m_mutex);
 
-    auto service = portData.m_serviceDescription;
-    auto uniqueId = portData.m_uniqueId;
-
-    auto index = m_connectionContainer.add(ConnectionInfo(portData));
-    if (index < 0)
+    const auto uniqueId = static_cast<uint64_t>(portData.m_uniqueId);
+    if (m_connectionIdIndex.find(uniqueId) != NOT_AN_ELEMENT)
     {
         return false;
     }
 
-    auto iter = m_connectionMap.find(service);
-
-    if (iter == m_connectionMap.end())
-    {
-        // service is new, create new map
-        std::map<popo::UniquePortId, typename ConnectionContainer::Index_t> innerConnectionMap;
-        innerConnectionMap.insert(std::make_pair(uniqueId, index));
-        m_connectionMap.insert(std::make_pair(service, innerConnectionMap));
-    }
-    else
+    auto index = m_connectionContainer.add(ConnectionInfo(portData));
+    if (index < 0)
     {
-        // service exists, add new entry
-        auto& innerConnectionMap = iter->second;
-        auto iter = innerConnectionMap.find(uniqueId);
-        if (iter == innerConnectionMap.end())
-        {
-            innerConnectionMap.insert(std::make_pair(uniqueId, index));
-        }
-        else
-        {
-            return false;
-        }
+        return false;
     }
 
+    // the index has the same capacity as the container, therefore this cannot fail
+    m_connectionIdIndex.insert(uniqueId, index);
     auto& connection = m_connectionContainer[index];
+    linkByService(m_connectionContainer, m_connectionServiceIndex, index, connection.subscriberInfo.serviceHash);
+    connection.topicEntry = addTopicEntry(
+        m_portTopic.m_subscriberList, m_connectionOfTopicEntry, connection.subscriberInfo.topicData, index);
+
+    // set corresponding publisher if exists, the newest one comes first
+    forEachWithService(
+        m_publisherContainer, m_publisherServiceIndex, portData.m_serviceDescription, [&](PublisherInfo& publisher) {
+            if (connection.publisherInfo == nullptr)
+            {
+                connection.publisherInfo = &publisher;
+            }
+        });
 
-    auto sendIter = m_publisherMap.find(service);
-    if (sendIter != m_publisherMap.end())
-    {
-        auto& innerPublisherMap = sendIter->second;
-        for (auto& iter : innerPublisherMap)
-        {
-            auto publisher = m_publisherContainer.get(iter.second);
-            connection.publisherInfo = publisher; // set corresponding publisher if exists
-        }
-    }
-
+    setNew(true);
     return true;
 }
 
@@ -352,30 +478,30 @@ PortIntrospection<PublisherPort, SubscriberPort>::PortData::removePublisher(cons
 {
     std::lock_guard<std::mutex> lock(m_mutex);
 
-    auto iter = m_publisherMap.find(port.getCaProServiceDescription());
-    if (iter == m_publisherMap.end())
+    const auto uniqueId = static_cast<uint64_t>(port.getUniqueID());
+    auto publisherIndex = m_publisherIdIndex.find(uniqueId);
+    if (publisherIndex == NOT_AN_ELEMENT)
     {
         return false;
     }
+    auto& publisher = m_publisherContainer[publisherIndex];
 
-    auto& innerPublisherMap = iter->second;
-    auto iterInnerMap = innerPublisherMap.find(port.getUniqueID());
-    if (iterInnerMap == innerPublisherMap.end())
+    // disconnect publisher from all its subscribers, they are in the list of its service hash
+    for (auto index = m_connectionServiceIndex.find(publisher.serviceHash); index != NOT_AN_ELEMENT;
+         index = m_connectionContainer[index].nextWithSameService)
     {
-        return false;
-    }
-    auto m_publisherIndex = iterInnerMap->second;
-    auto& publisher = m_publisherContainer[m_publisherIndex];
-
-    // disconnect publisher from all its subscribers
-    for (auto& pair : publisher.connectionMap)
-    {
-        pair.second->publisherInfo = nullptr;          // publisher is disconnected
-        pair.second->state = ConnectionState::DEFAULT; // connection state is now default
+        auto& connection = m_connectionContainer[index];
+        if (connection.publisherInfo == &publisher)
+        {
+            connection.publisherInfo = nullptr;          // publisher is disconnected
+            connection.state = ConnectionState::DEFAULT; // connection state is now default
+        }
     }
 
-    innerPublisherMap.erase(iterInnerMap);
-    m_publisherContainer.remove(m_publisherIndex);
+    unlinkByService(m_publisherContainer, m_publisherServiceIndex, publisherIndex, publisher.serviceHash);
+    removeTopicEntry(m_portTopic.m_publisherList, m_publisherOfTopicEntry, m_publisherContainer, publisherIndex);
+    m_publisherIdIndex.erase(uniqueId);
+    m_publisherContainer.remove(publisherIndex);
     setNew(true); // indicates we have to send new data because
                   // something changed
 
@@ -388,35 +514,18 @@ PortIntrospection<PublisherPort, SubscriberPort>::PortData::removeSubscriber(con
 {
     std::lock_guard<std::mutex> lock(m_mutex);
 
-    auto iter = m_connectionMap.find(port.getCaProServiceDescription());
-    if (iter == m_connectionMap.end())
+    const auto uniqueId = static_cast<uint64_t>(port.getUniqueID());
+    auto connectionIndex = m_connectionIdIndex.find(uniqueId);
+    if (connectionIndex == NOT_AN_ELEMENT)
     {
         return false; // not found and therefore not removed
     }
 
-    auto& innerConnectionMap = iter->second;
-    auto mapIter = innerConnectionMap.find(port.getUniqueID());
-
-    if (mapIter == innerConnectionMap.end())
-    {
-        return false; // not found and therefore not removed
-    }
-
-    // remove subscriber in corresponding publisher
-    auto connectionIndex = mapIter->second;
     auto& connection = m_connectionContainer[connectionIndex];
-    auto& publisher = connection.publisherInfo;
-
-    if (publisher)
-    {
-        auto connIter = publisher->connectionMap.find(connectionIndex);
-        if (connIter != publisher->connectionMap.end())
-        {
-            publisher->connectionMap.erase(connIter);
-        }
-    }
-
-    innerConnectionMap.erase(mapIter);
+    unlinkByService(
+        m_connectionContainer, m_connectionServiceIndex, connectionIndex, connection.subscriberInfo.serviceHash);
+    removeTopicEntry(m_portTopic.m_subscriberList, m_connectionOfTopicEntry, m_connectionContainer, connectionIndex);
+    m_connectionIdIndex.erase(uniqueId);
     m_connectionContainer.remove(connectionIndex);
 
     setNew(true);
@@ -520,69 +629,75 @@ template <typename PublisherPort, typename SubscriberPort>
 inline void
 PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(PortIntrospectionTopic& topic) noexcept
 {
-    auto& m_publisherList = topic.m_publisherList;
-
     std::lock_guard<std::mutex> lock(m_mutex); // we need to lock the internal data structs
 
-    int32_t index{0};
-    for (auto& pub : m_publisherMap)
-    {
-        auto& innerPublisherMap = pub.second;
-        for (auto& pair : innerPublisherMap)
+    // only the entries of added or removed ports were written since the last send, the kept topic is copied
+    // into the freshly loaned chunk since the previous one may still be held by subscribers
+    topic = m_portTopic;
+
+    // needs to be done while holding the lock
+    setNew(false);
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(
+    PortThroughputIntrospectionTopic& topic) noexcept
+{
+    constexpr double NANOSECONDS_PER_SECOND{1000000000.0};
+    constexpr double SECONDS_PER_MINUTE{60.0};
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const mepoo::TimePointNs_t now = mepoo::BaseClock_t::now();
+
+    // same order as in the port topic, this allows the consumers to match the entries without a search
+    for (const auto index : m_publisherOfTopicEntry)
+    {
+        auto& publisherInfo = m_publisherContainer[index];
+        // the counters are written by the publishing application, they are only read here
+        const auto& senderData = publisherInfo.portData->m_chunkSenderData;
+        const uint64_t numberOfSentChunks = senderData.m_numberOfSentChunks.value();
+        const uint64_t sentUserPayloadBytes = senderData.m_sentUserPayloadBytes.value();
+
+        PortThroughputData throughputData;
+        throughputData.m_publisherPortID = static_cast<uint64_t>(publisherInfo.portData->m_uniqueId);
+        throughputData.m_chunkSize = senderData.m_lastSentChunkSize.load(std::memory_order_relaxed);
+        throughputData.m_isField = senderData.m_historyCapacity > 0U;
+        throughputData.m_numberOfSentSamples = numberOfSentChunks;
+        throughputData.m_numberOfSentBytes = sentUserPayloadBytes;
+        throughputData.m_numberOfLostSamples = senderData.m_numberOfLostChunks.value();
+        throughputData.m_numberOfLoanFailures = senderData.m_numberOfLoanFailures.value();
+        if (numberOfSentChunks > 0U)
         {
-            auto m_publisherIndex = pair.second;
-            if (m_publisherIndex >= 0)
-            {
-                auto& publisherInfo = m_publisherContainer[m_publisherIndex];
-                PublisherPortData publisherData;
-                PublisherPort port(publisherInfo.portData);
-                publisherData.m_publisherPortID = static_cast<uint64_t>(port.getUniqueID());
-                publisherData.m_sourceInterface = publisherInfo.service.getSourceInterface();
-                publisherData.m_name = publisherInfo.process;
-                publisherData.m_node = publisherInfo.node;
-
-                publisherData.m_caproInstanceID = publisherInfo.service.getInstanceIDString();
-                publisherData.m_caproServiceID = publisherInfo.service.getServiceIDString();
-                publisherData.m_caproEventMethodID = publisherInfo.service.getEventIDString();
-
-                m_publisherList.emplace_back(publisherData);
-                publisherInfo.index = index++;
-            }
+            throughputData.m_sampleSize = static_cast<uint32_t>(sentUserPayloadBytes / numberOfSentChunks);
         }
-    }
 
-    auto& m_subscriberList = topic.m_subscriberList;
-    for (auto& connPair : m_connectionMap)
-    {
-        for (auto& pair : connPair.second)
+        const bool hasPreviousSample = publisherInfo.m_throughputSampleTimestamp.time_since_epoch().count() != 0;
+        const auto intervalInNanoseconds = (now - publisherInfo.m_throughputSampleTimestamp).count();
+        if (hasPreviousSample && intervalInNanoseconds > 0)
         {
-            auto connectionIndex = pair.second;
-            if (connectionIndex >= 0)
+            const uint64_t chunksInInterval = numberOfSentChunks - publisherInfo.m_numberOfSentChunksAtThroughputSample;
+            const uint64_t bytesInInterval =
+                sentUserPayloadBytes - publisherInfo.m_sentUserPayloadBytesAtThroughputSample;
+            const double intervalInSeconds = static_cast<double>(intervalInNanoseconds) / NANOSECONDS_PER_SECOND;
+
+            throughputData.m_chunksPerMinute =
+                static_cast<double>(chunksInInterval) / intervalInSeconds * SECONDS_PER_MINUTE;
+            throughputData.m_bytesPerSecond = static_cast<double>(bytesInInterval) / intervalInSeconds;
+            // the counters provide no timestamp of the individual sends, therefore this is the mean interval
+            if (chunksInInterval > 0U)
             {
-                auto& connection = m_connectionContainer[connectionIndex];
-                SubscriberPortData subscriberData;
-                auto& subscriberInfo = connection.subscriberInfo;
-
-                subscriberData.m_name = subscriberInfo.process;
-                subscriberData.m_node = subscriberInfo.node;
-
-                subscriberData.m_caproInstanceID = subscriberInfo.service.getInstanceIDString();
-                subscriberData.m_caproServiceID = subscriberInfo.service.getServiceIDString();
-                subscriberData.m_caproEventMethodID = subscriberInfo.service.getEventIDString();
-                m_subscriberList.emplace_back(subscriberData);
+                throughputData.m_lastSendIntervalInNanoseconds =
+                    static_cast<uint64_t>(intervalInNanoseconds) / chunksInInterval;
             }
         }
-    }
 
-    // needs to be done while holding the lock
-    setNew(false);
-}
+        publisherInfo.m_throughputSampleTimestamp = now;
+        publisherInfo.m_numberOfSentChunksAtThroughputSample = numberOfSentChunks;
+        publisherInfo.m_sentUserPayloadBytesAtThroughputSample = sentUserPayloadBytes;
 
-template <typename PublisherPort, typename SubscriberPort>
-inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(
-    PortThroughputIntrospectionTopic& topic IOX_MAYBE_UNUSED) noexcept
-{
-    /// @todo #402 re-add port throughput
+        topic.m_throughputList.emplace_back(throughputData);
+    }
 }
 
 template <typename PublisherPort, typename SubscriberPort>
@@ -590,35 +705,44 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareT
     SubscriberPortChangingIntrospectionFieldTopic& topic) noexcept
 {
     std::lock_guard<std::mutex> lock(m_mutex);
-    for (auto& connPair : m_connectionMap)
+    // same order as in the port topic
+    for (const auto index : m_connectionOfTopicEntry)
     {
-        for (auto& pair : connPair.second)
+        auto& subscriberInfo = m_connectionContainer[index].subscriberInfo;
+        SubscriberPortChangingData subscriberData;
+        if (subscriberInfo.portData != nullptr)
         {
-            auto connectionIndex = pair.second;
-            if (connectionIndex >= 0)
-            {
-                auto& connection = m_connectionContainer[connectionIndex];
-                auto& subscriberInfo = connection.subscriberInfo;
-                SubscriberPortChangingData subscriberData;
-                if (subscriberInfo.portData != nullptr)
-                {
-                    SubscriberPort port(subscriberInfo.portData);
-                    subscriberData.subscriptionState = port.getSubscriptionState();
+            SubscriberPort port(subscriberInfo.portData);
+            subscriberData.subscriptionState = port.getSubscriptionState();
 
-                    // subscriberData.fifoCapacity = port .getDeliveryFiFoCapacity();
-                    // subscriberData.fifoSize = port.getDeliveryFiFoSize();
-                    subscriberData.propagationScope = port.getCaProServiceDescription().getScope();
-                }
-                else
+            // subscriberData.fifoCapacity = port .getDeliveryFiFoCapacity();
+            // subscriberData.fifoSize = port.getDeliveryFiFoSize();
+            subscriberData.propagationScope = port.getCaProServiceDescription().getScope();
+
+            const auto& receiverData = subscriberInfo.portData->m_chunkReceiverData;
+            subscriberData.latencyRecordingEnabled = receiverData.m_recordLatency;
+            if (receiverData.m_recordLatency)
+            {
+                const auto& histogram = receiverData.m_latencyHistogram;
+                subscriberData.latencySampleCount = histogram.sampleCount();
+                subscriberData.latencySumInNanoseconds = histogram.sumInNanoseconds();
+                subscriberData.maxLatencyInNanoseconds = histogram.maxInNanoseconds();
+                for (uint32_t i = 0U; i < NUMBER_OF_LATENCY_HISTOGRAM_BUCKETS; ++i)
                 {
-                    subscriberData.fifoCapacity = 0u;
-                    subscriberData.fifoSize = 0u;
-                    subscriberData.subscriptionState = iox::SubscribeState::NOT_SUBSCRIBED;
-                    subscriberData.propagationScope = capro::Scope::INVALID;
+                    subscriberData.latencyHistogram[i] = histogram.bucket(i);
                 }
-                topic.subscriberPortChangingDataList.push_back(subscriberData);
             }
+            subscriberData.numberOfReceivedSamples = receiverData.m_numberOfReceivedChunks.value();
+            subscriberData.numberOfLostSamples = receiverData.m_numberOfLostChunks.load(std::memory_order_relaxed);
+        }
+        else
+        {
+            subscriberData.fifoCapacity = 0u;
+            subscriberData.fifoSize = 0u;
+            subscriberData.subscriptionState = iox::SubscribeState::NOT_SUBSCRIBED;
+            subscriberData.propagationScope = capro::Scope::INVALID;
         }
+        topic.subscriberPortChangingDataList.push_back(subscriberData);
     }
 }
 
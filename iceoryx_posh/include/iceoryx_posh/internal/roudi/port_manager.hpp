@@ -67,6 +67,14 @@ class PortManager
 
     void doDiscovery() noexcept;
 
+    /// @brief Handles only the publisher, subscriber, client and server ports which announced a state change since
+    ///        the last call; falls back to doDiscovery if announcements were lost
+    void doDiscoveryForNotifiedPorts() noexcept;
+
+    /// @brief Returns the condition variable which is notified when a port announces a state change
+    /// @return reference to the ConditionVariableData in the port pool
+    popo::ConditionVariableData& getDiscoveryConditionVariableData() noexcept;
+
     cxx::expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     acquirePublisherPortData(const capro::ServiceDescription& service,
                              const popo::PublisherOptions& publisherOptions,
@@ -161,6 +169,8 @@ class PortManager
 
     void doDiscoveryForServerPort(popo::ServerPortRouDi& serverPort) noexcept;
 
+    void handleNotifiedPort(const popo::DirtyPort& dirtyPort) noexcept;
+
     void handleInterfaces() noexcept;
 
     void handleNodes() noexcept;
@@ -200,7 +210,16 @@ class PortManager
 
     bool isInternal(const capro::ServiceDescription& service) const noexcept;
 
-    void publishServiceRegistry() const noexcept;
+    void publishServiceRegistry() noexcept;
+
+    /// @brief Publishes the whole registry if a delta or the previous snapshot could not be published; this is done
+    ///        at the end of a discovery run
+    void publishPendingServiceRegistry() noexcept;
+
+    /// @brief Publishes the delta of a modified service and the whole registry every
+    ///        SERVICE_REGISTRY_SNAPSHOT_INTERVAL generations; does nothing if the registry was not modified
+    /// @param[in] service which was added to or removed from the registry
+    void publishServiceRegistryChange(const capro::ServiceDescription& service) noexcept;
 
     const ServiceRegistry& serviceRegistry() const noexcept;
 
@@ -211,6 +230,9 @@ class PortManager
     PortIntrospectionType m_portIntrospection;
     cxx::vector<capro::ServiceDescription, NUMBER_OF_INTERNAL_PUBLISHERS> m_internalServices;
     cxx::optional<PublisherPortRouDiType::MemberType_t*> m_serviceRegistryPublisherPortData;
+    cxx::optional<PublisherPortRouDiType::MemberType_t*> m_serviceRegistryDeltaPublisherPortData;
+    uint64_t m_publishedServiceRegistryGeneration{0U};
+    bool m_isServiceRegistryPublicationPending{false};
 
     // some ports for the service registry requires special handling
     // as we cannot send registry information if it was not created yet
@@ -28,7 +28,7 @@ inline cxx::optional<RuntimeName_t>
 PortManager::doesViolateCommunicationPolicy(const capro::ServiceDescription& service) noexcept
 {
     // check if the publisher is already in the list
-    for (auto publisherPortData : m_portPool->getPublisherPortDataList())
+    for (auto publisherPortData : m_portPool->getPublisherPortDataList(service))
     {
         popo::PublisherPortRouDi publisherPort(publisherPortData);
         if (service == publisherPort.getCaProServiceDescription())
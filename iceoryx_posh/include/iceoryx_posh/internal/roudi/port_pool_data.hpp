@@ -21,11 +21,13 @@
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notification_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/interface_port.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/server_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
+#include "iceoryx_posh/internal/roudi/service_port_index.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
 
 namespace iox
@@ -48,6 +50,16 @@ class FixedPositionContainer
 
     cxx::vector<T*, Capacity> content() noexcept;
 
+    /// @brief returns the position of an element; the position stays the same until the element is erased
+    /// @param[in] element which was created by insert
+    /// @return the position of the element or Capacity if the element is not stored in this container
+    uint64_t indexOf(const T* const element) const noexcept;
+
+    /// @brief returns the element at a position which was acquired by indexOf
+    /// @param[in] index of the element
+    /// @return pointer to the element or a nullptr if there is no element at this position
+    T* at(const uint64_t index) noexcept;
+
   private:
     cxx::vector<cxx::optional<T>, Capacity> m_data;
 };
@@ -63,6 +75,14 @@ struct PortPoolData
 
     FixedPositionContainer<iox::popo::ServerPortData, MAX_SERVERS> m_serverPortMembers;
     FixedPositionContainer<iox::popo::ClientPortData, MAX_CLIENTS> m_clientPortMembers;
+
+    /// @brief the positions of the ports in the containers above by service description, maintained by the PortPool
+    ServicePortIndex<MAX_PUBLISHERS> m_publisherPortIndex;
+    ServicePortIndex<MAX_SUBSCRIBERS> m_subscriberPortIndex;
+    ServicePortIndex<MAX_SERVERS> m_serverPortIndex;
+    ServicePortIndex<MAX_CLIENTS> m_clientPortIndex;
+
+    popo::DiscoveryNotificationData m_discoveryNotificationData;
 };
 
 } // namespace roudi
@@ -86,6 +86,29 @@ cxx::vector<T*, Capacity> FixedPositionContainer<T, Capacity>::content() noexcep
     return returnValue;
 }
 
+template <typename T, uint64_t Capacity>
+uint64_t FixedPositionContainer<T, Capacity>::indexOf(const T* const element) const noexcept
+{
+    for (uint64_t i = 0U; i < m_data.size(); ++i)
+    {
+        if (m_data[i].has_value() && &m_data[i].value() == element)
+        {
+            return i;
+        }
+    }
+    return Capacity;
+}
+
+template <typename T, uint64_t Capacity>
+T* FixedPositionContainer<T, Capacity>::at(const uint64_t index) noexcept
+{
+    if (index < m_data.size() && m_data[index].has_value())
+    {
+        return &m_data[index].value();
+    }
+    return nullptr;
+}
+
 } // namespace roudi
 } // namespace iox
 
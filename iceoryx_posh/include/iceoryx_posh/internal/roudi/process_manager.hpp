@@ -144,12 +144,22 @@ class ProcessManager : public ProcessManagerInterface
                              const popo::ServerOptions& serverOptions,
                              const PortConfigInfo& portConfigInfo) noexcept;
 
+    /// @brief Adds all ports of a IpcMessageType::CREATE_PORTS_BATCH to the internal process object and sends them to
+    /// the OS process with a single IpcMessageType::CREATE_PORTS_BATCH_ACK
+    /// @param[in] name is the name of the runtime requesting the ports
+    /// @param[in] message is the batch message with one fixed-layout port request per entry after the runtime name
+    void addPortsForProcess(const RuntimeName_t& name, const runtime::IpcMessage& message) noexcept;
+
     void addConditionVariableForProcess(const RuntimeName_t& runtimeName) noexcept;
 
     void initIntrospection(ProcessIntrospectionType* processIntrospection) noexcept;
 
     void run() noexcept;
 
+    /// @brief Handles the ports which announced a state change since the last call, without the cyclic monitoring
+    ///        and full discovery of run()
+    void discoveryUpdateForNotifiedPorts() noexcept;
+
     popo::PublisherPortData* addIntrospectionPublisherPort(const capro::ServiceDescription& service) noexcept;
 
     /// @brief Notify the application that it sent an unsupported message
@@ -157,8 +167,46 @@ class ProcessManager : public ProcessManagerInterface
 
 
   private:
+    using PortOffset_t = cxx::expected<rp::UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType>;
+    using SegmentUserInformation_t = mepoo::SegmentManager<>::SegmentUserInformation;
+
     cxx::optional<Process*> findProcess(const RuntimeName_t& name) noexcept;
 
+    PortOffset_t acquireSubscriberPort(const RuntimeName_t& name,
+                                       const capro::ServiceDescription& service,
+                                       const popo::SubscriberOptions& subscriberOptions,
+                                       const PortConfigInfo& portConfigInfo) noexcept;
+
+    PortOffset_t acquirePublisherPort(const RuntimeName_t& name,
+                                      const SegmentUserInformation_t& segmentInfo,
+                                      const capro::ServiceDescription& service,
+                                      const popo::PublisherOptions& publisherOptions,
+                                      const PortConfigInfo& portConfigInfo) noexcept;
+
+    PortOffset_t acquireClientPort(const RuntimeName_t& name,
+                                   const SegmentUserInformation_t& segmentInfo,
+                                   const capro::ServiceDescription& service,
+                                   const popo::ClientOptions& clientOptions,
+                                   const PortConfigInfo& portConfigInfo) noexcept;
+
+    PortOffset_t acquireServerPort(const RuntimeName_t& name,
+                                   const SegmentUserInformation_t& segmentInfo,
+                                   const capro::ServiceDescription& service,
+                                   const popo::ServerOptions& serverOptions,
+                                   const PortConfigInfo& portConfigInfo) noexcept;
+
+    void addPortFromBatchEntry(const RuntimeName_t& name,
+                               const SegmentUserInformation_t& segmentInfo,
+                               const std::string& entry,
+                               runtime::IpcMessage& sendBuffer) noexcept;
+
+    /// @brief appends either the ackType and the offset of the port or ERROR and the error type
+    void appendPortResponse(runtime::IpcMessage& sendBuffer,
+                            const runtime::IpcMessageType ackType,
+                            const PortOffset_t& port) const noexcept;
+
+    void sendPortResponse(Process& process, const runtime::IpcMessageType ackType, const PortOffset_t& port) noexcept;
+
     void monitorProcesses() noexcept;
     void discoveryUpdate() noexcept override;
 
@@ -0,0 +1,75 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_SERVICE_PORT_INDEX_HPP
+#define IOX_POSH_ROUDI_SERVICE_PORT_INDEX_HPP
+
+#include "iceoryx_hoofs/cxx/function_ref.hpp"
+#include "iceoryx_posh/capro/service_description.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Hash index from a service description to the positions of the ports in a FixedPositionContainer. The
+///        positions of a bucket are chained in ascending order via a next-position table, therefore the index
+///        neither allocates memory nor contains pointers and can be placed in shared memory.
+/// @tparam Capacity the number of positions which can be indexed, positions must be in [0, Capacity)
+template <uint64_t Capacity>
+class ServicePortIndex
+{
+    static_assert(Capacity > 0U, "the ServicePortIndex requires a capacity of at least one");
+
+  public:
+    /// @brief one bucket per position keeps the load factor at most one
+    static constexpr uint64_t NUMBER_OF_BUCKETS{Capacity};
+    static constexpr uint64_t INVALID_POSITION{Capacity};
+
+    ServicePortIndex() noexcept;
+
+    /// @brief Adds a port to the index
+    /// @param[in] service of the port
+    /// @param[in] position of the port in the container; must not be in the index already
+    void add(const capro::ServiceDescription& service, const uint64_t position) noexcept;
+
+    /// @brief Removes a port from the index, positions which are not in the index are ignored
+    /// @param[in] service of the port, must be the same as for add
+    /// @param[in] position of the port in the container
+    void remove(const capro::ServiceDescription& service, const uint64_t position) noexcept;
+
+    /// @brief Calls the callable in ascending order with the positions of all ports which share the bucket with the
+    ///        service; the caller has to compare the service descriptions since different services can collide
+    /// @param[in] service to look up
+    /// @param[in] callable which is called with the position of each candidate
+    void forEachCandidate(const capro::ServiceDescription& service,
+                          const cxx::function_ref<void(const uint64_t)> callable) const noexcept;
+
+  private:
+    static uint64_t bucketOf(const capro::ServiceDescription& service) noexcept;
+
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) stored in shared memory
+    uint64_t m_bucketHeads[NUMBER_OF_BUCKETS];
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) stored in shared memory
+    uint64_t m_nextPositions[Capacity];
+};
+
+} // namespace roudi
+} // namespace iox
+
+#include "iceoryx_posh/internal/roudi/service_port_index.inl"
+
+#endif // IOX_POSH_ROUDI_SERVICE_PORT_INDEX_HPP
@@ -0,0 +1,100 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_SERVICE_PORT_INDEX_INL
+#define IOX_POSH_ROUDI_SERVICE_PORT_INDEX_INL
+
+#include "iceoryx_posh/internal/capro/service_description_hash.hpp"
+#include "iceoryx_posh/internal/roudi/service_port_index.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+template <uint64_t Capacity>
+constexpr uint64_t ServicePortIndex<Capacity>::NUMBER_OF_BUCKETS;
+template <uint64_t Capacity>
+constexpr uint64_t ServicePortIndex<Capacity>::INVALID_POSITION;
+
+template <uint64_t Capacity>
+inline ServicePortIndex<Capacity>::ServicePortIndex() noexcept
+{
+    for (auto& head : m_bucketHeads)
+    {
+        head = INVALID_POSITION;
+    }
+    for (auto& next : m_nextPositions)
+    {
+        next = INVALID_POSITION;
+    }
+}
+
+template <uint64_t Capacity>
+inline void ServicePortIndex<Capacity>::add(const capro::ServiceDescription& service, const uint64_t position) noexcept
+{
+    if (position >= Capacity)
+    {
+        return;
+    }
+
+    // keep the chain sorted, this way the candidates are visited in the same order as in the container
+    uint64_t* link = &m_bucketHeads[bucketOf(service)];
+    while (*link != INVALID_POSITION && *link < position)
+    {
+        link = &m_nextPositions[*link];
+    }
+    m_nextPositions[position] = *link;
+    *link = position;
+}
+
+template <uint64_t Capacity>
+inline void ServicePortIndex<Capacity>::remove(const capro::ServiceDescription& service,
+                                               const uint64_t position) noexcept
+{
+    uint64_t* link = &m_bucketHeads[bucketOf(service)];
+    while (*link != INVALID_POSITION)
+    {
+        if (*link == position)
+        {
+            *link = m_nextPositions[position];
+            m_nextPositions[position] = INVALID_POSITION;
+            return;
+        }
+        link = &m_nextPositions[*link];
+    }
+}
+
+template <uint64_t Capacity>
+inline void
+ServicePortIndex<Capacity>::forEachCandidate(const capro::ServiceDescription& service,
+                                             const cxx::function_ref<void(const uint64_t)> callable) const noexcept
+{
+    for (uint64_t position = m_bucketHeads[bucketOf(service)]; position != INVALID_POSITION;
+         position = m_nextPositions[position])
+    {
+        callable(position);
+    }
+}
+
+template <uint64_t Capacity>
+inline uint64_t ServicePortIndex<Capacity>::bucketOf(const capro::ServiceDescription& service) noexcept
+{
+    return capro::hashServiceDescription(service) % NUMBER_OF_BUCKETS;
+}
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_SERVICE_PORT_INDEX_INL
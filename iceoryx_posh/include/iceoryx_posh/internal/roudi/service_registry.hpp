@@ -32,6 +32,11 @@ namespace iox
 {
 namespace roudi
 {
+struct ServiceRegistryDelta;
+
+/// @brief Multi-set of the offered service descriptions. Exact lookups use an open addressing hash table and
+///        lookups with wildcards use a chained index on each of the three strings. All indices are stored as
+///        positions in plain arrays, therefore the registry can be copied into a chunk and sent to the runtimes.
 class ServiceRegistry
 {
   public:
@@ -41,6 +46,8 @@ class ServiceRegistry
     };
 
     static constexpr uint32_t CAPACITY = iox::SERVICE_REGISTRY_CAPACITY;
+    /// @brief twice the capacity keeps the load factor of the hash table at most 0.5
+    static constexpr uint32_t HASH_TABLE_SIZE = 2U * CAPACITY;
 
     using ReferenceCounter_t = uint64_t;
 
@@ -56,6 +63,8 @@ class ServiceRegistry
         ReferenceCounter_t serverCount{0U};
     };
 
+    ServiceRegistry() noexcept;
+
     /// @brief Adds a given publisher service description to registry
     /// @param[in] serviceDescription, service to be added
     /// @return ServiceRegistryError, error wrapped in cxx::expected
@@ -96,14 +105,52 @@ class ServiceRegistry
     /// @note Can be used to obtain all entries or count them
     void forEach(cxx::function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept;
 
+    /// @brief Every modification of the registry increments the generation
+    /// @return the current generation, zero for an unmodified registry
+    uint64_t generation() const noexcept;
+
+    /// @brief Creates the delta which describes the current state of a service description
+    /// @param[in] serviceDescription, service of the delta
+    /// @return the delta with the current generation, the counters are zero if the service is not registered
+    ServiceRegistryDelta deltaOf(const capro::ServiceDescription& serviceDescription) const noexcept;
+
+    /// @brief Sets the counters of the entry described by the delta and takes over the generation of the delta,
+    ///        entries are removed when both counters are zero
+    /// @param[in] delta, change to apply
+    /// @note the caller has to ensure that the delta is the successor of the current generation
+    void apply(const ServiceRegistryDelta& delta) noexcept;
+
   private:
     using Entry_t = cxx::optional<ServiceDescriptionEntry>;
     using ServiceDescriptionContainer_t = cxx::vector<Entry_t, CAPACITY>;
 
     static constexpr uint32_t NO_INDEX = CAPACITY;
+    static constexpr uint32_t DELETED_INDEX = CAPACITY + 1U;
+
+    enum Field : uint32_t
+    {
+        SERVICE,
+        INSTANCE,
+        EVENT,
+        NUMBER_OF_FIELDS
+    };
 
     ServiceDescriptionContainer_t m_serviceDescriptions;
 
+    // open addressing with linear probing; a slot contains either an index of m_serviceDescriptions, NO_INDEX for
+    // an empty slot or DELETED_INDEX for a removed entry which must not terminate the probing
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) copied into a chunk
+    uint32_t m_hashTable[HASH_TABLE_SIZE];
+    uint32_t m_deletedSlots{0U};
+
+    // one bucket per entry for each of the three strings, the indices of a bucket are chained in ascending order
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) copied into a chunk
+    uint32_t m_fieldBucketHeads[NUMBER_OF_FIELDS][CAPACITY];
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) copied into a chunk
+    uint32_t m_fieldNextIndices[NUMBER_OF_FIELDS][CAPACITY];
+
+    uint64_t m_generation{0U};
+
     // store the last known free Index (if any is known)
     // we could use a queue (or stack) here since they are not optimal
     // for the filling pattern of a vector (prefer entries close to the front)
@@ -112,9 +159,36 @@ class ServiceRegistry
   private:
     uint32_t findIndex(const capro::ServiceDescription& serviceDescription) const noexcept;
 
-
     cxx::expected<Error> add(const capro::ServiceDescription& serviceDescription,
                              ReferenceCounter_t ServiceDescriptionEntry::*count);
+
+    void remove(const capro::ServiceDescription& serviceDescription,
+                ReferenceCounter_t ServiceDescriptionEntry::*count) noexcept;
+
+    uint32_t insert(const capro::ServiceDescription& serviceDescription) noexcept;
+    void erase(const uint32_t index) noexcept;
+
+    void addToIndices(const uint32_t index) noexcept;
+    void removeFromIndices(const uint32_t index) noexcept;
+    void insertIntoHashTable(const uint32_t index) noexcept;
+    void rebuildHashTable() noexcept;
+
+    static const capro::IdString_t& fieldOf(const capro::ServiceDescription& serviceDescription,
+                                            const Field field) noexcept;
+    static uint32_t bucketOf(const capro::IdString_t& value) noexcept;
+};
+
+/// @brief Change of a single entry of the ServiceRegistry. RouDi publishes one delta per modification of its
+///        registry, a runtime which applies all deltas in the order of their generation to a copy of the registry
+///        keeps the copy up to date without receiving the whole registry
+struct ServiceRegistryDelta
+{
+    ServiceRegistryDelta(const uint64_t generation, const ServiceRegistry::ServiceDescriptionEntry& entry) noexcept;
+
+    /// @brief generation of the registry after the modification
+    uint64_t generation{0U};
+    /// @brief the entry after the modification, both counters are zero if the entry was removed
+    ServiceRegistry::ServiceDescriptionEntry entry;
 };
 
 } // namespace roudi
@@ -0,0 +1,279 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_RUNTIME_IPC_BINARY_MESSAGE_HPP
+#define IOX_POSH_RUNTIME_IPC_BINARY_MESSAGE_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/cxx/string.hpp"
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/popo/client_options.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/server_options.hpp"
+#include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+
+#include <cstdint>
+#include <string>
+
+namespace iox
+{
+namespace runtime
+{
+/// @brief Version of the fixed-layout port requests. RouDi announces the version it understands with the REG_ACK and
+///        the runtime uses the binary requests only if it matches its own version.
+constexpr uint32_t IPC_BINARY_PROTOCOL_VERSION{2U};
+/// @brief Announced by or assumed for a RouDi which understands only the comma separated text requests
+constexpr uint32_t IPC_BINARY_PROTOCOL_UNSUPPORTED{0U};
+
+enum class IpcBinaryMessageError : uint8_t
+{
+    INVALID_SIZE,
+    INVALID_ENCODING,
+    PROTOCOL_VERSION_MISMATCH,
+    INVALID_CONTENT
+};
+
+/// @brief Fixed-layout part of a ServiceDescription, the id strings are appended to the request without terminator
+struct IpcServiceDescriptionHeader
+{
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) fixed-layout record for the IPC channel
+    uint32_t classHash[capro::CLASS_HASH_ELEMENT_COUNT];
+    uint16_t scope;
+    uint16_t interfaceSource;
+    uint8_t serviceLength;
+    uint8_t instanceLength;
+    uint8_t eventLength;
+};
+
+/// @brief Fixed-layout image of a PortConfigInfo
+struct IpcPortConfigInfoHeader
+{
+    uint32_t portType;
+    uint32_t deviceId;
+    uint32_t memoryType;
+};
+
+/// @brief Fixed-layout part of IpcMessageType::CREATE_PUBLISHER_BINARY
+struct IpcPublisherRequestHeader
+{
+    uint32_t protocolVersion;
+    int32_t messageType;
+    IpcServiceDescriptionHeader service;
+    IpcPortConfigInfoHeader portConfigInfo;
+    uint64_t historyCapacity;
+    uint64_t waitForConsumerTimeoutInNanoseconds;
+    uint8_t nodeNameLength;
+    uint8_t offerOnCreate;
+    uint8_t subscriberTooSlowPolicy;
+    uint8_t publishTimestamp;
+};
+
+/// @brief Fixed-layout part of IpcMessageType::CREATE_SUBSCRIBER_BINARY
+struct IpcSubscriberRequestHeader
+{
+    uint32_t protocolVersion;
+    int32_t messageType;
+    IpcServiceDescriptionHeader service;
+    IpcPortConfigInfoHeader portConfigInfo;
+    uint64_t queueCapacity;
+    uint64_t historyRequest;
+    uint8_t nodeNameLength;
+    uint8_t subscribeOnCreate;
+    uint8_t queueFullPolicy;
+    uint8_t requiresPublisherHistorySupport;
+    uint8_t recordLatency;
+};
+
+/// @brief Fixed-layout part of IpcMessageType::CREATE_CLIENT_BINARY
+struct IpcClientRequestHeader
+{
+    uint32_t protocolVersion;
+    int32_t messageType;
+    IpcServiceDescriptionHeader service;
+    IpcPortConfigInfoHeader portConfigInfo;
+    uint64_t responseQueueCapacity;
+    uint8_t nodeNameLength;
+    uint8_t connectOnCreate;
+    uint8_t responseQueueFullPolicy;
+    uint8_t serverTooSlowPolicy;
+};
+
+/// @brief Fixed-layout part of IpcMessageType::CREATE_SERVER_BINARY
+struct IpcServerRequestHeader
+{
+    uint32_t protocolVersion;
+    int32_t messageType;
+    IpcServiceDescriptionHeader service;
+    IpcPortConfigInfoHeader portConfigInfo;
+    uint64_t requestQueueCapacity;
+    uint8_t nodeNameLength;
+    uint8_t offerOnCreate;
+    uint8_t requestQueueFullPolicy;
+    uint8_t clientTooSlowPolicy;
+};
+
+/// @brief Capacity of an encoded request, the hex encoded largest header followed by the service, instance, event and
+///        node name
+constexpr uint64_t IPC_REQUEST_ENTRY_CAPACITY{
+    2U
+        * cxx::maxSize<IpcPublisherRequestHeader,
+                       IpcSubscriberRequestHeader,
+                       IpcClientRequestHeader,
+                       IpcServerRequestHeader>()
+    + 3U * capro::IdString_t::capacity() + NodeName_t::capacity()};
+
+/// @brief An encoded request, it is assembled without a heap allocation
+using IpcRequestEntry_t = cxx::string<IPC_REQUEST_ENTRY_CAPACITY>;
+
+/// @brief Reads the message type of a request entry without decoding the whole request, used to dispatch the
+///        entries of a IpcMessageType::CREATE_PORTS_BATCH
+/// @param[in] entry the IPC message entry
+/// @return the message type stored in the header or an IpcBinaryMessageError when the entry is too short, is
+///         corrupted or was created with another protocol version
+cxx::expected<int32_t, IpcBinaryMessageError> getBinaryRequestMessageType(const std::string& entry) noexcept;
+
+/// @brief Request of a publisher port which is transferred as one IPC message entry. The entry consists of the
+///        hex encoded fixed-layout IpcPublisherRequestHeader, the IPC channels transport null terminated strings,
+///        followed by the service, instance, event and node name. Neither creating nor reading the entry requires
+///        a per field serialization.
+class IpcPublisherRequest
+{
+  public:
+    /// @brief creates a request
+    /// @param[in] serviceDescription the service description of the publisher
+    /// @param[in] publisherOptions the options of the publisher
+    /// @param[in] portConfigInfo the port config info of the publisher
+    IpcPublisherRequest(const capro::ServiceDescription& serviceDescription,
+                        const popo::PublisherOptions& publisherOptions,
+                        const PortConfigInfo& portConfigInfo) noexcept;
+
+    /// @brief restores a request from an IPC message entry created with toEntry
+    /// @param[in] entry the IPC message entry
+    /// @return the request or an IpcBinaryMessageError when the entry has the wrong size, is corrupted, was created
+    ///         with another protocol version or contains out of range values
+    static cxx::expected<IpcPublisherRequest, IpcBinaryMessageError> fromEntry(const std::string& entry) noexcept;
+
+    /// @brief converts the request into an entry which can be added to an IpcMessage
+    IpcRequestEntry_t toEntry() const noexcept;
+
+    const capro::ServiceDescription& serviceDescription() const noexcept;
+    const popo::PublisherOptions& publisherOptions() const noexcept;
+    const PortConfigInfo& portConfigInfo() const noexcept;
+
+  private:
+    capro::ServiceDescription m_serviceDescription;
+    popo::PublisherOptions m_publisherOptions;
+    PortConfigInfo m_portConfigInfo;
+};
+
+/// @brief Request of a subscriber port, see IpcPublisherRequest
+class IpcSubscriberRequest
+{
+  public:
+    /// @brief creates a request
+    /// @param[in] serviceDescription the service description of the subscriber
+    /// @param[in] subscriberOptions the options of the subscriber
+    /// @param[in] portConfigInfo the port config info of the subscriber
+    IpcSubscriberRequest(const capro::ServiceDescription& serviceDescription,
+                         const popo::SubscriberOptions& subscriberOptions,
+                         const PortConfigInfo& portConfigInfo) noexcept;
+
+    /// @brief restores a request from an IPC message entry created with toEntry
+    /// @param[in] entry the IPC message entry
+    /// @return the request or an IpcBinaryMessageError when the entry has the wrong size, is corrupted, was created
+    ///         with another protocol version or contains out of range values
+    static cxx::expected<IpcSubscriberRequest, IpcBinaryMessageError> fromEntry(const std::string& entry) noexcept;
+
+    /// @brief converts the request into an entry which can be added to an IpcMessage
+    IpcRequestEntry_t toEntry() const noexcept;
+
+    const capro::ServiceDescription& serviceDescription() const noexcept;
+    const popo::SubscriberOptions& subscriberOptions() const noexcept;
+    const PortConfigInfo& portConfigInfo() const noexcept;
+
+  private:
+    capro::ServiceDescription m_serviceDescription;
+    popo::SubscriberOptions m_subscriberOptions;
+    PortConfigInfo m_portConfigInfo;
+};
+
+/// @brief Request of a client port, see IpcPublisherRequest
+class IpcClientRequest
+{
+  public:
+    /// @brief creates a request
+    /// @param[in] serviceDescription the service description of the client
+    /// @param[in] clientOptions the options of the client
+    /// @param[in] portConfigInfo the port config info of the client
+    IpcClientRequest(const capro::ServiceDescription& serviceDescription,
+                     const popo::ClientOptions& clientOptions,
+                     const PortConfigInfo& portConfigInfo) noexcept;
+
+    /// @brief restores a request from an IPC message entry created with toEntry
+    /// @param[in] entry the IPC message entry
+    /// @return the request or an IpcBinaryMessageError when the entry has the wrong size, is corrupted, was created
+    ///         with another protocol version or contains out of range values
+    static cxx::expected<IpcClientRequest, IpcBinaryMessageError> fromEntry(const std::string& entry) noexcept;
+
+    /// @brief converts the request into an entry which can be added to an IpcMessage
+    IpcRequestEntry_t toEntry() const noexcept;
+
+    const capro::ServiceDescription& serviceDescription() const noexcept;
+    const popo::ClientOptions& clientOptions() const noexcept;
+    const PortConfigInfo& portConfigInfo() const noexcept;
+
+  private:
+    capro::ServiceDescription m_serviceDescription;
+    popo::ClientOptions m_clientOptions;
+    PortConfigInfo m_portConfigInfo;
+};
+
+/// @brief Request of a server port, see IpcPublisherRequest
+class IpcServerRequest
+{
+  public:
+    /// @brief creates a request
+    /// @param[in] serviceDescription the service description of the server
+    /// @param[in] serverOptions the options of the server
+    /// @param[in] portConfigInfo the port config info of the server
+    IpcServerRequest(const capro::ServiceDescription& serviceDescription,
+                     const popo::ServerOptions& serverOptions,
+                     const PortConfigInfo& portConfigInfo) noexcept;
+
+    /// @brief restores a request from an IPC message entry created with toEntry
+    /// @param[in] entry the IPC message entry
+    /// @return the request or an IpcBinaryMessageError when the entry has the wrong size, is corrupted, was created
+    ///         with another protocol version or contains out of range values
+    static cxx::expected<IpcServerRequest, IpcBinaryMessageError> fromEntry(const std::string& entry) noexcept;
+
+    /// @brief converts the request into an entry which can be added to an IpcMessage
+    IpcRequestEntry_t toEntry() const noexcept;
+
+    const capro::ServiceDescription& serviceDescription() const noexcept;
+    const popo::ServerOptions& serverOptions() const noexcept;
+    const PortConfigInfo& portConfigInfo() const noexcept;
+
+  private:
+    capro::ServiceDescription m_serviceDescription;
+    popo::ServerOptions m_serverOptions;
+    PortConfigInfo m_portConfigInfo;
+};
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_IPC_BINARY_MESSAGE_HPP
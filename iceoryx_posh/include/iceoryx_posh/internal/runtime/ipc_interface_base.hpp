@@ -87,6 +87,14 @@ enum class IpcMessageType : int32_t
     WAKEUP_TRIGGER,
     REPLAY,
     MESSAGE_NOT_SUPPORTED,
+    // fixed-layout requests, only sent when RouDi announced IPC_BINARY_PROTOCOL_VERSION with the REG_ACK
+    CREATE_PUBLISHER_BINARY,
+    CREATE_SUBSCRIBER_BINARY,
+    CREATE_CLIENT_BINARY,
+    CREATE_SERVER_BINARY,
+    // several of the fixed-layout requests above in one message, answered with a single CREATE_PORTS_BATCH_ACK
+    CREATE_PORTS_BATCH,
+    CREATE_PORTS_BATCH_ACK,
     // etc..
     END,
 };
@@ -119,6 +127,8 @@ enum class IpcMessageErrorType : int32_t
     CONDITION_VARIABLE_LIST_FULL,
     EVENT_VARIABLE_LIST_FULL,
     NODE_DATA_LIST_FULL,
+    /// An entry of a CREATE_PORTS_BATCH could not be decoded
+    INVALID_PORT_REQUEST,
     END,
 };
 
@@ -19,6 +19,7 @@
 #define IOX_POSH_RUNTIME_IPC_RUNTIME_INTERFACE_HPP
 
 #include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_creator.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
 
@@ -66,6 +67,10 @@ class IpcRuntimeInterface
     /// @return segment id
     uint64_t getSegmentId() const noexcept;
 
+    /// @brief get the version of the binary port request protocol RouDi announced with the REG_ACK
+    /// @return the protocol version or IPC_BINARY_PROTOCOL_UNSUPPORTED if RouDi understands only text requests
+    uint32_t getBinaryProtocolVersion() const noexcept;
+
   private:
     enum class RegAckResult
     {
@@ -85,6 +90,7 @@ class IpcRuntimeInterface
     uint64_t m_shmTopicSize{0U};
     uint64_t m_segmentId{0U};
     bool m_sendKeepalive = true;
+    uint32_t m_binaryProtocolVersion{IPC_BINARY_PROTOCOL_UNSUPPORTED};
 };
 
 } // namespace runtime
@@ -20,6 +20,7 @@
 #include "iceoryx_hoofs/cxx/function.hpp"
 #include "iceoryx_hoofs/internal/concurrent/periodic_task.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/mutex.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
 #include "iceoryx_posh/internal/runtime/shared_memory_user.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 
@@ -67,6 +68,9 @@ class PoshRuntimeImpl : public PoshRuntime
                         const popo::ServerOptions& ServerOptions = {},
                         const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept override;
 
+    /// @copydoc PoshRuntime::createPorts
+    bool createPorts(PortBatch& batch) noexcept override;
+
     /// @copydoc PoshRuntime::getMiddlewareInterface
     popo::InterfacePortData* getMiddlewareInterface(const capro::Interfaces interface,
                                                     const NodeName_t& nodeName = {""}) noexcept override;
@@ -104,6 +108,35 @@ class PoshRuntimeImpl : public PoshRuntime
     cxx::expected<popo::ConditionVariableData*, IpcMessageErrorType>
     requestConditionVariableFromRoudi(const IpcMessage& sendBuffer) noexcept;
 
+    /// @brief the fixed-layout port requests are used only when RouDi announced the same protocol version
+    bool isBinaryProtocolSupported() const noexcept;
+
+    popo::PublisherOptions preparePublisherOptions(const popo::PublisherOptions& publisherOptions) const noexcept;
+    popo::SubscriberOptions prepareSubscriberOptions(const capro::ServiceDescription& service,
+                                                     const popo::SubscriberOptions& subscriberOptions) const noexcept;
+    popo::ClientOptions prepareClientOptions(const popo::ClientOptions& clientOptions) const noexcept;
+    popo::ServerOptions prepareServerOptions(const popo::ServerOptions& serverOptions) const noexcept;
+
+    void reportPublisherError(const capro::ServiceDescription& service, const IpcMessageErrorType error) const noexcept;
+    void reportSubscriberError(const capro::ServiceDescription& service,
+                               const IpcMessageErrorType error) const noexcept;
+    void reportClientError(const capro::ServiceDescription& service, const IpcMessageErrorType error) const noexcept;
+    void reportServerError(const capro::ServiceDescription& service, const IpcMessageErrorType error) const noexcept;
+    void reportPortError(const PortBatch::Request& request, const IpcMessageErrorType error) const noexcept;
+
+    /// @brief creates the port of a batch request with a dedicated request to RouDi, used when RouDi does not
+    ///        support batched requests
+    void* createPort(const PortBatch::Request& request) noexcept;
+
+    IpcRequestEntry_t toBinaryEntry(const PortBatch::Request& request) const noexcept;
+    static IpcMessageType getAckType(const PortBatch::Request& request) noexcept;
+
+    /// @brief sends one CREATE_PORTS_BATCH message and stores the created ports in the batch
+    /// @return true if all ports of the message were created
+    bool requestPortsFromRoudi(const IpcMessage& sendBuffer,
+                               const cxx::vector<uint64_t, MAX_PORTS_PER_BATCH>& requestIndices,
+                               PortBatch& batch) noexcept;
+
     mutable posix::mutex m_appIpcRequestMutex{false};
 
     IpcRuntimeInterface m_ipcChannelInterface;
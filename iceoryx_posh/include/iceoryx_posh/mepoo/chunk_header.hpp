@@ -59,7 +59,7 @@ struct ChunkHeader
     ///            - data width of members changes
     ///            - members are rearranged
     ///            - semantic meaning of a member changes
-    static constexpr uint8_t CHUNK_HEADER_VERSION{1U};
+    static constexpr uint8_t CHUNK_HEADER_VERSION{2U};
 
     /// @brief User-Header id for no user-header
     static constexpr uint16_t NO_USER_HEADER{0x0000};
@@ -138,6 +138,17 @@ struct ChunkHeader
     /// @brief the serquence number of the chunk
     uint64_t sequenceNumber() const noexcept;
 
+    /// @brief The point in time when the chunk was sent. It is only set when the publisher was created with
+    /// 'PublisherOptions::publishTimestamp' and uses the same monotonic clock as 'publishTimestampNow()'
+    /// @return the publish timestamp in nanoseconds or 0 if the publisher does not add timestamps
+    uint64_t publishTimestamp() const noexcept;
+
+    /// @brief The current time of the monotonic clock which is used for the publish timestamp. The clock is shared by
+    /// all processes on the same machine, therefore 'publishTimestampNow() - publishTimestamp()' is the transport
+    /// latency of a chunk.
+    /// @return the current time in nanoseconds
+    static uint64_t publishTimestampNow() noexcept;
+
   private:
     template <typename T>
     friend class popo::ChunkSender;
@@ -146,6 +157,8 @@ struct ChunkHeader
 
     void setSequenceNumber(const uint64_t sequenceNumber) noexcept;
 
+    void setPublishTimestamp(const uint64_t publishTimestamp) noexcept;
+
     uint64_t overflowSafeUsedSizeOfChunk() const noexcept;
 
   private:
@@ -163,6 +176,7 @@ struct ChunkHeader
     uint16_t m_userHeaderId{NO_USER_HEADER};
     popo::UniquePortId m_originId{popo::InvalidPortId};
     uint64_t m_sequenceNumber{0U};
+    uint64_t m_publishTimestamp{0U};
     uint32_t m_userHeaderSize{0U};
     uint32_t m_userPayloadSize{0U};
     uint32_t m_userPayloadAlignment{1U};
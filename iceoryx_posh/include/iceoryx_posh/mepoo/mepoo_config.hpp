@@ -29,6 +29,16 @@ class PortManager;
 }
 namespace mepoo
 {
+/// @brief Defines how the MemoryManager reacts when the best fitting mempool for a chunk request is exhausted
+enum class MemPoolSpillPolicy : uint8_t
+{
+    /// @brief only the smallest mempool which can hold the requested chunk is used; if it is exhausted the request
+    /// fails
+    BEST_FIT_ONLY,
+    /// @brief if the best fitting mempool is exhausted, the next larger mempools are tried in increasing order
+    SPILL_TO_LARGER_MEMPOOLS
+};
+
 struct MePooConfig
 {
   public:
@@ -46,6 +56,7 @@ struct MePooConfig
 
     using MePooConfigContainerType = cxx::vector<Entry, MAX_NUMBER_OF_MEMPOOLS>;
     MePooConfigContainerType m_mempoolConfig;
+    MemPoolSpillPolicy m_spillPolicy{MemPoolSpillPolicy::BEST_FIT_ONLY};
 
     /// @brief Default constructor to set the configuration for memory pools
     MePooConfig() noexcept = default;
@@ -0,0 +1,83 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_MEPOO_THREAD_LOCAL_CHUNK_CACHE_HPP
+#define IOX_POSH_MEPOO_THREAD_LOCAL_CHUNK_CACHE_HPP
+
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+class MemPool;
+
+/// @brief Opt-in per-thread cache of free chunks in front of the lock-free free-lists of the mempools. When enabled
+///        for a thread, the chunks which are acquired and released by this thread are served from a small thread local
+///        magazine per mempool. The magazines are refilled from and flushed to the free-list in batches, so that the
+///        common case of MemPool::getChunk and MemPool::freeChunk does not need any atomic read-modify-write
+///        operation on shared memory.
+/// @note The usage statistics of the mempools (MemPoolInfo) are updated in batches as well. The deviation is bounded
+///       by CHUNK_CAPACITY_PER_MEMPOOL per thread and mempool and vanishes with a flush.
+/// @note Cached chunks are not available to other threads. A mempool might therefore report to be exhausted while
+///       up to CHUNK_CAPACITY_PER_MEMPOOL free chunks are held by the cache of another thread.
+/// @note The cache lives in process local memory. Cached chunks are lost for the whole system when the process
+///       terminates abnormally, since RouDi cannot reclaim them.
+/// @code
+///   // in the thread which publishes or receives with a high frequency
+///   iox::mepoo::ThreadLocalChunkCache::enable();
+///   // ... publish and take samples
+///   // before the runtime is destroyed
+///   iox::mepoo::ThreadLocalChunkCache::disable();
+/// @endcode
+class ThreadLocalChunkCache
+{
+  public:
+    static constexpr uint32_t CHUNK_CAPACITY_PER_MEMPOOL{16U};
+    static constexpr uint32_t MAX_NUMBER_OF_CACHED_MEMPOOLS{8U};
+
+    ThreadLocalChunkCache() = delete;
+
+    /// @brief Enables the chunk cache for the calling thread
+    static void enable() noexcept;
+
+    /// @brief Returns all cached chunks of the calling thread to their mempools and disables the chunk cache for the
+    ///        calling thread
+    static void disable() noexcept;
+
+    /// @brief Returns true if the chunk cache is enabled for the calling thread, otherwise false
+    static bool isEnabled() noexcept;
+
+    /// @brief Returns all cached chunks of the calling thread to their mempools and updates the usage statistics of
+    ///        the mempools. This is also done automatically when the thread terminates.
+    /// @attention Must be called by every thread with an enabled cache before a mempool which was used by this
+    ///            thread is destroyed
+    static void flush() noexcept;
+
+  private:
+    friend class MemPool;
+
+    struct Cache;
+
+    static Cache& threadLocalCache() noexcept;
+    static bool getChunkIndex(MemPool& memPool, uint32_t& index) noexcept;
+    static bool freeChunkIndex(MemPool& memPool, const uint32_t index) noexcept;
+    static void flush(Cache& cache) noexcept;
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_THREAD_LOCAL_CHUNK_CACHE_HPP
@@ -27,6 +27,7 @@
 #include "iceoryx_posh/popo/notification_attorney.hpp"
 #include "iceoryx_posh/popo/notification_callback.hpp"
 #include "iceoryx_posh/popo/trigger_handle.hpp"
+#include "iceoryx_posh/popo/wait_strategy.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 
 #include <thread>
@@ -104,6 +105,10 @@ class ListenerImpl
 {
   public:
     ListenerImpl() noexcept;
+
+    /// @brief creates a Listener whose background thread waits with the provided strategy
+    /// @param[in] waitStrategy defines if and how long the background thread polls before blocking
+    explicit ListenerImpl(const WaitStrategy& waitStrategy) noexcept;
     ListenerImpl(const ListenerImpl&) = delete;
     ListenerImpl(ListenerImpl&&) = delete;
     ~ListenerImpl() noexcept;
@@ -169,7 +174,8 @@ class ListenerImpl
     uint64_t size() const noexcept;
 
   protected:
-    ListenerImpl(ConditionVariableData& conditionVariableData) noexcept;
+    ListenerImpl(ConditionVariableData& conditionVariableData,
+                 const WaitStrategy& waitStrategy = WaitStrategy()) noexcept;
 
   private:
     class Event_t;
@@ -221,9 +227,10 @@ class Listener : public ListenerImpl<MAX_NUMBER_OF_EVENTS_PER_LISTENER>
   public:
     using Parent = ListenerImpl<MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
     Listener() noexcept;
+    explicit Listener(const WaitStrategy& waitStrategy) noexcept;
 
   protected:
-    Listener(ConditionVariableData& conditionVariableData) noexcept;
+    Listener(ConditionVariableData& conditionVariableData, const WaitStrategy& waitStrategy = WaitStrategy()) noexcept;
 };
 
 } // namespace popo
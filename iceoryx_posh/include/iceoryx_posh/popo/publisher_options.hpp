@@ -43,6 +43,15 @@ struct PublisherOptions
     /// @brief The option whether the publisher should block when the subscriber queue is full
     ConsumerTooSlowPolicy subscriberTooSlowPolicy{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
 
+    /// @brief The maximum time the publisher sleeps when it is blocked by a full subscriber queue before it checks the
+    /// queue again; the publisher is woken up earlier when the subscriber takes a sample. Only relevant with
+    /// ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER
+    units::Duration waitForConsumerTimeout{DEFAULT_WAIT_FOR_CONSUMER_TIMEOUT};
+
+    /// @brief The option whether the publisher stores the point in time of the publish call in the ChunkHeader of
+    /// every sent chunk, see 'ChunkHeader::publishTimestamp()'
+    bool publishTimestamp{false};
+
     /// @brief serialization of the PublisherOptions
     cxx::Serialization serialize() const noexcept;
     /// @brief deserialization of the PublisherOptions
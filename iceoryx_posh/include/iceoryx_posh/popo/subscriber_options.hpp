@@ -51,6 +51,10 @@ struct SubscriberOptions
     ///        i.e. require historyCapacity > 0 to be eligible to be connected
     bool requiresPublisherHistorySupport{false};
 
+    /// @brief The option whether the subscriber records the publish-to-take latency of chunks carrying a publish
+    /// timestamp in a histogram which is exported via the port introspection
+    bool recordLatency{false};
+
     /// @brief serialization of the SubscriberOptions
     cxx::Serialization serialize() const noexcept;
     /// @brief deserialization of the SubscriberOptions
@@ -33,6 +33,7 @@
 #include "iceoryx_posh/popo/notification_info.hpp"
 #include "iceoryx_posh/popo/trigger.hpp"
 #include "iceoryx_posh/popo/trigger_handle.hpp"
+#include "iceoryx_posh/popo/wait_strategy.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 
 namespace iox
@@ -63,6 +64,10 @@ class WaitSet
     using NotificationInfoVector = cxx::vector<const NotificationInfo*, CAPACITY>;
 
     WaitSet() noexcept;
+
+    /// @brief creates a WaitSet which waits with the provided strategy
+    /// @param[in] waitStrategy defines if and how long wait() and timedWait() poll before blocking
+    explicit WaitSet(const WaitStrategy& waitStrategy) noexcept;
     ~WaitSet() noexcept;
 
     /// @brief all the Trigger have a pointer pointing to this waitset for cleanup
@@ -210,7 +215,7 @@ class WaitSet
     static constexpr uint64_t capacity() noexcept;
 
   protected:
-    explicit WaitSet(ConditionVariableData& condVarData) noexcept;
+    explicit WaitSet(ConditionVariableData& condVarData, const WaitStrategy& waitStrategy = WaitStrategy()) noexcept;
 
   private:
     enum class NoStateEnumUsed : StateEnumIdentifier
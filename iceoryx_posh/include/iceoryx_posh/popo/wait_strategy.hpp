@@ -0,0 +1,53 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_WAIT_STRATEGY_HPP
+#define IOX_POSH_POPO_WAIT_STRATEGY_HPP
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Defines how a WaitSet, a Listener or a ConditionListener waits for notifications
+enum class WaitMode : uint8_t
+{
+    /// @brief blocks on the semaphore right away, lowest CPU usage but the wake-up latency of the operating system
+    ALWAYS_BLOCK,
+    /// @brief polls for notifications for WaitStrategy::spinIterations and blocks afterwards
+    SPIN_THEN_BLOCK,
+    /// @brief polls for notifications without ever blocking, lowest latency at the cost of a fully used CPU core
+    BUSY_POLL
+};
+
+/// @brief Number of polls with a pause instruction in between before SPIN_THEN_BLOCK blocks; roughly 100us on a
+/// standard pc
+constexpr uint64_t DEFAULT_WAIT_STRATEGY_SPIN_ITERATIONS{10000U};
+
+/// @brief This struct is used to configure the wait strategy of a WaitSet, a Listener or a ConditionListener
+struct WaitStrategy
+{
+    /// @brief The mode which is used to wait for notifications
+    WaitMode mode{WaitMode::ALWAYS_BLOCK};
+
+    /// @brief The number of polls before blocking, only used with WaitMode::SPIN_THEN_BLOCK
+    uint64_t spinIterations{DEFAULT_WAIT_STRATEGY_SPIN_ITERATIONS};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_WAIT_STRATEGY_HPP
@@ -100,6 +100,12 @@ struct PortThroughputData
     double m_chunksPerMinute{0};
     uint64_t m_lastSendIntervalInNanoseconds{0};
     bool m_isField{false};
+    double m_bytesPerSecond{0};
+    // totals since the creation of the publisher, the rates above refer to the last introspection interval
+    uint64_t m_numberOfSentSamples{0};
+    uint64_t m_numberOfSentBytes{0};
+    uint64_t m_numberOfLostSamples{0};
+    uint64_t m_numberOfLoanFailures{0};
 };
 
 /// @brief the topic for the port throughput that a user can subscribe to
@@ -118,6 +124,17 @@ struct SubscriberPortChangingData
     uint64_t fifoCapacity{0};
     iox::SubscribeState subscriptionState{iox::SubscribeState::NOT_SUBSCRIBED};
     capro::Scope propagationScope{capro::Scope::INVALID};
+    // publish-to-take latency, only recorded when enabled via SubscriberOptions::recordLatency
+    bool latencyRecordingEnabled{false};
+    uint64_t latencySampleCount{0U};
+    uint64_t latencySumInNanoseconds{0U};
+    uint64_t maxLatencyInNanoseconds{0U};
+    /// bucket 'i' counts latencies in [2^i, 2^(i+1)) nanoseconds, see popo::LatencyHistogram
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) fixed size storage in shared memory
+    uint64_t latencyHistogram[NUMBER_OF_LATENCY_HISTOGRAM_BUCKETS]{};
+    // totals since the creation of the subscriber
+    uint64_t numberOfReceivedSamples{0U};
+    uint64_t numberOfLostSamples{0U};
 };
 
 struct SubscriberPortChangingIntrospectionFieldTopic
@@ -72,6 +72,20 @@ class PortPool
     cxx::vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS> getSubscriberPortDataList() noexcept;
     cxx::vector<popo::ClientPortData*, MAX_CLIENTS> getClientPortDataList() noexcept;
     cxx::vector<popo::ServerPortData*, MAX_SERVERS> getServerPortDataList() noexcept;
+
+    /// @brief Returns the ports with the given service description; uses the service index of the pool instead of
+    ///        scanning all ports
+    /// @param[in] service the ports must have
+    /// @return the ports in the order of their position in the pool
+    cxx::vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS>
+    getPublisherPortDataList(const capro::ServiceDescription& service) noexcept;
+    cxx::vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS>
+    getSubscriberPortDataList(const capro::ServiceDescription& service) noexcept;
+    cxx::vector<popo::ClientPortData*, MAX_CLIENTS>
+    getClientPortDataList(const capro::ServiceDescription& service) noexcept;
+    cxx::vector<popo::ServerPortData*, MAX_SERVERS>
+    getServerPortDataList(const capro::ServiceDescription& service) noexcept;
+
     cxx::vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER> getInterfacePortDataList() noexcept;
     cxx::vector<runtime::NodeData*, MAX_NODE_NUMBER> getNodeDataList() noexcept;
     cxx::vector<popo::ConditionVariableData*, MAX_NUMBER_OF_CONDITION_VARIABLES>
@@ -175,7 +189,21 @@ class PortPool
     /// @note after this call the provided ConditionVariableData is no longer available for usage
     void removeConditionVariableData(const popo::ConditionVariableData* const conditionVariableData) noexcept;
 
+    /// @brief Returns the queue in which the ports announce pending state changes to RouDi
+    /// @return reference to the DiscoveryNotificationData in the port pool
+    popo::DiscoveryNotificationData& getDiscoveryNotificationData() noexcept;
+
+    /// @brief Returns the port data at the position which was announced by a popo::DirtyPort
+    /// @param[in] index of the port in the pool
+    /// @return pointer to the port data or a nullptr if the port was already removed
+    PublisherPortRouDiType::MemberType_t* getPublisherPortData(const uint64_t index) noexcept;
+    SubscriberPortType::MemberType_t* getSubscriberPortData(const uint64_t index) noexcept;
+    popo::ClientPortData* getClientPortData(const uint64_t index) noexcept;
+    popo::ServerPortData* getServerPortData(const uint64_t index) noexcept;
+
   private:
+    void enableDiscoveryNotification(popo::BasePortData& portData, const popo::DirtyPort& dirtyPort) noexcept;
+
     PortPoolData* m_portPoolData;
 };
 
@@ -0,0 +1,163 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_RUNTIME_PORT_BATCH_HPP
+#define IOX_POSH_RUNTIME_PORT_BATCH_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/variant.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/popo/client_options.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/server_options.hpp"
+#include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+struct PublisherPortData;
+struct SubscriberPortData;
+struct ClientPortData;
+struct ServerPortData;
+} // namespace popo
+
+namespace runtime
+{
+class PoshRuntimeImpl;
+
+enum class PortBatchError : uint8_t
+{
+    BATCH_FULL
+};
+
+/// @brief Collects the requests for many ports so that they can be created with a single PoshRuntime::createPorts
+///        call. Instead of one request/response round trip to RouDi per port, the requests are transferred in as few
+///        IPC messages as possible and RouDi creates all ports of a message in one pass. A batch holds up to
+///        MAX_PORTS_PER_BATCH requests.
+/// @code
+///     iox::runtime::PortBatch batch;
+///     auto publisherIndex = batch.addPublisher({"Radar", "FrontLeft", "Object"}).value();
+///     auto subscriberIndex = batch.addSubscriber({"Radar", "FrontRight", "Object"}).value();
+///     if (iox::runtime::PoshRuntime::getInstance().createPorts(batch))
+///     {
+///         auto publisherPortData = batch.getPublisher(publisherIndex);
+///         auto subscriberPortData = batch.getSubscriber(subscriberIndex);
+///     }
+/// @endcode
+class PortBatch
+{
+  public:
+    /// @brief adds the request for a publisher port
+    /// @param[in] service service description for the new publisher port
+    /// @param[in] publisherOptions like the history capacity of a publisher
+    /// @param[in] portConfigInfo configuration information for the port
+    /// @return index which is used to acquire the created port with getPublisher or PortBatchError::BATCH_FULL when
+    ///         the batch already holds MAX_PORTS_PER_BATCH requests
+    cxx::expected<uint64_t, PortBatchError> addPublisher(const capro::ServiceDescription& service,
+                                                         const popo::PublisherOptions& publisherOptions = {},
+                                                         const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief adds the request for a subscriber port
+    /// @param[in] service service description for the new subscriber port
+    /// @param[in] subscriberOptions like the queue capacity and history requested by a subscriber
+    /// @param[in] portConfigInfo configuration information for the port
+    /// @return index which is used to acquire the created port with getSubscriber or PortBatchError::BATCH_FULL when
+    ///         the batch already holds MAX_PORTS_PER_BATCH requests
+    cxx::expected<uint64_t, PortBatchError> addSubscriber(const capro::ServiceDescription& service,
+                                                          const popo::SubscriberOptions& subscriberOptions = {},
+                                                          const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief adds the request for a client port
+    /// @param[in] service service description for the new client port
+    /// @param[in] clientOptions like the queue capacity and queue full policy of a client
+    /// @param[in] portConfigInfo configuration information for the port
+    /// @return index which is used to acquire the created port with getClient or PortBatchError::BATCH_FULL when
+    ///         the batch already holds MAX_PORTS_PER_BATCH requests
+    cxx::expected<uint64_t, PortBatchError> addClient(const capro::ServiceDescription& service,
+                                                      const popo::ClientOptions& clientOptions = {},
+                                                      const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief adds the request for a server port
+    /// @param[in] service service description for the new server port
+    /// @param[in] serverOptions like the queue capacity and queue full policy of a server
+    /// @param[in] portConfigInfo configuration information for the port
+    /// @return index which is used to acquire the created port with getServer or PortBatchError::BATCH_FULL when
+    ///         the batch already holds MAX_PORTS_PER_BATCH requests
+    cxx::expected<uint64_t, PortBatchError> addServer(const capro::ServiceDescription& service,
+                                                      const popo::ServerOptions& serverOptions = {},
+                                                      const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief returns the number of requested ports
+    uint64_t size() const noexcept;
+
+    /// @brief returns the publisher port which was created for the request with the given index
+    /// @param[in] index the index returned by addPublisher
+    /// @return pointer to the port data or nullptr if the port was not created or the index does not belong to a
+    ///         publisher
+    popo::PublisherPortData* getPublisher(const uint64_t index) const noexcept;
+
+    /// @brief returns the subscriber port which was created for the request with the given index
+    /// @param[in] index the index returned by addSubscriber
+    /// @return pointer to the port data or nullptr if the port was not created or the index does not belong to a
+    ///         subscriber
+    popo::SubscriberPortData* getSubscriber(const uint64_t index) const noexcept;
+
+    /// @brief returns the client port which was created for the request with the given index
+    /// @param[in] index the index returned by addClient
+    /// @return pointer to the port data or nullptr if the port was not created or the index does not belong to a
+    ///         client
+    popo::ClientPortData* getClient(const uint64_t index) const noexcept;
+
+    /// @brief returns the server port which was created for the request with the given index
+    /// @param[in] index the index returned by addServer
+    /// @return pointer to the port data or nullptr if the port was not created or the index does not belong to a
+    ///         server
+    popo::ServerPortData* getServer(const uint64_t index) const noexcept;
+
+  private:
+    friend class PoshRuntimeImpl;
+
+    using Options_t =
+        cxx::variant<popo::PublisherOptions, popo::SubscriberOptions, popo::ClientOptions, popo::ServerOptions>;
+
+    struct Request
+    {
+        capro::ServiceDescription service;
+        Options_t options;
+        PortConfigInfo portConfigInfo;
+        void* port{nullptr};
+    };
+
+    template <typename Options>
+    cxx::expected<uint64_t, PortBatchError> addRequest(const capro::ServiceDescription& service,
+                                                       const Options& options,
+                                                       const PortConfigInfo& portConfigInfo) noexcept;
+
+    template <typename PortData, typename Options>
+    PortData* getPort(const uint64_t index) const noexcept;
+
+    cxx::vector<Request, MAX_PORTS_PER_BATCH> m_requests;
+};
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_PORT_BATCH_HPP
@@ -31,6 +31,7 @@
 #include "iceoryx_posh/popo/client_options.hpp"
 #include "iceoryx_posh/popo/server_options.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/runtime/port_batch.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
 
 #include <atomic>
@@ -123,6 +124,11 @@ class PoshRuntime
                         const popo::ServerOptions& serverOptions = {},
                         const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept = 0;
 
+    /// @brief request the RouDi daemon to create all ports of a batch with as few IPC round trips as possible
+    /// @param[in] batch the requested ports, the created ports can be acquired from it afterwards
+    /// @return true if all ports of the batch were created, false if at least one port could not be created
+    virtual bool createPorts(PortBatch& batch) noexcept = 0;
+
     /// @brief request the RouDi daemon to create an interface port
     /// @param[in] interface interface to create
     /// @param[in] nodeName name of the node where the interface should belong to
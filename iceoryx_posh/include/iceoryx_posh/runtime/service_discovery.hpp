@@ -83,7 +83,17 @@ class ServiceDiscovery
         {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_EVENT_NAME},
         {1U, 1U, iox::NodeName_t("Service Registry"), true}};
 
+    // every modification of the registry is announced by a delta, the registry subscriber is only used to get a base
+    // for the deltas
+    popo::Subscriber<roudi::ServiceRegistryDelta> m_serviceRegistryDeltaSubscriber{
+        {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_DELTA_EVENT_NAME},
+        {SERVICE_REGISTRY_SNAPSHOT_INTERVAL,
+         SERVICE_REGISTRY_SNAPSHOT_INTERVAL,
+         iox::NodeName_t("Service Registry"),
+         true}};
+
     void update();
+    void updateFromSnapshot();
 };
 
 } // namespace runtime
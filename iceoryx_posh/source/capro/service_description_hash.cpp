@@ -0,0 +1,46 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/capro/service_description_hash.hpp"
+
+namespace iox
+{
+namespace capro
+{
+uint64_t hashIdString(const IdString_t& value, const uint64_t hash) noexcept
+{
+    constexpr uint64_t FNV_PRIME{1099511628211U};
+
+    uint64_t result{hash};
+    for (uint64_t i = 0U; i < value.size(); ++i)
+    {
+        result ^= static_cast<uint8_t>(value.c_str()[i]);
+        result *= FNV_PRIME;
+    }
+    // separates the strings, otherwise "ab", "c" and "a", "bc" would always collide
+    result *= FNV_PRIME;
+    return result;
+}
+
+uint64_t hashServiceDescription(const ServiceDescription& service) noexcept
+{
+    return hashIdString(
+        service.getEventIDString(),
+        hashIdString(service.getInstanceIDString(), hashIdString(service.getServiceIDString())));
+}
+
+} // namespace capro
+} // namespace iox
@@ -0,0 +1,409 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/gateway/domain_bridge_receiver.hpp"
+#include "iceoryx_hoofs/cxx/serialization.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace iox
+{
+namespace gw
+{
+namespace
+{
+/// @brief the longest time the receive thread waits for a message before it checks whether the gateway is shut down
+constexpr units::Duration RECEIVE_TIMEOUT{100_ms};
+
+cxx::expected<void*, popo::AllocationError> loan(popo::UntypedPublisher& publisher,
+                                                 const BridgeSampleHeader& sampleHeader) noexcept
+{
+    // the user-header alignment is not stored in the ChunkHeader but it has no influence on the chunk layout since
+    // the user-header is always adjacent to the ChunkHeader; the smallest alignment fits every user-header size
+    const uint32_t userHeaderAlignment{1U};
+    return publisher.loan(sampleHeader.userPayloadSize,
+                          sampleHeader.userPayloadAlignment,
+                          sampleHeader.userHeaderSize,
+                          userHeaderAlignment);
+}
+
+/// @brief copies data to the given offset in the concatenation of the user-header and user-payload of a loaned chunk
+void copyIntoSample(void* userPayload, const uint64_t offset, const uint8_t* data, const uint64_t size) noexcept
+{
+    auto chunkHeader = mepoo::ChunkHeader::fromUserPayload(userPayload);
+    const uint64_t userHeaderSize{chunkHeader->userHeaderSize()};
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    if (offset < userHeaderSize)
+    {
+        const uint64_t userHeaderPartSize{std::min(size, userHeaderSize - offset)};
+        std::memcpy(static_cast<uint8_t*>(chunkHeader->userHeader()) + offset, data, userHeaderPartSize);
+    }
+    if (offset + size > userHeaderSize)
+    {
+        const uint64_t userPayloadOffset{std::max(offset, userHeaderSize) - userHeaderSize};
+        const uint64_t dataOffset{userHeaderSize + userPayloadOffset - offset};
+        std::memcpy(static_cast<uint8_t*>(userPayload) + userPayloadOffset, data + dataOffset, size - dataOffset);
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+} // namespace
+
+DomainBridgeReceiver::DomainBridgeReceiver(const BridgeName_t& bridgeName,
+                                           const popo::PublisherOptions& publisherOptions,
+                                           const capro::Interfaces interface) noexcept
+    : GatewayGeneric<BridgeReceiverChannel>(interface)
+    , m_publisherOptions(publisherOptions)
+{
+    posix::UnixDomainSocket::create(bridgeName, posix::IpcChannelSide::SERVER)
+        .and_then([&](auto& socket) { m_socket = std::move(socket); })
+        .or_else([&](auto) { LogError() << "Unable to create the socket '" << bridgeName << "' of the bridge"; });
+}
+
+DomainBridgeReceiver::~DomainBridgeReceiver() noexcept
+{
+    // the receive thread uses the socket which is destroyed before the base class
+    shutdown();
+    for (auto& announcedService : m_announcedServices)
+    {
+        discardFragmentedSample(announcedService);
+    }
+}
+
+void DomainBridgeReceiver::runMultithreaded() noexcept
+{
+    GatewayGeneric<BridgeReceiverChannel>::runMultithreaded();
+    m_receiveThread = std::thread([this] {
+        while (isRunning())
+        {
+            receive(RECEIVE_TIMEOUT);
+        }
+    });
+}
+
+void DomainBridgeReceiver::shutdown() noexcept
+{
+    GatewayGeneric<BridgeReceiverChannel>::shutdown();
+    if (m_receiveThread.joinable())
+    {
+        m_receiveThread.join();
+    }
+}
+
+void DomainBridgeReceiver::loadConfiguration(const config::GatewayConfig& config) noexcept
+{
+    m_servicesToPublish.clear();
+    for (const auto& entry : config.m_configuredServices)
+    {
+        m_servicesToPublish.emplace_back(entry.m_serviceDescription);
+    }
+}
+
+void DomainBridgeReceiver::discover(const capro::CaproMessage&) noexcept
+{
+}
+
+void DomainBridgeReceiver::forward(const BridgeReceiverChannel&) noexcept
+{
+}
+
+void DomainBridgeReceiver::receive(const units::Duration& timeout) noexcept
+{
+    if (!m_socket.isInitialized())
+    {
+        std::this_thread::sleep_for(std::chrono::nanoseconds(timeout.toNanoseconds()));
+        return;
+    }
+
+    m_socket.timedReceive(m_receiveBuffer.data(), m_receiveBuffer.size(), timeout)
+        .and_then([&](auto messageSize) { process(messageSize); })
+        .or_else([&](auto& error) {
+            if (error != posix::IpcChannelError::TIMEOUT)
+            {
+                LogWarn() << "Unable to receive a message of the bridge";
+                std::this_thread::sleep_for(std::chrono::nanoseconds(timeout.toNanoseconds()));
+            }
+        });
+}
+
+uint64_t DomainBridgeReceiver::numberOfPublishedSamples() const noexcept
+{
+    return m_numberOfPublishedSamples.load(std::memory_order_relaxed);
+}
+
+uint64_t DomainBridgeReceiver::numberOfDroppedSamples() const noexcept
+{
+    return m_numberOfDroppedSamples.load(std::memory_order_relaxed);
+}
+
+bool DomainBridgeReceiver::isPublished(const capro::ServiceDescription& service) const noexcept
+{
+    if (m_servicesToPublish.empty())
+    {
+        return true;
+    }
+    for (const auto& serviceToPublish : m_servicesToPublish)
+    {
+        if (serviceToPublish == service)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void DomainBridgeReceiver::process(const uint64_t messageSize) noexcept
+{
+    BridgeMessageHeader messageHeader;
+    if (messageSize < sizeof(messageHeader))
+    {
+        LogWarn() << "Discarding a bridge message which is smaller than its header";
+        return;
+    }
+    std::memcpy(&messageHeader, m_receiveBuffer.data(), sizeof(messageHeader));
+    if (messageHeader.magic != BridgeMessageHeader::MAGIC
+        || messageHeader.protocolVersion != BridgeMessageHeader::PROTOCOL_VERSION
+        || messageHeader.serviceIndex >= MAX_BRIDGED_SERVICES)
+    {
+        LogWarn() << "Discarding a bridge message with an invalid header";
+        return;
+    }
+
+    switch (messageHeader.type)
+    {
+    case BridgeMessageType::OFFER:
+        offer(messageHeader, &m_receiveBuffer[sizeof(messageHeader)], messageSize - sizeof(messageHeader));
+        break;
+    case BridgeMessageType::STOP_OFFER:
+        stopOffer(messageHeader.serviceIndex);
+        break;
+    case BridgeMessageType::SAMPLES:
+        publish(messageHeader, messageSize);
+        break;
+    case BridgeMessageType::SAMPLE_FRAGMENT:
+        publishFragment(messageHeader, messageSize);
+        break;
+    default:
+        LogWarn() << "Discarding a bridge message of the unknown type "
+                  << static_cast<uint16_t>(messageHeader.type);
+        break;
+    }
+}
+
+void DomainBridgeReceiver::offer(const BridgeMessageHeader& messageHeader,
+                                 const uint8_t* serializedService,
+                                 const uint64_t size) noexcept
+{
+    // NOLINTJUSTIFICATION the serialized service is a string of the message
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    auto service = capro::ServiceDescription::deserialize(
+        cxx::Serialization(std::string(reinterpret_cast<const char*>(serializedService), size)));
+    if (service.has_error())
+    {
+        LogWarn() << "Discarding a bridge message with an invalid service description";
+        return;
+    }
+
+    const auto serviceIndex = messageHeader.serviceIndex;
+    if (serviceIndex >= m_announcedServices.size())
+    {
+        m_announcedServices.resize(serviceIndex + 1U);
+    }
+    auto& announcedService = m_announcedServices[serviceIndex];
+    if (announcedService.channel.has_value())
+    {
+        // a sender announces its services again when it reconnects
+        if (announcedService.channel->getServiceDescription() == service.value())
+        {
+            if (announcedService.generation != messageHeader.generation)
+            {
+                discardFragmentedSample(announcedService);
+                announcedService.generation = messageHeader.generation;
+            }
+            return;
+        }
+        stopOffer(serviceIndex);
+    }
+
+    announcedService.generation = messageHeader.generation;
+    if (!isPublished(service.value()))
+    {
+        return;
+    }
+
+    addChannel(service.value(), m_publisherOptions)
+        .and_then([&](auto& addedChannel) { announcedService.channel.emplace(addedChannel); })
+        .or_else([&](auto) {
+            LogWarn() << "Unable to publish " << service.value() << " since no channel could be created";
+        });
+}
+
+void DomainBridgeReceiver::stopOffer(const uint16_t serviceIndex) noexcept
+{
+    if (serviceIndex >= m_announcedServices.size() || !m_announcedServices[serviceIndex].channel.has_value())
+    {
+        return;
+    }
+
+    auto& announcedService = m_announcedServices[serviceIndex];
+    discardFragmentedSample(announcedService);
+    discardChannel(announcedService.channel->getServiceDescription()).or_else([](auto) {});
+    announcedService.channel.reset();
+}
+
+cxx::optional<DomainBridgeReceiver::AnnouncedService*>
+DomainBridgeReceiver::announcedServiceOf(const BridgeMessageHeader& messageHeader) noexcept
+{
+    if (messageHeader.serviceIndex >= m_announcedServices.size())
+    {
+        return cxx::nullopt;
+    }
+    auto& announcedService = m_announcedServices[messageHeader.serviceIndex];
+    // the samples of a stopped service can still arrive after its index was assigned to another service
+    if (!announcedService.channel.has_value() || announcedService.generation != messageHeader.generation)
+    {
+        return cxx::nullopt;
+    }
+    return &announcedService;
+}
+
+void DomainBridgeReceiver::publish(const BridgeMessageHeader& messageHeader, const uint64_t messageSize) noexcept
+{
+    const uint64_t numberOfSamples{messageHeader.numberOfSamples};
+    auto announcedService = announcedServiceOf(messageHeader);
+    if (!announcedService.has_value())
+    {
+        // the service is not published in this domain
+        m_numberOfDroppedSamples.fetch_add(numberOfSamples, std::memory_order_relaxed);
+        return;
+    }
+
+    auto publisher = (*announcedService)->channel->getIceoryxTerminal();
+    uint64_t position{sizeof(messageHeader)};
+    for (uint64_t i = 0U; i < numberOfSamples; ++i)
+    {
+        BridgeSampleHeader sampleHeader;
+        if (messageSize - position < sizeof(sampleHeader))
+        {
+            LogWarn() << "Discarding the remainder of a truncated bridge message";
+            m_numberOfDroppedSamples.fetch_add(numberOfSamples - i, std::memory_order_relaxed);
+            return;
+        }
+        std::memcpy(&sampleHeader, &m_receiveBuffer[position], sizeof(sampleHeader));
+        position += sizeof(sampleHeader);
+
+        const uint64_t sampleDataSize{static_cast<uint64_t>(sampleHeader.userHeaderSize)
+                                      + static_cast<uint64_t>(sampleHeader.userPayloadSize)};
+        if (messageSize - position < sampleDataSize)
+        {
+            LogWarn() << "Discarding the remainder of a truncated bridge message";
+            m_numberOfDroppedSamples.fetch_add(numberOfSamples - i, std::memory_order_relaxed);
+            return;
+        }
+
+        loan(*publisher, sampleHeader)
+            .and_then([&](void* userPayload) {
+                copyIntoSample(userPayload, 0U, &m_receiveBuffer[position], sampleDataSize);
+                publisher->publish(userPayload);
+                m_numberOfPublishedSamples.fetch_add(1U, std::memory_order_relaxed);
+            })
+            .or_else([&](auto) { m_numberOfDroppedSamples.fetch_add(1U, std::memory_order_relaxed); });
+        position += sampleDataSize;
+    }
+}
+
+void DomainBridgeReceiver::publishFragment(const BridgeMessageHeader& messageHeader,
+                                           const uint64_t messageSize) noexcept
+{
+    BridgeSampleHeader sampleHeader;
+    if (messageSize < sizeof(messageHeader) + sizeof(sampleHeader))
+    {
+        LogWarn() << "Discarding a truncated bridge message";
+        return;
+    }
+    std::memcpy(&sampleHeader, &m_receiveBuffer[sizeof(messageHeader)], sizeof(sampleHeader));
+    const uint64_t position{sizeof(messageHeader) + sizeof(sampleHeader)};
+    const uint64_t fragmentSize{messageSize - position};
+    const bool isFirstFragment{sampleHeader.fragmentOffset == 0U};
+
+    auto announcedService = announcedServiceOf(messageHeader);
+    if (!announcedService.has_value())
+    {
+        // every sample is counted once, with its first fragment
+        if (isFirstFragment)
+        {
+            m_numberOfDroppedSamples.fetch_add(1U, std::memory_order_relaxed);
+        }
+        return;
+    }
+
+    auto& service = **announcedService;
+    auto publisher = service.channel->getIceoryxTerminal();
+    if (isFirstFragment)
+    {
+        // the remaining fragments of the previous sample were dropped by the sender
+        discardFragmentedSample(service);
+        loan(*publisher, sampleHeader)
+            .and_then([&](void* userPayload) {
+                service.fragmentedUserPayload = userPayload;
+                service.receivedFragmentSize = 0U;
+            })
+            .or_else([&](auto) { m_numberOfDroppedSamples.fetch_add(1U, std::memory_order_relaxed); });
+    }
+    if (service.fragmentedUserPayload == nullptr)
+    {
+        return;
+    }
+
+    const auto chunkHeader = mepoo::ChunkHeader::fromUserPayload(service.fragmentedUserPayload);
+    const uint64_t sampleDataSize{static_cast<uint64_t>(chunkHeader->userHeaderSize())
+                                  + static_cast<uint64_t>(chunkHeader->userPayloadSize())};
+    if (sampleHeader.fragmentOffset != service.receivedFragmentSize
+        || sampleHeader.userPayloadSize != chunkHeader->userPayloadSize()
+        || sampleDataSize - service.receivedFragmentSize < fragmentSize)
+    {
+        LogWarn() << "Discarding a sample with missing or invalid fragments";
+        discardFragmentedSample(service);
+        return;
+    }
+
+    copyIntoSample(
+        service.fragmentedUserPayload, service.receivedFragmentSize, &m_receiveBuffer[position], fragmentSize);
+    service.receivedFragmentSize += fragmentSize;
+    if (service.receivedFragmentSize == sampleDataSize)
+    {
+        publisher->publish(service.fragmentedUserPayload);
+        service.fragmentedUserPayload = nullptr;
+        m_numberOfPublishedSamples.fetch_add(1U, std::memory_order_relaxed);
+    }
+}
+
+void DomainBridgeReceiver::discardFragmentedSample(AnnouncedService& announcedService) noexcept
+{
+    if (announcedService.fragmentedUserPayload == nullptr)
+    {
+        return;
+    }
+    announcedService.channel->getIceoryxTerminal()->release(announcedService.fragmentedUserPayload);
+    announcedService.fragmentedUserPayload = nullptr;
+    m_numberOfDroppedSamples.fetch_add(1U, std::memory_order_relaxed);
+}
+
+} // namespace gw
+} // namespace iox
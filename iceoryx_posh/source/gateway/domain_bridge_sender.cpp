@@ -0,0 +1,528 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/gateway/domain_bridge_sender.hpp"
+#include "iceoryx_hoofs/cxx/serialization.hpp"
+#include "iceoryx_posh/internal/capro/capro_message.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace iox
+{
+namespace gw
+{
+namespace
+{
+/// @brief the longest time the sender blocks on a full socket before it checks whether the gateway is shut down
+constexpr units::Duration SEND_TIMEOUT{100_ms};
+constexpr uint64_t MAX_SEND_ATTEMPTS{DomainBridgeSender::MAX_SEND_DURATION.toMilliseconds()
+                                     / SEND_TIMEOUT.toMilliseconds()};
+
+iovec ioVectorEntry(const void* data, const uint64_t offset, const uint64_t size) noexcept
+{
+    iovec entry;
+    // NOLINTJUSTIFICATION the data is only read by sendmsg, iovec lacks the const qualifier for historic reasons
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-const-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    entry.iov_base = const_cast<uint8_t*>(static_cast<const uint8_t*>(data) + offset);
+    // NOLINTEND(cppcoreguidelines-pro-type-const-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    entry.iov_len = size;
+    return entry;
+}
+} // namespace
+
+static_assert(MAX_BRIDGED_SERVICES <= std::numeric_limits<uint16_t>::max() + 1U,
+              "The service index of a bridge message cannot address all services");
+
+constexpr uint64_t BridgeSenderTerminal::NOT_ANNOUNCED;
+constexpr uint32_t DomainBridgeSender::Batch::MAX_IO_VECTOR_SIZE;
+constexpr units::Duration DomainBridgeSender::MAX_SEND_DURATION;
+
+DomainBridgeSender::Batch::Batch() noexcept
+{
+    clear();
+}
+
+void DomainBridgeSender::Batch::clear() noexcept
+{
+    messageHeader = BridgeMessageHeader();
+    messageHeader.type = BridgeMessageType::SAMPLES;
+    ioVectorSize = 0U;
+    messageSize = 0U;
+    append(&messageHeader, sizeof(messageHeader));
+}
+
+bool DomainBridgeSender::Batch::isEmpty() const noexcept
+{
+    return messageHeader.numberOfSamples == 0U;
+}
+
+bool DomainBridgeSender::Batch::hasSpaceFor(const uint64_t sampleSize) const noexcept
+{
+    return messageHeader.numberOfSamples < MAX_BRIDGE_SAMPLES_PER_MESSAGE
+           && messageSize + sampleSize <= MAX_BRIDGE_MESSAGE_SIZE;
+}
+
+void DomainBridgeSender::Batch::add(const mepoo::ChunkHeader& chunkHeader) noexcept
+{
+    const auto sampleIndex = messageHeader.numberOfSamples;
+    auto& sampleHeader = sampleHeaders[sampleIndex];
+    sampleHeader.userPayloadSize = chunkHeader.userPayloadSize();
+    sampleHeader.userPayloadAlignment = chunkHeader.userPayloadAlignment();
+    sampleHeader.userHeaderSize = chunkHeader.userHeaderSize();
+    userPayloads[sampleIndex] = chunkHeader.userPayload();
+
+    append(&sampleHeader, sizeof(sampleHeader));
+    if (chunkHeader.userHeaderSize() != CHUNK_NO_USER_HEADER_SIZE)
+    {
+        append(chunkHeader.userHeader(), chunkHeader.userHeaderSize());
+    }
+    append(chunkHeader.userPayload(), chunkHeader.userPayloadSize());
+    ++messageHeader.numberOfSamples;
+}
+
+void DomainBridgeSender::Batch::append(const void* data, const uint64_t size) noexcept
+{
+    ioVector[ioVectorSize] = ioVectorEntry(data, 0U, size);
+    ++ioVectorSize;
+    messageSize += size;
+}
+
+DomainBridgeSender::DomainBridgeSender(const BridgeName_t& bridgeName,
+                                       const popo::SubscriberOptions& subscriberOptions,
+                                       const capro::Interfaces interface) noexcept
+    : GatewayGeneric<BridgeSenderChannel>(interface, 1000_ms, 50_ms, ForwardingMode::EVENT_DRIVEN)
+    , m_bridgeName(bridgeName)
+    , m_subscriberOptions(subscriberOptions)
+{
+}
+
+DomainBridgeSender::~DomainBridgeSender() noexcept
+{
+    // the forwarding threads use the socket which is destroyed before the base class
+    shutdown();
+}
+
+void DomainBridgeSender::loadConfiguration(const config::GatewayConfig& config) noexcept
+{
+    m_servicesToBridge.clear();
+    for (const auto& entry : config.m_configuredServices)
+    {
+        m_servicesToBridge.emplace_back(entry.m_serviceDescription);
+    }
+}
+
+void DomainBridgeSender::discover(const capro::CaproMessage& msg) noexcept
+{
+    if (msg.m_serviceType != capro::CaproServiceType::PUBLISHER || !isBridged(msg.m_serviceDescription))
+    {
+        return;
+    }
+
+    cxx::optional<Route> stopOfferRoute;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (msg.m_type == capro::CaproMessageType::OFFER)
+        {
+            offer(msg.m_serviceDescription);
+        }
+        else if (msg.m_type == capro::CaproMessageType::STOP_OFFER)
+        {
+            stopOfferRoute = stopOffer(msg.m_serviceDescription);
+        }
+    }
+
+    // like the samples, the STOP_OFFER is sent without holding the mutex
+    stopOfferRoute.and_then([&](auto& route) {
+        BridgeMessageHeader header;
+        header.type = BridgeMessageType::STOP_OFFER;
+        header.serviceIndex = route.serviceIndex;
+        header.generation = route.generation;
+        iovec ioVector{&header, sizeof(header)};
+        if (trySend(*route.socket, &ioVector, 1U).has_error())
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_socket == route.socket)
+            {
+                disconnect();
+            }
+        }
+    });
+}
+
+void DomainBridgeSender::forward(const BridgeSenderChannel& channel) noexcept
+{
+    auto subscriber = channel.getIceoryxTerminal();
+
+    Batch batch;
+    while (!subscriber->take()
+                .and_then([&](const void* userPayload) {
+                    const auto& chunkHeader = *mepoo::ChunkHeader::fromUserPayload(userPayload);
+                    const auto size = sampleSize(chunkHeader);
+                    if (sizeof(BridgeMessageHeader) + size > MAX_BRIDGE_MESSAGE_SIZE)
+                    {
+                        // the samples of the batch were taken before and are sent first to keep the order
+                        if (!batch.isEmpty())
+                        {
+                            send(batch, channel);
+                        }
+                        sendFragmented(chunkHeader, channel);
+                        return;
+                    }
+
+                    if (!batch.hasSpaceFor(size))
+                    {
+                        send(batch, channel);
+                    }
+                    batch.add(chunkHeader);
+                })
+                .has_error())
+    {
+    }
+
+    if (!batch.isEmpty())
+    {
+        send(batch, channel);
+    }
+}
+
+uint64_t DomainBridgeSender::numberOfSentSamples() const noexcept
+{
+    return m_numberOfSentSamples.load(std::memory_order_relaxed);
+}
+
+uint64_t DomainBridgeSender::numberOfDroppedSamples() const noexcept
+{
+    return m_numberOfDroppedSamples.load(std::memory_order_relaxed);
+}
+
+bool DomainBridgeSender::isBridged(const capro::ServiceDescription& service) const noexcept
+{
+    if (m_servicesToBridge.empty())
+    {
+        // the services of RouDi exist in every domain
+        return service.getInstanceIDString()
+               != capro::IdString_t(cxx::TruncateToCapacity, SERVICE_DISCOVERY_INSTANCE_NAME);
+    }
+    for (const auto& serviceToBridge : m_servicesToBridge)
+    {
+        if (serviceToBridge == service)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint64_t DomainBridgeSender::sampleSize(const mepoo::ChunkHeader& chunkHeader) noexcept
+{
+    return sizeof(BridgeSampleHeader) + static_cast<uint64_t>(chunkHeader.userHeaderSize())
+           + static_cast<uint64_t>(chunkHeader.userPayloadSize());
+}
+
+void DomainBridgeSender::send(Batch& batch, const BridgeSenderChannel& channel) noexcept
+{
+    const uint64_t numberOfSamples{batch.messageHeader.numberOfSamples};
+    bool isSent{false};
+    routeOf(channel).and_then([&](auto& route) {
+        batch.messageHeader.serviceIndex = route.serviceIndex;
+        batch.messageHeader.generation = route.generation;
+        isSent = sendMessage(channel, route, batch.ioVector.data(), batch.ioVectorSize);
+    });
+
+    if (isSent)
+    {
+        m_numberOfSentSamples.fetch_add(numberOfSamples, std::memory_order_relaxed);
+    }
+    else
+    {
+        m_numberOfDroppedSamples.fetch_add(numberOfSamples, std::memory_order_relaxed);
+    }
+
+    // the kernel has copied the samples into the socket, the chunks can be released
+    auto subscriber = channel.getIceoryxTerminal();
+    for (uint64_t i = 0U; i < numberOfSamples; ++i)
+    {
+        subscriber->release(batch.userPayloads[i]);
+    }
+    batch.clear();
+}
+
+void DomainBridgeSender::sendFragmented(const mepoo::ChunkHeader& chunkHeader,
+                                        const BridgeSenderChannel& channel) noexcept
+{
+    BridgeMessageHeader messageHeader;
+    messageHeader.type = BridgeMessageType::SAMPLE_FRAGMENT;
+    messageHeader.numberOfSamples = 1U;
+    BridgeSampleHeader sampleHeader;
+    sampleHeader.userPayloadSize = chunkHeader.userPayloadSize();
+    sampleHeader.userPayloadAlignment = chunkHeader.userPayloadAlignment();
+    sampleHeader.userHeaderSize = chunkHeader.userHeaderSize();
+
+    const uint64_t userHeaderSize{chunkHeader.userHeaderSize()};
+    const uint64_t sampleDataSize{userHeaderSize + chunkHeader.userPayloadSize()};
+    bool isSent{false};
+    routeOf(channel).and_then([&](auto& route) {
+        messageHeader.serviceIndex = route.serviceIndex;
+        messageHeader.generation = route.generation;
+        isSent = true;
+        for (uint64_t offset = 0U; offset < sampleDataSize && isSent; offset += MAX_BRIDGE_FRAGMENT_SIZE)
+        {
+            const uint64_t fragmentSize{std::min(MAX_BRIDGE_FRAGMENT_SIZE, sampleDataSize - offset)};
+            sampleHeader.fragmentOffset = static_cast<uint32_t>(offset);
+
+            // a fragment can contain the end of the user-header and the beginning of the user-payload
+            std::array<iovec, 4U> ioVector;
+            uint32_t ioVectorSize{0U};
+            ioVector[ioVectorSize++] = ioVectorEntry(&messageHeader, 0U, sizeof(messageHeader));
+            ioVector[ioVectorSize++] = ioVectorEntry(&sampleHeader, 0U, sizeof(sampleHeader));
+            if (offset < userHeaderSize)
+            {
+                ioVector[ioVectorSize++] = ioVectorEntry(
+                    chunkHeader.userHeader(), offset, std::min(fragmentSize, userHeaderSize - offset));
+            }
+            if (offset + fragmentSize > userHeaderSize)
+            {
+                const uint64_t userPayloadOffset{std::max(offset, userHeaderSize) - userHeaderSize};
+                ioVector[ioVectorSize++] =
+                    ioVectorEntry(chunkHeader.userPayload(),
+                                  userPayloadOffset,
+                                  offset + fragmentSize - userHeaderSize - userPayloadOffset);
+            }
+            // a sample with missing fragments is discarded by the receiver
+            isSent = sendMessage(channel, route, ioVector.data(), ioVectorSize);
+        }
+    });
+
+    if (isSent)
+    {
+        m_numberOfSentSamples.fetch_add(1U, std::memory_order_relaxed);
+    }
+    else
+    {
+        m_numberOfDroppedSamples.fetch_add(1U, std::memory_order_relaxed);
+    }
+    channel.getIceoryxTerminal()->release(chunkHeader.userPayload());
+}
+
+cxx::optional<DomainBridgeSender::Route> DomainBridgeSender::routeOf(const BridgeSenderChannel& channel) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Route route;
+    if (!m_socket && !connect())
+    {
+        return cxx::nullopt;
+    }
+    if (!updateRoute(channel, route))
+    {
+        return cxx::nullopt;
+    }
+    return route;
+}
+
+bool DomainBridgeSender::updateRoute(const BridgeSenderChannel& channel, Route& route) noexcept
+{
+    // the service index is reset when the channel was discarded while the samples were taken
+    auto& terminal = *channel.getExternalTerminal();
+    if (!terminal.serviceIndex.has_value())
+    {
+        return false;
+    }
+
+    route.socket = m_socket;
+    route.connectionNumber = m_connectionNumber;
+    route.serviceIndex = terminal.serviceIndex.value();
+    route.generation = terminal.generation;
+    // only the forwarding thread of the channel sends its OFFER, this way it always precedes the samples
+    route.isAnnouncementRequired = (terminal.announcedConnectionNumber != m_connectionNumber);
+    if (route.isAnnouncementRequired)
+    {
+        terminal.announcedConnectionNumber = m_connectionNumber;
+        route.serializedService = m_announcedServices[route.serviceIndex]->serializedService;
+    }
+    return true;
+}
+
+bool DomainBridgeSender::sendMessage(const BridgeSenderChannel& channel,
+                                     Route& route,
+                                     const iovec* ioVector,
+                                     const uint32_t ioVectorSize) noexcept
+{
+    // a receiver which was restarted is reconnected once per message
+    bool hasReconnected{false};
+    while (true)
+    {
+        auto result = announce(route);
+        if (!result.has_error())
+        {
+            result = trySend(*route.socket, ioVector, ioVectorSize);
+        }
+        if (!result.has_error())
+        {
+            return true;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (hasReconnected || result.get_error() == posix::IpcChannelError::TIMEOUT
+            || result.get_error() == posix::IpcChannelError::MESSAGE_TOO_LONG)
+        {
+            // the OFFER is sent again with the next message
+            auto& terminal = *channel.getExternalTerminal();
+            if (route.isAnnouncementRequired && terminal.announcedConnectionNumber == route.connectionNumber)
+            {
+                terminal.announcedConnectionNumber = BridgeSenderTerminal::NOT_ANNOUNCED;
+            }
+            return false;
+        }
+        hasReconnected = true;
+
+        // another forwarding thread may have reconnected already
+        if (m_socket == route.socket)
+        {
+            disconnect();
+        }
+        if ((!m_socket && !connect()) || !updateRoute(channel, route))
+        {
+            return false;
+        }
+    }
+}
+
+void DomainBridgeSender::offer(const capro::ServiceDescription& service) noexcept
+{
+    if (findChannel(service).has_value())
+    {
+        return;
+    }
+
+    uint64_t serviceIndex{0U};
+    while (serviceIndex < m_announcedServices.size() && m_announcedServices[serviceIndex].has_value())
+    {
+        ++serviceIndex;
+    }
+    if (serviceIndex == m_announcedServices.size() && !m_announcedServices.emplace_back())
+    {
+        LogWarn() << "Unable to send " << service << " since the maximum number of bridged services is reached";
+        return;
+    }
+
+    // the service is announced to the receiver with the first message of the channel
+    addChannel(service, m_subscriberOptions)
+        .and_then([&](auto& channel) {
+            const uint16_t generation{m_nextGeneration++};
+            channel.getExternalTerminal()->serviceIndex.emplace(static_cast<uint16_t>(serviceIndex));
+            channel.getExternalTerminal()->generation = generation;
+            m_announcedServices[serviceIndex].emplace(
+                AnnouncedService{static_cast<cxx::Serialization>(service).toString()});
+        })
+        .or_else([&](auto) {
+            LogWarn() << "Unable to send " << service << " since no channel could be created";
+        });
+}
+
+cxx::optional<DomainBridgeSender::Route>
+DomainBridgeSender::stopOffer(const capro::ServiceDescription& service) noexcept
+{
+    cxx::optional<Route> stopOfferRoute;
+    findChannel(service).and_then([&](auto& channel) {
+        auto& terminal = *channel.getExternalTerminal();
+        if (!terminal.serviceIndex.has_value())
+        {
+            return;
+        }
+        m_announcedServices[terminal.serviceIndex.value()].reset();
+
+        // the receiver only knows the service when it was announced on the current connection
+        if (m_socket && terminal.announcedConnectionNumber == m_connectionNumber)
+        {
+            Route route;
+            route.socket = m_socket;
+            route.connectionNumber = m_connectionNumber;
+            route.serviceIndex = terminal.serviceIndex.value();
+            route.generation = terminal.generation;
+            stopOfferRoute.emplace(std::move(route));
+        }
+        terminal.serviceIndex.reset();
+    });
+    discardChannel(service).or_else([](auto) {});
+    return stopOfferRoute;
+}
+
+bool DomainBridgeSender::connect() noexcept
+{
+    auto socket = posix::UnixDomainSocket::create(m_bridgeName, posix::IpcChannelSide::CLIENT);
+    if (socket.has_error())
+    {
+        // the receiver is not running, this is reported by the dropped samples
+        return false;
+    }
+    m_socket = std::make_shared<posix::UnixDomainSocket>(std::move(socket.value()));
+    // the services are announced again on the new connection
+    ++m_connectionNumber;
+    return true;
+}
+
+void DomainBridgeSender::disconnect() noexcept
+{
+    m_socket.reset();
+}
+
+cxx::expected<posix::IpcChannelError> DomainBridgeSender::announce(Route& route) const noexcept
+{
+    if (!route.isAnnouncementRequired)
+    {
+        return cxx::success<>();
+    }
+
+    BridgeMessageHeader header;
+    header.type = BridgeMessageType::OFFER;
+    header.serviceIndex = route.serviceIndex;
+    header.generation = route.generation;
+    std::array<iovec, 2U> ioVector;
+    ioVector[0U] = ioVectorEntry(&header, 0U, sizeof(header));
+    ioVector[1U] = ioVectorEntry(route.serializedService.data(), 0U, route.serializedService.size());
+
+    auto result = trySend(*route.socket, ioVector.data(), static_cast<uint32_t>(ioVector.size()));
+    if (!result.has_error())
+    {
+        route.isAnnouncementRequired = false;
+    }
+    return result;
+}
+
+cxx::expected<posix::IpcChannelError> DomainBridgeSender::trySend(const posix::UnixDomainSocket& socket,
+                                                                  const iovec* ioVector,
+                                                                  const uint32_t ioVectorSize) const noexcept
+{
+    // with QueueFullPolicy::BLOCK_PRODUCER the back-pressure of the receiver is passed on to the publishers, the
+    // sender blocks until the receiver catches up or the gateway is shut down; otherwise the message is dropped after
+    // MAX_SEND_DURATION
+    const bool isBlocking{m_subscriberOptions.queueFullPolicy == popo::QueueFullPolicy::BLOCK_PRODUCER};
+    for (uint64_t attempt = 1U;; ++attempt)
+    {
+        auto result = socket.timedSend(ioVector, ioVectorSize, SEND_TIMEOUT);
+        if (result.has_error() && result.get_error() == posix::IpcChannelError::TIMEOUT
+            && (isBlocking || attempt < MAX_SEND_ATTEMPTS) && isRunning())
+        {
+            continue;
+        }
+        return result;
+    }
+}
+
+} // namespace gw
+} // namespace iox
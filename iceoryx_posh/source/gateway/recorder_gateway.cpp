@@ -0,0 +1,161 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/gateway/recorder_gateway.hpp"
+#include "iceoryx_posh/internal/capro/capro_message.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+
+namespace iox
+{
+namespace gw
+{
+constexpr capro::Interfaces RecorderGateway::DEFAULT_INTERFACE;
+
+RecorderGateway::RecorderGateway(const RecordingPath_t& recordingPath,
+                                 const uint64_t segmentSize,
+                                 const capro::Interfaces interface) noexcept
+    : GatewayGeneric<RecorderChannel>(interface, 1000_ms, 50_ms, ForwardingMode::EVENT_DRIVEN)
+    , m_writer(recordingPath, segmentSize)
+{
+}
+
+RecorderGateway::~RecorderGateway() noexcept
+{
+    // the forwarding threads use the writer which is destroyed before the base class
+    shutdown();
+}
+
+void RecorderGateway::loadConfiguration(const config::GatewayConfig& config) noexcept
+{
+    m_servicesToRecord.clear();
+    for (const auto& entry : config.m_configuredServices)
+    {
+        m_servicesToRecord.emplace_back(entry.m_serviceDescription);
+    }
+}
+
+void RecorderGateway::discover(const capro::CaproMessage& msg) noexcept
+{
+    if (msg.m_serviceType != capro::CaproServiceType::PUBLISHER || !isRecorded(msg.m_serviceDescription))
+    {
+        return;
+    }
+
+    if (msg.m_type == capro::CaproMessageType::OFFER)
+    {
+        popo::SubscriberOptions options;
+        // the oldest chunks are discarded when the recorder falls behind, this way the publishers are never blocked
+        options.queueCapacity = MAX_SUBSCRIBER_QUEUE_CAPACITY;
+        options.queueFullPolicy = popo::QueueFullPolicy::DISCARD_OLDEST_DATA;
+        addChannel(msg.m_serviceDescription, options).or_else([&](auto) {
+            LogWarn() << "Unable to record " << msg.m_serviceDescription << " since no channel could be created";
+        });
+    }
+    else if (msg.m_type == capro::CaproMessageType::STOP_OFFER)
+    {
+        // the service stays in the recording, it is only removed from the channels
+        discardChannel(msg.m_serviceDescription).or_else([](auto) {});
+    }
+}
+
+void RecorderGateway::forward(const RecorderChannel& channel) noexcept
+{
+    auto subscriber = channel.getIceoryxTerminal();
+    auto recordedService = channel.getExternalTerminal();
+
+    // a channel is never forwarded concurrently, therefore the service index needs no synchronization
+    if (!recordedService->serviceIndex.has_value())
+    {
+        m_writer.addService(channel.getServiceDescription()).and_then([&](auto serviceIndex) {
+            recordedService->serviceIndex.emplace(serviceIndex);
+        });
+    }
+
+    if (subscriber->hasMissedData())
+    {
+        m_numberOfLossEvents.fetch_add(1U, std::memory_order_relaxed);
+    }
+
+    while (!subscriber->take()
+                .and_then([&](const void* userPayload) {
+                    record(*recordedService, channel, *mepoo::ChunkHeader::fromUserPayload(userPayload));
+                    subscriber->release(userPayload);
+                })
+                .has_error())
+    {
+    }
+}
+
+uint64_t RecorderGateway::numberOfRecordedChunks() const noexcept
+{
+    return m_writer.numberOfChunks();
+}
+
+uint64_t RecorderGateway::numberOfDroppedChunks() const noexcept
+{
+    return m_numberOfDroppedChunks.load(std::memory_order_relaxed);
+}
+
+uint64_t RecorderGateway::numberOfLossEvents() const noexcept
+{
+    return m_numberOfLossEvents.load(std::memory_order_relaxed);
+}
+
+void RecorderGateway::record(const RecordedServiceTerminal& recordedService,
+                             const RecorderChannel& channel,
+                             const mepoo::ChunkHeader& chunkHeader) noexcept
+{
+    if (!recordedService.serviceIndex.has_value())
+    {
+        // the writer reported already that the service could not be added
+        m_numberOfDroppedChunks.fetch_add(1U, std::memory_order_relaxed);
+        return;
+    }
+
+    m_writer.write(recordedService.serviceIndex.value(), chunkHeader)
+        .and_then([&] { m_hasWriteError.store(false, std::memory_order_relaxed); })
+        .or_else([&](auto& error) {
+            m_numberOfDroppedChunks.fetch_add(1U, std::memory_order_relaxed);
+            // only the first error of a series is reported, e.g. a full disk would otherwise flood the log
+            if (!m_hasWriteError.exchange(true, std::memory_order_relaxed))
+            {
+                LogWarn() << "Unable to record a chunk of " << channel.getServiceDescription() << ": "
+                          << asStringLiteral(error);
+            }
+        });
+}
+
+bool RecorderGateway::isRecorded(const capro::ServiceDescription& service) const noexcept
+{
+    if (m_servicesToRecord.empty())
+    {
+        // the services of RouDi cannot be offered by the replayer and are therefore only recorded on request
+        return service.getInstanceIDString() != capro::IdString_t(cxx::TruncateToCapacity,
+                                                                   SERVICE_DISCOVERY_INSTANCE_NAME);
+    }
+    for (const auto& serviceToRecord : m_servicesToRecord)
+    {
+        if (serviceToRecord == service)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace gw
+} // namespace iox
@@ -0,0 +1,649 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/gateway/recording.hpp"
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/cxx/filesystem.hpp"
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/cxx/serialization.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
+#include "iceoryx_hoofs/posix_wrapper/types.hpp"
+#include "iceoryx_platform/errno.hpp"
+#include "iceoryx_platform/fcntl.hpp"
+#include "iceoryx_platform/stat.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+
+#include <cstring>
+#include <limits>
+
+namespace iox
+{
+namespace gw
+{
+constexpr uint64_t RecordingSegmentHeader::MAGIC;
+constexpr uint32_t RecordingSegmentHeader::FORMAT_VERSION;
+constexpr uint32_t RecordHeader::ALIGNMENT;
+constexpr uint64_t RecordingWriter::DEFAULT_SEGMENT_SIZE;
+constexpr uint64_t RecordingWriter::MIN_SEGMENT_SIZE;
+
+namespace
+{
+constexpr int32_t INVALID_FILE_DESCRIPTOR{-1};
+
+uint64_t firstRecordPosition() noexcept
+{
+    return cxx::align(sizeof(RecordingSegmentHeader), static_cast<uint64_t>(RecordHeader::ALIGNMENT));
+}
+
+uint64_t recordSize(const uint64_t payloadSize) noexcept
+{
+    return cxx::align(sizeof(RecordHeader) + payloadSize, static_cast<uint64_t>(RecordHeader::ALIGNMENT));
+}
+
+RecordingPath_t segmentPath(const RecordingPath_t& basePath, const uint64_t segmentIndex) noexcept
+{
+    RecordingPath_t path{basePath};
+    path.unsafe_append('.');
+    path.unsafe_append(cxx::string<20U>(cxx::TruncateToCapacity, cxx::convert::toString(segmentIndex)));
+    return path;
+}
+
+void closeFile(const int32_t fileDescriptor, const RecordingPath_t& path) noexcept
+{
+    posix::posixCall(iox_close)(fileDescriptor).failureReturnValue(-1).evaluate().or_else([&](auto&) {
+        LogWarn() << "Unable to close the recording segment '" << path << "'";
+    });
+}
+
+void removeFile(const RecordingPath_t& path) noexcept
+{
+    posix::posixCall(unlink)(path.c_str()).failureReturnValue(-1).evaluate().or_else([&](auto&) {
+        LogWarn() << "Unable to remove the recording segment '" << path << "'";
+    });
+}
+} // namespace
+
+const char* asStringLiteral(const RecordingError error) noexcept
+{
+    switch (error)
+    {
+    case RecordingError::FILE_ACCESS_FAILED:
+        return "RecordingError::FILE_ACCESS_FAILED";
+    case RecordingError::DISK_SPACE_ALLOCATION_FAILED:
+        return "RecordingError::DISK_SPACE_ALLOCATION_FAILED";
+    case RecordingError::MEMORY_MAPPING_FAILED:
+        return "RecordingError::MEMORY_MAPPING_FAILED";
+    case RecordingError::INVALID_FORMAT:
+        return "RecordingError::INVALID_FORMAT";
+    case RecordingError::INCOMPATIBLE_CHUNK_HEADER_VERSION:
+        return "RecordingError::INCOMPATIBLE_CHUNK_HEADER_VERSION";
+    case RecordingError::RECORD_TOO_LARGE:
+        return "RecordingError::RECORD_TOO_LARGE";
+    case RecordingError::TOO_MANY_SERVICES:
+        return "RecordingError::TOO_MANY_SERVICES";
+    case RecordingError::UNKNOWN_SERVICE:
+        return "RecordingError::UNKNOWN_SERVICE";
+    case RecordingError::END_OF_RECORDING:
+        return "RecordingError::END_OF_RECORDING";
+    }
+
+    return "[Undefined RecordingError]";
+}
+
+// ============================================ RecordingWriter ============================================ //
+
+RecordingWriter::Segment::Segment(const uint64_t segmentIndex,
+                                  const int32_t segmentFileDescriptor,
+                                  posix::MemoryMap&& segmentMemoryMap) noexcept
+    : index(segmentIndex)
+    , fileDescriptor(segmentFileDescriptor)
+    , memoryMap(std::move(segmentMemoryMap))
+{
+}
+
+RecordingWriter::RecordingWriter(const RecordingPath_t& basePath, const uint64_t segmentSize) noexcept
+    : m_basePath(basePath)
+    , m_segmentSize(cxx::align(std::max(segmentSize, MIN_SEGMENT_SIZE), static_cast<uint64_t>(RecordHeader::ALIGNMENT)))
+{
+    if (m_segmentSize != segmentSize)
+    {
+        LogWarn() << "The segment size of the recording '" << m_basePath << "' is adjusted to " << m_segmentSize;
+    }
+    m_segmentPreparationThread = std::thread([this] { prepareSegments(); });
+}
+
+RecordingWriter::~RecordingWriter() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopped = true;
+    }
+    m_segmentPreparationCondition.notify_all();
+    m_segmentPreparationThread.join();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_pendingCopiesCondition.wait(lock, [this] { return m_numberOfPendingCopies == 0U; });
+    if (m_segment.has_value())
+    {
+        static_cast<RecordingSegmentHeader*>(m_segment->memoryMap.getBaseAddress())->usedSize = m_position;
+        closeSegment(m_segment.value());
+        m_segment.reset();
+    }
+    if (m_segmentToClose.has_value())
+    {
+        closeSegment(m_segmentToClose.value());
+        m_segmentToClose.reset();
+    }
+    if (m_nextSegment.has_value())
+    {
+        removeSegment(m_nextSegment.value());
+        m_nextSegment.reset();
+    }
+}
+
+cxx::expected<RecordingWriter::ServiceIndex_t, RecordingError>
+RecordingWriter::addService(const capro::ServiceDescription& service) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (uint64_t i = 0U; i < m_services.size(); ++i)
+    {
+        if (m_services[i].service == service)
+        {
+            return cxx::success<ServiceIndex_t>(static_cast<ServiceIndex_t>(i));
+        }
+    }
+
+    if (!m_services.emplace_back())
+    {
+        LogWarn() << "Unable to record " << service << " since the recording is limited to " << MAX_RECORDED_SERVICES
+                  << " services";
+        return cxx::error<RecordingError>(RecordingError::TOO_MANY_SERVICES);
+    }
+    auto& recordedService = m_services.back();
+    recordedService.service = service;
+    recordedService.serializedService = static_cast<cxx::Serialization>(service).toString();
+    return cxx::success<ServiceIndex_t>(static_cast<ServiceIndex_t>(m_services.size() - 1U));
+}
+
+cxx::expected<RecordingError> RecordingWriter::write(const ServiceIndex_t serviceIndex,
+                                                     const mepoo::ChunkHeader& chunkHeader) noexcept
+{
+    if (chunkHeader.chunkHeaderVersion() != mepoo::ChunkHeader::CHUNK_HEADER_VERSION)
+    {
+        return cxx::error<RecordingError>(RecordingError::INCOMPATIBLE_CHUNK_HEADER_VERSION);
+    }
+
+    const uint64_t usedSizeOfChunk = chunkHeader.usedSizeOfChunk();
+    const uint64_t chunkRecordSize = recordSize(usedSizeOfChunk);
+    const uint64_t timestamp = (chunkHeader.publishTimestamp() != 0U) ? chunkHeader.publishTimestamp()
+                                                                       : mepoo::ChunkHeader::publishTimestampNow();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (serviceIndex >= m_services.size())
+    {
+        return cxx::error<RecordingError>(RecordingError::UNKNOWN_SERVICE);
+    }
+    auto& recordedService = m_services[serviceIndex];
+    const uint64_t serviceRecordSize = recordSize(sizeof(uint64_t) + recordedService.serializedService.size());
+
+    // the service record is only needed for the first chunk of the service in a segment but a new segment could be
+    // required, therefore the space for both records is reserved
+    const uint64_t requiredSize = serviceRecordSize + chunkRecordSize;
+    if (chunkRecordSize > std::numeric_limits<uint32_t>::max() || firstRecordPosition() + requiredSize > m_segmentSize)
+    {
+        return cxx::error<RecordingError>(RecordingError::RECORD_TOO_LARGE);
+    }
+
+    auto reserveResult = reserve(lock, requiredSize);
+    if (reserveResult.has_error())
+    {
+        return reserveResult;
+    }
+
+    if (!recordedService.isDefinedInSegment)
+    {
+        auto serviceRecord = appendRecord(serviceRecordSize, RecordType::SERVICE, serviceIndex, timestamp);
+        const uint64_t length = recordedService.serializedService.size();
+        std::memcpy(serviceRecord, &length, sizeof(length));
+        std::memcpy(
+            static_cast<uint8_t*>(serviceRecord) + sizeof(length), recordedService.serializedService.data(), length);
+        recordedService.isDefinedInSegment = true;
+        m_numberOfBytes += serviceRecordSize;
+    }
+
+    // the record is reserved and the segment is not closed before the copy finished, therefore the chunk is copied
+    // without the lock
+    auto chunkRecord = appendRecord(chunkRecordSize, RecordType::CHUNK, serviceIndex, timestamp);
+    ++m_numberOfPendingCopies;
+    lock.unlock();
+    std::memcpy(chunkRecord, &chunkHeader, usedSizeOfChunk);
+    lock.lock();
+
+    --m_numberOfPendingCopies;
+    ++m_numberOfChunks;
+    m_numberOfBytes += chunkRecordSize;
+    if (m_numberOfPendingCopies == 0U)
+    {
+        m_pendingCopiesCondition.notify_all();
+    }
+
+    return cxx::success<>();
+}
+
+uint64_t RecordingWriter::numberOfChunks() const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_numberOfChunks;
+}
+
+uint64_t RecordingWriter::numberOfBytes() const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_numberOfBytes;
+}
+
+cxx::expected<RecordingError> RecordingWriter::reserve(std::unique_lock<std::mutex>& lock,
+                                                       const uint64_t size) noexcept
+{
+    while (true)
+    {
+        if (m_segment.has_value())
+        {
+            if (m_position + size <= m_segmentSize)
+            {
+                return cxx::success<>();
+            }
+
+            // the used size covers only complete records, another writer can reserve space or swap the segments in
+            // the meantime, therefore everything is checked again
+            if (m_numberOfPendingCopies != 0U)
+            {
+                m_pendingCopiesCondition.wait(lock);
+                continue;
+            }
+
+            // the full segment is closed by the preparation thread
+            static_cast<RecordingSegmentHeader*>(m_segment->memoryMap.getBaseAddress())->usedSize = m_position;
+            if (m_segmentToClose.has_value())
+            {
+                closeSegment(m_segmentToClose.value());
+                m_segmentToClose.reset();
+            }
+            m_segmentToClose.emplace(std::move(m_segment.value()));
+            m_segment.reset();
+            ++m_segmentIndex;
+            m_segmentPreparationCondition.notify_all();
+        }
+
+        // the file of a segment which is prepared right now must not be created a second time; another writer can
+        // activate a segment in the meantime, therefore everything is checked again
+        if (m_isPreparingSegment)
+        {
+            m_segmentPreparationCondition.wait(lock);
+            continue;
+        }
+
+        if (m_nextSegment.has_value())
+        {
+            auto nextSegment = std::move(m_nextSegment.value());
+            m_nextSegment.reset();
+            if (nextSegment.index == m_segmentIndex)
+            {
+                activateSegment(std::move(nextSegment));
+                continue;
+            }
+            removeSegment(nextSegment);
+        }
+
+        // the preparation failed or the first segment is required
+        auto segment = createSegment(m_segmentIndex);
+        if (segment.has_error())
+        {
+            return cxx::error<RecordingError>(segment.get_error());
+        }
+        activateSegment(std::move(segment.value()));
+    }
+}
+
+void RecordingWriter::activateSegment(Segment&& segment) noexcept
+{
+    m_segment.emplace(std::move(segment));
+    m_position = firstRecordPosition();
+    for (auto& recordedService : m_services)
+    {
+        recordedService.isDefinedInSegment = false;
+    }
+    // the preparation of the next segment can start
+    m_segmentPreparationCondition.notify_all();
+}
+
+cxx::expected<RecordingWriter::Segment, RecordingError>
+RecordingWriter::createSegment(const uint64_t segmentIndex) const noexcept
+{
+    const auto path = segmentPath(m_basePath, segmentIndex);
+    const auto permissions =
+        cxx::perms::owner_read | cxx::perms::owner_write | cxx::perms::group_read | cxx::perms::others_read;
+    const auto flags = posix::convertToOflags(posix::AccessMode::READ_WRITE, posix::OpenMode::PURGE_AND_CREATE);
+    auto openCall = posix::posixCall(iox_open)(path.c_str(), flags, static_cast<mode_t>(permissions))
+                        .failureReturnValue(-1)
+                        .evaluate();
+    if (openCall.has_error())
+    {
+        LogError() << "Unable to create the recording segment '" << path << "'";
+        return cxx::error<RecordingError>(RecordingError::FILE_ACCESS_FAILED);
+    }
+    const int32_t fileDescriptor = openCall.value().value;
+
+    // the disk space is allocated and zero filled, therefore a full disk is detected here and not by a SIGBUS on the
+    // access of the mapping, and the unused remainder of the segment always ends the records
+    auto allocationCall = posix::posixCall(iox_posix_fallocate)(fileDescriptor, 0, static_cast<off_t>(m_segmentSize))
+                              .returnValueMatchesErrno()
+                              .suppressErrorMessagesForErrnos(ENOSPC, EFBIG)
+                              .evaluate();
+    if (allocationCall.has_error())
+    {
+        // a full disk is reported by every write which requires a new segment, the caller decides about logging
+        const auto errnum = allocationCall.get_error().errnum;
+        if (errnum != ENOSPC && errnum != EFBIG)
+        {
+            LogError() << "Unable to allocate " << m_segmentSize << " bytes for the recording segment '" << path
+                       << "'";
+        }
+        closeFile(fileDescriptor, path);
+        removeFile(path);
+        return cxx::error<RecordingError>(RecordingError::DISK_SPACE_ALLOCATION_FAILED);
+    }
+
+    auto memoryMap = posix::MemoryMapBuilder()
+                         .length(m_segmentSize)
+                         .fileDescriptor(fileDescriptor)
+                         .accessMode(posix::AccessMode::READ_WRITE)
+                         .flags(posix::MemoryMapFlags::SHARE_CHANGES)
+                         .create();
+    if (memoryMap.has_error())
+    {
+        LogError() << "Unable to map the recording segment '" << path << "'";
+        closeFile(fileDescriptor, path);
+        removeFile(path);
+        return cxx::error<RecordingError>(RecordingError::MEMORY_MAPPING_FAILED);
+    }
+
+    auto segmentHeader = new (memoryMap.value().getBaseAddress()) RecordingSegmentHeader();
+    segmentHeader->segmentIndex = segmentIndex;
+
+    return cxx::success<Segment>(segmentIndex, fileDescriptor, std::move(memoryMap.value()));
+}
+
+void RecordingWriter::closeSegment(Segment& segment) const noexcept
+{
+    const uint64_t usedSize = static_cast<RecordingSegmentHeader*>(segment.memoryMap.getBaseAddress())->usedSize;
+    const auto path = segmentPath(m_basePath, segment.index);
+    // the unused remainder of the segment is not kept on the disk
+    posix::posixCall(ftruncate)(segment.fileDescriptor, static_cast<off_t>(usedSize))
+        .failureReturnValue(-1)
+        .evaluate()
+        .or_else([&](auto&) { LogWarn() << "Unable to truncate the recording segment '" << path << "'"; });
+    closeFile(segment.fileDescriptor, path);
+    segment.fileDescriptor = INVALID_FILE_DESCRIPTOR;
+}
+
+void RecordingWriter::removeSegment(Segment& segment) const noexcept
+{
+    const auto path = segmentPath(m_basePath, segment.index);
+    closeFile(segment.fileDescriptor, path);
+    segment.fileDescriptor = INVALID_FILE_DESCRIPTOR;
+    removeFile(path);
+}
+
+void RecordingWriter::prepareSegments() noexcept
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_isStopped)
+    {
+        if (m_segmentToClose.has_value())
+        {
+            auto segment = std::move(m_segmentToClose.value());
+            m_segmentToClose.reset();
+            lock.unlock();
+            closeSegment(segment);
+            lock.lock();
+            continue;
+        }
+
+        const uint64_t nextSegmentIndex{m_segmentIndex + 1U};
+        if (m_segment.has_value() && !m_nextSegment.has_value() && m_lastPreparedSegmentIndex != nextSegmentIndex)
+        {
+            m_lastPreparedSegmentIndex = nextSegmentIndex;
+            m_isPreparingSegment = true;
+            lock.unlock();
+            auto segment = createSegment(nextSegmentIndex);
+            lock.lock();
+            m_isPreparingSegment = false;
+            segment.and_then([&](auto& preparedSegment) { m_nextSegment.emplace(std::move(preparedSegment)); });
+            m_segmentPreparationCondition.notify_all();
+            continue;
+        }
+
+        m_segmentPreparationCondition.wait(lock);
+    }
+}
+
+void* RecordingWriter::appendRecord(const uint64_t size,
+                                    const RecordType type,
+                                    const ServiceIndex_t serviceIndex,
+                                    const uint64_t timestamp) noexcept
+{
+    auto recordAddress = static_cast<uint8_t*>(m_segment->memoryMap.getBaseAddress()) + m_position;
+    auto recordHeader = new (recordAddress) RecordHeader();
+    recordHeader->size = static_cast<uint32_t>(size);
+    recordHeader->type = type;
+    recordHeader->serviceIndex = serviceIndex;
+    recordHeader->timestamp = timestamp;
+
+    m_position += size;
+    return recordAddress + sizeof(RecordHeader);
+}
+
+// ============================================ RecordingReader ============================================ //
+
+RecordingReader::RecordingReader(const RecordingPath_t& basePath) noexcept
+    : m_basePath(basePath)
+{
+}
+
+RecordingReader::~RecordingReader() noexcept
+{
+    closeSegment();
+}
+
+cxx::expected<RecordedChunk, RecordingError> RecordingReader::next() noexcept
+{
+    while (!m_isFinished)
+    {
+        if (!m_segment.has_value())
+        {
+            auto openResult = openSegment(m_segmentIndex);
+            if (openResult.has_error())
+            {
+                m_isFinished = (openResult.get_error() == RecordingError::END_OF_RECORDING);
+                return cxx::error<RecordingError>(openResult.get_error());
+            }
+        }
+
+        const auto segmentAddress = static_cast<const uint8_t*>(m_segment->getBaseAddress());
+        const auto recordHeader = reinterpret_cast<const RecordHeader*>(segmentAddress + m_position);
+        if (m_position + sizeof(RecordHeader) > m_endOfRecords || recordHeader->type == RecordType::END_OF_SEGMENT)
+        {
+            closeSegment();
+            ++m_segmentIndex;
+            continue;
+        }
+
+        if (recordHeader->size < sizeof(RecordHeader) || recordHeader->size > m_endOfRecords - m_position
+            || recordHeader->size % RecordHeader::ALIGNMENT != 0U)
+        {
+            LogError() << "The recording segment '" << segmentPath(m_basePath, m_segmentIndex)
+                       << "' contains an invalid record at position " << m_position;
+            return cxx::error<RecordingError>(RecordingError::INVALID_FORMAT);
+        }
+
+        const auto payload = segmentAddress + m_position + sizeof(RecordHeader);
+        const uint64_t payloadSize = recordHeader->size - sizeof(RecordHeader);
+        const auto serviceIndex = recordHeader->serviceIndex;
+
+        switch (recordHeader->type)
+        {
+        case RecordType::SERVICE:
+        {
+            uint64_t length{0U};
+            if (payloadSize >= sizeof(length))
+            {
+                std::memcpy(&length, payload, sizeof(length));
+            }
+            if (payloadSize < sizeof(length) || length > payloadSize - sizeof(length)
+                || (serviceIndex >= m_services.size() && !m_services.resize(serviceIndex + 1U)))
+            {
+                return cxx::error<RecordingError>(RecordingError::INVALID_FORMAT);
+            }
+
+            std::string serializedService(reinterpret_cast<const char*>(payload) + sizeof(length), length);
+            auto service = capro::ServiceDescription::deserialize(cxx::Serialization(serializedService));
+            if (service.has_error())
+            {
+                return cxx::error<RecordingError>(RecordingError::INVALID_FORMAT);
+            }
+            m_services[serviceIndex] = service.value();
+            m_position += recordHeader->size;
+            break;
+        }
+        case RecordType::CHUNK:
+        {
+            const auto chunkHeader = reinterpret_cast<const mepoo::ChunkHeader*>(payload);
+            if (payloadSize < sizeof(mepoo::ChunkHeader) || chunkHeader->usedSizeOfChunk() > payloadSize)
+            {
+                return cxx::error<RecordingError>(RecordingError::INVALID_FORMAT);
+            }
+            if (serviceIndex >= m_services.size() || !m_services[serviceIndex].has_value())
+            {
+                return cxx::error<RecordingError>(RecordingError::UNKNOWN_SERVICE);
+            }
+            m_position += recordHeader->size;
+            return cxx::success<RecordedChunk>(RecordedChunk{serviceIndex, recordHeader->timestamp, chunkHeader});
+        }
+        default:
+            return cxx::error<RecordingError>(RecordingError::INVALID_FORMAT);
+        }
+    }
+
+    return cxx::error<RecordingError>(RecordingError::END_OF_RECORDING);
+}
+
+const capro::ServiceDescription&
+RecordingReader::service(const RecordingWriter::ServiceIndex_t serviceIndex) const noexcept
+{
+    return m_services[serviceIndex].value();
+}
+
+cxx::expected<RecordingError> RecordingReader::openSegment(const uint64_t segmentIndex) noexcept
+{
+    const auto path = segmentPath(m_basePath, segmentIndex);
+    auto openCall =
+        posix::posixCall(iox_open)(path.c_str(),
+                                   posix::convertToOflags(posix::AccessMode::READ_ONLY, posix::OpenMode::OPEN_EXISTING),
+                                   static_cast<mode_t>(0))
+            .failureReturnValue(-1)
+            .suppressErrorMessagesForErrnos(ENOENT)
+            .evaluate();
+    if (openCall.has_error())
+    {
+        // the recording ends with the first missing segment
+        if (openCall.get_error().errnum == ENOENT && segmentIndex != 0U)
+        {
+            return cxx::error<RecordingError>(RecordingError::END_OF_RECORDING);
+        }
+        LogError() << "Unable to open the recording segment '" << path << "'";
+        return cxx::error<RecordingError>(RecordingError::FILE_ACCESS_FAILED);
+    }
+    const int32_t fileDescriptor = openCall.value().value;
+
+    struct stat fileStatus = {};
+    if (posix::posixCall(fstat)(fileDescriptor, &fileStatus).failureReturnValue(-1).evaluate().has_error())
+    {
+        LogError() << "Unable to determine the size of the recording segment '" << path << "'";
+        closeFile(fileDescriptor, path);
+        return cxx::error<RecordingError>(RecordingError::FILE_ACCESS_FAILED);
+    }
+    const uint64_t fileSize = static_cast<uint64_t>(fileStatus.st_size);
+    if (fileSize < firstRecordPosition())
+    {
+        LogError() << "The recording segment '" << path << "' is too small";
+        closeFile(fileDescriptor, path);
+        return cxx::error<RecordingError>(RecordingError::INVALID_FORMAT);
+    }
+
+    auto memoryMap = posix::MemoryMapBuilder()
+                         .length(fileSize)
+                         .fileDescriptor(fileDescriptor)
+                         .accessMode(posix::AccessMode::READ_ONLY)
+                         .flags(posix::MemoryMapFlags::SHARE_CHANGES)
+                         .create();
+    if (memoryMap.has_error())
+    {
+        LogError() << "Unable to map the recording segment '" << path << "'";
+        closeFile(fileDescriptor, path);
+        return cxx::error<RecordingError>(RecordingError::MEMORY_MAPPING_FAILED);
+    }
+
+    m_segment.emplace(std::move(memoryMap.value()));
+    m_fileDescriptor = fileDescriptor;
+
+    const auto segmentHeader = static_cast<const RecordingSegmentHeader*>(m_segment->getBaseAddress());
+    if (segmentHeader->magic != RecordingSegmentHeader::MAGIC
+        || segmentHeader->formatVersion != RecordingSegmentHeader::FORMAT_VERSION)
+    {
+        LogError() << "The file '" << path << "' is not a recording segment of a compatible format";
+        closeSegment();
+        return cxx::error<RecordingError>(RecordingError::INVALID_FORMAT);
+    }
+    if (segmentHeader->chunkHeaderVersion != mepoo::ChunkHeader::CHUNK_HEADER_VERSION)
+    {
+        LogError() << "The recording segment '" << path << "' was recorded with the ChunkHeader version "
+                   << static_cast<uint32_t>(segmentHeader->chunkHeaderVersion) << " but the current version is "
+                   << static_cast<uint32_t>(mepoo::ChunkHeader::CHUNK_HEADER_VERSION);
+        closeSegment();
+        return cxx::error<RecordingError>(RecordingError::INCOMPATIBLE_CHUNK_HEADER_VERSION);
+    }
+
+    m_endOfRecords = (segmentHeader->usedSize != 0U) ? std::min(segmentHeader->usedSize, fileSize) : fileSize;
+    m_position = firstRecordPosition();
+    return cxx::success<>();
+}
+
+void RecordingReader::closeSegment() noexcept
+{
+    if (!m_segment.has_value())
+    {
+        return;
+    }
+
+    m_segment.reset();
+    closeFile(m_fileDescriptor, segmentPath(m_basePath, m_segmentIndex));
+    m_fileDescriptor = INVALID_FILE_DESCRIPTOR;
+}
+
+} // namespace gw
+} // namespace iox
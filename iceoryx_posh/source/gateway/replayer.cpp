@@ -0,0 +1,153 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/gateway/replayer.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+namespace iox
+{
+namespace gw
+{
+namespace
+{
+/// @brief the longest sleep between two checks whether the replay shall be stopped
+constexpr uint64_t MAX_SLEEP_NANOSECONDS{100U * 1000U * 1000U};
+} // namespace
+
+Replayer::Replayer(const popo::PublisherOptions& publisherOptions) noexcept
+    : m_publisherOptions(publisherOptions)
+{
+}
+
+cxx::expected<uint64_t, RecordingError> Replayer::replay(const RecordingPath_t& recordingPath,
+                                                         const ReplayTiming timing) noexcept
+{
+    m_isStopRequested.store(false);
+    m_publishers.clear();
+    m_timing = timing;
+
+    RecordingReader reader(recordingPath);
+    uint64_t numberOfReplayedChunks{0U};
+    bool isFirstChunk{true};
+    while (!m_isStopRequested.load(std::memory_order_relaxed))
+    {
+        auto nextChunk = reader.next();
+        if (nextChunk.has_error())
+        {
+            if (nextChunk.get_error() == RecordingError::END_OF_RECORDING)
+            {
+                break;
+            }
+            return cxx::error<RecordingError>(nextChunk.get_error());
+        }
+        const auto& recordedChunk = nextChunk.value();
+
+        if (isFirstChunk)
+        {
+            isFirstChunk = false;
+            m_firstTimestamp = recordedChunk.timestamp;
+            m_startTime = mepoo::ChunkHeader::publishTimestampNow();
+        }
+        else if (!waitUntil(recordedChunk.timestamp))
+        {
+            break;
+        }
+
+        const auto& chunkHeader = *recordedChunk.chunkHeader;
+        auto& publisher = publisherOf(reader, recordedChunk.serviceIndex);
+        // the user-header alignment is not stored in the ChunkHeader but it has no influence on the chunk layout since
+        // the user-header is always adjacent to the ChunkHeader; the smallest alignment fits every user-header size
+        const uint32_t userHeaderAlignment{1U};
+        publisher
+            .loan(chunkHeader.userPayloadSize(),
+                  chunkHeader.userPayloadAlignment(),
+                  chunkHeader.userHeaderSize(),
+                  userHeaderAlignment)
+            .and_then([&](void* userPayload) {
+                if (chunkHeader.userHeaderSize() != CHUNK_NO_USER_HEADER_SIZE)
+                {
+                    std::memcpy(mepoo::ChunkHeader::fromUserPayload(userPayload)->userHeader(),
+                                chunkHeader.userHeader(),
+                                chunkHeader.userHeaderSize());
+                }
+                std::memcpy(userPayload, chunkHeader.userPayload(), chunkHeader.userPayloadSize());
+                publisher.publish(userPayload);
+                ++numberOfReplayedChunks;
+            })
+            .or_else([&](auto) {
+                LogWarn() << "Unable to replay a chunk of " << reader.service(recordedChunk.serviceIndex)
+                          << " since no chunk could be loaned";
+            });
+    }
+
+    return cxx::success<uint64_t>(numberOfReplayedChunks);
+}
+
+void Replayer::stop() noexcept
+{
+    m_isStopRequested.store(true);
+}
+
+popo::UntypedPublisher& Replayer::publisherOf(const RecordingReader& reader,
+                                              const RecordingWriter::ServiceIndex_t serviceIndex) noexcept
+{
+    // the reader ensures that the service index is below MAX_RECORDED_SERVICES
+    if (serviceIndex >= m_publishers.size())
+    {
+        m_publishers.resize(serviceIndex + 1U);
+    }
+
+    auto& publisher = m_publishers[serviceIndex];
+    if (!publisher.has_value())
+    {
+        const auto& service = reader.service(serviceIndex);
+        // the recorded service carries the interface of the recorder, the replayed one is an internal service
+        publisher.emplace(capro::ServiceDescription{service.getServiceIDString(),
+                                                    service.getInstanceIDString(),
+                                                    service.getEventIDString()},
+                          m_publisherOptions);
+    }
+    return publisher.value();
+}
+
+bool Replayer::waitUntil(const uint64_t timestamp) noexcept
+{
+    if (m_timing == ReplayTiming::AS_FAST_AS_POSSIBLE || timestamp <= m_firstTimestamp)
+    {
+        return true;
+    }
+
+    const uint64_t releaseTime = m_startTime + (timestamp - m_firstTimestamp);
+    while (!m_isStopRequested.load(std::memory_order_relaxed))
+    {
+        const uint64_t now = mepoo::ChunkHeader::publishTimestampNow();
+        if (now >= releaseTime)
+        {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::nanoseconds(std::min(releaseTime - now, MAX_SLEEP_NANOSECONDS)));
+    }
+    return false;
+}
+
+} // namespace gw
+} // namespace iox
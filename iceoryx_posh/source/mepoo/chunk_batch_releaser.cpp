@@ -0,0 +1,79 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/chunk_batch_releaser.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_management.hpp"
+
+#include <algorithm>
+#include <functional>
+
+namespace iox
+{
+namespace mepoo
+{
+constexpr uint32_t ChunkBatchReleaser::CAPACITY;
+
+ChunkBatchReleaser::~ChunkBatchReleaser() noexcept
+{
+    flush();
+}
+
+void ChunkBatchReleaser::release(SharedChunk&& chunk) noexcept
+{
+    ChunkManagement* chunkManagement = chunk.release();
+    if ((chunkManagement == nullptr)
+        || (chunkManagement->m_referenceCounter.fetch_sub(1U, std::memory_order_relaxed) != 1U))
+    {
+        return;
+    }
+
+    if (m_entries.size() + 2U > m_entries.capacity())
+    {
+        flush();
+    }
+
+    m_entries.push_back({chunkManagement->m_mempool.get(), chunkManagement->m_chunkHeader.get()});
+    m_entries.push_back({chunkManagement->m_chunkManagementPool.get(), chunkManagement});
+}
+
+void ChunkBatchReleaser::flush() noexcept
+{
+    std::sort(m_entries.begin(), m_entries.end(), [](const Entry& lhs, const Entry& rhs) {
+        return std::less<const MemPool*>()(lhs.m_memPool, rhs.m_memPool);
+    });
+
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) fixed size buffer for MemPool::freeChunks
+    const void* chunks[2U * CAPACITY];
+    uint64_t begin{0U};
+    while (begin < m_entries.size())
+    {
+        MemPool* memPool = m_entries[begin].m_memPool;
+        uint32_t numberOfChunks{0U};
+        for (auto i = begin; i < m_entries.size() && m_entries[i].m_memPool == memPool; ++i)
+        {
+            chunks[numberOfChunks] = m_entries[i].m_chunk;
+            ++numberOfChunks;
+        }
+
+        memPool->freeChunks(&chunks[0], numberOfChunks);
+        begin += numberOfChunks;
+    }
+
+    m_entries.clear();
+}
+
+} // namespace mepoo
+} // namespace iox
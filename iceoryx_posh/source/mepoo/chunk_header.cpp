@@ -19,6 +19,8 @@
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 
+#include <chrono>
+
 namespace iox
 {
 namespace mepoo
@@ -222,6 +224,23 @@ void ChunkHeader::setSequenceNumber(const uint64_t sequenceNumber) noexcept
     m_sequenceNumber = sequenceNumber;
 }
 
+uint64_t ChunkHeader::publishTimestamp() const noexcept
+{
+    return m_publishTimestamp;
+}
+
+void ChunkHeader::setPublishTimestamp(const uint64_t publishTimestamp) noexcept
+{
+    m_publishTimestamp = publishTimestamp;
+}
+
+uint64_t ChunkHeader::publishTimestampNow() noexcept
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
 uint64_t ChunkHeader::overflowSafeUsedSizeOfChunk() const noexcept
 {
     return static_cast<uint64_t>(m_userPayloadOffset) + static_cast<uint64_t>(m_userPayloadSize);
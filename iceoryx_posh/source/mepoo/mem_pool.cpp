@@ -39,6 +39,7 @@ MemPoolInfo::MemPoolInfo(const uint32_t usedChunks,
 }
 
 constexpr uint64_t MemPool::CHUNK_MEMORY_ALIGNMENT;
+constexpr uint32_t MemPool::INDEX_BATCH_SIZE;
 
 MemPool::MemPool(const cxx::greater_or_equal<uint32_t, CHUNK_MEMORY_ALIGNMENT> chunkSize,
                  const cxx::greater_or_equal<uint32_t, 1> numberOfChunks,
@@ -71,29 +72,98 @@ bool MemPool::isMultipleOfAlignment(const uint32_t value) const noexcept
 void MemPool::adjustMinFree() noexcept
 {
     // @todo rethink the concurrent change that can happen. do we need a CAS loop?
-    m_minFree.store(std::min(m_numberOfChunks - m_usedChunks.load(std::memory_order_relaxed),
-                             m_minFree.load(std::memory_order_relaxed)));
+    m_minFree.store(std::min(m_numberOfChunks - getUsedChunks(), m_minFree.load(std::memory_order_relaxed)));
 }
 
 void* MemPool::getChunk() noexcept
 {
     uint32_t l_index{0U};
-    if (!m_freeIndices.pop(l_index))
+    const bool hasChunk = ThreadLocalChunkCache::isEnabled() ? ThreadLocalChunkCache::getChunkIndex(*this, l_index)
+                                                             : popChunkIndex(l_index);
+    if (!hasChunk)
     {
         std::cerr << "Mempool [m_chunkSize = " << m_chunkSize << ", numberOfChunks = " << m_numberOfChunks
-                  << ", used_chunks = " << m_usedChunks << " ] has no more space left" << std::endl;
+                  << ", used_chunks = " << getUsedChunks() << " ] has no more space left" << std::endl;
         return nullptr;
     }
 
-    /// @todo: verify that m_usedChunk is not changed during adjustMInFree
-    ///         without changing m_minFree
-    m_usedChunks.fetch_add(1U, std::memory_order_relaxed);
-    adjustMinFree();
-
     return m_rawMemory.get() + l_index * m_chunkSize;
 }
 
 void MemPool::freeChunk(const void* chunk) noexcept
+{
+    uint32_t index = indexOfChunk(chunk);
+
+    const bool isValidIndex = ThreadLocalChunkCache::isEnabled() ? ThreadLocalChunkCache::freeChunkIndex(*this, index)
+                                                                 : pushChunkIndex(index);
+    if (!isValidIndex)
+    {
+        errorHandler(PoshError::POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+    }
+}
+
+uint32_t MemPool::getChunks(void** chunks, const uint32_t numberOfChunks) noexcept
+{
+    cxx::Expects(chunks != nullptr || numberOfChunks == 0U);
+
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) fixed size buffer for LoFFLi::popN
+    uint32_t indices[INDEX_BATCH_SIZE];
+    uint32_t numberOfAcquiredChunks{0U};
+    while (numberOfAcquiredChunks < numberOfChunks)
+    {
+        const uint32_t numberOfRequestedIndices = std::min(numberOfChunks - numberOfAcquiredChunks, INDEX_BATCH_SIZE);
+        const uint32_t numberOfPoppedIndices = m_freeIndices.popN(&indices[0], numberOfRequestedIndices);
+        for (uint32_t i = 0U; i < numberOfPoppedIndices; ++i)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) limited by numberOfChunks
+            chunks[numberOfAcquiredChunks + i] = m_rawMemory.get() + indices[i] * m_chunkSize;
+        }
+        numberOfAcquiredChunks += numberOfPoppedIndices;
+
+        if (numberOfPoppedIndices < numberOfRequestedIndices)
+        {
+            break;
+        }
+    }
+
+    if (numberOfAcquiredChunks > 0U)
+    {
+        m_usedChunks.fetch_add(static_cast<int64_t>(numberOfAcquiredChunks), std::memory_order_relaxed);
+        adjustMinFree();
+    }
+
+    return numberOfAcquiredChunks;
+}
+
+void MemPool::freeChunks(const void* const* chunks, const uint32_t numberOfChunks) noexcept
+{
+    cxx::Expects(chunks != nullptr || numberOfChunks == 0U);
+
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) fixed size buffer for LoFFLi::pushN
+    uint32_t indices[INDEX_BATCH_SIZE];
+    bool areAllIndicesValid{true};
+    uint32_t numberOfReleasedChunks{0U};
+    while (numberOfReleasedChunks < numberOfChunks)
+    {
+        const uint32_t numberOfIndices = std::min(numberOfChunks - numberOfReleasedChunks, INDEX_BATCH_SIZE);
+        for (uint32_t i = 0U; i < numberOfIndices; ++i)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) limited by numberOfChunks
+            indices[i] = indexOfChunk(chunks[numberOfReleasedChunks + i]);
+        }
+        areAllIndicesValid = m_freeIndices.pushN(&indices[0], numberOfIndices) && areAllIndicesValid;
+        numberOfReleasedChunks += numberOfIndices;
+    }
+
+    m_usedChunks.fetch_sub(static_cast<int64_t>(numberOfReleasedChunks), std::memory_order_relaxed);
+
+    if (!areAllIndicesValid)
+    {
+        errorHandler(PoshError::POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+    }
+}
+
+uint32_t MemPool::indexOfChunk(const void* chunk) const noexcept
 {
     cxx::Expects(m_rawMemory.get() <= chunk
                  && chunk <= m_rawMemory.get() + (static_cast<uint64_t>(m_chunkSize) * (m_numberOfChunks - 1U)));
@@ -101,14 +171,37 @@ void MemPool::freeChunk(const void* chunk) noexcept
     auto offset = static_cast<const uint8_t*>(chunk) - m_rawMemory.get();
     cxx::Expects(offset % m_chunkSize == 0);
 
-    uint32_t index = static_cast<uint32_t>(offset / m_chunkSize);
+    return static_cast<uint32_t>(offset / m_chunkSize);
+}
 
-    if (!m_freeIndices.push(index))
+bool MemPool::popChunkIndex(uint32_t& index) noexcept
+{
+    if (!m_freeIndices.pop(index))
     {
-        errorHandler(PoshError::POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+        return false;
     }
 
-    m_usedChunks.fetch_sub(1U, std::memory_order_relaxed);
+    /// @todo: verify that m_usedChunk is not changed during adjustMInFree
+    ///         without changing m_minFree
+    m_usedChunks.fetch_add(1, std::memory_order_relaxed);
+    adjustMinFree();
+    return true;
+}
+
+bool MemPool::pushChunkIndex(const uint32_t index) noexcept
+{
+    const bool isValidIndex = m_freeIndices.push(index);
+    m_usedChunks.fetch_sub(1, std::memory_order_relaxed);
+    return isValidIndex;
+}
+
+void MemPool::applyPendingUsedChunks(const int64_t pendingUsedChunks) noexcept
+{
+    m_usedChunks.fetch_add(pendingUsedChunks, std::memory_order_relaxed);
+    if (pendingUsedChunks > 0)
+    {
+        adjustMinFree();
+    }
 }
 
 uint32_t MemPool::getChunkSize() const noexcept
@@ -123,7 +216,11 @@ uint32_t MemPool::getChunkCount() const noexcept
 
 uint32_t MemPool::getUsedChunks() const noexcept
 {
-    return m_usedChunks.load(std::memory_order_relaxed);
+    // the balance is negative or exceeds the number of chunks while the loans of a thread local chunk cache are
+    // not yet accounted for
+    const auto usedChunks = m_usedChunks.load(std::memory_order_relaxed);
+    return static_cast<uint32_t>(std::min(std::max(usedChunks, static_cast<int64_t>(0)),
+                                          static_cast<int64_t>(m_numberOfChunks)));
 }
 
 uint32_t MemPool::getMinFree() const noexcept
@@ -133,7 +230,7 @@ uint32_t MemPool::getMinFree() const noexcept
 
 MemPoolInfo MemPool::getInfo() const noexcept
 {
-    return {m_usedChunks.load(std::memory_order_relaxed),
+    return {getUsedChunks(),
             m_minFree.load(std::memory_order_relaxed),
             m_numberOfChunks,
             m_chunkSize};
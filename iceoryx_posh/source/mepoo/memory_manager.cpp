@@ -144,37 +144,74 @@ void MemoryManager::configureMemoryManager(const MePooConfig& mePooConfig,
         addMemPool(managementAllocator, chunkMemoryAllocator, entry.m_size, entry.m_chunkCount);
     }
 
+    m_spillPolicy = mePooConfig.m_spillPolicy;
+    generateSizeClassIndex();
     generateChunkManagementPool(managementAllocator);
 }
 
-cxx::expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
+uint32_t MemoryManager::sizeClassOf(const uint32_t chunkSize) noexcept
 {
-    void* chunk{nullptr};
-    MemPool* memPoolPointer{nullptr};
-    const auto requiredChunkSize = chunkSettings.requiredChunkSize();
+    if (chunkSize == 0U)
+    {
+        return 0U;
+    }
 
-    uint32_t aquiredChunkSize = 0U;
+    // floor(log2(chunkSize)) via a fixed number of steps to keep the lookup independent of the chunk size
+    uint32_t value{chunkSize};
+    uint32_t log2{0U};
+    for (uint32_t shift : {16U, 8U, 4U, 2U, 1U})
+    {
+        if (value >= (1U << shift))
+        {
+            value >>= shift;
+            log2 += shift;
+        }
+    }
+    return log2 + 1U;
+}
 
-    for (auto& memPool : m_memPoolVector)
+void MemoryManager::generateSizeClassIndex() noexcept
+{
+    const auto numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    uint32_t memPoolIndex{0U};
+    for (uint32_t sizeClass = 0U; sizeClass < NUMBER_OF_SIZE_CLASSES; ++sizeClass)
     {
-        uint32_t chunkSizeOfMemPool = memPool.getChunkSize();
-        if (chunkSizeOfMemPool >= requiredChunkSize)
+        const uint64_t lowerBoundOfSizeClass = (sizeClass == 0U) ? 0U : (1ULL << (sizeClass - 1U));
+        while (memPoolIndex < numberOfMemPools && m_memPoolVector[memPoolIndex].getChunkSize() < lowerBoundOfSizeClass)
         {
-            chunk = memPool.getChunk();
-            memPoolPointer = &memPool;
-            aquiredChunkSize = chunkSizeOfMemPool;
-            break;
+            ++memPoolIndex;
         }
+        m_sizeClassIndex[sizeClass] = memPoolIndex;
+    }
+}
+
+uint32_t MemoryManager::bestFittingMemPoolIndex(const uint32_t requiredChunkSize) const noexcept
+{
+    const auto numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    uint32_t memPoolIndex = m_sizeClassIndex[sizeClassOf(requiredChunkSize)];
+    // only the mempools within the size class of the required chunk size can be too small
+    while (memPoolIndex < numberOfMemPools && m_memPoolVector[memPoolIndex].getChunkSize() < requiredChunkSize)
+    {
+        ++memPoolIndex;
     }
+    return memPoolIndex;
+}
+
+cxx::expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
+{
+    const auto requiredChunkSize = chunkSettings.requiredChunkSize();
+    const auto numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
 
-    if (m_memPoolVector.size() == 0)
+    if (numberOfMemPools == 0U)
     {
         LogFatal() << "There are no mempools available!";
 
         errorHandler(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_CHUNK_WITHOUT_MEMPOOL, ErrorLevel::SEVERE);
         return cxx::error<Error>(Error::NO_MEMPOOLS_AVAILABLE);
     }
-    else if (memPoolPointer == nullptr)
+
+    uint32_t memPoolIndex = bestFittingMemPoolIndex(requiredChunkSize);
+    if (memPoolIndex >= numberOfMemPools)
     {
         LogFatal() << "The following mempools are available:" << [this](auto& log) -> iox::log::LogStream& {
             this->printMemPoolVector(log);
@@ -185,7 +222,17 @@ cxx::expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const C
         errorHandler(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_CHUNK_IS_TOO_LARGE, ErrorLevel::SEVERE);
         return cxx::error<Error>(Error::NO_MEMPOOL_FOR_REQUESTED_CHUNK_SIZE);
     }
-    else if (chunk == nullptr)
+
+    void* chunk = m_memPoolVector[memPoolIndex].getChunk();
+    if (chunk == nullptr && m_spillPolicy == MemPoolSpillPolicy::SPILL_TO_LARGER_MEMPOOLS)
+    {
+        while (chunk == nullptr && ++memPoolIndex < numberOfMemPools)
+        {
+            chunk = m_memPoolVector[memPoolIndex].getChunk();
+        }
+    }
+
+    if (chunk == nullptr)
     {
         LogError() << "MemoryManager: unable to acquire a chunk with a chunk-payload size of "
                    << chunkSettings.userPayloadSize()
@@ -197,13 +244,29 @@ cxx::expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const C
         errorHandler(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS, ErrorLevel::MODERATE);
         return cxx::error<Error>(Error::MEMPOOL_OUT_OF_CHUNKS);
     }
-    else
+
+    auto& memPool = m_memPoolVector[memPoolIndex];
+    auto chunkHeader = new (chunk) ChunkHeader(memPool.getChunkSize(), chunkSettings);
+    auto chunkManagement = new (m_chunkManagementPool.front().getChunk())
+        ChunkManagement(chunkHeader, &memPool, &m_chunkManagementPool.front());
+    return cxx::success<SharedChunk>(SharedChunk(chunkManagement));
+}
+
+cxx::optional<uint32_t> MemoryManager::getMemPoolIndex(const SharedChunk& chunk) const noexcept
+{
+    if (!chunk)
+    {
+        return cxx::nullopt;
+    }
+
+    // the mempools have strictly increasing chunk sizes, therefore the chunk size identifies the mempool
+    const auto chunkSize = chunk.getChunkHeader()->chunkSize();
+    const auto memPoolIndex = bestFittingMemPoolIndex(chunkSize);
+    if (memPoolIndex < m_memPoolVector.size() && m_memPoolVector[memPoolIndex].getChunkSize() == chunkSize)
     {
-        auto chunkHeader = new (chunk) ChunkHeader(aquiredChunkSize, chunkSettings);
-        auto chunkManagement = new (m_chunkManagementPool.front().getChunk())
-            ChunkManagement(chunkHeader, memPoolPointer, &m_chunkManagementPool.front());
-        return cxx::success<SharedChunk>(SharedChunk(chunkManagement));
+        return memPoolIndex;
     }
+    return cxx::nullopt;
 }
 
 std::ostream& operator<<(std::ostream& stream, const MemoryManager::Error value) noexcept
@@ -0,0 +1,193 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/mepoo/thread_local_chunk_cache.hpp"
+#include "iceoryx_hoofs/internal/concurrent/loffli_magazine.hpp"
+#include "iceoryx_posh/error_handling/error_handling.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+
+namespace iox
+{
+namespace mepoo
+{
+constexpr uint32_t ThreadLocalChunkCache::CHUNK_CAPACITY_PER_MEMPOOL;
+constexpr uint32_t ThreadLocalChunkCache::MAX_NUMBER_OF_CACHED_MEMPOOLS;
+
+struct ThreadLocalChunkCache::Cache
+{
+    struct Entry
+    {
+        MemPool* m_memPool{nullptr};
+        concurrent::LoFFLiMagazine<CHUNK_CAPACITY_PER_MEMPOOL> m_magazine;
+        /// @brief chunks which were acquired (positive) or released (negative) via the magazine but are not yet
+        /// accounted for in the usage statistics of the mempool
+        int64_t m_pendingUsedChunks{0};
+    };
+
+    Cache() noexcept = default;
+    Cache(const Cache&) = delete;
+    Cache(Cache&&) = delete;
+    Cache& operator=(const Cache&) = delete;
+    Cache& operator=(Cache&&) = delete;
+
+    ~Cache() noexcept
+    {
+        ThreadLocalChunkCache::flush(*this);
+    }
+
+    Entry* getEntry(MemPool& memPool) noexcept
+    {
+        if (m_lastUsedEntry < m_numberOfEntries && m_entries[m_lastUsedEntry].m_memPool == &memPool)
+        {
+            return &m_entries[m_lastUsedEntry];
+        }
+
+        for (uint32_t i = 0U; i < m_numberOfEntries; ++i)
+        {
+            if (m_entries[i].m_memPool == &memPool)
+            {
+                m_lastUsedEntry = i;
+                return &m_entries[i];
+            }
+        }
+
+        if (m_numberOfEntries == MAX_NUMBER_OF_CACHED_MEMPOOLS)
+        {
+            return nullptr;
+        }
+
+        auto& entry = m_entries[m_numberOfEntries];
+        entry.m_memPool = &memPool;
+        entry.m_magazine.init(memPool.m_freeIndices);
+        entry.m_pendingUsedChunks = 0;
+        m_lastUsedEntry = m_numberOfEntries;
+        ++m_numberOfEntries;
+        return &entry;
+    }
+
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) fixed size storage without heap
+    Entry m_entries[MAX_NUMBER_OF_CACHED_MEMPOOLS];
+    uint32_t m_numberOfEntries{0U};
+    uint32_t m_lastUsedEntry{0U};
+};
+
+namespace
+{
+/// @brief trivially constructible to avoid the construction of the cache for threads which do not use it
+thread_local bool t_isCacheEnabled{false};
+} // namespace
+
+ThreadLocalChunkCache::Cache& ThreadLocalChunkCache::threadLocalCache() noexcept
+{
+    thread_local Cache cache;
+    return cache;
+}
+
+void ThreadLocalChunkCache::enable() noexcept
+{
+    t_isCacheEnabled = true;
+}
+
+void ThreadLocalChunkCache::disable() noexcept
+{
+    if (t_isCacheEnabled)
+    {
+        flush();
+        t_isCacheEnabled = false;
+    }
+}
+
+bool ThreadLocalChunkCache::isEnabled() noexcept
+{
+    return t_isCacheEnabled;
+}
+
+void ThreadLocalChunkCache::flush() noexcept
+{
+    if (t_isCacheEnabled)
+    {
+        flush(threadLocalCache());
+    }
+}
+
+void ThreadLocalChunkCache::flush(Cache& cache) noexcept
+{
+    bool hasReturnedAllChunks{true};
+    for (uint32_t i = 0U; i < cache.m_numberOfEntries; ++i)
+    {
+        auto& entry = cache.m_entries[i];
+        if (!entry.m_magazine.flush())
+        {
+            hasReturnedAllChunks = false;
+        }
+        entry.m_memPool->applyPendingUsedChunks(entry.m_pendingUsedChunks);
+        entry.m_pendingUsedChunks = 0;
+        entry.m_memPool = nullptr;
+    }
+    cache.m_numberOfEntries = 0U;
+    cache.m_lastUsedEntry = 0U;
+
+    if (!hasReturnedAllChunks)
+    {
+        errorHandler(PoshError::POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+    }
+}
+
+bool ThreadLocalChunkCache::getChunkIndex(MemPool& memPool, uint32_t& index) noexcept
+{
+    auto entry = threadLocalCache().getEntry(memPool);
+    if (entry == nullptr)
+    {
+        return memPool.popChunkIndex(index);
+    }
+
+    if (entry->m_magazine.size() == 0U)
+    {
+        // the magazine is refilled from the shared free-list, the statistics are updated along with it
+        memPool.applyPendingUsedChunks(entry->m_pendingUsedChunks);
+        entry->m_pendingUsedChunks = 0;
+    }
+
+    if (!entry->m_magazine.pop(index))
+    {
+        return false;
+    }
+
+    ++entry->m_pendingUsedChunks;
+    return true;
+}
+
+bool ThreadLocalChunkCache::freeChunkIndex(MemPool& memPool, const uint32_t index) noexcept
+{
+    auto entry = threadLocalCache().getEntry(memPool);
+    if (entry == nullptr)
+    {
+        return memPool.pushChunkIndex(index);
+    }
+
+    if (entry->m_magazine.size() == CHUNK_CAPACITY_PER_MEMPOOL)
+    {
+        // the magazine is flushed partially to the shared free-list, the statistics are updated along with it
+        memPool.applyPendingUsedChunks(entry->m_pendingUsedChunks);
+        entry->m_pendingUsedChunks = 0;
+    }
+
+    --entry->m_pendingUsedChunks;
+    return entry->m_magazine.push(index);
+}
+
+} // namespace mepoo
+} // namespace iox
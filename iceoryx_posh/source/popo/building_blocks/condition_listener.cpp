@@ -16,14 +16,37 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_hoofs/cxx/deadline_timer.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
 namespace iox
 {
 namespace popo
 {
-ConditionListener::ConditionListener(ConditionVariableData& condVarData) noexcept
+namespace
+{
+/// @brief hints the CPU that the thread is in a spin loop, this reduces the power consumption and frees resources for
+/// a hyperthreading sibling
+inline void spinPause() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield");
+#endif
+}
+
+/// @brief the clock is only read every n-th poll since reading it costs more than a poll
+constexpr uint64_t SPIN_DEADLINE_CHECK_INTERVAL{64U};
+} // namespace
+
+ConditionListener::ConditionListener(ConditionVariableData& condVarData, const WaitStrategy& waitStrategy) noexcept
     : m_condVarDataPtr(&condVarData)
+    , m_waitStrategy(waitStrategy)
 {
 }
 
@@ -58,7 +81,8 @@ bool ConditionListener::wasNotified() const noexcept
 
 ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 {
-    return waitImpl([this]() -> bool {
+    auto hasDeadlineExpired = [] { return false; };
+    return waitImpl(hasDeadlineExpired, [this]() -> bool {
         if (this->getMembers()->m_semaphore->wait().has_error())
         {
             errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT, ErrorLevel::FATAL);
@@ -70,8 +94,10 @@ ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 
 ConditionListener::NotificationVector_t ConditionListener::timedWait(const units::Duration& timeToWait) noexcept
 {
-    return waitImpl([this, timeToWait]() -> bool {
-        if (this->getMembers()->m_semaphore->timedWait(timeToWait).has_error())
+    cxx::DeadlineTimer deadline{timeToWait};
+    auto hasDeadlineExpired = [&deadline] { return deadline.hasExpired(); };
+    return waitImpl(hasDeadlineExpired, [this, &deadline]() -> bool {
+        if (this->getMembers()->m_semaphore->timedWait(deadline.remainingTime()).has_error())
         {
             errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT, ErrorLevel::FATAL);
         }
@@ -79,38 +105,120 @@ ConditionListener::NotificationVector_t ConditionListener::timedWait(const units
     });
 }
 
-ConditionListener::NotificationVector_t ConditionListener::waitImpl(const cxx::function_ref<bool()>& waitCall) noexcept
+ConditionListener::NotificationVector_t ConditionListener::waitImpl(const cxx::function_ref<bool()>& hasDeadlineExpired,
+                                                                    const cxx::function_ref<bool()>& waitCall) noexcept
 {
-    using Type_t = iox::cxx::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
     NotificationVector_t activeNotifications;
 
     resetSemaphore();
     bool doReturnAfterNotificationCollection = false;
     while (!m_toBeDestroyed.load(std::memory_order_relaxed))
     {
-        for (Type_t i = 0U; i < MAX_NUMBER_OF_NOTIFIERS; i++)
-        {
-            if (getMembers()->m_activeNotifications[i].load(std::memory_order_relaxed))
-            {
-                resetUnchecked(i);
-                activeNotifications.emplace_back(i);
-            }
-        }
+        collectActiveNotifications(activeNotifications);
         if (!activeNotifications.empty() || doReturnAfterNotificationCollection)
         {
             return activeNotifications;
         }
 
-        doReturnAfterNotificationCollection = !waitCall();
+        if (spinUntilNotified(hasDeadlineExpired))
+        {
+            continue;
+        }
+
+        // announce the sleep and collect again to not miss a notification which did not post the semaphore since
+        // the listener was not yet sleeping; pairs with the fence in ConditionNotifier::notify
+        getMembers()->m_numberOfSleepingListeners.fetch_add(1U, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        collectActiveNotifications(activeNotifications);
+        if (activeNotifications.empty())
+        {
+            doReturnAfterNotificationCollection = !waitCall();
+        }
+        getMembers()->m_numberOfSleepingListeners.fetch_sub(1U, std::memory_order_relaxed);
     }
 
     return activeNotifications;
 }
 
-void ConditionListener::resetUnchecked(const uint64_t index) noexcept
+bool ConditionListener::spinUntilNotified(const cxx::function_ref<bool()>& hasDeadlineExpired) noexcept
 {
-    getMembers()->m_activeNotifications[index].store(false, std::memory_order_relaxed);
-    getMembers()->m_wasNotified.store(false, std::memory_order_relaxed);
+    if (m_waitStrategy.mode == WaitMode::ALWAYS_BLOCK)
+    {
+        return false;
+    }
+
+    const bool isBusyPolling = m_waitStrategy.mode == WaitMode::BUSY_POLL;
+    for (uint64_t i = 0U; isBusyPolling || i < m_waitStrategy.spinIterations; ++i)
+    {
+        // the flag is reset since it could still be set by a notification which was already collected; if the
+        // notification is not yet visible the blocking path collects it after announcing the sleep
+        if (getMembers()->m_wasNotified.load(std::memory_order_relaxed)
+            && getMembers()->m_wasNotified.exchange(false, std::memory_order_relaxed))
+        {
+            return true;
+        }
+        if (m_toBeDestroyed.load(std::memory_order_relaxed))
+        {
+            return true;
+        }
+        if (i % SPIN_DEADLINE_CHECK_INTERVAL == 0U && hasDeadlineExpired())
+        {
+            return false;
+        }
+        spinPause();
+    }
+
+    return false;
+}
+
+void ConditionListener::collectActiveNotifications(NotificationVector_t& activeNotifications) noexcept
+{
+    using Type_t = iox::cxx::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
+
+    // the flag is reset before the words are collected; a notification which is set after the collection of its
+    // word sets the flag again afterwards and is therefore not lost for a spinning listener; pairs with the
+    // sequentially consistent operations in ConditionNotifier::notify
+    if (getMembers()->m_wasNotified.load(std::memory_order_relaxed))
+    {
+        getMembers()->m_wasNotified.store(false, std::memory_order_seq_cst);
+    }
+
+    for (uint64_t wordIndex = 0U; wordIndex < ConditionVariableData::NUMBER_OF_NOTIFICATION_WORDS; ++wordIndex)
+    {
+        auto& word = getMembers()->m_activeNotifications[wordIndex];
+        // the load avoids the cache line invalidation of the exchange for words without notifications
+        if (word.load(std::memory_order_seq_cst) == 0U)
+        {
+            continue;
+        }
+
+        uint64_t notifications = word.exchange(0U, std::memory_order_seq_cst);
+        while (notifications != 0U)
+        {
+            const uint64_t bitIndex = countTrailingZeros(notifications);
+            activeNotifications.emplace_back(
+                static_cast<Type_t>(wordIndex * ConditionVariableData::NOTIFICATION_WORD_WIDTH + bitIndex));
+            // clear the lowest set bit
+            notifications &= notifications - 1U;
+        }
+    }
+}
+
+uint64_t ConditionListener::countTrailingZeros(const uint64_t value) noexcept
+{
+    // portable bit scan with a de Bruijn sequence, the isolated lowest set bit multiplied by the sequence yields a
+    // unique pattern in the upper six bits which is mapped to the bit position by the table
+    constexpr uint64_t DE_BRUIJN_SEQUENCE{0x03f79d71b4cb0a89U};
+    constexpr uint64_t DE_BRUIJN_SHIFT{58U};
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) constexpr lookup table
+    constexpr uint8_t BIT_POSITION[64U]{0U,  1U,  48U, 2U,  57U, 49U, 28U, 3U,  61U, 58U, 50U, 42U, 38U,
+                                        29U, 17U, 4U,  62U, 55U, 59U, 36U, 53U, 51U, 43U, 22U, 45U, 39U,
+                                        33U, 30U, 24U, 18U, 12U, 5U,  63U, 47U, 56U, 27U, 60U, 41U, 37U,
+                                        16U, 54U, 35U, 52U, 21U, 44U, 32U, 23U, 11U, 46U, 26U, 40U, 15U,
+                                        34U, 20U, 31U, 10U, 25U, 14U, 19U, 9U,  13U, 8U,  7U,  6U};
+
+    const uint64_t lowestSetBit = value & (~value + 1U);
+    return BIT_POSITION[(lowestSetBit * DE_BRUIJN_SEQUENCE) >> DE_BRUIJN_SHIFT];
 }
 
 const ConditionVariableData* ConditionListener::getMembers() const noexcept
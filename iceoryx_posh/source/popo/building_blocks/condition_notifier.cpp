@@ -36,10 +36,22 @@ ConditionNotifier::ConditionNotifier(ConditionVariableData& condVarDataRef, cons
 
 void ConditionNotifier::notify() noexcept
 {
-    getMembers()->m_activeNotifications[m_notificationIndex].store(true, std::memory_order_release);
-    getMembers()->m_wasNotified.store(true, std::memory_order_relaxed);
-    getMembers()->m_semaphore->post().or_else(
-        [](auto) { errorHandler(PoshError::POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY, ErrorLevel::FATAL); });
+    getMembers()
+        ->m_activeNotifications[ConditionVariableData::notificationWordIndex(m_notificationIndex)]
+        .fetch_or(ConditionVariableData::notificationBitMask(m_notificationIndex), std::memory_order_seq_cst);
+    // the flag is set after the notification; pairs with ConditionListener::collectActiveNotifications which resets
+    // the flag before it collects the notifications
+    getMembers()->m_wasNotified.store(true, std::memory_order_seq_cst);
+
+    // pairs with the fence in ConditionListener::waitImpl; either the listener sees the notification before it goes
+    // to sleep or the notifier sees the sleeping listener and wakes it up
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (getMembers()->m_numberOfSleepingListeners.load(std::memory_order_relaxed) > 0U)
+    {
+        getMembers()->m_semaphore->post().or_else([](auto) {
+            errorHandler(PoshError::POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY, ErrorLevel::FATAL);
+        });
+    }
 }
 
 const ConditionVariableData* ConditionNotifier::getMembers() const noexcept
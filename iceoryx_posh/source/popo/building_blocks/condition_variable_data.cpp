@@ -21,6 +21,9 @@ namespace iox
 {
 namespace popo
 {
+constexpr uint64_t ConditionVariableData::NOTIFICATION_WORD_WIDTH;
+constexpr uint64_t ConditionVariableData::NUMBER_OF_NOTIFICATION_WORDS;
+
 ConditionVariableData::ConditionVariableData() noexcept
     : ConditionVariableData("")
 {
@@ -33,10 +36,27 @@ ConditionVariableData::ConditionVariableData(const RuntimeName_t& runtimeName) n
         errorHandler(PoshError::POPO__CONDITION_VARIABLE_DATA_FAILED_TO_CREATE_SEMAPHORE, ErrorLevel::FATAL);
     });
 
-    for (auto& id : m_activeNotifications)
+    for (auto& word : m_activeNotifications)
     {
-        id.store(false, std::memory_order_relaxed);
+        word.store(0U, std::memory_order_relaxed);
     }
 }
+
+uint64_t ConditionVariableData::notificationWordIndex(const uint64_t index) noexcept
+{
+    return index / NOTIFICATION_WORD_WIDTH;
+}
+
+uint64_t ConditionVariableData::notificationBitMask(const uint64_t index) noexcept
+{
+    return static_cast<uint64_t>(1U) << (index % NOTIFICATION_WORD_WIDTH);
+}
+
+bool ConditionVariableData::isNotificationActive(const uint64_t index) const noexcept
+{
+    return (m_activeNotifications[notificationWordIndex(index)].load(std::memory_order_relaxed)
+            & notificationBitMask(index))
+           != 0U;
+}
 } // namespace popo
 } // namespace iox
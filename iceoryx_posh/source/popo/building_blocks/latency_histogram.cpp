@@ -0,0 +1,65 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint32_t LatencyHistogram::NUMBER_OF_BUCKETS;
+
+void LatencyHistogram::record(const uint64_t latencyInNanoseconds) noexcept
+{
+    m_buckets[bucketIndex(latencyInNanoseconds)].add();
+    m_sampleCount.add();
+    m_sumInNanoseconds.add(latencyInNanoseconds);
+    m_maxInNanoseconds.raiseTo(latencyInNanoseconds);
+}
+
+uint64_t LatencyHistogram::sampleCount() const noexcept
+{
+    return m_sampleCount.value();
+}
+
+uint64_t LatencyHistogram::sumInNanoseconds() const noexcept
+{
+    return m_sumInNanoseconds.value();
+}
+
+uint64_t LatencyHistogram::maxInNanoseconds() const noexcept
+{
+    return m_maxInNanoseconds.value();
+}
+
+uint64_t LatencyHistogram::bucket(const uint32_t index) const noexcept
+{
+    return (index < NUMBER_OF_BUCKETS) ? m_buckets[index].value() : 0U;
+}
+
+uint32_t LatencyHistogram::bucketIndex(const uint64_t latencyInNanoseconds) noexcept
+{
+    uint32_t index{0U};
+    for (auto remaining = latencyInNanoseconds >> 1U; remaining != 0U && index < NUMBER_OF_BUCKETS - 1U;
+         remaining >>= 1U)
+    {
+        ++index;
+    }
+    return index;
+}
+
+} // namespace popo
+} // namespace iox
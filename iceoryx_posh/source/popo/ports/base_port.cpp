@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/popo/ports/base_port.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 
 namespace iox
 {
@@ -69,6 +70,7 @@ BasePort::operator bool() const noexcept
 void BasePort::destroy() noexcept
 {
     getMembers()->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+    notifyDiscovery();
 }
 
 bool BasePort::toBeDestroyed() const noexcept
@@ -76,5 +78,23 @@ bool BasePort::toBeDestroyed() const noexcept
     return getMembers()->m_toBeDestroyed.load(std::memory_order_relaxed);
 }
 
+void BasePort::notifyDiscovery() noexcept
+{
+    auto members = getMembers();
+    auto notificationData = members->m_discoveryNotificationDataPtr.get();
+    if (notificationData == nullptr || members->m_isDiscoveryNotificationPending.exchange(true))
+    {
+        return;
+    }
+
+    if (!notificationData->m_dirtyPorts.tryPush(members->m_dirtyPort))
+    {
+        members->m_isDiscoveryNotificationPending.store(false);
+        notificationData->m_hasLostNotifications.store(true);
+    }
+
+    ConditionNotifier(notificationData->m_conditionVariableData, 0U).notify();
+}
+
 } // namespace popo
 } // namespace iox
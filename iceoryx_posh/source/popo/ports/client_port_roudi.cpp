@@ -252,5 +252,15 @@ void ClientPortRouDi::releaseAllChunks() noexcept
     m_chunkReceiver.releaseAll();
 }
 
+bool ClientPortRouDi::isChunkQueueInUse() const noexcept
+{
+    return m_chunkReceiver.isReferencedByDistributors();
+}
+
+bool ClientPortRouDi::releaseRemovedQueues() noexcept
+{
+    return m_chunkSender.releaseRemovedQueues();
+}
+
 } // namespace popo
 } // namespace iox
@@ -121,5 +121,10 @@ void PublisherPortRouDi::releaseAllChunks() noexcept
     m_chunkSender.releaseAll();
 }
 
+bool PublisherPortRouDi::releaseRemovedQueues() noexcept
+{
+    return m_chunkSender.releaseRemovedQueues();
+}
+
 } // namespace popo
 } // namespace iox
@@ -81,6 +81,7 @@ void PublisherPortUser::offer() noexcept
     if (!getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(true, std::memory_order_relaxed);
+        notifyDiscovery();
     }
 }
 
@@ -89,6 +90,7 @@ void PublisherPortUser::stopOffer() noexcept
     if (getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(false, std::memory_order_relaxed);
+        notifyDiscovery();
     }
 }
 
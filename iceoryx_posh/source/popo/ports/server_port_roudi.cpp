@@ -169,5 +169,15 @@ void ServerPortRouDi::releaseAllChunks() noexcept
     m_chunkReceiver.releaseAll();
 }
 
+bool ServerPortRouDi::isChunkQueueInUse() const noexcept
+{
+    return m_chunkReceiver.isReferencedByDistributors();
+}
+
+bool ServerPortRouDi::releaseRemovedQueues() noexcept
+{
+    return m_chunkSender.releaseRemovedQueues();
+}
+
 } // namespace popo
 } // namespace iox
@@ -47,5 +47,10 @@ void SubscriberPortRouDi::releaseAllChunks() noexcept
     m_chunkReceiver.releaseAll();
 }
 
+bool SubscriberPortRouDi::isChunkQueueInUse() const noexcept
+{
+    return m_chunkReceiver.isReferencedByDistributors();
+}
+
 } // namespace popo
 } // namespace iox
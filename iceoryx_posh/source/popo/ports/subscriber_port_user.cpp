@@ -48,6 +48,7 @@ void SubscriberPortUser::subscribe() noexcept
         m_chunkReceiver.clear();
 
         getMembers()->m_subscribeRequested.store(true, std::memory_order_relaxed);
+        notifyDiscovery();
     }
 }
 
@@ -56,6 +57,7 @@ void SubscriberPortUser::unsubscribe() noexcept
     if (getMembers()->m_subscribeRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_subscribeRequested.store(false, std::memory_order_relaxed);
+        notifyDiscovery();
     }
 }
 
@@ -27,7 +27,9 @@ cxx::Serialization PublisherOptions::serialize() const noexcept
         historyCapacity,
         nodeName,
         offerOnCreate,
-        static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(subscriberTooSlowPolicy));
+        static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(subscriberTooSlowPolicy),
+        waitForConsumerTimeout.toNanoseconds(),
+        publishTimestamp);
 }
 
 cxx::expected<PublisherOptions, cxx::Serialization::Error>
@@ -37,11 +39,14 @@ PublisherOptions::deserialize(const cxx::Serialization& serialized) noexcept
 
     PublisherOptions publisherOptions;
     ConsumerTooSlowPolicyUT subscriberTooSlowPolicy;
+    uint64_t waitForConsumerTimeoutInNanoseconds{0U};
 
     auto deserializationSuccessful = serialized.extract(publisherOptions.historyCapacity,
                                                         publisherOptions.nodeName,
                                                         publisherOptions.offerOnCreate,
-                                                        subscriberTooSlowPolicy);
+                                                        subscriberTooSlowPolicy,
+                                                        waitForConsumerTimeoutInNanoseconds,
+                                                        publisherOptions.publishTimestamp);
 
     if (!deserializationSuccessful
         || subscriberTooSlowPolicy > static_cast<ConsumerTooSlowPolicyUT>(ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA))
@@ -50,6 +55,7 @@ PublisherOptions::deserialize(const cxx::Serialization& serialized) noexcept
     }
 
     publisherOptions.subscriberTooSlowPolicy = static_cast<ConsumerTooSlowPolicy>(subscriberTooSlowPolicy);
+    publisherOptions.waitForConsumerTimeout = units::Duration::fromNanoseconds(waitForConsumerTimeoutInNanoseconds);
     return cxx::success<PublisherOptions>(publisherOptions);
 }
 } // namespace popo
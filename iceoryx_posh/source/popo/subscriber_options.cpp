@@ -28,7 +28,8 @@ cxx::Serialization SubscriberOptions::serialize() const noexcept
                                       nodeName,
                                       subscribeOnCreate,
                                       static_cast<std::underlying_type_t<QueueFullPolicy>>(queueFullPolicy),
-                                      requiresPublisherHistorySupport);
+                                      requiresPublisherHistorySupport,
+                                      recordLatency);
 }
 
 cxx::expected<SubscriberOptions, cxx::Serialization::Error>
@@ -44,7 +45,8 @@ SubscriberOptions::deserialize(const cxx::Serialization& serialized) noexcept
                                                         subscriberOptions.nodeName,
                                                         subscriberOptions.subscribeOnCreate,
                                                         queueFullPolicy,
-                                                        subscriberOptions.requiresPublisherHistorySupport);
+                                                        subscriberOptions.requiresPublisherHistorySupport,
+                                                        subscriberOptions.recordLatency);
 
     if (!deserializationSuccessful
         || queueFullPolicy > static_cast<QueueFullPolicyUT>(QueueFullPolicy::DISCARD_OLDEST_DATA))
@@ -18,6 +18,7 @@
 #include "iceoryx_posh/roudi/memory/default_roudi_memory.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 
 namespace iox
@@ -58,6 +59,12 @@ mepoo::MePooConfig DefaultRouDiMemory::introspectionMemPoolConfig() const noexce
     mempoolConfig.m_mempoolConfig.push_back(
         {cxx::align(static_cast<uint32_t>(sizeof(roudi::SubscriberPortChangingIntrospectionFieldTopic)), ALIGNMENT),
          CHUNK_COUNT});
+    // the deltas of the service registry are kept in the history of the publisher and in the queue of each
+    // ServiceDiscovery; when the mempool runs out of chunks the runtimes continue with the next registry snapshot
+    constexpr uint32_t SERVICE_REGISTRY_DELTA_CHUNK_COUNT{512U};
+    mempoolConfig.m_mempoolConfig.push_back(
+        {cxx::align(static_cast<uint32_t>(sizeof(roudi::ServiceRegistryDelta)), ALIGNMENT),
+         SERVICE_REGISTRY_DELTA_CHUNK_COUNT});
 
     mempoolConfig.optimize();
     return mempoolConfig;
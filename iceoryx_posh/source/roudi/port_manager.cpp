@@ -67,15 +67,27 @@ PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept
     registryPortOptions.nodeName = iox::NodeName_t("Service Registry");
     registryPortOptions.offerOnCreate = true;
 
-    // we cannot (fully) perform discovery without this port
+    // the deltas are kept in the history until the next snapshot of the registry is published for sure
+    popo::PublisherOptions registryDeltaPortOptions;
+    registryDeltaPortOptions.historyCapacity = SERVICE_REGISTRY_SNAPSHOT_INTERVAL;
+    registryDeltaPortOptions.nodeName = iox::NodeName_t("Service Registry");
+    registryDeltaPortOptions.offerOnCreate = true;
+
+    // we cannot (fully) perform discovery without these ports
     m_serviceRegistryPublisherPortData = acquireInternalPublisherPortDataWithoutDiscovery(
         {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_EVENT_NAME},
         registryPortOptions,
         introspectionMemoryManager);
+    m_serviceRegistryDeltaPublisherPortData = acquireInternalPublisherPortDataWithoutDiscovery(
+        {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_DELTA_EVENT_NAME},
+        registryDeltaPortOptions,
+        introspectionMemoryManager);
 
-    // if we arrive here, the port for service discovery exists and we perform the discovery
+    // if we arrive here, the ports for service discovery exist and we perform the discovery
     PublisherPortRouDiType serviceRegistryPort(*m_serviceRegistryPublisherPortData);
     doDiscoveryForPublisherPort(serviceRegistryPort);
+    PublisherPortRouDiType serviceRegistryDeltaPort(*m_serviceRegistryDeltaPublisherPortData);
+    doDiscoveryForPublisherPort(serviceRegistryDeltaPort);
 
     popo::PublisherOptions options;
     options.historyCapacity = 1U;
@@ -94,6 +106,9 @@ PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept
                                               PublisherPortUserType(std::move(portThroughput)),
                                               PublisherPortUserType(std::move(subscriberPortsData)));
     m_portIntrospection.run();
+
+    // provides the base for the deltas to runtimes which are started later
+    publishServiceRegistry();
 }
 
 void PortManager::stopPortIntrospection() noexcept
@@ -116,6 +131,101 @@ void PortManager::doDiscovery() noexcept
     handleNodes();
 
     handleConditionVariables();
+
+    publishPendingServiceRegistry();
+}
+
+void PortManager::doDiscoveryForNotifiedPorts() noexcept
+{
+    auto& notificationData = m_portPool->getDiscoveryNotificationData();
+    // only the ports which were in the queue at the beginning are handled, ports which notify in the meantime
+    // signal the condition variable again
+    auto numberOfNotifiedPorts = notificationData.m_dirtyPorts.size();
+    for (uint64_t i = 0U; i < numberOfNotifiedPorts; ++i)
+    {
+        notificationData.m_dirtyPorts.pop().and_then([this](auto& dirtyPort) { this->handleNotifiedPort(dirtyPort); });
+    }
+
+    if (notificationData.m_hasLostNotifications.exchange(false))
+    {
+        LogWarn() << "Lost discovery notifications of ports! Performing a full discovery.";
+        doDiscovery();
+    }
+
+    publishPendingServiceRegistry();
+}
+
+popo::ConditionVariableData& PortManager::getDiscoveryConditionVariableData() noexcept
+{
+    return m_portPool->getDiscoveryNotificationData().m_conditionVariableData;
+}
+
+void PortManager::handleNotifiedPort(const popo::DirtyPort& dirtyPort) noexcept
+{
+    // the pending flag is reset before the port is handled, a state change during the handling is announced again
+    switch (dirtyPort.kind)
+    {
+    case popo::DiscoveryPortKind::PUBLISHER:
+    {
+        auto publisherPortData = m_portPool->getPublisherPortData(dirtyPort.index);
+        if (publisherPortData != nullptr)
+        {
+            publisherPortData->m_isDiscoveryNotificationPending.exchange(false);
+            PublisherPortRouDiType publisherPort(publisherPortData);
+            doDiscoveryForPublisherPort(publisherPort);
+            if (publisherPort.toBeDestroyed())
+            {
+                destroyPublisherPort(publisherPortData);
+            }
+        }
+        break;
+    }
+    case popo::DiscoveryPortKind::SUBSCRIBER:
+    {
+        auto subscriberPortData = m_portPool->getSubscriberPortData(dirtyPort.index);
+        if (subscriberPortData != nullptr)
+        {
+            subscriberPortData->m_isDiscoveryNotificationPending.exchange(false);
+            SubscriberPortType subscriberPort(subscriberPortData);
+            doDiscoveryForSubscriberPort(subscriberPort);
+            if (subscriberPort.toBeDestroyed())
+            {
+                destroySubscriberPort(subscriberPortData);
+            }
+        }
+        break;
+    }
+    case popo::DiscoveryPortKind::CLIENT:
+    {
+        auto clientPortData = m_portPool->getClientPortData(dirtyPort.index);
+        if (clientPortData != nullptr)
+        {
+            clientPortData->m_isDiscoveryNotificationPending.exchange(false);
+            popo::ClientPortRouDi clientPort(*clientPortData);
+            doDiscoveryForClientPort(clientPort);
+            if (clientPort.toBeDestroyed())
+            {
+                destroyClientPort(clientPortData);
+            }
+        }
+        break;
+    }
+    case popo::DiscoveryPortKind::SERVER:
+    {
+        auto serverPortData = m_portPool->getServerPortData(dirtyPort.index);
+        if (serverPortData != nullptr)
+        {
+            serverPortData->m_isDiscoveryNotificationPending.exchange(false);
+            popo::ServerPortRouDi serverPort(*serverPortData);
+            doDiscoveryForServerPort(serverPort);
+            if (serverPort.toBeDestroyed())
+            {
+                destroyServerPort(serverPortData);
+            }
+        }
+        break;
+    }
+    }
 }
 
 void PortManager::handlePublisherPorts() noexcept
@@ -126,6 +236,8 @@ void PortManager::handlePublisherPorts() noexcept
         PublisherPortRouDiType publisherPort(publisherPortData);
 
         doDiscoveryForPublisherPort(publisherPort);
+        // the removal of a queue does not wait until the deliveries which could still use it are finished
+        IOX_DISCARD_RESULT(publisherPort.releaseRemovedQueues());
 
         // check if we have to destroy this publisher port
         if (publisherPort.toBeDestroyed())
@@ -139,15 +251,8 @@ void PortManager::doDiscoveryForPublisherPort(PublisherPortRouDiType& publisherP
 {
     publisherPort.tryGetCaProMessage().and_then([this, &publisherPort](auto caproMessage) {
         m_portIntrospection.reportMessage(caproMessage);
-        if (capro::CaproMessageType::OFFER == caproMessage.m_type)
-        {
-            this->addPublisherToServiceRegistry(caproMessage.m_serviceDescription);
-        }
-        else if (capro::CaproMessageType::STOP_OFFER == caproMessage.m_type)
-        {
-            this->removePublisherFromServiceRegistry(caproMessage.m_serviceDescription);
-        }
-        else
+        if (capro::CaproMessageType::OFFER != caproMessage.m_type
+            && capro::CaproMessageType::STOP_OFFER != caproMessage.m_type)
         {
             LogWarn() << "CaPro protocol error for publisher from runtime '" << publisherPort.getRuntimeName()
                       << "' and with service description '" << publisherPort.getCaProServiceDescription()
@@ -158,8 +263,18 @@ void PortManager::doDiscoveryForPublisherPort(PublisherPortRouDiType& publisherP
         }
 
         this->sendToAllMatchingSubscriberPorts(caproMessage, publisherPort);
-        // forward to interfaces
+        // forward to interfaces before the service registry change is announced, this way a gateway which
+        // is woken up by the announcement already finds the CaPro message in its interface port
         this->sendToAllMatchingInterfacePorts(caproMessage);
+
+        if (capro::CaproMessageType::OFFER == caproMessage.m_type)
+        {
+            this->addPublisherToServiceRegistry(caproMessage.m_serviceDescription);
+        }
+        else
+        {
+            this->removePublisherFromServiceRegistry(caproMessage.m_serviceDescription);
+        }
     });
 }
 
@@ -231,6 +346,13 @@ void PortManager::destroyClientPort(popo::ClientPortData* const clientPortData)
 
     clientPortRoudi.releaseAllChunks();
 
+    if (clientPortRoudi.isChunkQueueInUse())
+    {
+        // see destroySubscriberPort
+        clientPortData->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+        return;
+    }
+
     /// @todo iox-#1128 remove from to port introspection
 
     LogDebug() << "Destroy client port from runtime '" << clientPortData->m_runtimeName
@@ -248,6 +370,7 @@ void PortManager::handleClientPorts() noexcept
         popo::ClientPortRouDi clientPort(*clientPortData);
 
         doDiscoveryForClientPort(clientPort);
+        IOX_DISCARD_RESULT(clientPort.releaseRemovedQueues());
 
         // check if we have to destroy this clinet port
         if (clientPort.toBeDestroyed())
@@ -313,13 +436,20 @@ void PortManager::destroyServerPort(popo::ServerPortData* const serverPortData)
         cxx::Ensures(caproMessage.m_serviceType == capro::CaproServiceType::SERVER);
 
         /// @todo iox-#1128 report to port introspection
-        this->removeServerFromServiceRegistry(caproMessage.m_serviceDescription);
         this->sendToAllMatchingClientPorts(caproMessage, serverPortRoudi);
         this->sendToAllMatchingInterfacePorts(caproMessage);
+        this->removeServerFromServiceRegistry(caproMessage.m_serviceDescription);
     });
 
     serverPortRoudi.releaseAllChunks();
 
+    if (serverPortRoudi.isChunkQueueInUse())
+    {
+        // see destroySubscriberPort
+        serverPortData->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+        return;
+    }
+
     /// @todo iox-#1128 remove from port introspection
 
     LogDebug() << "Destroy server port from runtime '" << serverPortData->m_runtimeName
@@ -337,6 +467,7 @@ void PortManager::handleServerPorts() noexcept
         popo::ServerPortRouDi serverPort(*serverPortData);
 
         doDiscoveryForServerPort(serverPort);
+        IOX_DISCARD_RESULT(serverPort.releaseRemovedQueues());
 
         // check if we have to destroy this server port
         if (serverPort.toBeDestroyed())
@@ -351,15 +482,8 @@ void PortManager::doDiscoveryForServerPort(popo::ServerPortRouDi& serverPort) no
     serverPort.tryGetCaProMessage().and_then([this, &serverPort](auto caproMessage) {
         /// @todo iox-#1128 report to port instrospection
 
-        if (capro::CaproMessageType::OFFER == caproMessage.m_type)
-        {
-            this->addServerToServiceRegistry(caproMessage.m_serviceDescription);
-        }
-        else if (capro::CaproMessageType::STOP_OFFER == caproMessage.m_type)
-        {
-            this->removeServerFromServiceRegistry(caproMessage.m_serviceDescription);
-        }
-        else
+        if (capro::CaproMessageType::OFFER != caproMessage.m_type
+            && capro::CaproMessageType::STOP_OFFER != caproMessage.m_type)
         {
             LogWarn() << "CaPro protocol error for server from runtime '" << serverPort.getRuntimeName()
                       << "' and with service description '" << serverPort.getCaProServiceDescription()
@@ -370,6 +494,15 @@ void PortManager::doDiscoveryForServerPort(popo::ServerPortRouDi& serverPort) no
 
         this->sendToAllMatchingClientPorts(caproMessage, serverPort);
         this->sendToAllMatchingInterfacePorts(caproMessage);
+
+        if (capro::CaproMessageType::OFFER == caproMessage.m_type)
+        {
+            this->addServerToServiceRegistry(caproMessage.m_serviceDescription);
+        }
+        else
+        {
+            this->removeServerFromServiceRegistry(caproMessage.m_serviceDescription);
+        }
     });
 }
 
@@ -498,7 +631,7 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
                                                   SubscriberPortType& subscriberSource) noexcept
 {
     bool publisherFound = false;
-    for (auto publisherPortData : m_portPool->getPublisherPortDataList())
+    for (auto publisherPortData : m_portPool->getPublisherPortDataList(subscriberSource.getCaProServiceDescription()))
     {
         PublisherPortRouDiType publisherPort(publisherPortData);
 
@@ -536,7 +669,7 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
 void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& message,
                                                    PublisherPortRouDiType& publisherSource) noexcept
 {
-    for (auto subscriberPortData : m_portPool->getSubscriberPortDataList())
+    for (auto subscriberPortData : m_portPool->getSubscriberPortDataList(publisherSource.getCaProServiceDescription()))
     {
         SubscriberPortType subscriberPort(subscriberPortData);
 
@@ -602,7 +735,7 @@ bool PortManager::isCompatibleClientServer(const popo::ServerPortRouDi& server,
 void PortManager::sendToAllMatchingClientPorts(const capro::CaproMessage& message,
                                                popo::ServerPortRouDi& serverSource) noexcept
 {
-    for (auto clientPortData : m_portPool->getClientPortDataList())
+    for (auto clientPortData : m_portPool->getClientPortDataList(serverSource.getCaProServiceDescription()))
     {
         popo::ClientPortRouDi clientPort(*clientPortData);
         if (isCompatibleClientServer(serverSource, clientPort))
@@ -639,9 +772,14 @@ bool PortManager::sendToAllMatchingServerPorts(const capro::CaproMessage& messag
                                                popo::ClientPortRouDi& clientSource) noexcept
 {
     bool serverFound = false;
-    for (auto serverPortData : m_portPool->getServerPortDataList())
+    for (auto serverPortData : m_portPool->getServerPortDataList(clientSource.getCaProServiceDescription()))
     {
         popo::ServerPortRouDi serverPort(*serverPortData);
+        // a server whose destruction is deferred must not answer in place of a new server with the same service
+        if (serverPort.toBeDestroyed())
+        {
+            continue;
+        }
         if (isCompatibleClientServer(serverPort, clientSource))
         {
             // send CONNECT/DISCONNECT to server
@@ -724,6 +862,7 @@ void PortManager::deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcep
     if (runtimeName == RuntimeName_t(iox::roudi::IPC_CHANNEL_ROUDI_NAME))
     {
         m_serviceRegistryPublisherPortData.reset();
+        m_serviceRegistryDeltaPublisherPortData.reset();
     }
     for (auto port : m_portPool->getPublisherPortDataList())
     {
@@ -803,9 +942,9 @@ void PortManager::destroyPublisherPort(PublisherPortRouDiType::MemberType_t* con
         cxx::Ensures(caproMessage.m_type == capro::CaproMessageType::STOP_OFFER);
 
         m_portIntrospection.reportMessage(caproMessage);
-        this->removePublisherFromServiceRegistry(caproMessage.m_serviceDescription);
         this->sendToAllMatchingSubscriberPorts(caproMessage, publisherPortRoudi);
         this->sendToAllMatchingInterfacePorts(caproMessage);
+        this->removePublisherFromServiceRegistry(caproMessage.m_serviceDescription);
     });
 
     publisherPortRoudi.releaseAllChunks();
@@ -836,6 +975,14 @@ void PortManager::destroySubscriberPort(SubscriberPortType::MemberType_t* const
 
     subscriberPortRoudi.releaseAllChunks();
 
+    if (subscriberPortRoudi.isChunkQueueInUse())
+    {
+        // a delivery which started before the unsubscription might still use the queue; the port is destroyed by a
+        // later discovery run after the grace period, the chunks such a delivery pushed are released then as well
+        subscriberPortData->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+        return;
+    }
+
     m_portIntrospection.removeSubscriber(subscriberPortUser);
 
     LogDebug() << "Destroy subscriber port from runtime '" << subscriberPortData->m_runtimeName
@@ -989,7 +1136,7 @@ PortManager::acquireServerPortData(const capro::ServiceDescription& service,
 {
     // it is not allowed to have two servers with the same ServiceDescription;
     // check if the server is already in the list
-    for (const auto serverPortData : m_portPool->getServerPortDataList())
+    for (const auto serverPortData : m_portPool->getServerPortDataList(service))
     {
         if (service == serverPortData->m_serviceDescription)
         {
@@ -1035,7 +1182,7 @@ popo::InterfacePortData* PortManager::acquireInterfacePortData(capro::Interfaces
     }
 }
 
-void PortManager::publishServiceRegistry() const noexcept
+void PortManager::publishServiceRegistry() noexcept
 {
     if (!m_serviceRegistryPublisherPortData.has_value())
     {
@@ -1055,8 +1202,60 @@ void PortManager::publishServiceRegistry() const noexcept
             new (chunk->userPayload()) ServiceRegistry(m_serviceRegistry);
 
             publisher.sendChunk(chunk);
+            m_isServiceRegistryPublicationPending = false;
         })
-        .or_else([](auto&) { LogWarn() << "Could not allocate a chunk for the service registry!"; });
+        .or_else([&](auto&) {
+            LogWarn() << "Could not allocate a chunk for the service registry!";
+            m_isServiceRegistryPublicationPending = true;
+        });
+}
+
+void PortManager::publishPendingServiceRegistry() noexcept
+{
+    if (m_isServiceRegistryPublicationPending)
+    {
+        publishServiceRegistry();
+    }
+}
+
+void PortManager::publishServiceRegistryChange(const capro::ServiceDescription& service) noexcept
+{
+    auto delta = m_serviceRegistry.deltaOf(service);
+    if (delta.generation == m_publishedServiceRegistryGeneration)
+    {
+        // e.g. the registry was full or a service which was not registered should be removed
+        return;
+    }
+    m_publishedServiceRegistryGeneration = delta.generation;
+
+    if (!m_serviceRegistryDeltaPublisherPortData.has_value())
+    {
+        LogWarn() << "Could not publish service registry delta!";
+        return;
+    }
+    PublisherPortUserType publisher(m_serviceRegistryDeltaPublisherPortData.value());
+    publisher
+        .tryAllocateChunk(sizeof(ServiceRegistryDelta),
+                          alignof(ServiceRegistryDelta),
+                          CHUNK_NO_USER_HEADER_SIZE,
+                          CHUNK_NO_USER_HEADER_ALIGNMENT)
+        .and_then([&](auto& chunk) {
+            new (chunk->userPayload()) ServiceRegistryDelta(delta);
+            publisher.sendChunk(chunk);
+        })
+        .or_else([&](auto&) {
+            // the runtimes detect the gap in the generations and continue with the snapshot which is published at the
+            // end of the discovery run
+            LogWarn() << "Could not allocate a chunk for the service registry delta!";
+            m_isServiceRegistryPublicationPending = true;
+        });
+
+    // the delta history holds all deltas since the last snapshot, therefore the runtimes only require a snapshot
+    // every SERVICE_REGISTRY_SNAPSHOT_INTERVAL deltas or when a delta is missing
+    if (delta.generation % SERVICE_REGISTRY_SNAPSHOT_INTERVAL == 0U)
+    {
+        publishServiceRegistry();
+    }
 }
 
 const ServiceRegistry& PortManager::serviceRegistry() const noexcept
@@ -1070,13 +1269,13 @@ void PortManager::addPublisherToServiceRegistry(const capro::ServiceDescription&
         LogWarn() << "Could not add publisher with service description '" << service << "' to service registry!";
         errorHandler(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, ErrorLevel::MODERATE);
     });
-    publishServiceRegistry();
+    publishServiceRegistryChange(service);
 }
 
 void PortManager::removePublisherFromServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
     m_serviceRegistry.removePublisher(service);
-    publishServiceRegistry();
+    publishServiceRegistryChange(service);
 }
 
 void PortManager::addServerToServiceRegistry(const capro::ServiceDescription& service) noexcept
@@ -1085,13 +1284,13 @@ void PortManager::addServerToServiceRegistry(const capro::ServiceDescription& se
         LogWarn() << "Could not add server with service description '" << service << "' to service registry!";
         errorHandler(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, ErrorLevel::MODERATE);
     });
-    publishServiceRegistry();
+    publishServiceRegistryChange(service);
 }
 
 void PortManager::removeServerFromServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
     m_serviceRegistry.removeServer(service);
-    publishServiceRegistry();
+    publishServiceRegistryChange(service);
 }
 
 cxx::expected<runtime::NodeData*, PortPoolError> PortManager::acquireNodeData(const RuntimeName_t& runtimeName,
@@ -23,6 +23,25 @@ namespace iox
 {
 namespace roudi
 {
+namespace
+{
+template <typename T, uint64_t Capacity>
+cxx::vector<T*, Capacity> portsWithService(FixedPositionContainer<T, Capacity>& ports,
+                                           const ServicePortIndex<Capacity>& index,
+                                           const capro::ServiceDescription& service) noexcept
+{
+    cxx::vector<T*, Capacity> returnValue;
+    index.forEachCandidate(service, [&](const uint64_t position) {
+        auto port = ports.at(position);
+        if (port != nullptr && port->m_serviceDescription == service)
+        {
+            returnValue.emplace_back(port);
+        }
+    });
+    return returnValue;
+}
+} // namespace
+
 PortPool::PortPool(PortPoolData& portPoolData) noexcept
     : m_portPoolData(&portPoolData)
 {
@@ -119,6 +138,18 @@ cxx::vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS> PortPool::getSub
     return m_portPoolData->m_subscriberPortMembers.content();
 }
 
+cxx::vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS>
+PortPool::getPublisherPortDataList(const capro::ServiceDescription& service) noexcept
+{
+    return portsWithService(m_portPoolData->m_publisherPortMembers, m_portPoolData->m_publisherPortIndex, service);
+}
+
+cxx::vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS>
+PortPool::getSubscriberPortDataList(const capro::ServiceDescription& service) noexcept
+{
+    return portsWithService(m_portPoolData->m_subscriberPortMembers, m_portPoolData->m_subscriberPortIndex, service);
+}
+
 cxx::expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
 PortPool::addPublisherPort(const capro::ServiceDescription& serviceDescription,
                            mepoo::MemoryManager* const memoryManager,
@@ -130,6 +161,9 @@ PortPool::addPublisherPort(const capro::ServiceDescription& serviceDescription,
     {
         auto publisherPortData = m_portPoolData->m_publisherPortMembers.insert(
             serviceDescription, runtimeName, memoryManager, publisherOptions, memoryInfo);
+        auto position = m_portPoolData->m_publisherPortMembers.indexOf(publisherPortData);
+        m_portPoolData->m_publisherPortIndex.add(serviceDescription, position);
+        enableDiscoveryNotification(*publisherPortData, {popo::DiscoveryPortKind::PUBLISHER, position});
         return cxx::success<PublisherPortRouDiType::MemberType_t*>(publisherPortData);
     }
     else
@@ -151,6 +185,9 @@ PortPool::addSubscriberPort(const capro::ServiceDescription& serviceDescription,
     {
         auto subscriberPortData = constructSubscriber<iox::build::CommunicationPolicy>(
             serviceDescription, runtimeName, subscriberOptions, memoryInfo);
+        auto position = m_portPoolData->m_subscriberPortMembers.indexOf(subscriberPortData);
+        m_portPoolData->m_subscriberPortIndex.add(serviceDescription, position);
+        enableDiscoveryNotification(*subscriberPortData, {popo::DiscoveryPortKind::SUBSCRIBER, position});
 
         return cxx::success<SubscriberPortType::MemberType_t*>(subscriberPortData);
     }
@@ -173,6 +210,18 @@ cxx::vector<popo::ServerPortData*, MAX_SERVERS> PortPool::getServerPortDataList(
     return m_portPoolData->m_serverPortMembers.content();
 }
 
+cxx::vector<popo::ClientPortData*, MAX_CLIENTS>
+PortPool::getClientPortDataList(const capro::ServiceDescription& service) noexcept
+{
+    return portsWithService(m_portPoolData->m_clientPortMembers, m_portPoolData->m_clientPortIndex, service);
+}
+
+cxx::vector<popo::ServerPortData*, MAX_SERVERS>
+PortPool::getServerPortDataList(const capro::ServiceDescription& service) noexcept
+{
+    return portsWithService(m_portPoolData->m_serverPortMembers, m_portPoolData->m_serverPortIndex, service);
+}
+
 cxx::expected<popo::ClientPortData*, PortPoolError>
 PortPool::addClientPort(const capro::ServiceDescription& serviceDescription,
                         mepoo::MemoryManager* const memoryManager,
@@ -190,6 +239,9 @@ PortPool::addClientPort(const capro::ServiceDescription& serviceDescription,
 
     auto clientPortData = m_portPoolData->m_clientPortMembers.insert(
         serviceDescription, runtimeName, clientOptions, memoryManager, memoryInfo);
+    auto position = m_portPoolData->m_clientPortMembers.indexOf(clientPortData);
+    m_portPoolData->m_clientPortIndex.add(serviceDescription, position);
+    enableDiscoveryNotification(*clientPortData, {popo::DiscoveryPortKind::CLIENT, position});
     return cxx::success<popo::ClientPortData*>(clientPortData);
 }
 
@@ -210,27 +262,70 @@ PortPool::addServerPort(const capro::ServiceDescription& serviceDescription,
 
     auto serverPortData = m_portPoolData->m_serverPortMembers.insert(
         serviceDescription, runtimeName, serverOptions, memoryManager, memoryInfo);
+    auto position = m_portPoolData->m_serverPortMembers.indexOf(serverPortData);
+    m_portPoolData->m_serverPortIndex.add(serviceDescription, position);
+    enableDiscoveryNotification(*serverPortData, {popo::DiscoveryPortKind::SERVER, position});
     return cxx::success<popo::ServerPortData*>(serverPortData);
 }
 
 void PortPool::removePublisherPort(const PublisherPortRouDiType::MemberType_t* const portData) noexcept
 {
+    m_portPoolData->m_publisherPortIndex.remove(portData->m_serviceDescription,
+                                                m_portPoolData->m_publisherPortMembers.indexOf(portData));
     m_portPoolData->m_publisherPortMembers.erase(portData);
 }
 
 void PortPool::removeSubscriberPort(const SubscriberPortType::MemberType_t* const portData) noexcept
 {
+    m_portPoolData->m_subscriberPortIndex.remove(portData->m_serviceDescription,
+                                                 m_portPoolData->m_subscriberPortMembers.indexOf(portData));
     m_portPoolData->m_subscriberPortMembers.erase(portData);
 }
 
 void PortPool::removeClientPort(const popo::ClientPortData* const portData) noexcept
 {
+    m_portPoolData->m_clientPortIndex.remove(portData->m_serviceDescription,
+                                             m_portPoolData->m_clientPortMembers.indexOf(portData));
     m_portPoolData->m_clientPortMembers.erase(portData);
 }
+
 void PortPool::removeServerPort(const popo::ServerPortData* const portData) noexcept
 {
+    m_portPoolData->m_serverPortIndex.remove(portData->m_serviceDescription,
+                                             m_portPoolData->m_serverPortMembers.indexOf(portData));
     m_portPoolData->m_serverPortMembers.erase(portData);
 }
 
+popo::DiscoveryNotificationData& PortPool::getDiscoveryNotificationData() noexcept
+{
+    return m_portPoolData->m_discoveryNotificationData;
+}
+
+PublisherPortRouDiType::MemberType_t* PortPool::getPublisherPortData(const uint64_t index) noexcept
+{
+    return m_portPoolData->m_publisherPortMembers.at(index);
+}
+
+SubscriberPortType::MemberType_t* PortPool::getSubscriberPortData(const uint64_t index) noexcept
+{
+    return m_portPoolData->m_subscriberPortMembers.at(index);
+}
+
+popo::ClientPortData* PortPool::getClientPortData(const uint64_t index) noexcept
+{
+    return m_portPoolData->m_clientPortMembers.at(index);
+}
+
+popo::ServerPortData* PortPool::getServerPortData(const uint64_t index) noexcept
+{
+    return m_portPoolData->m_serverPortMembers.at(index);
+}
+
+void PortPool::enableDiscoveryNotification(popo::BasePortData& portData, const popo::DirtyPort& dirtyPort) noexcept
+{
+    portData.m_dirtyPort = dirtyPort;
+    portData.m_discoveryNotificationDataPtr = &m_portPoolData->m_discoveryNotificationData;
+}
+
 } // namespace roudi
 } // namespace iox
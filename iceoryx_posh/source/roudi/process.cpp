@@ -31,7 +31,7 @@ Process::Process(const RuntimeName_t& name,
                  const bool isMonitored,
                  const uint64_t sessionId) noexcept
     : m_pid(pid)
-    , m_ipcChannel(name)
+    , m_ipcChannel(name, APP_MAX_MESSAGES, runtime::IpcInterfaceBase::MAX_MESSAGE_SIZE)
     , m_timestamp(mepoo::BaseClock_t::now())
     , m_user(user)
     , m_isMonitored(isMonitored)
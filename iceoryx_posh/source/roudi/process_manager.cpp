@@ -26,6 +26,7 @@
 #include "iceoryx_platform/wait.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 
@@ -268,7 +269,7 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
     auto offset = rp::UntypedRelativePointer::getOffset(rp::segment_id_t{m_mgmtSegmentId}, m_segmentManager);
     sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::REG_ACK)
                << m_roudiMemoryInterface.mgmtMemoryProvider()->size() << offset << transmissionTimestamp
-               << m_mgmtSegmentId << sendKeepAlive;
+               << m_mgmtSegmentId << sendKeepAlive << runtime::IPC_BINARY_PROTOCOL_VERSION;
 
     m_processList.back().sendViaIpcChannel(sendBuffer);
 
@@ -417,33 +418,9 @@ void ProcessManager::addSubscriberForProcess(const RuntimeName_t& name,
 {
     findProcess(name)
         .and_then([&](auto& process) {
-            // create a SubscriberPort
-            auto maybeSubscriber =
-                m_portManager.acquireSubscriberPortData(service, subscriberOptions, name, portConfigInfo);
-
-            if (!maybeSubscriber.has_error())
-            {
-                // send SubscriberPort to app as a serialized relative pointer
-                auto offset =
-                    rp::UntypedRelativePointer::getOffset(rp::segment_id_t{m_mgmtSegmentId}, maybeSubscriber.value());
-
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK)
-                           << cxx::convert::toString(offset) << cxx::convert::toString(m_mgmtSegmentId);
-                process->sendViaIpcChannel(sendBuffer);
-
-                LogDebug() << "Created new SubscriberPort for application '" << name << "' with service description '"
-                           << service << "'";
-            }
-            else
-            {
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::SUBSCRIBER_LIST_FULL);
-                process->sendViaIpcChannel(sendBuffer);
-                LogError() << "Could not create SubscriberPort for application '" << name
-                           << "' with service description '" << service << "'";
-            }
+            sendPortResponse(*process,
+                             runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK,
+                             acquireSubscriberPort(name, service, subscriberOptions, portConfigInfo));
         })
         .or_else([&]() {
             LogWarn() << "Unknown application '" << name << "' requested a SubscriberPort with service description '"
@@ -457,68 +434,11 @@ void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
                                             const PortConfigInfo& portConfigInfo) noexcept
 {
     findProcess(name)
-        .and_then([&](auto& process) { // create a PublisherPort
+        .and_then([&](auto& process) {
             auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
-
-            if (!segmentInfo.m_memoryManager.has_value())
-            {
-                // Tell the app no writable shared memory segment was found
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(
-                    runtime::IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT);
-                process->sendViaIpcChannel(sendBuffer);
-                return;
-            }
-
-            auto maybePublisher = m_portManager.acquirePublisherPortData(
-                service, publisherOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
-
-            if (!maybePublisher.has_error())
-            {
-                // send PublisherPort to app as a serialized relative pointer
-                auto offset =
-                    rp::UntypedRelativePointer::getOffset(rp::segment_id_t{m_mgmtSegmentId}, maybePublisher.value());
-
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PUBLISHER_ACK)
-                           << cxx::convert::toString(offset) << cxx::convert::toString(m_mgmtSegmentId);
-                process->sendViaIpcChannel(sendBuffer);
-
-                LogDebug() << "Created new PublisherPort for application '" << name << "' with service description '"
-                           << service << "'";
-            }
-            else
-            {
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-
-                std::string error;
-                switch (maybePublisher.get_error())
-                {
-                case PortPoolError::UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::NO_UNIQUE_CREATED);
-                    break;
-                }
-                case PortPoolError::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(
-                        runtime::IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN);
-                    break;
-                }
-                default:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL);
-                    break;
-                }
-                }
-                sendBuffer << error;
-
-                process->sendViaIpcChannel(sendBuffer);
-                LogError() << "Could not create PublisherPort for application '" << name
-                           << "' with service description '" << service << "'";
-            }
+            sendPortResponse(*process,
+                             runtime::IpcMessageType::CREATE_PUBLISHER_ACK,
+                             acquirePublisherPort(name, segmentInfo, service, publisherOptions, portConfigInfo));
         })
         .or_else([&]() {
             LogWarn() << "Unknown application '" << name << "' requested a PublisherPort with service description '"
@@ -532,45 +452,11 @@ void ProcessManager::addClientForProcess(const RuntimeName_t& name,
                                          const PortConfigInfo& portConfigInfo) noexcept
 {
     findProcess(name)
-        .and_then([&](auto& process) { // create a ClientPort
+        .and_then([&](auto& process) {
             auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
-
-            if (!segmentInfo.m_memoryManager.has_value())
-            {
-                // Tell the app no writable shared memory segment was found
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(
-                    runtime::IpcMessageErrorType::REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT);
-                process->sendViaIpcChannel(sendBuffer);
-                return;
-            }
-
-            m_portManager
-                .acquireClientPortData(
-                    service, clientOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo)
-                .and_then([&](auto& clientPort) {
-                    auto relativePtrToClientPort =
-                        rp::UntypedRelativePointer::getOffset(rp::segment_id_t{m_mgmtSegmentId}, clientPort);
-
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_CLIENT_ACK)
-                               << cxx::convert::toString(relativePtrToClientPort)
-                               << cxx::convert::toString(m_mgmtSegmentId);
-                    process->sendViaIpcChannel(sendBuffer);
-
-                    LogDebug() << "Created new ClientPort for application '" << name << "' with service description '"
-                               << service << "'";
-                })
-                .or_else([&](auto&) {
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                    sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::CLIENT_LIST_FULL);
-                    process->sendViaIpcChannel(sendBuffer);
-
-                    LogError() << "Could not create ClientPort for application '" << name
-                               << "' with service description '" << service << "'";
-                });
+            sendPortResponse(*process,
+                             runtime::IpcMessageType::CREATE_CLIENT_ACK,
+                             acquireClientPort(name, segmentInfo, service, clientOptions, portConfigInfo));
         })
         .or_else([&]() {
             LogWarn() << "Unknown application '" << name << "' requested a ClientPort with service description '"
@@ -584,50 +470,249 @@ void ProcessManager::addServerForProcess(const RuntimeName_t& name,
                                          const PortConfigInfo& portConfigInfo) noexcept
 {
     findProcess(name)
-        .and_then([&](auto& process) { // create a ServerPort
+        .and_then([&](auto& process) {
+            auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
+            sendPortResponse(*process,
+                             runtime::IpcMessageType::CREATE_SERVER_ACK,
+                             acquireServerPort(name, segmentInfo, service, serverOptions, portConfigInfo));
+        })
+        .or_else([&]() {
+            LogWarn() << "Unknown application '" << name << "' requested a ServerPort with service description '"
+                      << service << "'";
+        });
+}
+
+void ProcessManager::addPortsForProcess(const RuntimeName_t& name, const runtime::IpcMessage& message) noexcept
+{
+    findProcess(name)
+        .and_then([&](auto& process) {
+            // the segment lookup is done once for all requests of the batch
             auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
 
-            if (!segmentInfo.m_memoryManager.has_value())
+            runtime::IpcMessage sendBuffer;
+            sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PORTS_BATCH_ACK)
+                       << cxx::convert::toString(m_mgmtSegmentId);
+            for (uint32_t index = 2U; index < message.getNumberOfElements(); ++index)
             {
-                // Tell the app no writable shared memory segment was found
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(
-                    runtime::IpcMessageErrorType::REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT);
-                process->sendViaIpcChannel(sendBuffer);
-                return;
+                addPortFromBatchEntry(name, segmentInfo, message.getElementAtIndex(index), sendBuffer);
             }
+            process->sendViaIpcChannel(sendBuffer);
+        })
+        .or_else([&]() { LogWarn() << "Unknown application '" << name << "' requested a batch of ports"; });
+}
 
-            m_portManager
-                .acquireServerPortData(
-                    service, serverOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo)
-                .and_then([&](auto& serverPort) {
-                    auto relativePtrToServerPort =
-                        rp::UntypedRelativePointer::getOffset(rp::segment_id_t{m_mgmtSegmentId}, serverPort);
+void ProcessManager::addPortFromBatchEntry(const RuntimeName_t& name,
+                                           const SegmentUserInformation_t& segmentInfo,
+                                           const std::string& entry,
+                                           runtime::IpcMessage& sendBuffer) noexcept
+{
+    auto invalidRequest = [&](auto&) {
+        LogError() << "Application '" << name << "' requested a port with an invalid batch entry";
+        appendPortResponse(
+            sendBuffer,
+            runtime::IpcMessageType::ERROR,
+            cxx::error<runtime::IpcMessageErrorType>(runtime::IpcMessageErrorType::INVALID_PORT_REQUEST));
+    };
+
+    auto messageType = runtime::getBinaryRequestMessageType(entry);
+    if (messageType.has_error())
+    {
+        invalidRequest(messageType.get_error());
+        return;
+    }
 
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SERVER_ACK)
-                               << cxx::convert::toString(relativePtrToServerPort)
-                               << cxx::convert::toString(m_mgmtSegmentId);
-                    process->sendViaIpcChannel(sendBuffer);
+    switch (static_cast<runtime::IpcMessageType>(messageType.value()))
+    {
+    case runtime::IpcMessageType::CREATE_PUBLISHER_BINARY:
+        runtime::IpcPublisherRequest::fromEntry(entry)
+            .and_then([&](auto& request) {
+                appendPortResponse(sendBuffer,
+                                   runtime::IpcMessageType::CREATE_PUBLISHER_ACK,
+                                   acquirePublisherPort(name,
+                                                        segmentInfo,
+                                                        request.serviceDescription(),
+                                                        request.publisherOptions(),
+                                                        request.portConfigInfo()));
+            })
+            .or_else(invalidRequest);
+        break;
+    case runtime::IpcMessageType::CREATE_SUBSCRIBER_BINARY:
+        runtime::IpcSubscriberRequest::fromEntry(entry)
+            .and_then([&](auto& request) {
+                appendPortResponse(
+                    sendBuffer,
+                    runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK,
+                    acquireSubscriberPort(
+                        name, request.serviceDescription(), request.subscriberOptions(), request.portConfigInfo()));
+            })
+            .or_else(invalidRequest);
+        break;
+    case runtime::IpcMessageType::CREATE_CLIENT_BINARY:
+        runtime::IpcClientRequest::fromEntry(entry)
+            .and_then([&](auto& request) {
+                appendPortResponse(sendBuffer,
+                                   runtime::IpcMessageType::CREATE_CLIENT_ACK,
+                                   acquireClientPort(name,
+                                                     segmentInfo,
+                                                     request.serviceDescription(),
+                                                     request.clientOptions(),
+                                                     request.portConfigInfo()));
+            })
+            .or_else(invalidRequest);
+        break;
+    case runtime::IpcMessageType::CREATE_SERVER_BINARY:
+        runtime::IpcServerRequest::fromEntry(entry)
+            .and_then([&](auto& request) {
+                appendPortResponse(sendBuffer,
+                                   runtime::IpcMessageType::CREATE_SERVER_ACK,
+                                   acquireServerPort(name,
+                                                     segmentInfo,
+                                                     request.serviceDescription(),
+                                                     request.serverOptions(),
+                                                     request.portConfigInfo()));
+            })
+            .or_else(invalidRequest);
+        break;
+    default:
+        invalidRequest(messageType.value());
+        break;
+    }
+}
 
-                    LogDebug() << "Created new ServerPort for application '" << name << "' with service description '"
-                               << service << "'";
-                })
-                .or_else([&](auto&) {
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                    sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::SERVER_LIST_FULL);
-                    process->sendViaIpcChannel(sendBuffer);
+ProcessManager::PortOffset_t ProcessManager::acquireSubscriberPort(const RuntimeName_t& name,
+                                                                   const capro::ServiceDescription& service,
+                                                                   const popo::SubscriberOptions& subscriberOptions,
+                                                                   const PortConfigInfo& portConfigInfo) noexcept
+{
+    auto maybeSubscriber = m_portManager.acquireSubscriberPortData(service, subscriberOptions, name, portConfigInfo);
+    if (maybeSubscriber.has_error())
+    {
+        LogError() << "Could not create SubscriberPort for application '" << name << "' with service description '"
+                   << service << "'";
+        return cxx::error<runtime::IpcMessageErrorType>(runtime::IpcMessageErrorType::SUBSCRIBER_LIST_FULL);
+    }
 
-                    LogError() << "Could not create ServerPort for application '" << name
-                               << "' with service description '" << service << "'";
-                });
-        })
-        .or_else([&]() {
-            LogWarn() << "Unknown application '" << name << "' requested a ServerPort with service description '"
-                      << service << "'";
-        });
+    LogDebug() << "Created new SubscriberPort for application '" << name << "' with service description '" << service
+               << "'";
+    return cxx::success<rp::UntypedRelativePointer::offset_t>(
+        rp::UntypedRelativePointer::getOffset(rp::segment_id_t{m_mgmtSegmentId}, maybeSubscriber.value()));
+}
+
+ProcessManager::PortOffset_t ProcessManager::acquirePublisherPort(const RuntimeName_t& name,
+                                                                  const SegmentUserInformation_t& segmentInfo,
+                                                                  const capro::ServiceDescription& service,
+                                                                  const popo::PublisherOptions& publisherOptions,
+                                                                  const PortConfigInfo& portConfigInfo) noexcept
+{
+    if (!segmentInfo.m_memoryManager.has_value())
+    {
+        return cxx::error<runtime::IpcMessageErrorType>(
+            runtime::IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT);
+    }
+
+    auto maybePublisher = m_portManager.acquirePublisherPortData(
+        service, publisherOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
+    if (maybePublisher.has_error())
+    {
+        LogError() << "Could not create PublisherPort for application '" << name << "' with service description '"
+                   << service << "'";
+        switch (maybePublisher.get_error())
+        {
+        case PortPoolError::UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS:
+            return cxx::error<runtime::IpcMessageErrorType>(runtime::IpcMessageErrorType::NO_UNIQUE_CREATED);
+        case PortPoolError::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
+            return cxx::error<runtime::IpcMessageErrorType>(
+                runtime::IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN);
+        default:
+            return cxx::error<runtime::IpcMessageErrorType>(runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL);
+        }
+    }
+
+    LogDebug() << "Created new PublisherPort for application '" << name << "' with service description '" << service
+               << "'";
+    return cxx::success<rp::UntypedRelativePointer::offset_t>(
+        rp::UntypedRelativePointer::getOffset(rp::segment_id_t{m_mgmtSegmentId}, maybePublisher.value()));
+}
+
+ProcessManager::PortOffset_t ProcessManager::acquireClientPort(const RuntimeName_t& name,
+                                                               const SegmentUserInformation_t& segmentInfo,
+                                                               const capro::ServiceDescription& service,
+                                                               const popo::ClientOptions& clientOptions,
+                                                               const PortConfigInfo& portConfigInfo) noexcept
+{
+    if (!segmentInfo.m_memoryManager.has_value())
+    {
+        return cxx::error<runtime::IpcMessageErrorType>(
+            runtime::IpcMessageErrorType::REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT);
+    }
+
+    auto maybeClient = m_portManager.acquireClientPortData(
+        service, clientOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
+    if (maybeClient.has_error())
+    {
+        LogError() << "Could not create ClientPort for application '" << name << "' with service description '"
+                   << service << "'";
+        return cxx::error<runtime::IpcMessageErrorType>(runtime::IpcMessageErrorType::CLIENT_LIST_FULL);
+    }
+
+    LogDebug() << "Created new ClientPort for application '" << name << "' with service description '" << service
+               << "'";
+    return cxx::success<rp::UntypedRelativePointer::offset_t>(
+        rp::UntypedRelativePointer::getOffset(rp::segment_id_t{m_mgmtSegmentId}, maybeClient.value()));
+}
+
+ProcessManager::PortOffset_t ProcessManager::acquireServerPort(const RuntimeName_t& name,
+                                                               const SegmentUserInformation_t& segmentInfo,
+                                                               const capro::ServiceDescription& service,
+                                                               const popo::ServerOptions& serverOptions,
+                                                               const PortConfigInfo& portConfigInfo) noexcept
+{
+    if (!segmentInfo.m_memoryManager.has_value())
+    {
+        return cxx::error<runtime::IpcMessageErrorType>(
+            runtime::IpcMessageErrorType::REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT);
+    }
+
+    auto maybeServer = m_portManager.acquireServerPortData(
+        service, serverOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
+    if (maybeServer.has_error())
+    {
+        LogError() << "Could not create ServerPort for application '" << name << "' with service description '"
+                   << service << "'";
+        return cxx::error<runtime::IpcMessageErrorType>(runtime::IpcMessageErrorType::SERVER_LIST_FULL);
+    }
+
+    LogDebug() << "Created new ServerPort for application '" << name << "' with service description '" << service
+               << "'";
+    return cxx::success<rp::UntypedRelativePointer::offset_t>(
+        rp::UntypedRelativePointer::getOffset(rp::segment_id_t{m_mgmtSegmentId}, maybeServer.value()));
+}
+
+void ProcessManager::appendPortResponse(runtime::IpcMessage& sendBuffer,
+                                        const runtime::IpcMessageType ackType,
+                                        const PortOffset_t& port) const noexcept
+{
+    if (port.has_error())
+    {
+        sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR)
+                   << runtime::IpcMessageErrorTypeToString(port.get_error());
+        return;
+    }
+    sendBuffer << runtime::IpcMessageTypeToString(ackType) << cxx::convert::toString(port.value());
+}
+
+void ProcessManager::sendPortResponse(Process& process,
+                                      const runtime::IpcMessageType ackType,
+                                      const PortOffset_t& port) noexcept
+{
+    // single requests are answered with either ACK, offset, segment id or ERROR, error type
+    runtime::IpcMessage sendBuffer;
+    appendPortResponse(sendBuffer, ackType, port);
+    if (!port.has_error())
+    {
+        sendBuffer << cxx::convert::toString(m_mgmtSegmentId);
+    }
+    process.sendViaIpcChannel(sendBuffer);
 }
 
 void ProcessManager::addConditionVariableForProcess(const RuntimeName_t& runtimeName) noexcept
@@ -737,5 +822,10 @@ void ProcessManager::discoveryUpdate() noexcept
     m_portManager.doDiscovery();
 }
 
+void ProcessManager::discoveryUpdateForNotifiedPorts() noexcept
+{
+    m_portManager.doDiscoveryForNotifiedPorts();
+}
+
 } // namespace roudi
 } // namespace iox
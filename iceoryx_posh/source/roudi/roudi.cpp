@@ -17,10 +17,14 @@
 
 #include "iceoryx_posh/internal/roudi/roudi.hpp"
 #include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/cxx/deadline_timer.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_hoofs/posix_wrapper/thread.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
 #include "iceoryx_posh/internal/runtime/node_property.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
@@ -92,6 +96,7 @@ void RouDi::shutdown() noexcept
 
     // stop the process management thread in order to prevent application to register while shutting down
     m_runMonitoringAndDiscoveryThread = false;
+    popo::ConditionNotifier(m_portManager->getDiscoveryConditionVariableData(), 0U).notify();
     if (m_monitoringAndDiscoveryThread.joinable())
     {
         LogDebug() << "Joining 'Mon+Discover' thread...";
@@ -150,19 +155,37 @@ void RouDi::cyclicUpdateHook() noexcept
 
 void RouDi::monitorAndDiscoveryUpdate() noexcept
 {
+    // ports announce state changes via the condition variable and are discovered immediately; the monitoring and the
+    // full discovery still run cyclically and act as fallback for everything which is not announced
+    popo::ConditionListener discoveryListener(m_portManager->getDiscoveryConditionVariableData());
+    cxx::DeadlineTimer cyclicUpdateTimer(DISCOVERY_INTERVAL);
+
+    m_prcMgr->run();
+    cyclicUpdateHook();
+
     while (m_runMonitoringAndDiscoveryThread)
     {
-        m_prcMgr->run();
+        IOX_DISCARD_RESULT(discoveryListener.timedWait(cyclicUpdateTimer.remainingTime()));
 
-        cyclicUpdateHook();
+        m_prcMgr->discoveryUpdateForNotifiedPorts();
+
+        if (cyclicUpdateTimer.hasExpired())
+        {
+            cyclicUpdateTimer.reset();
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(DISCOVERY_INTERVAL.toMilliseconds()));
+            m_prcMgr->run();
+
+            cyclicUpdateHook();
+        }
     }
 }
 
 void RouDi::processRuntimeMessages() noexcept
 {
-    runtime::IpcInterfaceCreator roudiIpcInterface{IPC_CHANNEL_ROUDI_NAME};
+    // the channel is configured for the largest message the platform supports to keep the number of messages for
+    // batched port requests low
+    runtime::IpcInterfaceCreator roudiIpcInterface{
+        IPC_CHANNEL_ROUDI_NAME, ROUDI_MAX_MESSAGES, runtime::IpcInterfaceBase::MAX_MESSAGE_SIZE};
 
     // the logger is intentionally not used, to ensure that this message is always printed
     std::cout << "RouDi is ready for clients" << std::endl;
@@ -295,6 +318,52 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         }
         break;
     }
+    case runtime::IpcMessageType::CREATE_PUBLISHER_BINARY:
+    {
+        if (message.getNumberOfElements() != 3)
+        {
+            LogError() << "Wrong number of parameters for \"IpcMessageType::CREATE_PUBLISHER_BINARY\" from \""
+                       << runtimeName << "\"received!";
+        }
+        else
+        {
+            runtime::IpcPublisherRequest::fromEntry(message.getElementAtIndex(2))
+                .and_then([&](auto& request) {
+                    m_prcMgr->addPublisherForProcess(runtimeName,
+                                                     request.serviceDescription(),
+                                                     request.publisherOptions(),
+                                                     request.portConfigInfo());
+                })
+                .or_else([&](auto& error) {
+                    LogError() << "Invalid \"IpcMessageType::CREATE_PUBLISHER_BINARY\" from \"" << runtimeName
+                               << "\" received! Error code: " << static_cast<uint64_t>(error);
+                });
+        }
+        break;
+    }
+    case runtime::IpcMessageType::CREATE_SUBSCRIBER_BINARY:
+    {
+        if (message.getNumberOfElements() != 3)
+        {
+            LogError() << "Wrong number of parameters for \"IpcMessageType::CREATE_SUBSCRIBER_BINARY\" from \""
+                       << runtimeName << "\"received!";
+        }
+        else
+        {
+            runtime::IpcSubscriberRequest::fromEntry(message.getElementAtIndex(2))
+                .and_then([&](auto& request) {
+                    m_prcMgr->addSubscriberForProcess(runtimeName,
+                                                      request.serviceDescription(),
+                                                      request.subscriberOptions(),
+                                                      request.portConfigInfo());
+                })
+                .or_else([&](auto& error) {
+                    LogError() << "Invalid \"IpcMessageType::CREATE_SUBSCRIBER_BINARY\" from \"" << runtimeName
+                               << "\" received! Error code: " << static_cast<uint64_t>(error);
+                });
+        }
+        break;
+    }
     case runtime::IpcMessageType::CREATE_CLIENT:
     {
         if (message.getNumberOfElements() != 5)
@@ -367,6 +436,61 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         }
         break;
     }
+    case runtime::IpcMessageType::CREATE_CLIENT_BINARY:
+    {
+        if (message.getNumberOfElements() != 3)
+        {
+            LogError() << "Wrong number of parameters for \"IpcMessageType::CREATE_CLIENT_BINARY\" from \""
+                       << runtimeName << "\"received!";
+        }
+        else
+        {
+            runtime::IpcClientRequest::fromEntry(message.getElementAtIndex(2))
+                .and_then([&](auto& request) {
+                    m_prcMgr->addClientForProcess(
+                        runtimeName, request.serviceDescription(), request.clientOptions(), request.portConfigInfo());
+                })
+                .or_else([&](auto& error) {
+                    LogError() << "Invalid \"IpcMessageType::CREATE_CLIENT_BINARY\" from \"" << runtimeName
+                               << "\" received! Error code: " << static_cast<uint64_t>(error);
+                });
+        }
+        break;
+    }
+    case runtime::IpcMessageType::CREATE_SERVER_BINARY:
+    {
+        if (message.getNumberOfElements() != 3)
+        {
+            LogError() << "Wrong number of parameters for \"IpcMessageType::CREATE_SERVER_BINARY\" from \""
+                       << runtimeName << "\"received!";
+        }
+        else
+        {
+            runtime::IpcServerRequest::fromEntry(message.getElementAtIndex(2))
+                .and_then([&](auto& request) {
+                    m_prcMgr->addServerForProcess(
+                        runtimeName, request.serviceDescription(), request.serverOptions(), request.portConfigInfo());
+                })
+                .or_else([&](auto& error) {
+                    LogError() << "Invalid \"IpcMessageType::CREATE_SERVER_BINARY\" from \"" << runtimeName
+                               << "\" received! Error code: " << static_cast<uint64_t>(error);
+                });
+        }
+        break;
+    }
+    case runtime::IpcMessageType::CREATE_PORTS_BATCH:
+    {
+        if (message.getNumberOfElements() < 3)
+        {
+            LogError() << "Wrong number of parameters for \"IpcMessageType::CREATE_PORTS_BATCH\" from \""
+                       << runtimeName << "\"received!";
+        }
+        else
+        {
+            m_prcMgr->addPortsForProcess(runtimeName, message);
+        }
+        break;
+    }
     case runtime::IpcMessageType::CREATE_CONDITION_VARIABLE:
     {
         if (message.getNumberOfElements() != 2)
@@ -16,64 +16,118 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iceoryx_posh/internal/capro/service_description_hash.hpp"
 
 namespace iox
 {
 namespace roudi
 {
+constexpr uint32_t ServiceRegistry::CAPACITY;
+constexpr uint32_t ServiceRegistry::HASH_TABLE_SIZE;
+constexpr uint32_t ServiceRegistry::NO_INDEX;
+constexpr uint32_t ServiceRegistry::DELETED_INDEX;
+
 ServiceRegistry::ServiceDescriptionEntry::ServiceDescriptionEntry(const capro::ServiceDescription& serviceDescription)
     : serviceDescription(serviceDescription)
 {
 }
 
+ServiceRegistryDelta::ServiceRegistryDelta(const uint64_t generation,
+                                           const ServiceRegistry::ServiceDescriptionEntry& entry) noexcept
+    : generation(generation)
+    , entry(entry)
+{
+}
+
+ServiceRegistry::ServiceRegistry() noexcept
+{
+    for (auto& slot : m_hashTable)
+    {
+        slot = NO_INDEX;
+    }
+    for (uint32_t field = 0U; field < NUMBER_OF_FIELDS; ++field)
+    {
+        for (uint32_t i = 0U; i < CAPACITY; ++i)
+        {
+            m_fieldBucketHeads[field][i] = NO_INDEX;
+            m_fieldNextIndices[field][i] = NO_INDEX;
+        }
+    }
+}
+
 cxx::expected<ServiceRegistry::Error> ServiceRegistry::add(const capro::ServiceDescription& serviceDescription,
                                                            ReferenceCounter_t ServiceDescriptionEntry::*count)
 {
     auto index = findIndex(serviceDescription);
-    if (index != NO_INDEX)
+    if (index == NO_INDEX)
     {
-        // multiple entries with the same service descripion are possible
-        // and we just increase the count in this case (multi-set semantics)
-        // entry exists, increment counter
-        auto& entry = m_serviceDescriptions[index];
-        ((*entry).*count)++;
-        return cxx::success<>();
+        index = insert(serviceDescription);
+        if (index == NO_INDEX)
+        {
+            return cxx::error<Error>(Error::SERVICE_REGISTRY_FULL);
+        }
     }
 
+    // multiple entries with the same service descripion are possible
+    // and we just increase the count in this case (multi-set semantics)
+    auto& entry = m_serviceDescriptions[index];
+    ((*entry).*count)++;
+    ++m_generation;
+    return cxx::success<>();
+}
+
+uint32_t ServiceRegistry::insert(const capro::ServiceDescription& serviceDescription) noexcept
+{
     // entry does not exist, find a free slot if it exists
+    uint32_t index{NO_INDEX};
 
     // fast path to a free slot (which was occupied by previously removed entry),
     // prefer to fill entries close to the front
     if (m_freeIndex != NO_INDEX)
     {
-        auto& entry = m_serviceDescriptions[m_freeIndex];
-        entry.emplace(serviceDescription);
-        (*entry).*count = 1U;
+        index = m_freeIndex;
         m_freeIndex = NO_INDEX;
-        return cxx::success<>();
     }
-
-    // search from start
-    for (auto& entry : m_serviceDescriptions)
+    else
     {
-        if (!entry)
+        // search from start
+        for (uint32_t i = 0U; i < m_serviceDescriptions.size(); ++i)
+        {
+            if (!m_serviceDescriptions[i])
+            {
+                index = i;
+                break;
+            }
+        }
+
+        // append new entry at the end (the size only grows up to capacity)
+        if (index == NO_INDEX && m_serviceDescriptions.emplace_back())
         {
-            entry.emplace(serviceDescription);
-            (*entry).*count = 1U;
-            return cxx::success<>();
+            index = static_cast<uint32_t>(m_serviceDescriptions.size() - 1U);
         }
     }
 
-    // append new entry at the end (the size only grows up to capacity)
-    if (m_serviceDescriptions.emplace_back())
+    if (index != NO_INDEX)
     {
-        auto& entry = m_serviceDescriptions.back();
-        entry.emplace(serviceDescription);
-        (*entry).*count = 1U;
-        return cxx::success<>();
+        m_serviceDescriptions[index].emplace(serviceDescription);
+        addToIndices(index);
     }
+    return index;
+}
 
-    return cxx::error<Error>(Error::SERVICE_REGISTRY_FULL);
+void ServiceRegistry::erase(const uint32_t index) noexcept
+{
+    removeFromIndices(index);
+    m_serviceDescriptions[index].reset();
+    // reuse the slot in the next insertion
+    m_freeIndex = index;
+
+    // deleted slots lengthen the probing of unsuccessful lookups, when there are too many of them the hash table is
+    // rebuilt from the remaining entries
+    if (m_deletedSlots > CAPACITY / 2U)
+    {
+        rebuildHashTable();
+    }
 }
 
 cxx::expected<ServiceRegistry::Error>
@@ -88,42 +142,33 @@ ServiceRegistry::addServer(const capro::ServiceDescription& serviceDescription)
     return add(serviceDescription, &ServiceDescriptionEntry::serverCount);
 }
 
-void ServiceRegistry::removePublisher(const capro::ServiceDescription& serviceDescription) noexcept
+void ServiceRegistry::remove(const capro::ServiceDescription& serviceDescription,
+                             ReferenceCounter_t ServiceDescriptionEntry::*count) noexcept
 {
     auto index = findIndex(serviceDescription);
     if (index != NO_INDEX)
     {
         auto& entry = m_serviceDescriptions[index];
 
-        if (entry && entry->publisherCount >= 1U)
+        if (entry && (*entry).*count >= 1U)
         {
-            if (--entry->publisherCount == 0U && entry->serverCount == 0)
+            ++m_generation;
+            if (--((*entry).*count) == 0U && entry->publisherCount == 0U && entry->serverCount == 0U)
             {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
+                erase(index);
             }
         }
     }
 }
 
-void ServiceRegistry::removeServer(const capro::ServiceDescription& serviceDescription) noexcept
+void ServiceRegistry::removePublisher(const capro::ServiceDescription& serviceDescription) noexcept
 {
-    auto index = findIndex(serviceDescription);
-    if (index != NO_INDEX)
-    {
-        auto& entry = m_serviceDescriptions[index];
+    remove(serviceDescription, &ServiceDescriptionEntry::publisherCount);
+}
 
-        if (entry && entry->serverCount >= 1U)
-        {
-            if (--entry->serverCount == 0U && entry->publisherCount == 0)
-            {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
-            }
-        }
-    }
+void ServiceRegistry::removeServer(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    remove(serviceDescription, &ServiceDescriptionEntry::serverCount);
 }
 
 void ServiceRegistry::purge(const capro::ServiceDescription& serviceDescription) noexcept
@@ -131,10 +176,8 @@ void ServiceRegistry::purge(const capro::ServiceDescription& serviceDescription)
     auto index = findIndex(serviceDescription);
     if (index != NO_INDEX)
     {
-        auto& entry = m_serviceDescriptions[index];
-        entry.reset();
-        // reuse the slot in the next insertion
-        m_freeIndex = index;
+        erase(index);
+        ++m_generation;
     }
 }
 
@@ -143,31 +186,74 @@ void ServiceRegistry::find(const cxx::optional<capro::IdString_t>& service,
                            const cxx::optional<capro::IdString_t>& event,
                            cxx::function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
 {
-    for (auto& entry : m_serviceDescriptions)
+    if (service && instance && event)
     {
-        if (entry)
+        auto index = findIndex(capro::ServiceDescription(*service, *instance, *event));
+        if (index != NO_INDEX)
         {
-            bool match = (service) ? (entry->serviceDescription.getServiceIDString() == *service) : true;
-            match &= (instance) ? (entry->serviceDescription.getInstanceIDString() == *instance) : true;
-            match &= (event) ? (entry->serviceDescription.getEventIDString() == *event) : true;
+            callable(*m_serviceDescriptions[index]);
+        }
+        return;
+    }
 
-            if (match)
-            {
-                callable(*entry);
-            }
+    auto isMatch = [&](const ServiceDescriptionEntry& entry) {
+        bool match = (service) ? (entry.serviceDescription.getServiceIDString() == *service) : true;
+        match &= (instance) ? (entry.serviceDescription.getInstanceIDString() == *instance) : true;
+        match &= (event) ? (entry.serviceDescription.getEventIDString() == *event) : true;
+        return match;
+    };
+
+    // the first string which is not a wildcard selects the index, the others are compared for each candidate
+    const capro::IdString_t* key{nullptr};
+    Field field{SERVICE};
+    if (service)
+    {
+        key = &*service;
+    }
+    else if (instance)
+    {
+        key = &*instance;
+        field = INSTANCE;
+    }
+    else if (event)
+    {
+        key = &*event;
+        field = EVENT;
+    }
+
+    if (key == nullptr)
+    {
+        forEach(callable);
+        return;
+    }
+
+    for (auto index = m_fieldBucketHeads[field][bucketOf(*key)]; index != NO_INDEX;
+         index = m_fieldNextIndices[field][index])
+    {
+        auto& entry = m_serviceDescriptions[index];
+        if (entry && isMatch(*entry))
+        {
+            callable(*entry);
         }
     }
 }
 
 uint32_t ServiceRegistry::findIndex(const capro::ServiceDescription& serviceDescription) const noexcept
 {
-    for (uint32_t i = 0; i < m_serviceDescriptions.size(); ++i)
+    auto slot = static_cast<uint32_t>(capro::hashServiceDescription(serviceDescription) % HASH_TABLE_SIZE);
+    // the table always contains empty slots which terminate the probing, the bound is only a safeguard
+    for (uint32_t probe = 0U; probe < HASH_TABLE_SIZE; ++probe)
     {
-        auto& entry = m_serviceDescriptions[i];
-        if (entry && entry->serviceDescription == serviceDescription)
+        auto index = m_hashTable[slot];
+        if (index == NO_INDEX)
+        {
+            break;
+        }
+        if (index != DELETED_INDEX && m_serviceDescriptions[index]->serviceDescription == serviceDescription)
         {
-            return i;
+            return index;
         }
+        slot = (slot + 1U) % HASH_TABLE_SIZE;
     }
     return NO_INDEX;
 }
@@ -183,5 +269,149 @@ void ServiceRegistry::forEach(cxx::function_ref<void(const ServiceDescriptionEnt
     }
 }
 
+uint64_t ServiceRegistry::generation() const noexcept
+{
+    return m_generation;
+}
+
+ServiceRegistryDelta ServiceRegistry::deltaOf(const capro::ServiceDescription& serviceDescription) const noexcept
+{
+    auto index = findIndex(serviceDescription);
+    if (index == NO_INDEX)
+    {
+        return ServiceRegistryDelta(m_generation, ServiceDescriptionEntry(serviceDescription));
+    }
+    return ServiceRegistryDelta(m_generation, *m_serviceDescriptions[index]);
+}
+
+void ServiceRegistry::apply(const ServiceRegistryDelta& delta) noexcept
+{
+    const bool isRemoved = delta.entry.publisherCount == 0U && delta.entry.serverCount == 0U;
+    auto index = findIndex(delta.entry.serviceDescription);
+    if (index != NO_INDEX && isRemoved)
+    {
+        erase(index);
+    }
+    else if (!isRemoved)
+    {
+        if (index == NO_INDEX)
+        {
+            // cannot fail since the registry of RouDi which created the delta has the same capacity
+            index = insert(delta.entry.serviceDescription);
+        }
+        if (index != NO_INDEX)
+        {
+            m_serviceDescriptions[index]->publisherCount = delta.entry.publisherCount;
+            m_serviceDescriptions[index]->serverCount = delta.entry.serverCount;
+        }
+    }
+    m_generation = delta.generation;
+}
+
+void ServiceRegistry::addToIndices(const uint32_t index) noexcept
+{
+    insertIntoHashTable(index);
+
+    const auto& serviceDescription = m_serviceDescriptions[index]->serviceDescription;
+    for (uint32_t field = 0U; field < NUMBER_OF_FIELDS; ++field)
+    {
+        // keep the chain sorted, this way find returns the entries in the same order as forEach
+        uint32_t* link = &m_fieldBucketHeads[field][bucketOf(fieldOf(serviceDescription, static_cast<Field>(field)))];
+        while (*link != NO_INDEX && *link < index)
+        {
+            link = &m_fieldNextIndices[field][*link];
+        }
+        m_fieldNextIndices[field][index] = *link;
+        *link = index;
+    }
+}
+
+void ServiceRegistry::removeFromIndices(const uint32_t index) noexcept
+{
+    const auto& serviceDescription = m_serviceDescriptions[index]->serviceDescription;
+
+    auto slot = static_cast<uint32_t>(capro::hashServiceDescription(serviceDescription) % HASH_TABLE_SIZE);
+    for (uint32_t probe = 0U; probe < HASH_TABLE_SIZE; ++probe)
+    {
+        if (m_hashTable[slot] == index)
+        {
+            m_hashTable[slot] = DELETED_INDEX;
+            ++m_deletedSlots;
+            break;
+        }
+        slot = (slot + 1U) % HASH_TABLE_SIZE;
+    }
+
+    for (uint32_t field = 0U; field < NUMBER_OF_FIELDS; ++field)
+    {
+        uint32_t* link = &m_fieldBucketHeads[field][bucketOf(fieldOf(serviceDescription, static_cast<Field>(field)))];
+        while (*link != NO_INDEX)
+        {
+            if (*link == index)
+            {
+                *link = m_fieldNextIndices[field][index];
+                m_fieldNextIndices[field][index] = NO_INDEX;
+                break;
+            }
+            link = &m_fieldNextIndices[field][*link];
+        }
+    }
+}
+
+void ServiceRegistry::insertIntoHashTable(const uint32_t index) noexcept
+{
+    auto slot = static_cast<uint32_t>(
+        capro::hashServiceDescription(m_serviceDescriptions[index]->serviceDescription) % HASH_TABLE_SIZE);
+    for (uint32_t probe = 0U; probe < HASH_TABLE_SIZE; ++probe)
+    {
+        if (m_hashTable[slot] == NO_INDEX || m_hashTable[slot] == DELETED_INDEX)
+        {
+            if (m_hashTable[slot] == DELETED_INDEX)
+            {
+                --m_deletedSlots;
+            }
+            m_hashTable[slot] = index;
+            return;
+        }
+        slot = (slot + 1U) % HASH_TABLE_SIZE;
+    }
+}
+
+void ServiceRegistry::rebuildHashTable() noexcept
+{
+    for (auto& slot : m_hashTable)
+    {
+        slot = NO_INDEX;
+    }
+    m_deletedSlots = 0U;
+
+    for (uint32_t i = 0U; i < m_serviceDescriptions.size(); ++i)
+    {
+        if (m_serviceDescriptions[i])
+        {
+            insertIntoHashTable(i);
+        }
+    }
+}
+
+const capro::IdString_t& ServiceRegistry::fieldOf(const capro::ServiceDescription& serviceDescription,
+                                                  const Field field) noexcept
+{
+    switch (field)
+    {
+    case INSTANCE:
+        return serviceDescription.getInstanceIDString();
+    case EVENT:
+        return serviceDescription.getEventIDString();
+    default:
+        return serviceDescription.getServiceIDString();
+    }
+}
+
+uint32_t ServiceRegistry::bucketOf(const capro::IdString_t& value) noexcept
+{
+    return static_cast<uint32_t>(capro::hashIdString(value) % CAPACITY);
+}
+
 } // namespace roudi
 } // namespace iox
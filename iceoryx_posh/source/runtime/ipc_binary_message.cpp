@@ -0,0 +1,548 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_interface_base.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace iox
+{
+namespace runtime
+{
+static_assert(std::is_trivially_copyable<IpcPublisherRequestHeader>::value, "the header is copied as raw bytes");
+static_assert(std::is_trivially_copyable<IpcSubscriberRequestHeader>::value, "the header is copied as raw bytes");
+static_assert(std::is_trivially_copyable<IpcClientRequestHeader>::value, "the header is copied as raw bytes");
+static_assert(std::is_trivially_copyable<IpcServerRequestHeader>::value, "the header is copied as raw bytes");
+static_assert(capro::IdString_t::capacity() <= std::numeric_limits<uint8_t>::max(), "the length is sent as uint8_t");
+static_assert(NodeName_t::capacity() <= std::numeric_limits<uint8_t>::max(), "the length is sent as uint8_t");
+
+namespace
+{
+constexpr char HEX_DIGITS[] = "0123456789abcdef";
+constexpr int8_t INVALID_HEX_DIGIT{-1};
+
+int8_t hexDigitValue(const char c) noexcept
+{
+    if (c >= '0' && c <= '9')
+    {
+        return static_cast<int8_t>(c - '0');
+    }
+    if (c >= 'a' && c <= 'f')
+    {
+        return static_cast<int8_t>(c - 'a' + 10);
+    }
+    return INVALID_HEX_DIGIT;
+}
+
+/// @brief the members every request header starts with
+struct IpcRequestHeaderPrefix
+{
+    uint32_t protocolVersion;
+    int32_t messageType;
+};
+
+template <typename Header>
+constexpr bool startsWithPrefix() noexcept
+{
+    return offsetof(Header, protocolVersion) == offsetof(IpcRequestHeaderPrefix, protocolVersion)
+           && offsetof(Header, messageType) == offsetof(IpcRequestHeaderPrefix, messageType);
+}
+static_assert(startsWithPrefix<IpcPublisherRequestHeader>(), "the message type must be readable from the prefix");
+static_assert(startsWithPrefix<IpcSubscriberRequestHeader>(), "the message type must be readable from the prefix");
+static_assert(startsWithPrefix<IpcClientRequestHeader>(), "the message type must be readable from the prefix");
+static_assert(startsWithPrefix<IpcServerRequestHeader>(), "the message type must be readable from the prefix");
+
+/// @brief decodes the first 2 * size hex digits of the entry, the entry must have at least that size
+bool decodeHex(const std::string& entry, uint8_t* bytes, const uint64_t size) noexcept
+{
+    for (uint64_t i = 0U; i < size; ++i)
+    {
+        const auto high = hexDigitValue(entry[2U * i]);
+        const auto low = hexDigitValue(entry[2U * i + 1U]);
+        if (high == INVALID_HEX_DIGIT || low == INVALID_HEX_DIGIT)
+        {
+            return false;
+        }
+        bytes[i] = static_cast<uint8_t>((static_cast<uint8_t>(high) << 4U) | static_cast<uint8_t>(low));
+    }
+    return true;
+}
+
+// the capacity of an entry covers the largest header and all strings, hence the appends below never truncate
+template <typename Header>
+void appendHeader(IpcRequestEntry_t& entry, const Header& header) noexcept
+{
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&header);
+    for (uint64_t i = 0U; i < sizeof(Header); ++i)
+    {
+        entry.append(cxx::TruncateToCapacity, HEX_DIGITS[bytes[i] >> 4U]);
+        entry.append(cxx::TruncateToCapacity, HEX_DIGITS[bytes[i] & 0x0FU]);
+    }
+}
+
+template <uint64_t Capacity>
+void appendString(IpcRequestEntry_t& entry, const cxx::string<Capacity>& value) noexcept
+{
+    entry.append(cxx::TruncateToCapacity, value);
+}
+
+template <uint64_t Capacity>
+cxx::string<Capacity> readString(const std::string& entry, uint64_t& position, const uint8_t length) noexcept
+{
+    cxx::string<Capacity> value(cxx::TruncateToCapacity, entry.data() + position, length);
+    position += length;
+    return value;
+}
+
+void setServiceDescriptionHeader(IpcServiceDescriptionHeader& header,
+                                 const capro::ServiceDescription& serviceDescription) noexcept
+{
+    const auto classHash = serviceDescription.getClassHash();
+    for (uint64_t i = 0U; i < capro::CLASS_HASH_ELEMENT_COUNT; ++i)
+    {
+        header.classHash[i] = classHash[i];
+    }
+    header.scope = static_cast<uint16_t>(serviceDescription.getScope());
+    header.interfaceSource = static_cast<uint16_t>(serviceDescription.getSourceInterface());
+    header.serviceLength = static_cast<uint8_t>(serviceDescription.getServiceIDString().size());
+    header.instanceLength = static_cast<uint8_t>(serviceDescription.getInstanceIDString().size());
+    header.eventLength = static_cast<uint8_t>(serviceDescription.getEventIDString().size());
+}
+
+void appendServiceDescriptionStrings(IpcRequestEntry_t& entry, const capro::ServiceDescription& serviceDescription) noexcept
+{
+    appendString(entry, serviceDescription.getServiceIDString());
+    appendString(entry, serviceDescription.getInstanceIDString());
+    appendString(entry, serviceDescription.getEventIDString());
+}
+
+bool isValid(const IpcServiceDescriptionHeader& header) noexcept
+{
+    return header.scope <= static_cast<uint16_t>(capro::Scope::LOCAL)
+           && header.interfaceSource < static_cast<uint16_t>(capro::Interfaces::INTERFACE_END)
+           && header.serviceLength <= capro::IdString_t::capacity()
+           && header.instanceLength <= capro::IdString_t::capacity()
+           && header.eventLength <= capro::IdString_t::capacity();
+}
+
+uint64_t stringsLength(const IpcServiceDescriptionHeader& header) noexcept
+{
+    return static_cast<uint64_t>(header.serviceLength) + header.instanceLength + header.eventLength;
+}
+
+capro::ServiceDescription
+readServiceDescription(const IpcServiceDescriptionHeader& header, const std::string& entry, uint64_t& position) noexcept
+{
+    capro::ServiceDescription::ClassHash classHash;
+    for (uint64_t i = 0U; i < capro::CLASS_HASH_ELEMENT_COUNT; ++i)
+    {
+        classHash[i] = header.classHash[i];
+    }
+    auto service = readString<capro::IdString_t::capacity()>(entry, position, header.serviceLength);
+    auto instance = readString<capro::IdString_t::capacity()>(entry, position, header.instanceLength);
+    auto event = readString<capro::IdString_t::capacity()>(entry, position, header.eventLength);
+    capro::ServiceDescription serviceDescription(
+        service, instance, event, classHash, static_cast<capro::Interfaces>(header.interfaceSource));
+    if (static_cast<capro::Scope>(header.scope) == capro::Scope::LOCAL)
+    {
+        serviceDescription.setLocal();
+    }
+    return serviceDescription;
+}
+
+void setPortConfigInfoHeader(IpcPortConfigInfoHeader& header, const PortConfigInfo& portConfigInfo) noexcept
+{
+    header.portType = portConfigInfo.portType;
+    header.deviceId = portConfigInfo.memoryInfo.deviceId;
+    header.memoryType = portConfigInfo.memoryInfo.memoryType;
+}
+
+PortConfigInfo toPortConfigInfo(const IpcPortConfigInfoHeader& header) noexcept
+{
+    return PortConfigInfo(header.portType, header.deviceId, header.memoryType);
+}
+
+/// @brief decodes the header and verifies everything which is common to all requests, the caller has to verify
+///        the request specific values
+template <typename Header>
+cxx::expected<Header, IpcBinaryMessageError> readHeader(const std::string& entry,
+                                                        const IpcMessageType expectedMessageType) noexcept
+{
+    constexpr uint64_t ENCODED_HEADER_SIZE{2U * sizeof(Header)};
+    if (entry.size() < ENCODED_HEADER_SIZE)
+    {
+        return cxx::error<IpcBinaryMessageError>(IpcBinaryMessageError::INVALID_SIZE);
+    }
+
+    Header header;
+    if (!decodeHex(entry, reinterpret_cast<uint8_t*>(&header), sizeof(Header)))
+    {
+        return cxx::error<IpcBinaryMessageError>(IpcBinaryMessageError::INVALID_ENCODING);
+    }
+
+    if (header.protocolVersion != IPC_BINARY_PROTOCOL_VERSION)
+    {
+        return cxx::error<IpcBinaryMessageError>(IpcBinaryMessageError::PROTOCOL_VERSION_MISMATCH);
+    }
+
+    if (header.messageType != static_cast<int32_t>(expectedMessageType) || !isValid(header.service)
+        || header.nodeNameLength > NodeName_t::capacity())
+    {
+        return cxx::error<IpcBinaryMessageError>(IpcBinaryMessageError::INVALID_CONTENT);
+    }
+
+    if (entry.size() != ENCODED_HEADER_SIZE + stringsLength(header.service) + header.nodeNameLength)
+    {
+        return cxx::error<IpcBinaryMessageError>(IpcBinaryMessageError::INVALID_SIZE);
+    }
+
+    return cxx::success<Header>(header);
+}
+
+template <typename Header>
+Header createHeader(const IpcMessageType messageType) noexcept
+{
+    Header header;
+    // zero the padding bytes, otherwise uninitialized memory would be sent to RouDi
+    std::memset(&header, 0, sizeof(header));
+    header.protocolVersion = IPC_BINARY_PROTOCOL_VERSION;
+    header.messageType = static_cast<int32_t>(messageType);
+    return header;
+}
+
+bool isValidPolicy(const uint8_t policy) noexcept
+{
+    static_assert(static_cast<uint8_t>(popo::QueueFullPolicy::DISCARD_OLDEST_DATA)
+                      == static_cast<uint8_t>(popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA),
+                  "both policies are expected to have the same range");
+    return policy <= static_cast<uint8_t>(popo::QueueFullPolicy::DISCARD_OLDEST_DATA);
+}
+} // namespace
+
+cxx::expected<int32_t, IpcBinaryMessageError> getBinaryRequestMessageType(const std::string& entry) noexcept
+{
+    IpcRequestHeaderPrefix prefix;
+    if (entry.size() < 2U * sizeof(IpcRequestHeaderPrefix))
+    {
+        return cxx::error<IpcBinaryMessageError>(IpcBinaryMessageError::INVALID_SIZE);
+    }
+    if (!decodeHex(entry, reinterpret_cast<uint8_t*>(&prefix), sizeof(IpcRequestHeaderPrefix)))
+    {
+        return cxx::error<IpcBinaryMessageError>(IpcBinaryMessageError::INVALID_ENCODING);
+    }
+    if (prefix.protocolVersion != IPC_BINARY_PROTOCOL_VERSION)
+    {
+        return cxx::error<IpcBinaryMessageError>(IpcBinaryMessageError::PROTOCOL_VERSION_MISMATCH);
+    }
+    return cxx::success<int32_t>(prefix.messageType);
+}
+
+IpcPublisherRequest::IpcPublisherRequest(const capro::ServiceDescription& serviceDescription,
+                                         const popo::PublisherOptions& publisherOptions,
+                                         const PortConfigInfo& portConfigInfo) noexcept
+    : m_serviceDescription(serviceDescription)
+    , m_publisherOptions(publisherOptions)
+    , m_portConfigInfo(portConfigInfo)
+{
+}
+
+cxx::expected<IpcPublisherRequest, IpcBinaryMessageError>
+IpcPublisherRequest::fromEntry(const std::string& entry) noexcept
+{
+    auto result = readHeader<IpcPublisherRequestHeader>(entry, IpcMessageType::CREATE_PUBLISHER_BINARY);
+    if (result.has_error())
+    {
+        return cxx::error<IpcBinaryMessageError>(result.get_error());
+    }
+
+    const auto& header = result.value();
+    if (!isValidPolicy(header.subscriberTooSlowPolicy))
+    {
+        return cxx::error<IpcBinaryMessageError>(IpcBinaryMessageError::INVALID_CONTENT);
+    }
+
+    uint64_t position{2U * sizeof(IpcPublisherRequestHeader)};
+    auto serviceDescription = readServiceDescription(header.service, entry, position);
+
+    popo::PublisherOptions publisherOptions;
+    publisherOptions.historyCapacity = header.historyCapacity;
+    publisherOptions.nodeName = readString<NodeName_t::capacity()>(entry, position, header.nodeNameLength);
+    publisherOptions.offerOnCreate = (header.offerOnCreate != 0U);
+    publisherOptions.subscriberTooSlowPolicy = static_cast<popo::ConsumerTooSlowPolicy>(header.subscriberTooSlowPolicy);
+    publisherOptions.waitForConsumerTimeout =
+        units::Duration::fromNanoseconds(header.waitForConsumerTimeoutInNanoseconds);
+    publisherOptions.publishTimestamp = (header.publishTimestamp != 0U);
+
+    return cxx::success<IpcPublisherRequest>(
+        IpcPublisherRequest(serviceDescription, publisherOptions, toPortConfigInfo(header.portConfigInfo)));
+}
+
+IpcRequestEntry_t IpcPublisherRequest::toEntry() const noexcept
+{
+    auto header = createHeader<IpcPublisherRequestHeader>(IpcMessageType::CREATE_PUBLISHER_BINARY);
+    setServiceDescriptionHeader(header.service, m_serviceDescription);
+    setPortConfigInfoHeader(header.portConfigInfo, m_portConfigInfo);
+    header.historyCapacity = m_publisherOptions.historyCapacity;
+    header.waitForConsumerTimeoutInNanoseconds = m_publisherOptions.waitForConsumerTimeout.toNanoseconds();
+    header.nodeNameLength = static_cast<uint8_t>(m_publisherOptions.nodeName.size());
+    header.offerOnCreate = static_cast<uint8_t>(m_publisherOptions.offerOnCreate ? 1U : 0U);
+    header.subscriberTooSlowPolicy = static_cast<uint8_t>(m_publisherOptions.subscriberTooSlowPolicy);
+    header.publishTimestamp = static_cast<uint8_t>(m_publisherOptions.publishTimestamp ? 1U : 0U);
+
+    IpcRequestEntry_t entry;
+    appendHeader(entry, header);
+    appendServiceDescriptionStrings(entry, m_serviceDescription);
+    appendString(entry, m_publisherOptions.nodeName);
+    return entry;
+}
+
+const capro::ServiceDescription& IpcPublisherRequest::serviceDescription() const noexcept
+{
+    return m_serviceDescription;
+}
+
+const popo::PublisherOptions& IpcPublisherRequest::publisherOptions() const noexcept
+{
+    return m_publisherOptions;
+}
+
+const PortConfigInfo& IpcPublisherRequest::portConfigInfo() const noexcept
+{
+    return m_portConfigInfo;
+}
+
+IpcSubscriberRequest::IpcSubscriberRequest(const capro::ServiceDescription& serviceDescription,
+                                           const popo::SubscriberOptions& subscriberOptions,
+                                           const PortConfigInfo& portConfigInfo) noexcept
+    : m_serviceDescription(serviceDescription)
+    , m_subscriberOptions(subscriberOptions)
+    , m_portConfigInfo(portConfigInfo)
+{
+}
+
+cxx::expected<IpcSubscriberRequest, IpcBinaryMessageError>
+IpcSubscriberRequest::fromEntry(const std::string& entry) noexcept
+{
+    auto result = readHeader<IpcSubscriberRequestHeader>(entry, IpcMessageType::CREATE_SUBSCRIBER_BINARY);
+    if (result.has_error())
+    {
+        return cxx::error<IpcBinaryMessageError>(result.get_error());
+    }
+
+    const auto& header = result.value();
+    if (!isValidPolicy(header.queueFullPolicy))
+    {
+        return cxx::error<IpcBinaryMessageError>(IpcBinaryMessageError::INVALID_CONTENT);
+    }
+
+    uint64_t position{2U * sizeof(IpcSubscriberRequestHeader)};
+    auto serviceDescription = readServiceDescription(header.service, entry, position);
+
+    popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.queueCapacity = header.queueCapacity;
+    subscriberOptions.historyRequest = header.historyRequest;
+    subscriberOptions.nodeName = readString<NodeName_t::capacity()>(entry, position, header.nodeNameLength);
+    subscriberOptions.subscribeOnCreate = (header.subscribeOnCreate != 0U);
+    subscriberOptions.queueFullPolicy = static_cast<popo::QueueFullPolicy>(header.queueFullPolicy);
+    subscriberOptions.requiresPublisherHistorySupport = (header.requiresPublisherHistorySupport != 0U);
+    subscriberOptions.recordLatency = (header.recordLatency != 0U);
+
+    return cxx::success<IpcSubscriberRequest>(
+        IpcSubscriberRequest(serviceDescription, subscriberOptions, toPortConfigInfo(header.portConfigInfo)));
+}
+
+IpcRequestEntry_t IpcSubscriberRequest::toEntry() const noexcept
+{
+    auto header = createHeader<IpcSubscriberRequestHeader>(IpcMessageType::CREATE_SUBSCRIBER_BINARY);
+    setServiceDescriptionHeader(header.service, m_serviceDescription);
+    setPortConfigInfoHeader(header.portConfigInfo, m_portConfigInfo);
+    header.queueCapacity = m_subscriberOptions.queueCapacity;
+    header.historyRequest = m_subscriberOptions.historyRequest;
+    header.nodeNameLength = static_cast<uint8_t>(m_subscriberOptions.nodeName.size());
+    header.subscribeOnCreate = static_cast<uint8_t>(m_subscriberOptions.subscribeOnCreate ? 1U : 0U);
+    header.queueFullPolicy = static_cast<uint8_t>(m_subscriberOptions.queueFullPolicy);
+    header.requiresPublisherHistorySupport =
+        static_cast<uint8_t>(m_subscriberOptions.requiresPublisherHistorySupport ? 1U : 0U);
+    header.recordLatency = static_cast<uint8_t>(m_subscriberOptions.recordLatency ? 1U : 0U);
+
+    IpcRequestEntry_t entry;
+    appendHeader(entry, header);
+    appendServiceDescriptionStrings(entry, m_serviceDescription);
+    appendString(entry, m_subscriberOptions.nodeName);
+    return entry;
+}
+
+const capro::ServiceDescription& IpcSubscriberRequest::serviceDescription() const noexcept
+{
+    return m_serviceDescription;
+}
+
+const popo::SubscriberOptions& IpcSubscriberRequest::subscriberOptions() const noexcept
+{
+    return m_subscriberOptions;
+}
+
+const PortConfigInfo& IpcSubscriberRequest::portConfigInfo() const noexcept
+{
+    return m_portConfigInfo;
+}
+
+IpcClientRequest::IpcClientRequest(const capro::ServiceDescription& serviceDescription,
+                                   const popo::ClientOptions& clientOptions,
+                                   const PortConfigInfo& portConfigInfo) noexcept
+    : m_serviceDescription(serviceDescription)
+    , m_clientOptions(clientOptions)
+    , m_portConfigInfo(portConfigInfo)
+{
+}
+
+cxx::expected<IpcClientRequest, IpcBinaryMessageError> IpcClientRequest::fromEntry(const std::string& entry) noexcept
+{
+    auto result = readHeader<IpcClientRequestHeader>(entry, IpcMessageType::CREATE_CLIENT_BINARY);
+    if (result.has_error())
+    {
+        return cxx::error<IpcBinaryMessageError>(result.get_error());
+    }
+
+    const auto& header = result.value();
+    if (!isValidPolicy(header.responseQueueFullPolicy) || !isValidPolicy(header.serverTooSlowPolicy))
+    {
+        return cxx::error<IpcBinaryMessageError>(IpcBinaryMessageError::INVALID_CONTENT);
+    }
+
+    uint64_t position{2U * sizeof(IpcClientRequestHeader)};
+    auto serviceDescription = readServiceDescription(header.service, entry, position);
+
+    popo::ClientOptions clientOptions;
+    clientOptions.responseQueueCapacity = header.responseQueueCapacity;
+    clientOptions.nodeName = readString<NodeName_t::capacity()>(entry, position, header.nodeNameLength);
+    clientOptions.connectOnCreate = (header.connectOnCreate != 0U);
+    clientOptions.responseQueueFullPolicy = static_cast<popo::QueueFullPolicy>(header.responseQueueFullPolicy);
+    clientOptions.serverTooSlowPolicy = static_cast<popo::ConsumerTooSlowPolicy>(header.serverTooSlowPolicy);
+
+    return cxx::success<IpcClientRequest>(
+        IpcClientRequest(serviceDescription, clientOptions, toPortConfigInfo(header.portConfigInfo)));
+}
+
+IpcRequestEntry_t IpcClientRequest::toEntry() const noexcept
+{
+    auto header = createHeader<IpcClientRequestHeader>(IpcMessageType::CREATE_CLIENT_BINARY);
+    setServiceDescriptionHeader(header.service, m_serviceDescription);
+    setPortConfigInfoHeader(header.portConfigInfo, m_portConfigInfo);
+    header.responseQueueCapacity = m_clientOptions.responseQueueCapacity;
+    header.nodeNameLength = static_cast<uint8_t>(m_clientOptions.nodeName.size());
+    header.connectOnCreate = static_cast<uint8_t>(m_clientOptions.connectOnCreate ? 1U : 0U);
+    header.responseQueueFullPolicy = static_cast<uint8_t>(m_clientOptions.responseQueueFullPolicy);
+    header.serverTooSlowPolicy = static_cast<uint8_t>(m_clientOptions.serverTooSlowPolicy);
+
+    IpcRequestEntry_t entry;
+    appendHeader(entry, header);
+    appendServiceDescriptionStrings(entry, m_serviceDescription);
+    appendString(entry, m_clientOptions.nodeName);
+    return entry;
+}
+
+const capro::ServiceDescription& IpcClientRequest::serviceDescription() const noexcept
+{
+    return m_serviceDescription;
+}
+
+const popo::ClientOptions& IpcClientRequest::clientOptions() const noexcept
+{
+    return m_clientOptions;
+}
+
+const PortConfigInfo& IpcClientRequest::portConfigInfo() const noexcept
+{
+    return m_portConfigInfo;
+}
+
+IpcServerRequest::IpcServerRequest(const capro::ServiceDescription& serviceDescription,
+                                   const popo::ServerOptions& serverOptions,
+                                   const PortConfigInfo& portConfigInfo) noexcept
+    : m_serviceDescription(serviceDescription)
+    , m_serverOptions(serverOptions)
+    , m_portConfigInfo(portConfigInfo)
+{
+}
+
+cxx::expected<IpcServerRequest, IpcBinaryMessageError> IpcServerRequest::fromEntry(const std::string& entry) noexcept
+{
+    auto result = readHeader<IpcServerRequestHeader>(entry, IpcMessageType::CREATE_SERVER_BINARY);
+    if (result.has_error())
+    {
+        return cxx::error<IpcBinaryMessageError>(result.get_error());
+    }
+
+    const auto& header = result.value();
+    if (!isValidPolicy(header.requestQueueFullPolicy) || !isValidPolicy(header.clientTooSlowPolicy))
+    {
+        return cxx::error<IpcBinaryMessageError>(IpcBinaryMessageError::INVALID_CONTENT);
+    }
+
+    uint64_t position{2U * sizeof(IpcServerRequestHeader)};
+    auto serviceDescription = readServiceDescription(header.service, entry, position);
+
+    popo::ServerOptions serverOptions;
+    serverOptions.requestQueueCapacity = header.requestQueueCapacity;
+    serverOptions.nodeName = readString<NodeName_t::capacity()>(entry, position, header.nodeNameLength);
+    serverOptions.offerOnCreate = (header.offerOnCreate != 0U);
+    serverOptions.requestQueueFullPolicy = static_cast<popo::QueueFullPolicy>(header.requestQueueFullPolicy);
+    serverOptions.clientTooSlowPolicy = static_cast<popo::ConsumerTooSlowPolicy>(header.clientTooSlowPolicy);
+
+    return cxx::success<IpcServerRequest>(
+        IpcServerRequest(serviceDescription, serverOptions, toPortConfigInfo(header.portConfigInfo)));
+}
+
+IpcRequestEntry_t IpcServerRequest::toEntry() const noexcept
+{
+    auto header = createHeader<IpcServerRequestHeader>(IpcMessageType::CREATE_SERVER_BINARY);
+    setServiceDescriptionHeader(header.service, m_serviceDescription);
+    setPortConfigInfoHeader(header.portConfigInfo, m_portConfigInfo);
+    header.requestQueueCapacity = m_serverOptions.requestQueueCapacity;
+    header.nodeNameLength = static_cast<uint8_t>(m_serverOptions.nodeName.size());
+    header.offerOnCreate = static_cast<uint8_t>(m_serverOptions.offerOnCreate ? 1U : 0U);
+    header.requestQueueFullPolicy = static_cast<uint8_t>(m_serverOptions.requestQueueFullPolicy);
+    header.clientTooSlowPolicy = static_cast<uint8_t>(m_serverOptions.clientTooSlowPolicy);
+
+    IpcRequestEntry_t entry;
+    appendHeader(entry, header);
+    appendServiceDescriptionStrings(entry, m_serviceDescription);
+    appendString(entry, m_serverOptions.nodeName);
+    return entry;
+}
+
+const capro::ServiceDescription& IpcServerRequest::serviceDescription() const noexcept
+{
+    return m_serviceDescription;
+}
+
+const popo::ServerOptions& IpcServerRequest::serverOptions() const noexcept
+{
+    return m_serverOptions;
+}
+
+const PortConfigInfo& IpcServerRequest::portConfigInfo() const noexcept
+{
+    return m_portConfigInfo;
+}
+
+} // namespace runtime
+} // namespace iox
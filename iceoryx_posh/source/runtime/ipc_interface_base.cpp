@@ -59,6 +59,9 @@ std::string IpcMessageErrorTypeToString(const IpcMessageErrorType msg) noexcept
     return cxx::convert::toString(static_cast<std::underlying_type<IpcMessageErrorType>::type>(msg));
 }
 
+template <typename IpcChannelType>
+constexpr uint64_t IpcInterface<IpcChannelType>::MAX_MESSAGE_SIZE;
+
 template <typename IpcChannelType>
 IpcInterface<IpcChannelType>::IpcInterface(const RuntimeName_t& runtimeName,
                                            const uint64_t maxMessages,
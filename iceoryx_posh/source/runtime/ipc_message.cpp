@@ -45,19 +45,19 @@ uint32_t IpcMessage::getNumberOfElements() const noexcept
 
 std::string IpcMessage::getElementAtIndex(const uint32_t index) const noexcept
 {
-    std::string messageRemainder(m_msg);
+    // the message is scanned in place, only the requested element is copied
     size_t startPos = 0u;
-    size_t endPos = messageRemainder.find_first_of(m_separator, startPos);
+    size_t endPos = m_msg.find(m_separator, startPos);
 
     for (uint32_t counter = 0u; endPos != std::string::npos; ++counter)
     {
         if (counter == index)
         {
-            return messageRemainder.substr(startPos, endPos - startPos);
+            return m_msg.substr(startPos, endPos - startPos);
         }
 
         startPos = endPos + 1u;
-        endPos = messageRemainder.find_first_of(m_separator, startPos);
+        endPos = m_msg.find(m_separator, startPos);
     }
 
     return std::string();
@@ -31,9 +31,9 @@ IpcRuntimeInterface::IpcRuntimeInterface(const RuntimeName_t& roudiName,
                                          const RuntimeName_t& runtimeName,
                                          const units::Duration roudiWaitingTimeout) noexcept
     : m_runtimeName(runtimeName)
-    , m_RoudiIpcInterface(roudiName)
+    , m_RoudiIpcInterface(roudiName, APP_MAX_MESSAGES, IpcInterfaceBase::MAX_MESSAGE_SIZE)
 {
-    m_AppIpcInterface.emplace(runtimeName);
+    m_AppIpcInterface.emplace(runtimeName, APP_MAX_MESSAGES, IpcInterfaceBase::MAX_MESSAGE_SIZE);
     if (!m_AppIpcInterface->isInitialized())
     {
         errorHandler(PoshError::IPC_INTERFACE__UNABLE_TO_CREATE_APPLICATION_CHANNEL);
@@ -226,8 +226,11 @@ IpcRuntimeInterface::RegAckResult IpcRuntimeInterface::waitForRegAck(int64_t tra
 
             if (stringToIpcMessageType(cmd.c_str()) == IpcMessageType::REG_ACK)
             {
+                // a RouDi which supports the binary port requests announces its protocol version as last parameter
                 constexpr uint32_t REGISTER_ACK_PARAMETERS = 6U;
-                if (receiveBuffer.getNumberOfElements() != REGISTER_ACK_PARAMETERS)
+                constexpr uint32_t REGISTER_ACK_PARAMETERS_WITH_BINARY_PROTOCOL = 7U;
+                if (receiveBuffer.getNumberOfElements() != REGISTER_ACK_PARAMETERS
+                    && receiveBuffer.getNumberOfElements() != REGISTER_ACK_PARAMETERS_WITH_BINARY_PROTOCOL)
                 {
                     errorHandler(PoshError::IPC_INTERFACE__REG_ACK_INVALIG_NUMBER_OF_PARAMS);
                 }
@@ -242,6 +245,11 @@ IpcRuntimeInterface::RegAckResult IpcRuntimeInterface::waitForRegAck(int64_t tra
                 cxx::convert::fromString(receiveBuffer.getElementAtIndex(3U).c_str(), receivedTimestamp);
                 cxx::convert::fromString(receiveBuffer.getElementAtIndex(4U).c_str(), m_segmentId);
                 cxx::convert::fromString(receiveBuffer.getElementAtIndex(5U).c_str(), m_sendKeepalive);
+                m_binaryProtocolVersion = IPC_BINARY_PROTOCOL_UNSUPPORTED;
+                if (receiveBuffer.getNumberOfElements() == REGISTER_ACK_PARAMETERS_WITH_BINARY_PROTOCOL)
+                {
+                    cxx::convert::fromString(receiveBuffer.getElementAtIndex(6U).c_str(), m_binaryProtocolVersion);
+                }
                 if (transmissionTimestamp == receivedTimestamp)
                 {
                     return RegAckResult::SUCCESS;
@@ -265,5 +273,10 @@ uint64_t IpcRuntimeInterface::getSegmentId() const noexcept
 {
     return m_segmentId;
 }
+
+uint32_t IpcRuntimeInterface::getBinaryProtocolVersion() const noexcept
+{
+    return m_binaryProtocolVersion;
+}
 } // namespace runtime
 } // namespace iox
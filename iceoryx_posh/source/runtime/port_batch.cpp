@@ -0,0 +1,99 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/runtime/port_batch.hpp"
+
+namespace iox
+{
+namespace runtime
+{
+template <typename Options>
+cxx::expected<uint64_t, PortBatchError> PortBatch::addRequest(const capro::ServiceDescription& service,
+                                                              const Options& options,
+                                                              const PortConfigInfo& portConfigInfo) noexcept
+{
+    if (!m_requests.push_back({service, Options_t(cxx::in_place_type<Options>(), options), portConfigInfo, nullptr}))
+    {
+        return cxx::error<PortBatchError>(PortBatchError::BATCH_FULL);
+    }
+    return cxx::success<uint64_t>(m_requests.size() - 1U);
+}
+
+template <typename PortData, typename Options>
+PortData* PortBatch::getPort(const uint64_t index) const noexcept
+{
+    if (index >= m_requests.size() || m_requests[index].options.template get<Options>() == nullptr)
+    {
+        return nullptr;
+    }
+    return static_cast<PortData*>(m_requests[index].port);
+}
+
+cxx::expected<uint64_t, PortBatchError> PortBatch::addPublisher(const capro::ServiceDescription& service,
+                                                                const popo::PublisherOptions& publisherOptions,
+                                                                const PortConfigInfo& portConfigInfo) noexcept
+{
+    return addRequest(service, publisherOptions, portConfigInfo);
+}
+
+cxx::expected<uint64_t, PortBatchError> PortBatch::addSubscriber(const capro::ServiceDescription& service,
+                                                                 const popo::SubscriberOptions& subscriberOptions,
+                                                                 const PortConfigInfo& portConfigInfo) noexcept
+{
+    return addRequest(service, subscriberOptions, portConfigInfo);
+}
+
+cxx::expected<uint64_t, PortBatchError> PortBatch::addClient(const capro::ServiceDescription& service,
+                                                             const popo::ClientOptions& clientOptions,
+                                                             const PortConfigInfo& portConfigInfo) noexcept
+{
+    return addRequest(service, clientOptions, portConfigInfo);
+}
+
+cxx::expected<uint64_t, PortBatchError> PortBatch::addServer(const capro::ServiceDescription& service,
+                                                             const popo::ServerOptions& serverOptions,
+                                                             const PortConfigInfo& portConfigInfo) noexcept
+{
+    return addRequest(service, serverOptions, portConfigInfo);
+}
+
+uint64_t PortBatch::size() const noexcept
+{
+    return m_requests.size();
+}
+
+popo::PublisherPortData* PortBatch::getPublisher(const uint64_t index) const noexcept
+{
+    return getPort<popo::PublisherPortData, popo::PublisherOptions>(index);
+}
+
+popo::SubscriberPortData* PortBatch::getSubscriber(const uint64_t index) const noexcept
+{
+    return getPort<popo::SubscriberPortData, popo::SubscriberOptions>(index);
+}
+
+popo::ClientPortData* PortBatch::getClient(const uint64_t index) const noexcept
+{
+    return getPort<popo::ClientPortData, popo::ClientOptions>(index);
+}
+
+popo::ServerPortData* PortBatch::getServer(const uint64_t index) const noexcept
+{
+    return getPort<popo::ServerPortData, popo::ServerOptions>(index);
+}
+
+} // namespace runtime
+} // namespace iox
@@ -24,6 +24,7 @@
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_message.hpp"
 #include "iceoryx_posh/runtime/node.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
@@ -78,10 +79,8 @@ PoshRuntimeImpl::~PoshRuntimeImpl() noexcept
     }
 }
 
-PublisherPortUserType::MemberType_t*
-PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service,
-                                        const popo::PublisherOptions& publisherOptions,
-                                        const PortConfigInfo& portConfigInfo) noexcept
+popo::PublisherOptions
+PoshRuntimeImpl::preparePublisherOptions(const popo::PublisherOptions& publisherOptions) const noexcept
 {
     constexpr uint64_t MAX_HISTORY_CAPACITY =
         PublisherPortUserType::MemberType_t::ChunkSenderData_t::ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY;
@@ -100,49 +99,73 @@ PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service
         options.nodeName = m_appName;
     }
 
+    return options;
+}
+
+void PoshRuntimeImpl::reportPublisherError(const capro::ServiceDescription& service,
+                                           const IpcMessageErrorType error) const noexcept
+{
+    switch (error)
+    {
+    case IpcMessageErrorType::NO_UNIQUE_CREATED:
+        LogWarn() << "Service '" << service << "' already in use by another process.";
+        errorHandler(PoshError::POSH__RUNTIME_PUBLISHER_PORT_NOT_UNIQUE, iox::ErrorLevel::SEVERE);
+        break;
+    case IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
+        LogWarn() << "Usage of internal service '" << service << "' is forbidden.";
+        errorHandler(PoshError::POSH__RUNTIME_SERVICE_DESCRIPTION_FORBIDDEN, iox::ErrorLevel::SEVERE);
+        break;
+    case IpcMessageErrorType::PUBLISHER_LIST_FULL:
+        LogWarn() << "Service '" << service << "' could not be created since we are out of memory for publishers.";
+        errorHandler(PoshError::POSH__RUNTIME_ROUDI_PUBLISHER_LIST_FULL, iox::ErrorLevel::SEVERE);
+        break;
+    case IpcMessageErrorType::REQUEST_PUBLISHER_INVALID_RESPONSE:
+        LogWarn() << "Service '" << service << "' could not be created. Request publisher got invalid response.";
+        errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_PUBLISHER_INVALID_RESPONSE, iox::ErrorLevel::SEVERE);
+        break;
+    case IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE:
+        LogWarn() << "Service '" << service
+                  << "' could not be created. Request publisher got wrong IPC channel response.";
+        errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE,
+                     iox::ErrorLevel::SEVERE);
+        break;
+    case IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT:
+        LogWarn() << "Service '" << service
+                  << "' could not be created. RouDi did not find a writable shared memory segment for the current "
+                     "user. Try using another user or adapt RouDi's config.";
+        errorHandler(PoshError::POSH__RUNTIME_NO_WRITABLE_SHM_SEGMENT, iox::ErrorLevel::SEVERE);
+        break;
+    default:
+        LogWarn() << "Unknown error occurred while creating service '" << service << "'.";
+        errorHandler(PoshError::POSH__RUNTIME_PUBLISHER_PORT_CREATION_UNKNOWN_ERROR, iox::ErrorLevel::SEVERE);
+        break;
+    }
+}
+
+PublisherPortUserType::MemberType_t*
+PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service,
+                                        const popo::PublisherOptions& publisherOptions,
+                                        const PortConfigInfo& portConfigInfo) noexcept
+{
+    auto options = preparePublisherOptions(publisherOptions);
+
     IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_PUBLISHER) << m_appName
-               << static_cast<cxx::Serialization>(service).toString() << publisherOptions.serialize().toString()
-               << static_cast<cxx::Serialization>(portConfigInfo).toString();
+    if (isBinaryProtocolSupported())
+    {
+        sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_PUBLISHER_BINARY) << m_appName
+                   << IpcPublisherRequest(service, options, portConfigInfo).toEntry();
+    }
+    else
+    {
+        sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_PUBLISHER) << m_appName
+                   << static_cast<cxx::Serialization>(service).toString() << publisherOptions.serialize().toString()
+                   << static_cast<cxx::Serialization>(portConfigInfo).toString();
+    }
 
     auto maybePublisher = requestPublisherFromRoudi(sendBuffer);
     if (maybePublisher.has_error())
     {
-        switch (maybePublisher.get_error())
-        {
-        case IpcMessageErrorType::NO_UNIQUE_CREATED:
-            LogWarn() << "Service '" << service << "' already in use by another process.";
-            errorHandler(PoshError::POSH__RUNTIME_PUBLISHER_PORT_NOT_UNIQUE, iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
-            LogWarn() << "Usage of internal service '" << service << "' is forbidden.";
-            errorHandler(PoshError::POSH__RUNTIME_SERVICE_DESCRIPTION_FORBIDDEN, iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::PUBLISHER_LIST_FULL:
-            LogWarn() << "Service '" << service << "' could not be created since we are out of memory for publishers.";
-            errorHandler(PoshError::POSH__RUNTIME_ROUDI_PUBLISHER_LIST_FULL, iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::REQUEST_PUBLISHER_INVALID_RESPONSE:
-            LogWarn() << "Service '" << service << "' could not be created. Request publisher got invalid response.";
-            errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_PUBLISHER_INVALID_RESPONSE, iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE:
-            LogWarn() << "Service '" << service
-                      << "' could not be created. Request publisher got wrong IPC channel response.";
-            errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE,
-                         iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT:
-            LogWarn() << "Service '" << service
-                      << "' could not be created. RouDi did not find a writable shared memory segment for the current "
-                         "user. Try using another user or adapt RouDi's config.";
-            errorHandler(PoshError::POSH__RUNTIME_NO_WRITABLE_SHM_SEGMENT, iox::ErrorLevel::SEVERE);
-            break;
-        default:
-            LogWarn() << "Unknown error occurred while creating service '" << service << "'.";
-            errorHandler(PoshError::POSH__RUNTIME_PUBLISHER_PORT_CREATION_UNKNOWN_ERROR, iox::ErrorLevel::SEVERE);
-            break;
-        }
+        reportPublisherError(service, maybePublisher.get_error());
         return nullptr;
     }
     return maybePublisher.value();
@@ -188,10 +211,9 @@ PoshRuntimeImpl::requestPublisherFromRoudi(const IpcMessage& sendBuffer) noexcep
     return cxx::error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE);
 }
 
-SubscriberPortUserType::MemberType_t*
-PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& service,
-                                         const popo::SubscriberOptions& subscriberOptions,
-                                         const PortConfigInfo& portConfigInfo) noexcept
+popo::SubscriberOptions
+PoshRuntimeImpl::prepareSubscriberOptions(const capro::ServiceDescription& service,
+                                          const popo::SubscriberOptions& subscriberOptions) const noexcept
 {
     constexpr uint64_t MAX_QUEUE_CAPACITY = SubscriberPortUserType::MemberType_t::ChunkQueueData_t::MAX_CAPACITY;
 
@@ -222,36 +244,59 @@ PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& servic
         options.nodeName = m_appName;
     }
 
+    return options;
+}
+
+void PoshRuntimeImpl::reportSubscriberError(const capro::ServiceDescription& service,
+                                            const IpcMessageErrorType error) const noexcept
+{
+    switch (error)
+    {
+    case IpcMessageErrorType::SUBSCRIBER_LIST_FULL:
+        LogWarn() << "Service '" << service << "' could not be created since we are out of memory for subscribers.";
+        errorHandler(PoshError::POSH__RUNTIME_ROUDI_SUBSCRIBER_LIST_FULL, iox::ErrorLevel::SEVERE);
+        break;
+    case IpcMessageErrorType::REQUEST_SUBSCRIBER_INVALID_RESPONSE:
+        LogWarn() << "Service '" << service << "' could not be created. Request subscriber got invalid response.";
+        errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SUBSCRIBER_INVALID_RESPONSE, iox::ErrorLevel::SEVERE);
+        break;
+    case IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE:
+        LogWarn() << "Service '" << service
+                  << "' could not be created. Request subscriber got wrong IPC channel response.";
+        errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE,
+                     iox::ErrorLevel::SEVERE);
+        break;
+    default:
+        LogWarn() << "Unknown error occurred while creating service '" << service << "'.";
+        errorHandler(PoshError::POSH__RUNTIME_SUBSCRIBER_PORT_CREATION_UNKNOWN_ERROR, iox::ErrorLevel::SEVERE);
+        break;
+    }
+}
+
+SubscriberPortUserType::MemberType_t*
+PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& service,
+                                         const popo::SubscriberOptions& subscriberOptions,
+                                         const PortConfigInfo& portConfigInfo) noexcept
+{
+    auto options = prepareSubscriberOptions(service, subscriberOptions);
+
     IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SUBSCRIBER) << m_appName
-               << static_cast<cxx::Serialization>(service).toString() << options.serialize().toString()
-               << static_cast<cxx::Serialization>(portConfigInfo).toString();
+    if (isBinaryProtocolSupported())
+    {
+        sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SUBSCRIBER_BINARY) << m_appName
+                   << IpcSubscriberRequest(service, options, portConfigInfo).toEntry();
+    }
+    else
+    {
+        sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SUBSCRIBER) << m_appName
+                   << static_cast<cxx::Serialization>(service).toString() << options.serialize().toString()
+                   << static_cast<cxx::Serialization>(portConfigInfo).toString();
+    }
 
     auto maybeSubscriber = requestSubscriberFromRoudi(sendBuffer);
-
     if (maybeSubscriber.has_error())
     {
-        switch (maybeSubscriber.get_error())
-        {
-        case IpcMessageErrorType::SUBSCRIBER_LIST_FULL:
-            LogWarn() << "Service '" << service << "' could not be created since we are out of memory for subscribers.";
-            errorHandler(PoshError::POSH__RUNTIME_ROUDI_SUBSCRIBER_LIST_FULL, iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::REQUEST_SUBSCRIBER_INVALID_RESPONSE:
-            LogWarn() << "Service '" << service << "' could not be created. Request subscriber got invalid response.";
-            errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SUBSCRIBER_INVALID_RESPONSE, iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE:
-            LogWarn() << "Service '" << service
-                      << "' could not be created. Request subscriber got wrong IPC channel response.";
-            errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE,
-                         iox::ErrorLevel::SEVERE);
-            break;
-        default:
-            LogWarn() << "Unknown error occurred while creating service '" << service << "'.";
-            errorHandler(PoshError::POSH__RUNTIME_SUBSCRIBER_PORT_CREATION_UNKNOWN_ERROR, iox::ErrorLevel::SEVERE);
-            break;
-        }
+        reportSubscriberError(service, maybeSubscriber.get_error());
         return nullptr;
     }
     return maybeSubscriber.value();
@@ -297,9 +342,7 @@ PoshRuntimeImpl::requestSubscriberFromRoudi(const IpcMessage& sendBuffer) noexce
     return cxx::error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE);
 }
 
-popo::ClientPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareClient(const capro::ServiceDescription& service,
-                                                                         const popo::ClientOptions& clientOptions,
-                                                                         const PortConfigInfo& portConfigInfo) noexcept
+popo::ClientOptions PoshRuntimeImpl::prepareClientOptions(const popo::ClientOptions& clientOptions) const noexcept
 {
     constexpr uint64_t MAX_QUEUE_CAPACITY = iox::popo::ClientChunkQueueConfig::MAX_QUEUE_CAPACITY;
     auto options = clientOptions;
@@ -317,43 +360,66 @@ popo::ClientPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareClient(const c
         options.responseQueueCapacity = 1U;
     }
 
+    return options;
+}
+
+void PoshRuntimeImpl::reportClientError(const capro::ServiceDescription& service,
+                                        const IpcMessageErrorType error) const noexcept
+{
+    switch (error)
+    {
+    case IpcMessageErrorType::CLIENT_LIST_FULL:
+        LogWarn() << "Could not create client with service description '" << service
+                  << "' as we are out of memory for clients.";
+        errorHandler(PoshError::POSH__RUNTIME_ROUDI_OUT_OF_CLIENTS, iox::ErrorLevel::SEVERE);
+        break;
+    case IpcMessageErrorType::REQUEST_CLIENT_INVALID_RESPONSE:
+        LogWarn() << "Could not create client with service description '" << service
+                  << "'; received invalid response.";
+        errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_CLIENT_INVALID_RESPONSE, iox::ErrorLevel::SEVERE);
+        break;
+    case IpcMessageErrorType::REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE:
+        LogWarn() << "Could not create client with service description '" << service
+                  << "'; received wrong IPC channel response.";
+        errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE,
+                     iox::ErrorLevel::SEVERE);
+        break;
+    case IpcMessageErrorType::REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT:
+        LogWarn() << "Service '" << service
+                  << "' could not be created. RouDi did not find a writable shared memory segment for the current "
+                     "user. Try using another user or adapt RouDi's config.";
+        errorHandler(PoshError::POSH__RUNTIME_NO_WRITABLE_SHM_SEGMENT, iox::ErrorLevel::SEVERE);
+        break;
+    default:
+        LogWarn() << "Unknown error occurred while creating client with service description '" << service << "'";
+        errorHandler(PoshError::POSH__RUNTIME_CLIENT_PORT_CREATION_UNKNOWN_ERROR, iox::ErrorLevel::SEVERE);
+        break;
+    }
+}
+
+popo::ClientPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareClient(const capro::ServiceDescription& service,
+                                                                         const popo::ClientOptions& clientOptions,
+                                                                         const PortConfigInfo& portConfigInfo) noexcept
+{
+    auto options = prepareClientOptions(clientOptions);
+
     IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_CLIENT) << m_appName
-               << static_cast<cxx::Serialization>(service).toString() << options.serialize().toString()
-               << static_cast<cxx::Serialization>(portConfigInfo).toString();
+    if (isBinaryProtocolSupported())
+    {
+        sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_CLIENT_BINARY) << m_appName
+                   << IpcClientRequest(service, options, portConfigInfo).toEntry();
+    }
+    else
+    {
+        sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_CLIENT) << m_appName
+                   << static_cast<cxx::Serialization>(service).toString() << options.serialize().toString()
+                   << static_cast<cxx::Serialization>(portConfigInfo).toString();
+    }
 
     auto maybeClient = requestClientFromRoudi(sendBuffer);
     if (maybeClient.has_error())
     {
-        switch (maybeClient.get_error())
-        {
-        case IpcMessageErrorType::CLIENT_LIST_FULL:
-            LogWarn() << "Could not create client with service description '" << service
-                      << "' as we are out of memory for clients.";
-            errorHandler(PoshError::POSH__RUNTIME_ROUDI_OUT_OF_CLIENTS, iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::REQUEST_CLIENT_INVALID_RESPONSE:
-            LogWarn() << "Could not create client with service description '" << service
-                      << "'; received invalid response.";
-            errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_CLIENT_INVALID_RESPONSE, iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE:
-            LogWarn() << "Could not create client with service description '" << service
-                      << "'; received wrong IPC channel response.";
-            errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE,
-                         iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT:
-            LogWarn() << "Service '" << service
-                      << "' could not be created. RouDi did not find a writable shared memory segment for the current "
-                         "user. Try using another user or adapt RouDi's config.";
-            errorHandler(PoshError::POSH__RUNTIME_NO_WRITABLE_SHM_SEGMENT, iox::ErrorLevel::SEVERE);
-            break;
-        default:
-            LogWarn() << "Unknown error occurred while creating client with service description '" << service << "'";
-            errorHandler(PoshError::POSH__RUNTIME_CLIENT_PORT_CREATION_UNKNOWN_ERROR, iox::ErrorLevel::SEVERE);
-            break;
-        }
+        reportClientError(service, maybeClient.get_error());
         return nullptr;
     }
     return maybeClient.value();
@@ -399,9 +465,7 @@ PoshRuntimeImpl::requestClientFromRoudi(const IpcMessage& sendBuffer) noexcept
     return cxx::error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE);
 }
 
-popo::ServerPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareServer(const capro::ServiceDescription& service,
-                                                                         const popo::ServerOptions& serverOptions,
-                                                                         const PortConfigInfo& portConfigInfo) noexcept
+popo::ServerOptions PoshRuntimeImpl::prepareServerOptions(const popo::ServerOptions& serverOptions) const noexcept
 {
     constexpr uint64_t MAX_QUEUE_CAPACITY = iox::popo::ServerChunkQueueConfig::MAX_QUEUE_CAPACITY;
     auto options = serverOptions;
@@ -419,43 +483,66 @@ popo::ServerPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareServer(const c
         options.requestQueueCapacity = 1U;
     }
 
+    return options;
+}
+
+void PoshRuntimeImpl::reportServerError(const capro::ServiceDescription& service,
+                                        const IpcMessageErrorType error) const noexcept
+{
+    switch (error)
+    {
+    case IpcMessageErrorType::SERVER_LIST_FULL:
+        LogWarn() << "Could not create server with service description '" << service
+                  << "' as we are out of memory for servers.";
+        errorHandler(PoshError::POSH__RUNTIME_ROUDI_OUT_OF_SERVERS, iox::ErrorLevel::SEVERE);
+        break;
+    case IpcMessageErrorType::REQUEST_SERVER_INVALID_RESPONSE:
+        LogWarn() << "Could not create server with service description '" << service
+                  << "'; received invalid response.";
+        errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SERVER_INVALID_RESPONSE, iox::ErrorLevel::SEVERE);
+        break;
+    case IpcMessageErrorType::REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE:
+        LogWarn() << "Could not create server with service description '" << service
+                  << "'; received wrong IPC channel response.";
+        errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE,
+                     iox::ErrorLevel::SEVERE);
+        break;
+    case IpcMessageErrorType::REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT:
+        LogWarn() << "Service '" << service
+                  << "' could not be created. RouDi did not find a writable shared memory segment for the current "
+                     "user. Try using another user or adapt RouDi's config.";
+        errorHandler(PoshError::POSH__RUNTIME_NO_WRITABLE_SHM_SEGMENT, iox::ErrorLevel::SEVERE);
+        break;
+    default:
+        LogWarn() << "Unknown error occurred while creating server with service description '" << service << "'";
+        errorHandler(PoshError::POSH__RUNTIME_SERVER_PORT_CREATION_UNKNOWN_ERROR, iox::ErrorLevel::SEVERE);
+        break;
+    }
+}
+
+popo::ServerPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareServer(const capro::ServiceDescription& service,
+                                                                         const popo::ServerOptions& serverOptions,
+                                                                         const PortConfigInfo& portConfigInfo) noexcept
+{
+    auto options = prepareServerOptions(serverOptions);
+
     IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SERVER) << m_appName
-               << static_cast<cxx::Serialization>(service).toString() << options.serialize().toString()
-               << static_cast<cxx::Serialization>(portConfigInfo).toString();
+    if (isBinaryProtocolSupported())
+    {
+        sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SERVER_BINARY) << m_appName
+                   << IpcServerRequest(service, options, portConfigInfo).toEntry();
+    }
+    else
+    {
+        sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SERVER) << m_appName
+                   << static_cast<cxx::Serialization>(service).toString() << options.serialize().toString()
+                   << static_cast<cxx::Serialization>(portConfigInfo).toString();
+    }
 
     auto maybeServer = requestServerFromRoudi(sendBuffer);
     if (maybeServer.has_error())
     {
-        switch (maybeServer.get_error())
-        {
-        case IpcMessageErrorType::SERVER_LIST_FULL:
-            LogWarn() << "Could not create server with service description '" << service
-                      << "' as we are out of memory for servers.";
-            errorHandler(PoshError::POSH__RUNTIME_ROUDI_OUT_OF_SERVERS, iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::REQUEST_SERVER_INVALID_RESPONSE:
-            LogWarn() << "Could not create server with service description '" << service
-                      << "'; received invalid response.";
-            errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SERVER_INVALID_RESPONSE, iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE:
-            LogWarn() << "Could not create server with service description '" << service
-                      << "'; received wrong IPC channel response.";
-            errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE,
-                         iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT:
-            LogWarn() << "Service '" << service
-                      << "' could not be created. RouDi did not find a writable shared memory segment for the current "
-                         "user. Try using another user or adapt RouDi's config.";
-            errorHandler(PoshError::POSH__RUNTIME_NO_WRITABLE_SHM_SEGMENT, iox::ErrorLevel::SEVERE);
-            break;
-        default:
-            LogWarn() << "Unknown error occurred while creating server with service description '" << service << "'";
-            errorHandler(PoshError::POSH__RUNTIME_SERVER_PORT_CREATION_UNKNOWN_ERROR, iox::ErrorLevel::SEVERE);
-            break;
-        }
+        reportServerError(service, maybeServer.get_error());
         return nullptr;
     }
     return maybeServer.value();
@@ -499,6 +586,201 @@ PoshRuntimeImpl::requestServerFromRoudi(const IpcMessage& sendBuffer) noexcept
     LogError() << "Request server got wrong response from IPC channel :'" << receiveBuffer.getMessage() << "'";
     return cxx::error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE);
 }
+bool PoshRuntimeImpl::createPorts(PortBatch& batch) noexcept
+{
+    bool allPortsCreated{true};
+    if (!isBinaryProtocolSupported())
+    {
+        for (auto& request : batch.m_requests)
+        {
+            request.port = createPort(request);
+            allPortsCreated = allPortsCreated && (request.port != nullptr);
+        }
+        return allPortsCreated;
+    }
+
+    // the requests are packed into as few messages as the IPC channel allows, RouDi answers each message with the
+    // ports of all its requests
+    IpcMessage sendBuffer;
+    cxx::vector<uint64_t, MAX_PORTS_PER_BATCH> requestIndices;
+    auto sendBatch = [&] {
+        allPortsCreated = requestPortsFromRoudi(sendBuffer, requestIndices, batch) && allPortsCreated;
+        sendBuffer.clearMessage();
+        requestIndices.clear();
+    };
+
+    for (uint64_t index = 0U; index < batch.m_requests.size(); ++index)
+    {
+        auto entry = toBinaryEntry(batch.m_requests[index]);
+        if (!requestIndices.empty()
+            && sendBuffer.getMessage().size() + entry.size() + 1U > IpcInterfaceBase::MAX_MESSAGE_SIZE)
+        {
+            sendBatch();
+        }
+
+        if (requestIndices.empty())
+        {
+            sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_PORTS_BATCH) << m_appName;
+        }
+        sendBuffer << entry;
+        requestIndices.push_back(index);
+    }
+
+    if (!requestIndices.empty())
+    {
+        sendBatch();
+    }
+
+    return allPortsCreated;
+}
+
+void* PoshRuntimeImpl::createPort(const PortBatch::Request& request) noexcept
+{
+    auto publisherOptions = request.options.get<popo::PublisherOptions>();
+    if (publisherOptions != nullptr)
+    {
+        return getMiddlewarePublisher(request.service, *publisherOptions, request.portConfigInfo);
+    }
+    auto subscriberOptions = request.options.get<popo::SubscriberOptions>();
+    if (subscriberOptions != nullptr)
+    {
+        return getMiddlewareSubscriber(request.service, *subscriberOptions, request.portConfigInfo);
+    }
+    auto clientOptions = request.options.get<popo::ClientOptions>();
+    if (clientOptions != nullptr)
+    {
+        return getMiddlewareClient(request.service, *clientOptions, request.portConfigInfo);
+    }
+    auto serverOptions = request.options.get<popo::ServerOptions>();
+    if (serverOptions != nullptr)
+    {
+        return getMiddlewareServer(request.service, *serverOptions, request.portConfigInfo);
+    }
+    return nullptr;
+}
+
+IpcRequestEntry_t PoshRuntimeImpl::toBinaryEntry(const PortBatch::Request& request) const noexcept
+{
+    auto publisherOptions = request.options.get<popo::PublisherOptions>();
+    if (publisherOptions != nullptr)
+    {
+        return IpcPublisherRequest(request.service, preparePublisherOptions(*publisherOptions), request.portConfigInfo)
+            .toEntry();
+    }
+    auto subscriberOptions = request.options.get<popo::SubscriberOptions>();
+    if (subscriberOptions != nullptr)
+    {
+        return IpcSubscriberRequest(request.service,
+                                    prepareSubscriberOptions(request.service, *subscriberOptions),
+                                    request.portConfigInfo)
+            .toEntry();
+    }
+    auto clientOptions = request.options.get<popo::ClientOptions>();
+    if (clientOptions != nullptr)
+    {
+        return IpcClientRequest(request.service, prepareClientOptions(*clientOptions), request.portConfigInfo)
+            .toEntry();
+    }
+    auto serverOptions = prepareServerOptions(*request.options.get<popo::ServerOptions>());
+    return IpcServerRequest(request.service, serverOptions, request.portConfigInfo).toEntry();
+}
+
+void PoshRuntimeImpl::reportPortError(const PortBatch::Request& request, const IpcMessageErrorType error) const noexcept
+{
+    if (request.options.get<popo::PublisherOptions>() != nullptr)
+    {
+        reportPublisherError(request.service, error);
+    }
+    else if (request.options.get<popo::SubscriberOptions>() != nullptr)
+    {
+        reportSubscriberError(request.service, error);
+    }
+    else if (request.options.get<popo::ClientOptions>() != nullptr)
+    {
+        reportClientError(request.service, error);
+    }
+    else
+    {
+        reportServerError(request.service, error);
+    }
+}
+
+IpcMessageType PoshRuntimeImpl::getAckType(const PortBatch::Request& request) noexcept
+{
+    if (request.options.get<popo::PublisherOptions>() != nullptr)
+    {
+        return IpcMessageType::CREATE_PUBLISHER_ACK;
+    }
+    if (request.options.get<popo::SubscriberOptions>() != nullptr)
+    {
+        return IpcMessageType::CREATE_SUBSCRIBER_ACK;
+    }
+    if (request.options.get<popo::ClientOptions>() != nullptr)
+    {
+        return IpcMessageType::CREATE_CLIENT_ACK;
+    }
+    return IpcMessageType::CREATE_SERVER_ACK;
+}
+
+bool PoshRuntimeImpl::requestPortsFromRoudi(const IpcMessage& sendBuffer,
+                                            const cxx::vector<uint64_t, MAX_PORTS_PER_BATCH>& requestIndices,
+                                            PortBatch& batch) noexcept
+{
+    IpcMessage receiveBuffer;
+    if (sendRequestToRouDi(sendBuffer, receiveBuffer) == false)
+    {
+        LogError() << "Request ports got invalid response!";
+        errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_PORTS_INVALID_RESPONSE, iox::ErrorLevel::SEVERE);
+        return false;
+    }
+
+    // CREATE_PORTS_BATCH_ACK, segment id and for each request either the ACK and the offset or ERROR and the error
+    const uint64_t expectedNumberOfElements = 2U + 2U * requestIndices.size();
+    if (receiveBuffer.getNumberOfElements() != expectedNumberOfElements
+        || stringToIpcMessageType(receiveBuffer.getElementAtIndex(0U).c_str())
+               != IpcMessageType::CREATE_PORTS_BATCH_ACK)
+    {
+        LogError() << "Request ports got wrong response from IPC channel :'" << receiveBuffer.getMessage() << "'";
+        errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_PORTS_WRONG_IPC_MESSAGE_RESPONSE,
+                     iox::ErrorLevel::SEVERE);
+        return false;
+    }
+
+    rp::segment_id_underlying_t segmentId{0U};
+    cxx::convert::fromString(receiveBuffer.getElementAtIndex(1U).c_str(), segmentId);
+
+    bool allPortsCreated{true};
+    uint32_t elementIndex{2U};
+    for (auto requestIndex : requestIndices)
+    {
+        auto& request = batch.m_requests[requestIndex];
+        auto responseType = stringToIpcMessageType(receiveBuffer.getElementAtIndex(elementIndex).c_str());
+        auto value = receiveBuffer.getElementAtIndex(elementIndex + 1U);
+        elementIndex += 2U;
+
+        if (responseType == getAckType(request))
+        {
+            rp::UntypedRelativePointer::offset_t offset{0U};
+            cxx::convert::fromString(value.c_str(), offset);
+            request.port = rp::UntypedRelativePointer::getPtr(rp::segment_id_t{segmentId}, offset);
+        }
+        else if (responseType == IpcMessageType::ERROR)
+        {
+            LogError() << "Request ports received no valid port for '" << request.service << "' from RouDi.";
+            reportPortError(request, stringToIpcMessageErrorType(value.c_str()));
+            allPortsCreated = false;
+        }
+        else
+        {
+            LogError() << "Request ports got wrong response for '" << request.service << "' from IPC channel :'"
+                       << receiveBuffer.getMessage() << "'";
+            errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_PORTS_WRONG_IPC_MESSAGE_RESPONSE,
+                         iox::ErrorLevel::SEVERE);
+            allPortsCreated = false;
+        }
+    }
+    return allPortsCreated;
+}
 
 popo::InterfacePortData* PoshRuntimeImpl::getMiddlewareInterface(const capro::Interfaces interface,
                                                                  const NodeName_t& nodeName) noexcept
@@ -643,6 +925,11 @@ popo::ConditionVariableData* PoshRuntimeImpl::getMiddlewareConditionVariable() n
     return maybeConditionVariable.value();
 }
 
+bool PoshRuntimeImpl::isBinaryProtocolSupported() const noexcept
+{
+    return m_ipcChannelInterface.getBinaryProtocolVersion() == IPC_BINARY_PROTOCOL_VERSION;
+}
+
 bool PoshRuntimeImpl::sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answer) noexcept
 {
     // runtime must be thread safe
@@ -29,8 +29,37 @@ void ServiceDiscovery::update()
 {
     // allows us to use update and hence findService concurrently
     std::lock_guard<std::mutex> lock(m_serviceRegistryMutex);
+
+    if (m_serviceRegistry->generation() == 0U)
+    {
+        updateFromSnapshot();
+    }
+
+    // the deltas are applied in the order of their generation, a gap means that deltas were discarded and the
+    // registry snapshot is required to continue; if it is older than the gap, the local registry stays consistent
+    // but outdated until RouDi publishes the next snapshot
+    while (m_serviceRegistryDeltaSubscriber.take().and_then(
+        [&](popo::Sample<const roudi::ServiceRegistryDelta>& delta) {
+            if (delta->generation > m_serviceRegistry->generation() + 1U)
+            {
+                updateFromSnapshot();
+            }
+            if (delta->generation == m_serviceRegistry->generation() + 1U)
+            {
+                m_serviceRegistry->apply(*delta);
+            }
+        }))
+    {
+    }
+}
+
+void ServiceDiscovery::updateFromSnapshot()
+{
     m_serviceRegistrySubscriber.take().and_then([&](popo::Sample<const roudi::ServiceRegistry>& serviceRegistrySample) {
-        *m_serviceRegistry = *serviceRegistrySample;
+        if (serviceRegistrySample->generation() > m_serviceRegistry->generation())
+        {
+            *m_serviceRegistry = *serviceRegistrySample;
+        }
     });
 }
 
@@ -80,7 +109,7 @@ void ServiceDiscovery::enableEvent(popo::TriggerHandle&& triggerHandle, const Se
     {
     case ServiceDiscoveryEvent::SERVICE_REGISTRY_CHANGED:
     {
-        m_serviceRegistrySubscriber.enableEvent(std::move(triggerHandle), popo::SubscriberEvent::DATA_RECEIVED);
+        m_serviceRegistryDeltaSubscriber.enableEvent(std::move(triggerHandle), popo::SubscriberEvent::DATA_RECEIVED);
         break;
     }
     default:
@@ -97,7 +126,7 @@ void ServiceDiscovery::disableEvent(const ServiceDiscoveryEvent event) noexcept
     {
     case ServiceDiscoveryEvent::SERVICE_REGISTRY_CHANGED:
     {
-        m_serviceRegistrySubscriber.disableEvent(popo::SubscriberEvent::DATA_RECEIVED);
+        m_serviceRegistryDeltaSubscriber.disableEvent(popo::SubscriberEvent::DATA_RECEIVED);
         break;
     }
     default:
@@ -110,13 +139,13 @@ void ServiceDiscovery::disableEvent(const ServiceDiscoveryEvent event) noexcept
 
 void ServiceDiscovery::invalidateTrigger(const uint64_t uniqueTriggerId)
 {
-    m_serviceRegistrySubscriber.invalidateTrigger(uniqueTriggerId);
+    m_serviceRegistryDeltaSubscriber.invalidateTrigger(uniqueTriggerId);
 }
 
 popo::WaitSetIsConditionSatisfiedCallback
 ServiceDiscovery::getCallbackForIsStateConditionSatisfied(const popo::SubscriberState state)
 {
-    return m_serviceRegistrySubscriber.getCallbackForIsStateConditionSatisfied(state);
+    return m_serviceRegistryDeltaSubscriber.getCallbackForIsStateConditionSatisfied(state);
 }
 
 } // namespace runtime
@@ -0,0 +1,330 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/posix_wrapper/unix_domain_socket.hpp"
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_posh/gateway/domain_bridge_receiver.hpp"
+#include "iceoryx_posh/gateway/domain_bridge_sender.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_posh/testing/roudi_gtest.hpp"
+#include "test.hpp"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::units::duration_literals;
+using iox::capro::ServiceDescription;
+using iox::gw::DomainBridgeReceiver;
+using iox::gw::DomainBridgeSender;
+
+const iox::RuntimeName_t RUNTIME_NAME{"DomainBridge"};
+const ServiceDescription BRIDGED_SERVICE{"Bridged", "Instance", "Event"};
+constexpr uint64_t WARM_UP_VALUE{0U};
+constexpr uint64_t NUMBER_OF_SAMPLES{10U};
+constexpr uint32_t USER_HEADER_VALUE{0xC0FFEEU};
+constexpr uint32_t FRAGMENTED_USER_PAYLOAD_SIZE{3U * iox::gw::MAX_BRIDGE_MESSAGE_SIZE + 123U};
+
+class TestSender : public DomainBridgeSender
+{
+  public:
+    using DomainBridgeSender::DomainBridgeSender;
+
+    void discover(const iox::capro::CaproMessage& msg) noexcept override
+    {
+        // the RouDiEnvironment manages the runtimes per thread, the subscribers are created by the discovery thread
+        iox::runtime::PoshRuntime::initRuntime(RUNTIME_NAME);
+        DomainBridgeSender::discover(msg);
+    }
+};
+
+class TestReceiver : public DomainBridgeReceiver
+{
+  public:
+    using DomainBridgeReceiver::DomainBridgeReceiver;
+
+    void receive(const iox::units::Duration& timeout) noexcept override
+    {
+        // the publishers are created by the receive thread
+        iox::runtime::PoshRuntime::initRuntime(RUNTIME_NAME);
+        DomainBridgeReceiver::receive(timeout);
+    }
+};
+
+class DomainBridge_test : public RouDi_GTest
+{
+  public:
+    void SetUp() override
+    {
+        watchdog.watchAndActOnFailure([] { std::terminate(); });
+        iox::posix::UnixDomainSocket::unlinkIfExists(bridgeName).or_else([](auto) {});
+
+        config.m_configuredServices.push_back(iox::config::GatewayConfig::ServiceEntry{BRIDGED_SERVICE});
+        sender.loadConfiguration(config);
+    }
+
+    template <typename Condition>
+    static bool waitFor(const Condition& condition)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!condition() && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return condition();
+    }
+
+    void publish(const uint64_t value, const uint32_t userPayloadSize = sizeof(uint64_t))
+    {
+        publisher.loan(userPayloadSize, alignof(uint64_t), sizeof(uint32_t), alignof(uint32_t))
+            .and_then([&](void* userPayload) {
+                // the bytes after the value are numbered to detect fragments which are copied to the wrong position
+                auto bytes = static_cast<uint8_t*>(userPayload);
+                for (uint32_t i = sizeof(uint64_t); i < userPayloadSize; ++i)
+                {
+                    bytes[i] = static_cast<uint8_t>(i);
+                }
+                *static_cast<uint64_t*>(userPayload) = value;
+                *static_cast<uint32_t*>(iox::mepoo::ChunkHeader::fromUserPayload(userPayload)->userHeader()) =
+                    USER_HEADER_VALUE;
+                publisher.publish(userPayload);
+            });
+    }
+
+    /// @brief takes all samples and stores the values of the bridged samples, i.e. the samples which were not
+    /// published by the publisher of the test but by the receiver
+    void takeBridgedSamples()
+    {
+        while (!subscriber.take()
+                    .and_then([&](const void* userPayload) {
+                        const auto chunkHeader = iox::mepoo::ChunkHeader::fromUserPayload(userPayload);
+                        if (chunkHeader->originId() != publisher.getUid())
+                        {
+                            EXPECT_THAT(*static_cast<const uint32_t*>(chunkHeader->userHeader()),
+                                        Eq(USER_HEADER_VALUE));
+                            auto bytes = static_cast<const uint8_t*>(userPayload);
+                            uint32_t numberOfWrongBytes{0U};
+                            for (uint32_t i = sizeof(uint64_t); i < chunkHeader->userPayloadSize(); ++i)
+                            {
+                                numberOfWrongBytes += (bytes[i] == static_cast<uint8_t>(i)) ? 0U : 1U;
+                            }
+                            EXPECT_THAT(numberOfWrongBytes, Eq(0U));
+                            bridgedValues.push_back(*static_cast<const uint64_t*>(userPayload));
+                        }
+                        subscriber.release(userPayload);
+                    })
+                    .has_error())
+        {
+        }
+    }
+
+    iox::runtime::PoshRuntime* runtime{&iox::runtime::PoshRuntime::initRuntime(RUNTIME_NAME)};
+    iox::gw::BridgeName_t bridgeName{"iox_domain_bridge_test"};
+    iox::config::GatewayConfig config;
+    iox::popo::UntypedPublisher publisher{BRIDGED_SERVICE};
+    iox::popo::UntypedSubscriber subscriber{BRIDGED_SERVICE};
+    TestSender sender{bridgeName};
+    std::vector<uint64_t> bridgedValues;
+    iox::units::Duration timeout{30_s};
+    Watchdog watchdog{timeout};
+};
+
+TEST_F(DomainBridge_test, SamplesWithUserHeaderAreBridged)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c8ca2187-057a-4a60-bdf8-355a958774a7");
+    TestReceiver receiver(bridgeName);
+    receiver.loadConfiguration(config);
+    receiver.runMultithreaded();
+    sender.runMultithreaded();
+
+    // the bridged publisher is created with the first message of the sender and connects asynchronously
+    ASSERT_TRUE(waitFor([&] {
+        publish(WARM_UP_VALUE);
+        takeBridgedSamples();
+        return !bridgedValues.empty();
+    }));
+    // the warm up samples which are still in the queue of the sender are bridged in the meantime
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    takeBridgedSamples();
+    bridgedValues.clear();
+
+    std::vector<uint64_t> expectedValues;
+    for (uint64_t i = 1U; i <= NUMBER_OF_SAMPLES; ++i)
+    {
+        publish(i);
+        expectedValues.push_back(i);
+    }
+
+    EXPECT_TRUE(waitFor([&] {
+        takeBridgedSamples();
+        return bridgedValues.size() >= NUMBER_OF_SAMPLES;
+    }));
+    EXPECT_THAT(bridgedValues, Eq(expectedValues));
+    EXPECT_THAT(sender.numberOfDroppedSamples(), Eq(0U));
+    EXPECT_THAT(receiver.numberOfDroppedSamples(), Eq(0U));
+}
+
+TEST_F(DomainBridge_test, SamplesAreDroppedWithoutReceiver)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e6073b3f-42a7-4fa0-854b-ee8461a11ef5");
+    sender.runMultithreaded();
+
+    EXPECT_TRUE(waitFor([&] {
+        publish(WARM_UP_VALUE);
+        return sender.numberOfDroppedSamples() > 0U;
+    }));
+    EXPECT_THAT(sender.numberOfSentSamples(), Eq(0U));
+}
+
+TEST_F(DomainBridge_test, SamplesWhichDoNotFitIntoAMessageAreBridgedInFragments)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dd5e9151-08ae-4785-a3b4-de7bef4ef61f");
+    TestReceiver receiver(bridgeName);
+    receiver.loadConfiguration(config);
+    receiver.runMultithreaded();
+    sender.runMultithreaded();
+
+    ASSERT_TRUE(waitFor([&] {
+        publish(WARM_UP_VALUE, FRAGMENTED_USER_PAYLOAD_SIZE);
+        takeBridgedSamples();
+        return !bridgedValues.empty();
+    }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    takeBridgedSamples();
+    bridgedValues.clear();
+
+    // small and large samples are bridged in the order of publishing
+    std::vector<uint64_t> expectedValues;
+    for (uint64_t i = 1U; i <= NUMBER_OF_SAMPLES; ++i)
+    {
+        publish(i, (i % 2U == 0U) ? FRAGMENTED_USER_PAYLOAD_SIZE : static_cast<uint32_t>(sizeof(uint64_t)));
+        expectedValues.push_back(i);
+    }
+
+    EXPECT_TRUE(waitFor([&] {
+        takeBridgedSamples();
+        return bridgedValues.size() >= NUMBER_OF_SAMPLES;
+    }));
+    EXPECT_THAT(bridgedValues, Eq(expectedValues));
+    EXPECT_THAT(sender.numberOfDroppedSamples(), Eq(0U));
+    EXPECT_THAT(receiver.numberOfDroppedSamples(), Eq(0U));
+}
+
+TEST_F(DomainBridge_test, SamplesAreDroppedWhenTheReceiverDoesNotReceiveThemInTime)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0584fcba-5d5c-4890-b677-4fbb5bd37c77");
+    // the socket exists but nobody receives, the sender blocks at most MAX_SEND_DURATION when the socket is full
+    TestReceiver receiver(bridgeName);
+    receiver.loadConfiguration(config);
+    sender.runMultithreaded();
+
+    constexpr uint64_t NUMBER_OF_SAMPLES_PER_BURST{50U};
+    constexpr uint32_t USER_PAYLOAD_SIZE{8U * 1024U};
+    EXPECT_TRUE(waitFor([&] {
+        for (uint64_t i = 0U; i < NUMBER_OF_SAMPLES_PER_BURST; ++i)
+        {
+            publish(WARM_UP_VALUE, USER_PAYLOAD_SIZE);
+        }
+        return sender.numberOfDroppedSamples() > 0U;
+    }));
+    EXPECT_THAT(sender.numberOfSentSamples(), Gt(0U));
+}
+
+TEST_F(DomainBridge_test, BlockingSenderDoesNotDropSamplesWhenTheReceiverStallsLongerThanTheMaxSendDuration)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9f3ed1af-022c-45a1-8773-4447c213a507");
+    // the socket exists but nobody receives; with QueueFullPolicy::BLOCK_PRODUCER the sender waits for the receiver
+    TestReceiver receiver(bridgeName);
+    receiver.loadConfiguration(config);
+    iox::popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.queueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PRODUCER;
+    TestSender blockingSender{bridgeName, subscriberOptions};
+    blockingSender.loadConfiguration(config);
+    iox::popo::PublisherOptions publisherOptions;
+    publisherOptions.subscriberTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    iox::popo::UntypedPublisher blockingPublisher{BRIDGED_SERVICE, publisherOptions};
+    blockingSender.runMultithreaded();
+
+    constexpr uint32_t USER_PAYLOAD_SIZE{8U * 1024U};
+    auto publishOnBlockingPublisher = [&] {
+        blockingPublisher.loan(USER_PAYLOAD_SIZE).and_then([&](void* userPayload) {
+            blockingPublisher.publish(userPayload);
+        });
+    };
+    ASSERT_TRUE(waitFor([&] {
+        publishOnBlockingPublisher();
+        return blockingSender.numberOfSentSamples() > 0U;
+    }));
+    // the warm up samples which are still in the queue of the sender are sent in the meantime
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    const auto numberOfWarmUpSamples = blockingSender.numberOfSentSamples();
+
+    // more samples than the socket can hold but less than the subscriber queue of the sender
+    constexpr uint64_t NUMBER_OF_BLOCKED_SAMPLES{100U};
+    for (uint64_t i = 0U; i < NUMBER_OF_BLOCKED_SAMPLES; ++i)
+    {
+        publishOnBlockingPublisher();
+    }
+    std::this_thread::sleep_for(
+        std::chrono::milliseconds(2U * DomainBridgeSender::MAX_SEND_DURATION.toMilliseconds()));
+    EXPECT_THAT(blockingSender.numberOfDroppedSamples(), Eq(0U));
+
+    receiver.runMultithreaded();
+
+    EXPECT_TRUE(waitFor([&] {
+        return blockingSender.numberOfSentSamples() + blockingSender.numberOfDroppedSamples()
+               >= numberOfWarmUpSamples + NUMBER_OF_BLOCKED_SAMPLES;
+    }));
+    EXPECT_THAT(blockingSender.numberOfDroppedSamples(), Eq(0U));
+}
+
+TEST_F(DomainBridge_test, NoSamplesAreLostWhenTheReceiverStartsLate)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4f25dff5-bb30-4013-8b15-da7b38b0e8d0");
+    // the socket exists but nobody receives, the messages stay in the socket until the receiver is started
+    TestReceiver receiver(bridgeName);
+    receiver.loadConfiguration(config);
+    sender.runMultithreaded();
+
+    ASSERT_TRUE(waitFor([&] {
+        publish(WARM_UP_VALUE);
+        return sender.numberOfSentSamples() > 0U;
+    }));
+    // the warm up samples which are still in the queue of the sender are sent in the meantime
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    const auto numberOfWarmUpSamples = sender.numberOfSentSamples();
+    for (uint64_t i = 1U; i <= NUMBER_OF_SAMPLES; ++i)
+    {
+        publish(i);
+    }
+    const auto numberOfSentSamples = numberOfWarmUpSamples + NUMBER_OF_SAMPLES;
+    ASSERT_TRUE(waitFor([&] { return sender.numberOfSentSamples() == numberOfSentSamples; }));
+
+    receiver.runMultithreaded();
+
+    EXPECT_TRUE(waitFor([&] { return receiver.numberOfPublishedSamples() == numberOfSentSamples; }));
+    EXPECT_THAT(sender.numberOfDroppedSamples(), Eq(0U));
+    EXPECT_THAT(receiver.numberOfDroppedSamples(), Eq(0U));
+}
+
+} // namespace
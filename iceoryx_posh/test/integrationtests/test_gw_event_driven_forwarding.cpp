@@ -0,0 +1,185 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/attributes.hpp"
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_posh/gateway/channel.hpp"
+#include "iceoryx_posh/gateway/gateway_generic.hpp"
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_posh/testing/roudi_gtest.hpp"
+#include "test.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::units::duration_literals;
+using iox::capro::IdString_t;
+using iox::capro::ServiceDescription;
+using iox::gw::ForwardingMode;
+
+struct ExternalTerminal
+{
+    ExternalTerminal(IdString_t, IdString_t, IdString_t){};
+};
+
+using TestChannel = iox::gw::Channel<iox::popo::UntypedSubscriber, ExternalTerminal>;
+
+constexpr uint64_t NUMBER_OF_SERVICES{4U};
+const IdString_t SERVICE_ID{"Forwarding"};
+const IdString_t EVENT_ID{"Event"};
+const iox::RuntimeName_t RUNTIME_NAME{"GatewayEventDrivenForwarding"};
+
+/// @brief Forwards the samples of the 'Forwarding' services by counting them. The discovery and forwarding periods
+/// are longer than the test timeout, therefore the samples are only forwarded in time when the gateway reacts on
+/// the events of the service registry and the subscribers.
+class CountingGateway : public iox::gw::GatewayGeneric<TestChannel>
+{
+  public:
+    explicit CountingGateway(const uint32_t numberOfForwardingThreads)
+        : iox::gw::GatewayGeneric<TestChannel>(
+            iox::capro::Interfaces::DDS, 60_s, 60_s, ForwardingMode::EVENT_DRIVEN, numberOfForwardingThreads)
+    {
+    }
+
+    ~CountingGateway() override
+    {
+        shutdown();
+    }
+
+    void loadConfiguration(const iox::config::GatewayConfig&) noexcept override
+    {
+    }
+
+    void discover(const iox::capro::CaproMessage& msg) noexcept override
+    {
+        if (msg.m_serviceDescription.getServiceIDString() != SERVICE_ID)
+        {
+            return;
+        }
+        if (msg.m_type == iox::capro::CaproMessageType::OFFER)
+        {
+            // the RouDiEnvironment manages the runtimes per thread, the subscriber is created by the discovery thread
+            iox::runtime::PoshRuntime::initRuntime(RUNTIME_NAME);
+            IOX_DISCARD_RESULT(addChannel(msg.m_serviceDescription, iox::popo::SubscriberOptions()));
+        }
+        else if (msg.m_type == iox::capro::CaproMessageType::STOP_OFFER)
+        {
+            IOX_DISCARD_RESULT(discardChannel(msg.m_serviceDescription));
+        }
+    }
+
+    void forward(const TestChannel& channel) noexcept override
+    {
+        auto subscriber = channel.getIceoryxTerminal();
+        while (!subscriber->take()
+                    .and_then([&](const void* payload) {
+                        forwardedSamples.fetch_add(1U);
+                        subscriber->release(payload);
+                    })
+                    .has_error())
+        {
+        }
+    }
+
+    std::atomic<uint64_t> forwardedSamples{0U};
+};
+
+class GatewayEventDrivenForwarding_test : public RouDi_GTest
+{
+  public:
+    void SetUp() override
+    {
+        watchdog.watchAndActOnFailure([] { std::terminate(); });
+    }
+
+    void publishUntilForwarded(CountingGateway& gateway, iox::popo::UntypedPublisher& publisher)
+    {
+        const auto samplesBefore = gateway.forwardedSamples.load();
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (gateway.forwardedSamples.load() == samplesBefore && std::chrono::steady_clock::now() < deadline)
+        {
+            publisher.loan(sizeof(uint64_t)).and_then([&](void* payload) { publisher.publish(payload); });
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+
+    iox::runtime::PoshRuntime* runtime{&iox::runtime::PoshRuntime::initRuntime(RUNTIME_NAME)};
+    iox::units::Duration timeout{30_s};
+    Watchdog watchdog{timeout};
+};
+
+TEST_F(GatewayEventDrivenForwarding_test, SamplesAreForwardedWithoutWaitingForThePeriods)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4aa1f9b3-e3e4-43a7-8b79-0cc415f68f80");
+    CountingGateway gateway(1U);
+    gateway.runMultithreaded();
+
+    iox::popo::UntypedPublisher publisher({SERVICE_ID, "Instance", EVENT_ID});
+    publishUntilForwarded(gateway, publisher);
+
+    EXPECT_THAT(gateway.forwardedSamples.load(), Gt(0U));
+    EXPECT_THAT(gateway.getNumberOfChannels(), Eq(1U));
+}
+
+TEST_F(GatewayEventDrivenForwarding_test, SamplesOfAllChannelsAreForwardedByMultipleThreads)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "13fd0f03-c301-475f-b480-8ddd3b34371b");
+    CountingGateway gateway(3U);
+    gateway.runMultithreaded();
+
+    std::vector<std::unique_ptr<iox::popo::UntypedPublisher>> publishers;
+    for (uint64_t i = 0U; i < NUMBER_OF_SERVICES; ++i)
+    {
+        publishers.emplace_back(new iox::popo::UntypedPublisher(
+            {SERVICE_ID, IdString_t(iox::cxx::TruncateToCapacity, iox::cxx::convert::toString(i)), EVENT_ID}));
+        publishUntilForwarded(gateway, *publishers.back());
+        EXPECT_THAT(gateway.forwardedSamples.load(), Ge(i + 1U));
+    }
+
+    EXPECT_THAT(gateway.getNumberOfChannels(), Eq(NUMBER_OF_SERVICES));
+}
+
+TEST_F(GatewayEventDrivenForwarding_test, ChannelIsDiscardedWhenThePublisherStopsOffering)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f19f1271-4bb3-4399-adbc-ed47b3698398");
+    CountingGateway gateway(2U);
+    gateway.runMultithreaded();
+
+    {
+        iox::popo::UntypedPublisher publisher({SERVICE_ID, "Instance", EVENT_ID});
+        publishUntilForwarded(gateway, publisher);
+        ASSERT_THAT(gateway.getNumberOfChannels(), Eq(1U));
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (gateway.getNumberOfChannels() != 0U && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    EXPECT_THAT(gateway.getNumberOfChannels(), Eq(0U));
+}
+
+} // namespace
@@ -0,0 +1,254 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_posh/gateway/recorder_gateway.hpp"
+#include "iceoryx_posh/gateway/replayer.hpp"
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_posh/testing/roudi_gtest.hpp"
+#include "test.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::units::duration_literals;
+using iox::capro::ServiceDescription;
+using iox::gw::RecorderGateway;
+using iox::gw::Replayer;
+using iox::gw::ReplayTiming;
+
+const iox::RuntimeName_t RUNTIME_NAME{"RecorderReplayer"};
+const ServiceDescription RECORDED_SERVICE{"Recorded", "Instance", "Event"};
+constexpr uint64_t NUMBER_OF_NUMBERED_CHUNKS{10U};
+constexpr uint64_t NUMBER_OF_SEGMENTS_TO_REMOVE{4U};
+
+/// @brief a user-header whose size is not a multiple of the alignment of the ChunkHeader
+using OddSizedUserHeader = std::array<uint8_t, 3U>;
+constexpr OddSizedUserHeader ODD_SIZED_USER_HEADER{{13U, 37U, 42U}};
+
+class TestRecorder : public RecorderGateway
+{
+  public:
+    using RecorderGateway::RecorderGateway;
+
+    void discover(const iox::capro::CaproMessage& msg) noexcept override
+    {
+        // the RouDiEnvironment manages the runtimes per thread, the subscribers are created by the discovery thread
+        iox::runtime::PoshRuntime::initRuntime(RUNTIME_NAME);
+        RecorderGateway::discover(msg);
+    }
+};
+
+class RecorderReplayer_test : public RouDi_GTest
+{
+  public:
+    void SetUp() override
+    {
+        watchdog.watchAndActOnFailure([] { std::terminate(); });
+        removeSegments();
+    }
+
+    void TearDown() override
+    {
+        removeSegments();
+    }
+
+    void removeSegments() const
+    {
+        for (uint64_t i = 0U; i < NUMBER_OF_SEGMENTS_TO_REMOVE; ++i)
+        {
+            std::remove((std::string(recordingPath.c_str()) + "." + iox::cxx::convert::toString(i)).c_str());
+        }
+    }
+
+    template <typename Condition>
+    static bool waitFor(const Condition& condition)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!condition() && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return condition();
+    }
+
+    static void publish(iox::popo::UntypedPublisher& publisher, const uint64_t value)
+    {
+        publisher.loan(sizeof(uint64_t)).and_then([&](void* userPayload) {
+            *static_cast<uint64_t*>(userPayload) = value;
+            publisher.publish(userPayload);
+        });
+    }
+
+    static void publishWithOddSizedUserHeader(iox::popo::UntypedPublisher& publisher, const uint64_t value)
+    {
+        publisher.loan(sizeof(uint64_t), alignof(uint64_t), sizeof(OddSizedUserHeader), alignof(OddSizedUserHeader))
+            .and_then([&](void* userPayload) {
+                auto userHeader = iox::mepoo::ChunkHeader::fromUserPayload(userPayload)->userHeader();
+                *static_cast<OddSizedUserHeader*>(userHeader) = ODD_SIZED_USER_HEADER;
+                *static_cast<uint64_t*>(userPayload) = value;
+                publisher.publish(userPayload);
+            });
+    }
+
+    using PublishFunction = void (*)(iox::popo::UntypedPublisher&, const uint64_t);
+
+    /// @brief records chunks with the values 0 to NUMBER_OF_NUMBERED_CHUNKS - 1, preceded by chunks with the value
+    /// NUMBER_OF_NUMBERED_CHUNKS which were published until the recorder was connected
+    uint64_t record(const std::chrono::milliseconds interval = std::chrono::milliseconds(0),
+                    const PublishFunction publishValue = &publish)
+    {
+        TestRecorder recorder(recordingPath);
+        recorder.runMultithreaded();
+
+        iox::popo::UntypedPublisher publisher(RECORDED_SERVICE);
+        EXPECT_TRUE(waitFor([&] {
+            publishValue(publisher, NUMBER_OF_NUMBERED_CHUNKS);
+            return recorder.numberOfRecordedChunks() > 0U;
+        }));
+        // the connection chunks which are still in the queue of the recorder are recorded in the meantime
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        const auto numberOfConnectionChunks = recorder.numberOfRecordedChunks();
+        for (uint64_t i = 0U; i < NUMBER_OF_NUMBERED_CHUNKS; ++i)
+        {
+            std::this_thread::sleep_for(interval);
+            publishValue(publisher, i);
+        }
+        const auto numberOfRecordedChunks = numberOfConnectionChunks + NUMBER_OF_NUMBERED_CHUNKS;
+        EXPECT_TRUE(waitFor([&] { return recorder.numberOfRecordedChunks() == numberOfRecordedChunks; }));
+        EXPECT_THAT(recorder.numberOfDroppedChunks(), Eq(0U));
+        return recorder.numberOfRecordedChunks();
+    }
+
+    iox::runtime::PoshRuntime* runtime{&iox::runtime::PoshRuntime::initRuntime(RUNTIME_NAME)};
+    iox::gw::RecordingPath_t recordingPath{"/tmp/iox_recorder_replayer_test"};
+    iox::units::Duration timeout{30_s};
+    Watchdog watchdog{timeout};
+};
+
+TEST_F(RecorderReplayer_test, ReplayedChunksAreTheRecordedChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "87ef021c-e0a6-4aa7-a7ed-1a2970d42e00");
+    const auto numberOfRecordedChunks = record();
+
+    iox::popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.historyRequest = iox::MAX_PUBLISHER_HISTORY;
+    iox::popo::UntypedSubscriber subscriber(RECORDED_SERVICE, subscriberOptions);
+    iox::popo::PublisherOptions publisherOptions;
+    publisherOptions.historyCapacity = iox::MAX_PUBLISHER_HISTORY;
+    Replayer sut(publisherOptions);
+
+    auto numberOfReplayedChunks = sut.replay(recordingPath, ReplayTiming::AS_FAST_AS_POSSIBLE);
+
+    ASSERT_FALSE(numberOfReplayedChunks.has_error());
+    EXPECT_THAT(numberOfReplayedChunks.value(), Eq(numberOfRecordedChunks));
+
+    // the subscriber receives the history of the replayed publisher, it ends with the numbered chunks
+    std::vector<uint64_t> receivedValues;
+    EXPECT_TRUE(waitFor([&] {
+        while (!subscriber.take()
+                    .and_then([&](const void* userPayload) {
+                        receivedValues.push_back(*static_cast<const uint64_t*>(userPayload));
+                        subscriber.release(userPayload);
+                    })
+                    .has_error())
+        {
+        }
+        return !receivedValues.empty() && receivedValues.back() == NUMBER_OF_NUMBERED_CHUNKS - 1U;
+    }));
+    ASSERT_THAT(receivedValues.size(), Ge(NUMBER_OF_NUMBERED_CHUNKS));
+    for (uint64_t i = 0U; i < NUMBER_OF_NUMBERED_CHUNKS; ++i)
+    {
+        EXPECT_THAT(receivedValues[receivedValues.size() - NUMBER_OF_NUMBERED_CHUNKS + i], Eq(i));
+    }
+}
+
+TEST_F(RecorderReplayer_test, ReplayedChunksKeepAnOddSizedUserHeader)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "baca1914-df60-483d-8afc-9545d56b911e");
+    const auto numberOfRecordedChunks = record(std::chrono::milliseconds(0), &publishWithOddSizedUserHeader);
+
+    iox::popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.historyRequest = 1U;
+    iox::popo::UntypedSubscriber subscriber(RECORDED_SERVICE, subscriberOptions);
+    iox::popo::PublisherOptions publisherOptions;
+    publisherOptions.historyCapacity = 1U;
+    Replayer sut(publisherOptions);
+
+    auto numberOfReplayedChunks = sut.replay(recordingPath, ReplayTiming::AS_FAST_AS_POSSIBLE);
+
+    ASSERT_FALSE(numberOfReplayedChunks.has_error());
+    EXPECT_THAT(numberOfReplayedChunks.value(), Eq(numberOfRecordedChunks));
+
+    // every replayed chunk which is received carries the user-header, the last one is received with the history
+    uint64_t lastReceivedValue{0U};
+    EXPECT_TRUE(waitFor([&] {
+        while (!subscriber.take()
+                    .and_then([&](const void* userPayload) {
+                        const auto chunkHeader = iox::mepoo::ChunkHeader::fromUserPayload(userPayload);
+                        EXPECT_THAT(chunkHeader->userHeaderSize(), Eq(sizeof(OddSizedUserHeader)));
+                        EXPECT_THAT(*static_cast<const OddSizedUserHeader*>(chunkHeader->userHeader()),
+                                    Eq(ODD_SIZED_USER_HEADER));
+                        lastReceivedValue = *static_cast<const uint64_t*>(userPayload);
+                        subscriber.release(userPayload);
+                    })
+                    .has_error())
+        {
+        }
+        return lastReceivedValue == NUMBER_OF_NUMBERED_CHUNKS - 1U;
+    }));
+}
+
+TEST_F(RecorderReplayer_test, ReplayWithOriginalTimingTakesAsLongAsTheRecording)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "53816bbf-ca6b-4ff0-aeb9-6407392d1a90");
+    constexpr std::chrono::milliseconds INTERVAL{20};
+    record(INTERVAL);
+    Replayer sut;
+
+    const auto start = std::chrono::steady_clock::now();
+    auto numberOfReplayedChunks = sut.replay(recordingPath, ReplayTiming::ORIGINAL);
+    const auto duration = std::chrono::steady_clock::now() - start;
+
+    ASSERT_FALSE(numberOfReplayedChunks.has_error());
+    // the numbered chunks were recorded with the interval in between
+    EXPECT_THAT(std::chrono::duration_cast<std::chrono::milliseconds>(duration).count(),
+                Ge((INTERVAL * (NUMBER_OF_NUMBERED_CHUNKS - 1U)).count()));
+}
+
+TEST_F(RecorderReplayer_test, ReplayingAMissingRecordingFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "15032704-c68c-481e-a269-5cf7692cb47e");
+    Replayer sut;
+
+    auto numberOfReplayedChunks = sut.replay(recordingPath, ReplayTiming::AS_FAST_AS_POSSIBLE);
+
+    ASSERT_TRUE(numberOfReplayedChunks.has_error());
+    EXPECT_THAT(numberOfReplayedChunks.get_error(), Eq(iox::gw::RecordingError::FILE_ACCESS_FAILED));
+}
+
+} // namespace
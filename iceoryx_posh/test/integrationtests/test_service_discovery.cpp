@@ -29,6 +29,7 @@
 #include "iceoryx_posh/testing/roudi_gtest.hpp"
 #include "test.hpp"
 
+#include <algorithm>
 #include <random>
 #include <set>
 #include <type_traits>
@@ -191,7 +192,7 @@ TEST_F(ServiceDiscoveryBase_test, FindServiceWithWildcardsReturnsOnlyIntrospecti
     ::testing::Test::RecordProperty("TEST_ID", "d944f32c-edef-44f5-a6eb-c19ee73c98eb");
     findService(iox::capro::Wildcard, iox::capro::Wildcard, iox::capro::Wildcard, MessagingPattern::PUB_SUB);
 
-    constexpr uint32_t NUM_INTERNAL_SERVICES = 6U;
+    constexpr uint32_t NUM_INTERNAL_SERVICES = 7U;
     EXPECT_EQ(serviceContainer.size(), NUM_INTERNAL_SERVICES);
     for (auto& service : serviceContainer)
     {
@@ -199,6 +200,82 @@ TEST_F(ServiceDiscoveryBase_test, FindServiceWithWildcardsReturnsOnlyIntrospecti
     }
 }
 
+TEST_F(ServiceDiscoveryNotification_test, ServiceRegistrySnapshotIsOnlyPublishedEverySnapshotIntervalDeltas)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "df96521b-3a5f-4f5e-9850-3a3563c16d4f");
+    using iox::SERVICE_REGISTRY_SNAPSHOT_INTERVAL;
+    iox::popo::Subscriber<iox::roudi::ServiceRegistry> snapshotSubscriber(
+        {iox::SERVICE_DISCOVERY_SERVICE_NAME, iox::SERVICE_DISCOVERY_INSTANCE_NAME, iox::SERVICE_DISCOVERY_EVENT_NAME},
+        {2U, 1U, iox::NodeName_t(""), false});
+    iox::popo::Subscriber<iox::roudi::ServiceRegistryDelta> deltaSubscriber(
+        {iox::SERVICE_DISCOVERY_SERVICE_NAME,
+         iox::SERVICE_DISCOVERY_INSTANCE_NAME,
+         iox::SERVICE_DISCOVERY_DELTA_EVENT_NAME},
+        {SERVICE_REGISTRY_SNAPSHOT_INTERVAL, SERVICE_REGISTRY_SNAPSHOT_INTERVAL, iox::NodeName_t(""), false});
+    iox::popo::WaitSet<1U> snapshotWaitSet;
+    iox::popo::WaitSet<1U> deltaWaitSet;
+    snapshotWaitSet.attachState(snapshotSubscriber, iox::popo::SubscriberState::HAS_DATA).or_else([](auto) {
+        GTEST_FAIL() << "Could not attach to wait set";
+    });
+    deltaWaitSet.attachState(deltaSubscriber, iox::popo::SubscriberState::HAS_DATA).or_else([](auto) {
+        GTEST_FAIL() << "Could not attach to wait set";
+    });
+
+    // the wait sets are only notified about samples which arrive after they were attached
+    snapshotSubscriber.subscribe();
+    deltaSubscriber.subscribe();
+
+    auto takeSnapshotGenerations = [&] {
+        std::vector<uint64_t> generations;
+        snapshotWaitSet.wait();
+        while (snapshotSubscriber.take().and_then([&](auto& sample) { generations.push_back(sample->generation()); }))
+        {
+        }
+        return generations;
+    };
+    uint64_t generation{0U};
+    auto takeDeltas = [&] {
+        deltaWaitSet.wait();
+        while (deltaSubscriber.take().and_then([&](auto& delta) { generation = delta->generation; }))
+        {
+        }
+    };
+
+    // the history of the deltas contains the modifications after the snapshot
+    const auto initialGenerations = takeSnapshotGenerations();
+    ASSERT_THAT(initialGenerations.empty(), Eq(false));
+    takeDeltas();
+    const uint64_t initialGeneration{std::max(initialGenerations.back(), generation)};
+
+    // every offer and stop offer is a delta which is handled in a discovery run, the last one completes the
+    // snapshot interval
+    const uint64_t numberOfDeltas{SERVICE_REGISTRY_SNAPSHOT_INTERVAL
+                                  - initialGeneration % SERVICE_REGISTRY_SNAPSHOT_INTERVAL};
+    iox::popo::PublisherOptions publisherOptions;
+    publisherOptions.offerOnCreate = false;
+    iox::popo::UntypedPublisher publisher({"Moep", "Fluepp", "Shoezzel"}, publisherOptions);
+    for (uint64_t i = 1U; i <= numberOfDeltas; ++i)
+    {
+        if (publisher.isOffered())
+        {
+            publisher.stopOffer();
+        }
+        else
+        {
+            publisher.offer();
+        }
+        while (generation < initialGeneration + i)
+        {
+            takeDeltas();
+        }
+    }
+
+    // the snapshot of the last delta is preceded by none of the discovery runs of the other deltas
+    const auto generations = takeSnapshotGenerations();
+    ASSERT_THAT(generations.size(), Eq(1U));
+    EXPECT_THAT(generations[0], Eq(initialGeneration + numberOfDeltas));
+}
+
 //
 // Offer, StopOffer, Reoffer
 // Variation of PUB/SUB and REQ/RES
@@ -457,6 +534,9 @@ class ReferenceDiscovery
             services.emplace(iox::SERVICE_DISCOVERY_SERVICE_NAME,
                              iox::SERVICE_DISCOVERY_INSTANCE_NAME,
                              iox::SERVICE_DISCOVERY_EVENT_NAME);
+            services.emplace(iox::SERVICE_DISCOVERY_SERVICE_NAME,
+                             iox::SERVICE_DISCOVERY_INSTANCE_NAME,
+                             iox::SERVICE_DISCOVERY_DELTA_EVENT_NAME);
         }
     }
 
@@ -0,0 +1,182 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/introspection/fixed_size_hash_index.hpp"
+#include "test.hpp"
+
+#include <cstdint>
+#include <map>
+#include <random>
+
+namespace
+{
+using namespace ::testing;
+
+using namespace iox::roudi;
+
+class FixedSizeHashIndex_test : public Test
+{
+  public:
+    using Index_t = int32_t;
+    static constexpr Index_t NOT_AN_ELEMENT{-1};
+};
+
+constexpr FixedSizeHashIndex_test::Index_t FixedSizeHashIndex_test::NOT_AN_ELEMENT;
+
+TEST_F(FixedSizeHashIndex_test, findOnEmptyIndexFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b01190e7-5854-4b56-b0bb-478703f2206a");
+    FixedSizeHashIndex<4> sut;
+    EXPECT_THAT(sut.find(0U), Eq(NOT_AN_ELEMENT));
+    EXPECT_THAT(sut.find(42U), Eq(NOT_AN_ELEMENT));
+    EXPECT_THAT(sut.size(), Eq(0U));
+}
+
+TEST_F(FixedSizeHashIndex_test, insertedKeysCanBeFound)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "65a4b89c-2436-44fd-b385-626fe208828d");
+    constexpr uint32_t CAPACITY{100U};
+    FixedSizeHashIndex<CAPACITY> sut;
+    for (uint32_t k = 0U; k < CAPACITY; ++k)
+    {
+        EXPECT_TRUE(sut.insert(k, static_cast<Index_t>(k * 2U)));
+    }
+
+    EXPECT_THAT(sut.size(), Eq(CAPACITY));
+    for (uint32_t k = 0U; k < CAPACITY; ++k)
+    {
+        EXPECT_THAT(sut.find(k), Eq(static_cast<Index_t>(k * 2U)));
+    }
+    EXPECT_THAT(sut.find(CAPACITY), Eq(NOT_AN_ELEMENT));
+}
+
+TEST_F(FixedSizeHashIndex_test, insertOfPresentKeyFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "62d26aa8-75c8-4a57-92b5-b7199287f85b");
+    FixedSizeHashIndex<4> sut;
+    EXPECT_TRUE(sut.insert(7U, 1));
+    EXPECT_FALSE(sut.insert(7U, 2));
+    EXPECT_THAT(sut.find(7U), Eq(1));
+    EXPECT_THAT(sut.size(), Eq(1U));
+}
+
+TEST_F(FixedSizeHashIndex_test, insertOfNegativeIndexFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a22b23a1-8181-4773-93f5-7ceb075aec49");
+    FixedSizeHashIndex<4> sut;
+    EXPECT_FALSE(sut.insert(7U, NOT_AN_ELEMENT));
+    EXPECT_THAT(sut.find(7U), Eq(NOT_AN_ELEMENT));
+    EXPECT_THAT(sut.size(), Eq(0U));
+}
+
+TEST_F(FixedSizeHashIndex_test, insertBeyondCapacityFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ddbb172d-5e0f-421e-a4ff-e83259cd31a4");
+    constexpr uint32_t CAPACITY{3U};
+    FixedSizeHashIndex<CAPACITY> sut;
+    for (uint32_t k = 0U; k < CAPACITY; ++k)
+    {
+        EXPECT_TRUE(sut.insert(k, 0));
+    }
+    EXPECT_FALSE(sut.insert(CAPACITY, 0));
+    EXPECT_THAT(sut.find(CAPACITY), Eq(NOT_AN_ELEMENT));
+}
+
+TEST_F(FixedSizeHashIndex_test, assignReplacesIndexOfPresentKeyOnly)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fab22dc0-61b2-4ffd-98de-0b0f215ecd10");
+    FixedSizeHashIndex<4> sut;
+    EXPECT_TRUE(sut.insert(7U, 1));
+    EXPECT_TRUE(sut.assign(7U, 3));
+    EXPECT_THAT(sut.find(7U), Eq(3));
+
+    EXPECT_FALSE(sut.assign(8U, 3));
+    EXPECT_THAT(sut.find(8U), Eq(NOT_AN_ELEMENT));
+    EXPECT_THAT(sut.size(), Eq(1U));
+}
+
+TEST_F(FixedSizeHashIndex_test, eraseRemovesOnlyTheGivenKey)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4c88cc84-5095-4482-8418-8b4de467ad51");
+    FixedSizeHashIndex<4> sut;
+    EXPECT_TRUE(sut.insert(7U, 1));
+    EXPECT_TRUE(sut.insert(8U, 2));
+
+    EXPECT_TRUE(sut.erase(7U));
+    EXPECT_FALSE(sut.erase(7U));
+    EXPECT_THAT(sut.find(7U), Eq(NOT_AN_ELEMENT));
+    EXPECT_THAT(sut.find(8U), Eq(2));
+    EXPECT_THAT(sut.size(), Eq(1U));
+}
+
+TEST_F(FixedSizeHashIndex_test, capacityIsAvailableAgainAfterErase)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e03898fb-32e1-41c6-baf9-a466433344fa");
+    constexpr uint32_t CAPACITY{16U};
+    FixedSizeHashIndex<CAPACITY> sut;
+    for (uint64_t round = 0U; round < 10U; ++round)
+    {
+        for (uint64_t k = 0U; k < CAPACITY; ++k)
+        {
+            EXPECT_TRUE(sut.insert(round * CAPACITY + k, 0));
+        }
+        for (uint64_t k = 0U; k < CAPACITY; ++k)
+        {
+            EXPECT_TRUE(sut.erase(round * CAPACITY + k));
+        }
+    }
+    EXPECT_THAT(sut.size(), Eq(0U));
+}
+
+TEST_F(FixedSizeHashIndex_test, randomInsertAndEraseMatchesReferenceMap)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "58031f53-70fd-4fcb-9167-6c1278189735");
+    // a small key range produces long probe sequences and exercises the back shift on erase
+    constexpr uint32_t CAPACITY{64U};
+    constexpr uint64_t KEY_RANGE{96U};
+    FixedSizeHashIndex<CAPACITY> sut;
+    std::map<uint64_t, Index_t> reference;
+
+    std::mt19937 generator(42U);
+    std::uniform_int_distribution<uint64_t> keyDistribution(0U, KEY_RANGE - 1U);
+    for (Index_t i = 0; i < 10000; ++i)
+    {
+        auto key = keyDistribution(generator);
+        if (reference.find(key) == reference.end())
+        {
+            bool isInserted = sut.insert(key, i);
+            EXPECT_THAT(isInserted, Eq(reference.size() < CAPACITY));
+            if (isInserted)
+            {
+                reference.emplace(key, i);
+            }
+        }
+        else
+        {
+            EXPECT_TRUE(sut.erase(key));
+            reference.erase(key);
+        }
+
+        ASSERT_THAT(sut.size(), Eq(reference.size()));
+        for (uint64_t k = 0U; k < KEY_RANGE; ++k)
+        {
+            auto iter = reference.find(k);
+            ASSERT_THAT(sut.find(k), Eq(iter == reference.end() ? NOT_AN_ELEMENT : iter->second));
+        }
+    }
+}
+
+} // namespace
@@ -0,0 +1,431 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_posh/gateway/recording.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "test.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::gw;
+using iox::capro::ServiceDescription;
+using iox::mepoo::ChunkHeader;
+using iox::mepoo::ChunkSettings;
+
+constexpr uint64_t MAX_NUMBER_OF_SEGMENTS{64U};
+constexpr uint32_t CHUNK_STORAGE_SIZE{8192U};
+
+class Recording_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        removeSegments();
+    }
+
+    void TearDown() override
+    {
+        removeSegments();
+    }
+
+    std::string segmentPath(const uint64_t segmentIndex) const
+    {
+        return std::string(basePath.c_str()) + "." + iox::cxx::convert::toString(segmentIndex);
+    }
+
+    uint64_t numberOfSegments() const
+    {
+        uint64_t segmentIndex{0U};
+        while (std::ifstream(segmentPath(segmentIndex)).good())
+        {
+            ++segmentIndex;
+        }
+        return segmentIndex;
+    }
+
+    void removeSegments() const
+    {
+        for (uint64_t i = 0U; i < MAX_NUMBER_OF_SEGMENTS; ++i)
+        {
+            std::remove(segmentPath(i).c_str());
+        }
+    }
+
+    ChunkHeader& createChunk(const uint32_t userPayloadSize,
+                             const uint8_t fillValue,
+                             const uint32_t userHeaderSize = iox::CHUNK_NO_USER_HEADER_SIZE)
+    {
+        const uint32_t userHeaderAlignment = (userHeaderSize == iox::CHUNK_NO_USER_HEADER_SIZE)
+                                                 ? iox::CHUNK_NO_USER_HEADER_ALIGNMENT
+                                                 : static_cast<uint32_t>(alignof(ChunkHeader));
+        auto chunkSettings = ChunkSettings::create(
+            userPayloadSize, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT, userHeaderSize, userHeaderAlignment);
+        EXPECT_FALSE(chunkSettings.has_error());
+        auto chunkHeader = new (chunkStorage) ChunkHeader(CHUNK_STORAGE_SIZE, chunkSettings.value());
+        std::memset(chunkHeader->userPayload(), fillValue, userPayloadSize);
+        if (userHeaderSize != iox::CHUNK_NO_USER_HEADER_SIZE)
+        {
+            std::memset(chunkHeader->userHeader(), static_cast<uint8_t>(~fillValue), userHeaderSize);
+        }
+        return *chunkHeader;
+    }
+
+    static bool isFilledWith(const void* data, const uint64_t size, const uint8_t value)
+    {
+        const auto bytes = static_cast<const uint8_t*>(data);
+        for (uint64_t i = 0U; i < size; ++i)
+        {
+            if (bytes[i] != value)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    RecordingPath_t basePath{"/tmp/iox_recording_test"};
+    ServiceDescription service1{"Radar", "FrontLeft", "Objects"};
+    ServiceDescription service2{"Camera", "Rear", "Image"};
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) storage for a placement new
+    alignas(ChunkHeader) uint8_t chunkStorage[CHUNK_STORAGE_SIZE];
+};
+
+TEST_F(Recording_test, RecordedChunksAreReadInTheRecordedOrderWithTheirService)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "afd79b1d-820f-4fdd-a548-6ead00e4e282");
+    {
+        RecordingWriter sut(basePath);
+        auto index1 = sut.addService(service1);
+        auto index2 = sut.addService(service2);
+        ASSERT_FALSE(index1.has_error());
+        ASSERT_FALSE(index2.has_error());
+
+        EXPECT_FALSE(sut.write(index1.value(), createChunk(16U, 1U)).has_error());
+        EXPECT_FALSE(sut.write(index2.value(), createChunk(32U, 2U)).has_error());
+        EXPECT_FALSE(sut.write(index1.value(), createChunk(64U, 3U)).has_error());
+        EXPECT_THAT(sut.numberOfChunks(), Eq(3U));
+    }
+
+    RecordingReader reader(basePath);
+    const std::vector<std::pair<ServiceDescription, uint32_t>> expectedChunks{
+        {service1, 16U}, {service2, 32U}, {service1, 64U}};
+    uint8_t fillValue{1U};
+    for (const auto& expectedChunk : expectedChunks)
+    {
+        auto chunk = reader.next();
+        ASSERT_FALSE(chunk.has_error());
+        EXPECT_THAT(reader.service(chunk.value().serviceIndex), Eq(expectedChunk.first));
+        ASSERT_THAT(chunk.value().chunkHeader->userPayloadSize(), Eq(expectedChunk.second));
+        EXPECT_TRUE(isFilledWith(chunk.value().chunkHeader->userPayload(), expectedChunk.second, fillValue));
+        ++fillValue;
+    }
+
+    auto endOfRecording = reader.next();
+    ASSERT_TRUE(endOfRecording.has_error());
+    EXPECT_THAT(endOfRecording.get_error(), Eq(RecordingError::END_OF_RECORDING));
+}
+
+TEST_F(Recording_test, UserHeaderIsRecordedWithTheChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "45a8e07d-8834-4194-96b0-debe5a17d238");
+    constexpr uint32_t USER_HEADER_SIZE{24U};
+    constexpr uint32_t USER_PAYLOAD_SIZE{100U};
+    constexpr uint8_t FILL_VALUE{0x42U};
+    {
+        RecordingWriter sut(basePath);
+        auto index = sut.addService(service1);
+        ASSERT_FALSE(index.has_error());
+        auto& chunkHeader = createChunk(USER_PAYLOAD_SIZE, FILL_VALUE, USER_HEADER_SIZE);
+        EXPECT_FALSE(sut.write(index.value(), chunkHeader).has_error());
+    }
+
+    RecordingReader reader(basePath);
+    auto chunk = reader.next();
+    ASSERT_FALSE(chunk.has_error());
+    const auto& chunkHeader = *chunk.value().chunkHeader;
+    ASSERT_THAT(chunkHeader.userHeaderSize(), Eq(USER_HEADER_SIZE));
+    EXPECT_TRUE(isFilledWith(chunkHeader.userHeader(), USER_HEADER_SIZE, static_cast<uint8_t>(~FILL_VALUE)));
+    ASSERT_THAT(chunkHeader.userPayloadSize(), Eq(USER_PAYLOAD_SIZE));
+    EXPECT_TRUE(isFilledWith(chunkHeader.userPayload(), USER_PAYLOAD_SIZE, FILL_VALUE));
+}
+
+TEST_F(Recording_test, RecordingIsSplitIntoSelfContainedSegments)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "57eb9474-1efa-4151-ab4f-28d0df6a38fb");
+    constexpr uint64_t NUMBER_OF_CHUNKS{20U};
+    constexpr uint32_t USER_PAYLOAD_SIZE{1000U};
+    {
+        RecordingWriter sut(basePath, RecordingWriter::MIN_SEGMENT_SIZE);
+        auto index1 = sut.addService(service1);
+        auto index2 = sut.addService(service2);
+        ASSERT_FALSE(index1.has_error());
+        ASSERT_FALSE(index2.has_error());
+        for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+        {
+            const auto index = (i % 2U == 0U) ? index1.value() : index2.value();
+            EXPECT_FALSE(sut.write(index, createChunk(USER_PAYLOAD_SIZE, static_cast<uint8_t>(i))).has_error());
+        }
+    }
+
+    EXPECT_THAT(numberOfSegments(), Gt(1U));
+
+    // the second segment is read on its own to verify that it defines its services
+    std::rename(segmentPath(1U).c_str(), segmentPath(0U).c_str());
+    for (uint64_t i = 2U; i < MAX_NUMBER_OF_SEGMENTS; ++i)
+    {
+        std::remove(segmentPath(i).c_str());
+    }
+
+    RecordingReader reader(basePath);
+    auto chunk = reader.next();
+    ASSERT_FALSE(chunk.has_error());
+    const auto& service = reader.service(chunk.value().serviceIndex);
+    EXPECT_TRUE(service == service1 || service == service2);
+    EXPECT_THAT(chunk.value().chunkHeader->userPayloadSize(), Eq(USER_PAYLOAD_SIZE));
+}
+
+TEST_F(Recording_test, AllChunksOfAllSegmentsAreRead)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b8a00f65-543f-4346-8896-99b0914d95c0");
+    constexpr uint64_t NUMBER_OF_CHUNKS{50U};
+    {
+        RecordingWriter sut(basePath, RecordingWriter::MIN_SEGMENT_SIZE);
+        auto index = sut.addService(service1);
+        ASSERT_FALSE(index.has_error());
+        for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+        {
+            EXPECT_FALSE(sut.write(index.value(), createChunk(500U, static_cast<uint8_t>(i))).has_error());
+        }
+    }
+
+    RecordingReader reader(basePath);
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto chunk = reader.next();
+        ASSERT_FALSE(chunk.has_error());
+        EXPECT_TRUE(isFilledWith(chunk.value().chunkHeader->userPayload(), 500U, static_cast<uint8_t>(i)));
+    }
+    EXPECT_TRUE(reader.next().has_error());
+}
+
+TEST_F(Recording_test, ChunksOfConcurrentWritersAreRecordedCompletely)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6e22ef0d-a036-442c-8b85-ea5bded6e942");
+    constexpr uint64_t NUMBER_OF_WRITERS{4U};
+    constexpr uint64_t NUMBER_OF_CHUNKS_PER_WRITER{200U};
+    constexpr uint32_t USER_PAYLOAD_SIZE{1000U};
+    {
+        RecordingWriter sut(basePath, 16U * RecordingWriter::MIN_SEGMENT_SIZE);
+        auto index = sut.addService(service1);
+        ASSERT_FALSE(index.has_error());
+
+        std::vector<std::thread> writers;
+        for (uint64_t writer = 0U; writer < NUMBER_OF_WRITERS; ++writer)
+        {
+            writers.emplace_back([&, writer] {
+                auto chunkSettings =
+                    ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+                ASSERT_FALSE(chunkSettings.has_error());
+                std::vector<uint64_t> storage(CHUNK_STORAGE_SIZE / sizeof(uint64_t));
+                auto chunkHeader = new (storage.data()) ChunkHeader(CHUNK_STORAGE_SIZE, chunkSettings.value());
+                std::memset(chunkHeader->userPayload(), static_cast<uint8_t>(writer + 1U), USER_PAYLOAD_SIZE);
+                for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS_PER_WRITER; ++i)
+                {
+                    EXPECT_FALSE(sut.write(index.value(), *chunkHeader).has_error());
+                }
+            });
+        }
+        for (auto& writer : writers)
+        {
+            writer.join();
+        }
+        EXPECT_THAT(sut.numberOfChunks(), Eq(NUMBER_OF_WRITERS * NUMBER_OF_CHUNKS_PER_WRITER));
+    }
+
+    EXPECT_THAT(numberOfSegments(), Gt(1U));
+
+    RecordingReader reader(basePath);
+    std::vector<uint64_t> numberOfChunks(NUMBER_OF_WRITERS, 0U);
+    for (auto chunk = reader.next(); !chunk.has_error(); chunk = reader.next())
+    {
+        const auto userPayload = static_cast<const uint8_t*>(chunk.value().chunkHeader->userPayload());
+        const uint8_t fillValue = userPayload[0U];
+        ASSERT_THAT(fillValue, Ge(1U));
+        ASSERT_THAT(fillValue, Le(NUMBER_OF_WRITERS));
+        EXPECT_TRUE(isFilledWith(userPayload, USER_PAYLOAD_SIZE, fillValue));
+        ++numberOfChunks[fillValue - 1U];
+    }
+    for (const auto number : numberOfChunks)
+    {
+        EXPECT_THAT(number, Eq(NUMBER_OF_CHUNKS_PER_WRITER));
+    }
+}
+
+TEST_F(Recording_test, LastSegmentIsTruncatedToItsRecords)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5de829e4-4a7b-4bef-b3f8-3ed30c060f7d");
+    uint64_t numberOfBytes{0U};
+    {
+        RecordingWriter sut(basePath);
+        auto index = sut.addService(service1);
+        ASSERT_FALSE(index.has_error());
+        EXPECT_FALSE(sut.write(index.value(), createChunk(8U, 1U)).has_error());
+        numberOfBytes = sut.numberOfBytes();
+    }
+
+    std::ifstream segment(segmentPath(0U), std::ios::binary | std::ios::ate);
+    ASSERT_TRUE(segment.good());
+    EXPECT_THAT(static_cast<uint64_t>(segment.tellg()), Eq(sizeof(RecordingSegmentHeader) + numberOfBytes));
+}
+
+TEST_F(Recording_test, AddingAServiceTwiceReturnsTheSameIndex)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "368329d8-0b6f-40a9-8dfd-c297dea77d64");
+    RecordingWriter sut(basePath);
+    auto index1 = sut.addService(service1);
+    auto index2 = sut.addService(service2);
+    auto index3 = sut.addService(service1);
+    ASSERT_FALSE(index1.has_error());
+    ASSERT_FALSE(index2.has_error());
+    ASSERT_FALSE(index3.has_error());
+
+    EXPECT_THAT(index1.value(), Ne(index2.value()));
+    EXPECT_THAT(index1.value(), Eq(index3.value()));
+}
+
+TEST_F(Recording_test, WritingAChunkOfAnUnknownServiceFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "84539ae9-ae75-4797-9f31-e8df257fc49b");
+    RecordingWriter sut(basePath);
+
+    auto result = sut.write(0U, createChunk(8U, 1U));
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(RecordingError::UNKNOWN_SERVICE));
+    EXPECT_THAT(sut.numberOfChunks(), Eq(0U));
+}
+
+TEST_F(Recording_test, WritingAChunkWhichExceedsTheSegmentSizeFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4d554fdc-a1be-4e25-8952-7cc8b7db6365");
+    RecordingWriter sut(basePath, RecordingWriter::MIN_SEGMENT_SIZE);
+    auto index = sut.addService(service1);
+    ASSERT_FALSE(index.has_error());
+
+    auto result = sut.write(index.value(), createChunk(RecordingWriter::MIN_SEGMENT_SIZE, 1U));
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(RecordingError::RECORD_TOO_LARGE));
+}
+
+TEST_F(Recording_test, WritingFailsWhenTheDiskSpaceOfASegmentCannotBeAllocated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "be0a2fa5-75e8-42a9-a14d-71222fa652ec");
+    // exceeds the maximum file size and the available disk space of every file system
+    constexpr uint64_t UNALLOCATABLE_SEGMENT_SIZE{1ULL << 50U};
+    RecordingWriter sut(basePath, UNALLOCATABLE_SEGMENT_SIZE);
+    auto index = sut.addService(service1);
+    ASSERT_FALSE(index.has_error());
+
+    auto result = sut.write(index.value(), createChunk(8U, 1U));
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(RecordingError::DISK_SPACE_ALLOCATION_FAILED));
+    EXPECT_THAT(sut.numberOfChunks(), Eq(0U));
+    EXPECT_THAT(numberOfSegments(), Eq(0U));
+}
+
+TEST_F(Recording_test, NextSegmentIsPreparedAndRemovedWhenItIsNotUsed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0e2574a9-1592-43ce-bb10-5fa004d59ef4");
+    {
+        RecordingWriter sut(basePath, RecordingWriter::MIN_SEGMENT_SIZE);
+        auto index = sut.addService(service1);
+        ASSERT_FALSE(index.has_error());
+        EXPECT_FALSE(sut.write(index.value(), createChunk(8U, 1U)).has_error());
+
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (numberOfSegments() < 2U && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        EXPECT_THAT(numberOfSegments(), Eq(2U));
+    }
+
+    EXPECT_THAT(numberOfSegments(), Eq(1U));
+    RecordingReader reader(basePath);
+    EXPECT_FALSE(reader.next().has_error());
+    ASSERT_TRUE(reader.next().has_error());
+}
+
+TEST_F(Recording_test, TheRecordingTimeIsUsedWithoutAPublishTimestamp)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "53631e91-cadb-4a02-8b18-dbd3d886f89b");
+    const uint64_t timeBeforeRecording = ChunkHeader::publishTimestampNow();
+    {
+        RecordingWriter sut(basePath);
+        auto index = sut.addService(service1);
+        ASSERT_FALSE(index.has_error());
+        EXPECT_FALSE(sut.write(index.value(), createChunk(8U, 1U)).has_error());
+    }
+
+    RecordingReader reader(basePath);
+    auto chunk = reader.next();
+    ASSERT_FALSE(chunk.has_error());
+    // without a publish timestamp the time of the recording is used
+    EXPECT_THAT(chunk.value().timestamp, Ge(timeBeforeRecording));
+    EXPECT_THAT(chunk.value().timestamp, Le(ChunkHeader::publishTimestampNow()));
+}
+
+TEST_F(Recording_test, ReadingAMissingRecordingFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7812c637-ee14-42c5-b728-b20a2e1e4649");
+    RecordingReader sut(basePath);
+
+    auto chunk = sut.next();
+
+    ASSERT_TRUE(chunk.has_error());
+    EXPECT_THAT(chunk.get_error(), Eq(RecordingError::FILE_ACCESS_FAILED));
+}
+
+TEST_F(Recording_test, ReadingAFileWhichIsNoRecordingFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3d078465-5486-4386-a12e-a61b8f6569fa");
+    {
+        std::ofstream segment(segmentPath(0U), std::ios::binary);
+        segment << std::string(1024U, 'x');
+    }
+    RecordingReader sut(basePath);
+
+    auto chunk = sut.next();
+
+    ASSERT_TRUE(chunk.has_error());
+    EXPECT_THAT(chunk.get_error(), Eq(RecordingError::INVALID_FORMAT));
+}
+
+} // namespace
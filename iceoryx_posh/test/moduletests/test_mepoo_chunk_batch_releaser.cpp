@@ -0,0 +1,123 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_batch_releaser.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "test.hpp"
+
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::mepoo;
+
+class ChunkBatchReleaser_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        MePooConfig mempoolconf;
+        mempoolconf.addMemPool({SMALL_CHUNK, NUMBER_OF_CHUNKS});
+        mempoolconf.addMemPool({BIG_CHUNK, NUMBER_OF_CHUNKS});
+        memoryManager.configureMemoryManager(mempoolconf, allocator, allocator);
+    }
+
+    SharedChunk getChunk(const uint32_t userPayloadSize)
+    {
+        auto chunkSettingsResult = ChunkSettings::create(userPayloadSize, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+        EXPECT_FALSE(chunkSettingsResult.has_error());
+        auto chunk = memoryManager.getChunk(chunkSettingsResult.value());
+        EXPECT_FALSE(chunk.has_error());
+        return chunk.has_error() ? SharedChunk() : chunk.value();
+    }
+
+    uint32_t numberOfUsedChunks()
+    {
+        uint32_t usedChunks{0U};
+        for (uint32_t i = 0U; i < memoryManager.getNumberOfMemPools(); ++i)
+        {
+            usedChunks += memoryManager.getMemPoolInfo(i).m_usedChunks;
+        }
+        return usedChunks;
+    }
+
+    static constexpr uint32_t NUMBER_OF_CHUNKS{3U * ChunkBatchReleaser::CAPACITY};
+    static constexpr uint32_t SMALL_CHUNK{128U};
+    static constexpr uint32_t BIG_CHUNK{256U};
+    static constexpr uint64_t MEMORY_SIZE{1024U * 1024U};
+
+    std::vector<uint8_t> memory = std::vector<uint8_t>(MEMORY_SIZE);
+    iox::posix::Allocator allocator{memory.data(), MEMORY_SIZE};
+    MemoryManager memoryManager;
+};
+
+TEST_F(ChunkBatchReleaser_test, ChunksWithoutOtherOwnersAreReleasedOnDestruction)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4c6d1e3b-4b26-48f4-9ca9-b10e8ee5d781");
+    {
+        ChunkBatchReleaser sut;
+        sut.release(getChunk(SMALL_CHUNK / 2U));
+        sut.release(getChunk(BIG_CHUNK / 2U));
+
+        EXPECT_THAT(numberOfUsedChunks(), Eq(2U));
+    }
+
+    EXPECT_THAT(numberOfUsedChunks(), Eq(0U));
+}
+
+TEST_F(ChunkBatchReleaser_test, ChunksWithOtherOwnersAreNotReleased)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0fc7d481-daaa-413a-85bd-af5dcdb06dc4");
+    auto chunk = getChunk(SMALL_CHUNK / 2U);
+    {
+        ChunkBatchReleaser sut;
+        auto copyOfChunk = chunk;
+        sut.release(std::move(copyOfChunk));
+    }
+
+    EXPECT_THAT(numberOfUsedChunks(), Eq(1U));
+    EXPECT_THAT(chunk.getUserPayload(), Ne(nullptr));
+}
+
+TEST_F(ChunkBatchReleaser_test, ReleasingAnEmptySharedChunkHasNoEffect)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "08cb2b99-cfe9-4973-9d97-762314aeb794");
+    ChunkBatchReleaser sut;
+    sut.release(SharedChunk());
+    sut.flush();
+
+    EXPECT_THAT(numberOfUsedChunks(), Eq(0U));
+}
+
+TEST_F(ChunkBatchReleaser_test, MoreChunksThanCapacityAreReleased)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "30e1b8c2-9b1b-43cc-95c7-5f3c6659f97a");
+    ChunkBatchReleaser sut;
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        sut.release(getChunk(SMALL_CHUNK / 2U));
+        sut.release(getChunk(BIG_CHUNK / 2U));
+    }
+
+    EXPECT_THAT(numberOfUsedChunks(), Le(ChunkBatchReleaser::CAPACITY));
+    sut.flush();
+    EXPECT_THAT(numberOfUsedChunks(), Eq(0U));
+}
+
+} // namespace
@@ -452,6 +452,104 @@ TEST_F(MemoryManager_test, freeChunkMultiMemPoolFullToEmptyToFull)
     EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(CHUNK_COUNT));
 }
 
+TEST_F(MemoryManager_test, getChunkWithSpillPolicyAcquiresChunksFromNextLargerMemPoolWhenBestFitIsExhausted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9e969e0b-e4c9-43ad-a76f-78a1cceb94bd");
+    constexpr uint32_t CHUNK_COUNT{10};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT});
+    mempoolconf.m_spillPolicy = iox::mepoo::MemPoolSpillPolicy::SPILL_TO_LARGER_MEMPOOLS;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_64);
+    auto spilledChunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_64);
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(2).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(0U));
+
+    ASSERT_FALSE(spilledChunkStore.empty());
+    auto memPoolIndex = sut->getMemPoolIndex(spilledChunkStore.front());
+    ASSERT_TRUE(memPoolIndex.has_value());
+    EXPECT_THAT(memPoolIndex.value(), Eq(2U));
+}
+
+TEST_F(MemoryManager_test, getChunkWithSpillPolicyFailsWhenAllLargerMemPoolsAreExhausted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3142b513-9da0-4ef9-8adb-278ee628db68");
+    constexpr uint32_t CHUNK_COUNT{10};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.m_spillPolicy = iox::mepoo::MemPoolSpillPolicy::SPILL_TO_LARGER_MEMPOOLS;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(2U * CHUNK_COUNT, chunkSettings_32);
+
+    constexpr auto EXPECTED_ERROR{iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS};
+    sut->getChunk(chunkSettings_32)
+        .and_then(
+            [&](auto&) { GTEST_FAIL() << "getChunk should fail with '" << EXPECTED_ERROR << "' but did not fail"; })
+        .or_else([&](const auto& error) { EXPECT_EQ(error, EXPECTED_ERROR); });
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(CHUNK_COUNT));
+}
+
+TEST_F(MemoryManager_test, getChunkWithManyMemPoolsSelectsSmallestFittingMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f258e979-3696-42ab-b467-f06c03f0833d");
+    constexpr uint32_t NUMBER_OF_MEMPOOLS{iox::MAX_NUMBER_OF_MEMPOOLS};
+    constexpr uint32_t CHUNK_COUNT{2};
+    constexpr uint32_t CHUNK_PAYLOAD_SIZE_STEP{24};
+    constexpr uint32_t MAX_USER_PAYLOAD_SIZE{CHUNK_PAYLOAD_SIZE_STEP * NUMBER_OF_MEMPOOLS * NUMBER_OF_MEMPOOLS};
+
+    for (uint32_t i = 0; i < NUMBER_OF_MEMPOOLS; ++i)
+    {
+        mempoolconf.addMemPool({CHUNK_PAYLOAD_SIZE_STEP * (i + 1U) * (i + 1U), CHUNK_COUNT});
+    }
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    for (uint32_t userPayloadSize = 0U; userPayloadSize <= MAX_USER_PAYLOAD_SIZE; userPayloadSize += 7U)
+    {
+        auto chunkSettings =
+            ChunkSettings::create(userPayloadSize, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value();
+
+        uint32_t expectedMemPoolIndex{0U};
+        while (sut->getMemPoolInfo(expectedMemPoolIndex).m_chunkSize < chunkSettings.requiredChunkSize())
+        {
+            ++expectedMemPoolIndex;
+        }
+
+        sut->getChunk(chunkSettings)
+            .and_then([&](auto& chunk) {
+                auto memPoolIndex = sut->getMemPoolIndex(chunk);
+                ASSERT_TRUE(memPoolIndex.has_value());
+                EXPECT_THAT(memPoolIndex.value(), Eq(expectedMemPoolIndex));
+                EXPECT_THAT(chunk.getChunkHeader()->chunkSize(),
+                            Eq(sut->getMemPoolInfo(expectedMemPoolIndex).m_chunkSize));
+            })
+            .or_else([&](const auto& error) {
+                GTEST_FAIL() << "getChunk for payload size " << userPayloadSize << " failed with: " << error;
+            });
+    }
+}
+
+TEST_F(MemoryManager_test, getMemPoolIndexOfInvalidChunkReturnsNullopt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f882b24d-37eb-496c-9f01-077b6929b91c");
+    mempoolconf.addMemPool({CHUNK_SIZE_32, 10});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::SharedChunk invalidChunk;
+
+    EXPECT_FALSE(sut->getMemPoolIndex(invalidChunk).has_value());
+}
+
 TEST_F(MemoryManager_test, getChunkWithUserPayloadSizeZeroShouldNotFail)
 {
     ::testing::Test::RecordProperty("TEST_ID", "9fbfe1ff-9d59-449b-b164-433bbb031125");
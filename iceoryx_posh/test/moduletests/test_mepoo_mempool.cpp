@@ -17,8 +17,12 @@
 
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/mepoo/thread_local_chunk_cache.hpp"
 #include "test.hpp"
 
+#include <algorithm>
+#include <thread>
+
 namespace
 {
 using namespace ::testing;
@@ -221,4 +225,198 @@ TEST_F(MemPool_test, dieWhenMempoolChunkSizeIsNotPowerOf32)
     EXPECT_DEATH({ iox::mepoo::MemPool sut(333, 10, allocator, allocator); }, ".*");
 }
 
+TEST_F(MemPool_test, GetChunksAcquiresAllChunksAndUpdatesTheUsageStatistics)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bb43b61b-2c71-4a05-b067-e5d8e928c5d7");
+    std::vector<void*> chunks(NUMBER_OF_CHUNKS, nullptr);
+
+    EXPECT_THAT(sut.getChunks(chunks.data(), NUMBER_OF_CHUNKS), Eq(NUMBER_OF_CHUNKS));
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(sut.getMinFree(), Eq(0U));
+    std::sort(chunks.begin(), chunks.end());
+    EXPECT_THAT(std::adjacent_find(chunks.begin(), chunks.end()), Eq(chunks.end()));
+    EXPECT_THAT(sut.getChunk(), Eq(nullptr));
+}
+
+TEST_F(MemPool_test, GetChunksAcquiresOnlyTheAvailableChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "02f07041-09df-4186-b44c-526b2e73360c");
+    constexpr uint32_t NUMBER_OF_USED_CHUNKS{NUMBER_OF_CHUNKS / 2U};
+    for (uint32_t i = 0U; i < NUMBER_OF_USED_CHUNKS; ++i)
+    {
+        ASSERT_THAT(sut.getChunk(), Ne(nullptr));
+    }
+    std::vector<void*> chunks(NUMBER_OF_CHUNKS, nullptr);
+
+    EXPECT_THAT(sut.getChunks(chunks.data(), NUMBER_OF_CHUNKS), Eq(NUMBER_OF_CHUNKS - NUMBER_OF_USED_CHUNKS));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TEST_F(MemPool_test, FreeChunksReleasesAllChunksAndUpdatesTheUsageStatistics)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "11a4ea68-4c4d-4f67-993c-27163479054d");
+    std::vector<void*> chunks(NUMBER_OF_CHUNKS, nullptr);
+    ASSERT_THAT(sut.getChunks(chunks.data(), NUMBER_OF_CHUNKS), Eq(NUMBER_OF_CHUNKS));
+
+    sut.freeChunks(chunks.data(), NUMBER_OF_CHUNKS);
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(sut.getMinFree(), Eq(0U));
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_THAT(sut.getChunk(), Ne(nullptr));
+    }
+}
+
+TEST_F(MemPool_test, FreeChunksWithChunkReleasedTwiceReturnsError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4adb8106-dced-4ea3-9e45-5a91dd360577");
+    std::vector<void*> chunks(2U, nullptr);
+    ASSERT_THAT(sut.getChunks(chunks.data(), 1U), Eq(1U));
+    chunks[1] = chunks[0];
+
+    iox::cxx::optional<iox::PoshError> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&detectedError](const iox::PoshError error, const iox::ErrorLevel) { detectedError.emplace(error); });
+
+    sut.freeChunks(chunks.data(), 2U);
+
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(), Eq(iox::PoshError::POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE));
+}
+
+class MemPoolWithThreadLocalChunkCache_test : public MemPool_test
+{
+  public:
+    void SetUp() override
+    {
+        ThreadLocalChunkCache::enable();
+    }
+    void TearDown() override
+    {
+        ThreadLocalChunkCache::disable();
+    }
+};
+
+TEST_F(MemPoolWithThreadLocalChunkCache_test, AllChunksCanBeAcquiredWithEnabledCache)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6b1a7ead-db7d-4abd-a46d-d3399c30e3f7");
+    std::vector<uint8_t*> chunks;
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto chunk = reinterpret_cast<uint8_t*>(sut.getChunk());
+        ASSERT_THAT(chunk, Ne(nullptr));
+        chunks.push_back(chunk);
+    }
+
+    EXPECT_THAT(sut.getChunk(), Eq(nullptr));
+    std::sort(chunks.begin(), chunks.end());
+    EXPECT_THAT(std::unique(chunks.begin(), chunks.end()), Eq(chunks.end()));
+}
+
+TEST_F(MemPoolWithThreadLocalChunkCache_test, UsedChunksAreExactAfterFlush)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4668241b-fbc3-4032-9f4f-27db3bc42d15");
+    constexpr uint32_t NUMBER_OF_ACQUIRED_CHUNKS{NUMBER_OF_CHUNKS / 2U + 3U};
+    std::vector<void*> chunks;
+    for (uint32_t i = 0U; i < NUMBER_OF_ACQUIRED_CHUNKS; ++i)
+    {
+        chunks.push_back(sut.getChunk());
+    }
+
+    EXPECT_THAT(sut.getUsedChunks(), Le(NUMBER_OF_ACQUIRED_CHUNKS));
+    EXPECT_THAT(sut.getUsedChunks() + ThreadLocalChunkCache::CHUNK_CAPACITY_PER_MEMPOOL,
+                Ge(NUMBER_OF_ACQUIRED_CHUNKS));
+
+    ThreadLocalChunkCache::flush();
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_ACQUIRED_CHUNKS));
+    EXPECT_THAT(sut.getMinFree(), Eq(NUMBER_OF_CHUNKS - NUMBER_OF_ACQUIRED_CHUNKS));
+
+    for (auto chunk : chunks)
+    {
+        sut.freeChunk(chunk);
+    }
+    ThreadLocalChunkCache::flush();
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0U));
+}
+
+TEST_F(MemPoolWithThreadLocalChunkCache_test, ChunksReleasedInOtherThreadAreAvailableAfterThreadTermination)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d7087cd4-094d-4547-8cdf-bfbf52de20aa");
+    std::vector<void*> chunks;
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.push_back(sut.getChunk());
+    }
+    ThreadLocalChunkCache::flush();
+
+    std::thread releasingThread([&] {
+        ThreadLocalChunkCache::enable();
+        for (auto chunk : chunks)
+        {
+            sut.freeChunk(chunk);
+        }
+    });
+    releasingThread.join();
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0U));
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_THAT(sut.getChunk(), Ne(nullptr));
+    }
+}
+
+TEST_F(MemPoolWithThreadLocalChunkCache_test, ChunksReleasedInThreadWithoutCacheDoNotCorruptTheUsageStatistics)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5240655f-f19d-438c-82ec-af2863f22f3d");
+    constexpr uint32_t NUMBER_OF_ACQUIRED_CHUNKS{ThreadLocalChunkCache::CHUNK_CAPACITY_PER_MEMPOOL / 2U};
+    std::vector<void*> chunks;
+    for (uint32_t i = 0U; i < NUMBER_OF_ACQUIRED_CHUNKS; ++i)
+    {
+        chunks.push_back(sut.getChunk());
+    }
+
+    // the loans from the magazine are not accounted for yet when another thread releases the chunks
+    std::thread releasingThread([&] {
+        for (auto chunk : chunks)
+        {
+            sut.freeChunk(chunk);
+        }
+    });
+    releasingThread.join();
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(sut.getInfo().m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut.getMinFree(), Le(NUMBER_OF_CHUNKS));
+
+    ThreadLocalChunkCache::flush();
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0U));
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_THAT(sut.getChunk(), Ne(nullptr));
+    }
+    EXPECT_THAT(sut.getUsedChunks(), Le(NUMBER_OF_CHUNKS));
+}
+
+TEST_F(MemPoolWithThreadLocalChunkCache_test, DoubleFreeIsDetectedWhenTheCacheIsFlushed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "58650c6f-8384-49a7-8c1b-0b4abe8f6a1c");
+    auto chunk = sut.getChunk();
+    sut.freeChunk(chunk);
+    sut.freeChunk(chunk);
+
+    iox::cxx::optional<iox::PoshError> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&detectedError](const iox::PoshError error, const iox::ErrorLevel) { detectedError.emplace(error); });
+
+    ThreadLocalChunkCache::flush();
+
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(), Eq(iox::PoshError::POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE));
+}
+
 } // namespace
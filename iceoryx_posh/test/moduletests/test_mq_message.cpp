@@ -458,5 +458,24 @@ TEST_F(IpcMessage_test, setMessage)
     EXPECT_THAT(message1.isValid(), Eq(false));
 }
 
+TEST_F(IpcMessage_test, getElementAtIndexWorksWithEmptyElementsAndEntriesAddedAfterSetMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0c3c1a7e-5d0f-4f0b-9c57-2b8e4a9d6f31");
+    IpcMessage message;
+
+    message.setMessage(",a,,bc,");
+    message << "" << "def";
+    EXPECT_THAT(message.isValid(), Eq(true));
+    ASSERT_THAT(message.getNumberOfElements(), Eq(6u));
+    EXPECT_THAT(message.getElementAtIndex(0), Eq(""));
+    EXPECT_THAT(message.getElementAtIndex(1), Eq("a"));
+    EXPECT_THAT(message.getElementAtIndex(2), Eq(""));
+    EXPECT_THAT(message.getElementAtIndex(3), Eq("bc"));
+    EXPECT_THAT(message.getElementAtIndex(4), Eq(""));
+    EXPECT_THAT(message.getElementAtIndex(5), Eq("def"));
+    EXPECT_THAT(message.getElementAtIndex(6), Eq(""));
+    EXPECT_THAT(message.getMessage(), Eq(",a,,bc,,def,"));
+}
+
 } // namespace
 #endif
@@ -24,6 +24,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "test.hpp"
@@ -822,4 +823,404 @@ TYPED_TEST(ChunkDistributor_test, MultipleBlockingQueuesWillBeFilledWhenThereBec
     }
 }
 
+TYPED_TEST(ChunkDistributor_test, BlockedDeliveryIsWokenUpByConsumerBeforeWaitTimeoutExpires)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0b7c5d8e-52a6-4f1e-9d0a-3c2f4e6b8a17");
+    constexpr auto WAIT_FOR_CONSUMER_TIMEOUT = iox::units::Duration::fromSeconds(10U);
+    auto sutData = std::make_shared<typename TestFixture::ChunkDistributorData_t>(
+        ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER, 0U, WAIT_FOR_CONSUMER_TIMEOUT);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(61U));
+
+    EXPECT_THAT(sut.getTimeWaitedForConsumers(), Eq(iox::units::Duration::fromNanoseconds(0U)));
+
+    Barrier isThreadStarted(1U);
+    std::atomic_bool wasChunkDelivered{false};
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        sut.deliverToAllStoredQueues(this->allocateChunk(62U));
+        wasChunkDelivered = true;
+    });
+
+    isThreadStarted.wait();
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(false));
+
+    const auto popTime = std::chrono::steady_clock::now();
+    EXPECT_TRUE(queue.tryPop().has_value());
+    t1.join();
+    const auto wakeUpLatency = std::chrono::steady_clock::now() - popTime;
+
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(true));
+    EXPECT_THAT(wakeUpLatency, Lt(std::chrono::seconds(2)));
+    EXPECT_THAT(sut.getTimeWaitedForConsumers(), Gt(iox::units::Duration::fromNanoseconds(0U)));
+}
+
+TYPED_TEST(ChunkDistributor_test, RemovingQueueWakesUpBlockedDelivery)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e4a1f3c2-9b8d-4d6e-8f70-1a2b3c4d5e6f");
+    constexpr auto WAIT_FOR_CONSUMER_TIMEOUT = iox::units::Duration::fromSeconds(10U);
+    auto sutData = std::make_shared<typename TestFixture::ChunkDistributorData_t>(
+        ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER, 0U, WAIT_FOR_CONSUMER_TIMEOUT);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(71U));
+
+    Barrier isThreadStarted(1U);
+    std::atomic_bool wasDeliveryFinished{false};
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        sut.deliverToAllStoredQueues(this->allocateChunk(72U));
+        wasDeliveryFinished = true;
+    });
+
+    isThreadStarted.wait();
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_THAT(wasDeliveryFinished.load(), Eq(false));
+
+    const auto removeTime = std::chrono::steady_clock::now();
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    t1.join();
+    const auto wakeUpLatency = std::chrono::steady_clock::now() - removeTime;
+
+    EXPECT_THAT(wasDeliveryFinished.load(), Eq(true));
+    EXPECT_THAT(wakeUpLatency, Lt(std::chrono::seconds(2)));
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(71U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWithoutHistoryDoesNotTakeTheLock)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6d4e430f-c0a5-43a5-95d3-b58422047aa5");
+    auto sutData = std::make_shared<typename TestFixture::ChunkDistributorData_t>(
+        ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, 0U);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    Barrier isLockTaken(1U);
+    Barrier isDeliveryDone(1U);
+    std::thread lockingThread([&] {
+        sutData->lock();
+        isLockTaken.notify();
+        isDeliveryDone.wait();
+        sutData->unlock();
+    });
+    isLockTaken.wait();
+
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(4451U)), Eq(1U));
+
+    isDeliveryDone.notify();
+    lockingThread.join();
+
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(4451U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesDoesNotDeliverToRemovedQueues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f1b0faf-03e2-46e8-9cec-a555e2be68bc");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData = this->getChunkQueueData();
+    auto removedQueueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> removedQueue(removedQueueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(removedQueueData.get()).has_error());
+    ASSERT_FALSE(sut.tryRemoveQueue(removedQueueData.get()).has_error());
+
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(7U)), Eq(1U));
+    EXPECT_THAT(removedQueue.tryPop().has_value(), Eq(false));
+
+    sut.removeAllQueues();
+
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(8U)), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, ConcurrentQueueChangesDoNotAffectDeliveryToOtherQueues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6e47736c-e977-4311-9d76-6e99a0b792ec");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData = this->getChunkQueueData();
+    // the history is pushed by the changing thread while the delivery pushes concurrently
+    auto changingQueueData = this->getChunkQueueData(QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                                     VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> changingQueue(changingQueueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{1000U};
+    std::atomic_bool isDeliveryDone{false};
+    std::thread changingThread([&] {
+        while (!isDeliveryDone)
+        {
+            IOX_DISCARD_RESULT(sut.tryAddQueue(changingQueueData.get()));
+            IOX_DISCARD_RESULT(sut.tryRemoveQueue(changingQueueData.get()));
+        }
+    });
+
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        const auto numberOfDeliveries = sut.deliverToAllStoredQueues(this->allocateChunk(i));
+        EXPECT_THAT(numberOfDeliveries, AllOf(Ge(1U), Le(2U)));
+
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i));
+        changingQueue.clear();
+    }
+
+    isDeliveryDone = true;
+    changingThread.join();
+}
+
+TYPED_TEST(ChunkDistributor_test, QueueAddedWhileADeliveryIsBlockedReceivesTheChunkWithHistory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0336d671-235e-48a6-8001-bcffc1b82df7");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto blockingQueueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> blockingQueue(blockingQueueData.get());
+    blockingQueue.setCapacity(1U);
+    ASSERT_FALSE(sut.tryAddQueue(blockingQueueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(7U));
+
+    Barrier isThreadStarted(1U);
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        sut.deliverToAllStoredQueues(this->allocateChunk(8U));
+    });
+    isThreadStarted.wait();
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+
+    // the blocked delivery does not know the added queue and the history does not contain its chunk yet
+    auto addedQueueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> addedQueue(addedQueueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(addedQueueData.get(), 1U).has_error());
+
+    blockingQueue.clear();
+    t1.join();
+
+    auto maybeSharedChunk = addedQueue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(7U));
+    maybeSharedChunk = addedQueue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(8U));
+}
+
+TYPED_TEST(ChunkDistributor_test, QueuesAddedWhilePublishingWithHistoryReceiveAllChunksWithoutGaps)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "394f208d-e222-48aa-ad06-b84ea3082e7b");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    // two alternating queues, this way a delivery cannot see the queue it is pushing to removed and added again
+    std::shared_ptr<typename TestFixture::ChunkQueueData_t> queueData[2]{
+        this->getChunkQueueData(QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                VariantQueueTypes::FiFo_MultiProducerSingleConsumer),
+        this->getChunkQueueData(QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                VariantQueueTypes::FiFo_MultiProducerSingleConsumer)};
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{5000U};
+    constexpr uint64_t CHUNKS_PER_SUBSCRIPTION{8U};
+    sut.deliverToAllStoredQueues(this->allocateChunk(0U));
+    std::atomic<uint64_t> numberOfPublishedChunks{1U};
+    std::atomic<uint64_t> publishLimit{1U};
+    uint64_t numberOfSubscriptions{0U};
+    uint64_t numberOfChunksWithGaps{0U};
+
+    std::thread subscribingThread([&] {
+        while (numberOfPublishedChunks.load() < NUMBER_OF_CHUNKS)
+        {
+            auto& currentQueueData = queueData[numberOfSubscriptions % 2U];
+            ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(currentQueueData.get());
+
+            // the subscription races with the deliveries which are allowed to start now
+            const auto subscribedLimit = numberOfPublishedChunks.load() + CHUNKS_PER_SUBSCRIPTION;
+            publishLimit.store(subscribedLimit);
+            IOX_DISCARD_RESULT(sut.tryAddQueue(currentQueueData.get(), 1U));
+            while (numberOfPublishedChunks.load() < std::min(subscribedLimit, NUMBER_OF_CHUNKS))
+            {
+                std::this_thread::yield();
+            }
+            IOX_DISCARD_RESULT(sut.tryRemoveQueue(currentQueueData.get()));
+            ++numberOfSubscriptions;
+
+            // the history provides the last chunk before the subscription, the deliveries all following ones
+            auto maybeSharedChunk = queue.tryPop();
+            if (!maybeSharedChunk.has_value())
+            {
+                ++numberOfChunksWithGaps;
+                continue;
+            }
+            auto expectedValue = this->getSharedChunkValue(*maybeSharedChunk) + 1U;
+            for (maybeSharedChunk = queue.tryPop(); maybeSharedChunk.has_value(); maybeSharedChunk = queue.tryPop())
+            {
+                const auto value = this->getSharedChunkValue(*maybeSharedChunk);
+                if (value != expectedValue)
+                {
+                    ++numberOfChunksWithGaps;
+                }
+                expectedValue = value + 1U;
+            }
+        }
+    });
+
+    for (uint64_t i = 1U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        while (i >= publishLimit.load())
+        {
+            std::this_thread::yield();
+        }
+        sut.deliverToAllStoredQueues(this->allocateChunk(i));
+        numberOfPublishedChunks.store(i + 1U);
+    }
+
+    subscribingThread.join();
+    EXPECT_THAT(numberOfSubscriptions, Gt(0U));
+    EXPECT_THAT(numberOfChunksWithGaps, Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, RemovedQueueIsReleasedOnlyAfterTheRunningDeliveriesFinished)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f55b181f-a190-429f-9753-014d08581840");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    EXPECT_TRUE(queue.isReferencedByDistributors());
+
+    // simulate a delivery which started before the removal and did not finish yet
+    auto& activeDeliveries = sutData->m_activeLockFreeDeliveries[sutData->m_lockFreeDeliveryEpoch.load() % 2U];
+    activeDeliveries.fetch_add(1U);
+
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    EXPECT_FALSE(sut.hasStoredQueues());
+    EXPECT_TRUE(queue.isReferencedByDistributors());
+    EXPECT_FALSE(sut.releaseRemovedQueues());
+    EXPECT_TRUE(queue.isReferencedByDistributors());
+
+    activeDeliveries.fetch_sub(1U);
+
+    EXPECT_TRUE(sut.releaseRemovedQueues());
+    EXPECT_FALSE(queue.isReferencedByDistributors());
+}
+
+TYPED_TEST(ChunkDistributor_test, QueueWhichIsRemovedRepeatedlyDuringAGracePeriodIsReleasedOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "71c5d9c0-5387-492e-a508-9509aa14c2f6");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+
+    auto& activeDeliveries = sutData->m_activeLockFreeDeliveries[sutData->m_lockFreeDeliveryEpoch.load() % 2U];
+    activeDeliveries.fetch_add(1U);
+
+    for (uint32_t i = 0U; i < TestFixture::MAX_NUMBER_QUEUES * 2U; ++i)
+    {
+        ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+        ASSERT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    }
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    sut.removeAllQueues();
+    EXPECT_TRUE(queue.isReferencedByDistributors());
+
+    activeDeliveries.fetch_sub(1U);
+
+    EXPECT_TRUE(sut.releaseRemovedQueues());
+    EXPECT_FALSE(queue.isReferencedByDistributors());
+}
+
+TYPED_TEST(ChunkDistributor_test, CleanupReleasesQueuesOfDeliveriesWhichDidNotFinish)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7288056d-57f8-48e6-b2bd-a9e3c97cdefa");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto removedQueueData = this->getChunkQueueData();
+    auto storedQueueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> removedQueue(removedQueueData.get());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> storedQueue(storedQueueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(removedQueueData.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(storedQueueData.get()).has_error());
+
+    // the delivery of a terminated process never finishes
+    sutData->m_activeLockFreeDeliveries[sutData->m_lockFreeDeliveryEpoch.load() % 2U].fetch_add(1U);
+    ASSERT_FALSE(sut.tryRemoveQueue(removedQueueData.get()).has_error());
+    EXPECT_FALSE(sut.releaseRemovedQueues());
+
+    sut.cleanup();
+
+    EXPECT_FALSE(removedQueue.isReferencedByDistributors());
+    EXPECT_FALSE(storedQueue.isReferencedByDistributors());
+    EXPECT_FALSE(sut.hasStoredQueues());
+}
+
+TYPED_TEST(ChunkDistributor_test, DetachOfConditionVariableWaitsUntilCleanupFreesTheSlotOfATerminatedNotifier)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dcefaa22-e8fd-4e6a-9442-b693e61751c4");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ConditionVariableData condVar("Horscht");
+    queue.setConditionVariable(condVar, 0U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    // the delivering process terminated while it notified the condition variable of the queue
+    queueData->m_activeNotifiers[0U].store(sutData->m_notifierId);
+
+    std::atomic_bool isDetached{false};
+    std::thread detachingThread([&] {
+        queue.unsetConditionVariable();
+        isDetached = true;
+    });
+
+    std::this_thread::sleep_for(this->BLOCKING_DURATION * 3U);
+    EXPECT_FALSE(isDetached.load());
+
+    sut.cleanup();
+    detachingThread.join();
+
+    EXPECT_TRUE(isDetached.load());
+    EXPECT_FALSE(queue.isConditionVariableSet());
+}
+
+TYPED_TEST(ChunkDistributor_test, CleanupDoesNotFreeTheNotifierSlotsOfOtherDistributors)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f5e5f95f-0ac5-46da-8e0b-a826047ca49f");
+    auto sutData = this->getChunkDistributorData();
+    auto otherData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    ASSERT_THAT(otherData->m_notifierId, Ne(sutData->m_notifierId));
+
+    queueData->m_activeNotifiers[0U].store(sutData->m_notifierId);
+    queueData->m_activeNotifiers[1U].store(otherData->m_notifierId);
+
+    sut.cleanup();
+
+    EXPECT_THAT(queueData->m_activeNotifiers[0U].load(), Eq(iox::popo::NO_NOTIFIER));
+    EXPECT_THAT(queueData->m_activeNotifiers[1U].load(), Eq(otherData->m_notifierId));
+}
+
 } // namespace
@@ -264,6 +264,22 @@ TYPED_TEST(ChunkQueue_test, AttachSecondConditionVariable)
     EXPECT_THAT(condVarWaiter2.timedWait(1_ms).empty(), Eq(false));
 }
 
+TYPED_TEST(ChunkQueue_test, PushAfterDetachedConditionVariableDoesNotNotify)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5d0e8b7a-2c41-4f93-a6e1-7b3c9d2f4e80");
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+
+    this->m_popper.setConditionVariable(condVar, 0U);
+    this->m_popper.unsetConditionVariable();
+    EXPECT_THAT(this->m_popper.isConditionVariableSet(), Eq(false));
+
+    auto chunk = this->allocateChunk();
+    this->m_pusher.push(chunk);
+
+    EXPECT_THAT(condVarWaiter.timedWait(1_ms).empty(), Eq(true));
+}
+
 /// @note this could be changed to a parameterized ChunkQueueSaturatingFIFO_test when there are more FIFOs available
 using ChunkQueueFiFoTestSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
 
@@ -23,6 +23,8 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_sender.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_sender_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iceoryx_posh/testing/mocks/chunk_mock.hpp"
@@ -93,6 +95,34 @@ class ChunkReceiver_test : public Test
     iox::popo::ChunkReceiver<ChunkReceiverData_t> m_chunkReceiver{&m_chunkReceiverData};
 
     iox::popo::ChunkQueuePusher<ChunkReceiverData_t> m_chunkQueuePusher{&m_chunkReceiverData};
+
+    using ChunkDistributorData_t = iox::popo::ChunkDistributorData<iox::DefaultChunkDistributorConfig,
+                                                                   iox::popo::ThreadSafePolicy,
+                                                                   iox::popo::ChunkQueuePusher<ChunkQueueData_t>>;
+    using ChunkSenderData_t =
+        iox::popo::ChunkSenderData<iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY, ChunkDistributorData_t>;
+
+    /// @brief sends a chunk to the given receiver data with a sender which adds the publish timestamp
+    void sendTimestampedChunk(ChunkReceiverData_t& receiverData)
+    {
+        constexpr bool PUBLISH_TIMESTAMP{true};
+        ChunkSenderData_t chunkSenderData{&m_memoryManager,
+                                          iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+                                          0U,
+                                          iox::mepoo::MemoryInfo(),
+                                          iox::DEFAULT_WAIT_FOR_CONSUMER_TIMEOUT,
+                                          PUBLISH_TIMESTAMP};
+        iox::popo::ChunkSender<ChunkSenderData_t> chunkSender{&chunkSenderData};
+        ASSERT_FALSE(chunkSender.tryAddQueue(&receiverData).has_error());
+        auto maybeChunkHeader = chunkSender.tryAllocate(iox::popo::UniquePortId(),
+                                                        sizeof(DummySample),
+                                                        alignof(DummySample),
+                                                        iox::CHUNK_NO_USER_HEADER_SIZE,
+                                                        iox::CHUNK_NO_USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        chunkSender.send(*maybeChunkHeader);
+        chunkSender.releaseAll();
+    }
 };
 
 TEST_F(ChunkReceiver_test, getNoChunkFromEmptyQueue)
@@ -235,6 +265,69 @@ TEST_F(ChunkReceiver_test, Cleanup)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(ChunkReceiver_test, LatencyIsNotRecordedByDefault)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a26a8d1b-6f62-4bd1-a7d4-6808a493190d");
+    sendTimestampedChunk(m_chunkReceiverData);
+
+    auto maybeChunkHeader = m_chunkReceiver.tryGet();
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT((*maybeChunkHeader)->publishTimestamp(), Ne(0U));
+    EXPECT_THAT(m_chunkReceiverData.m_latencyHistogram.sampleCount(), Eq(0U));
+    m_chunkReceiver.release(*maybeChunkHeader);
+}
+
+TEST_F(ChunkReceiver_test, LatencyIsRecordedForTimestampedChunksWhenEnabled)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "53c988f6-b6cb-4ade-bed1-52a0baa1f41a");
+    constexpr bool RECORD_LATENCY{true};
+    ChunkReceiverData_t chunkReceiverData{iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer,
+                                          iox::popo::QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                          iox::mepoo::MemoryInfo(),
+                                          RECORD_LATENCY};
+    iox::popo::ChunkReceiver<ChunkReceiverData_t> sut{&chunkReceiverData};
+
+    // a chunk without publish timestamp must be ignored
+    iox::popo::ChunkQueuePusher<ChunkReceiverData_t>{&chunkReceiverData}.push(getChunkFromMemoryManager());
+    sendTimestampedChunk(chunkReceiverData);
+
+    const auto timestampBeforeTake = iox::mepoo::ChunkHeader::publishTimestampNow();
+    auto chunkWithoutTimestamp = sut.tryGet();
+    auto chunkWithTimestamp = sut.tryGet();
+    const auto timestampAfterTake = iox::mepoo::ChunkHeader::publishTimestampNow();
+    ASSERT_FALSE(chunkWithoutTimestamp.has_error());
+    ASSERT_FALSE(chunkWithTimestamp.has_error());
+
+    const auto& histogram = chunkReceiverData.m_latencyHistogram;
+    EXPECT_THAT(histogram.sampleCount(), Eq(1U));
+    EXPECT_THAT(histogram.maxInNanoseconds(), Eq(histogram.sumInNanoseconds()));
+    EXPECT_THAT(histogram.maxInNanoseconds(), Le(timestampAfterTake - (*chunkWithTimestamp)->publishTimestamp()));
+    EXPECT_THAT(histogram.maxInNanoseconds(), Ge(timestampBeforeTake - (*chunkWithTimestamp)->publishTimestamp()));
+
+    sut.releaseAll();
+}
+
+TEST_F(ChunkReceiver_test, takenChunksAreCounted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ddf54534-e2e6-40bd-9570-0ea223720c2b");
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        iox::popo::ChunkQueuePusher<ChunkReceiverData_t>{&m_chunkReceiverData}.push(getChunkFromMemoryManager());
+    }
+    EXPECT_THAT(m_chunkReceiverData.m_numberOfReceivedChunks.value(), Eq(0U));
+
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeChunkHeader = m_chunkReceiver.tryGet();
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        m_chunkReceiver.release(*maybeChunkHeader);
+    }
+    EXPECT_TRUE(m_chunkReceiver.tryGet().has_error());
+
+    EXPECT_THAT(m_chunkReceiverData.m_numberOfReceivedChunks.value(), Eq(NUMBER_OF_CHUNKS));
+}
+
 TEST_F(ChunkReceiver_test, asStringLiteralConvertsChunkReceiveResultValuesToStrings)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5cbbda34-8a22-4eab-a8b6-20da345c1707");
@@ -394,6 +394,130 @@ TEST_F(ChunkSender_test, sendMultipleWithReceiver)
     }
 }
 
+TEST_F(ChunkSender_test, sendDoesNotSetPublishTimestampByDefault)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a1027b81-03a6-45c1-a13d-474f6ca6b9f5");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    m_chunkSender.send(*maybeChunkHeader);
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    auto popRet = myQueue.tryPop();
+    ASSERT_TRUE(popRet.has_value());
+    EXPECT_THAT(popRet->getChunkHeader()->publishTimestamp(), Eq(0U));
+}
+
+TEST_F(ChunkSender_test, sendSetsMonotonicPublishTimestampWhenEnabled)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a34daf83-8cff-4e76-bd68-fd6372296599");
+    constexpr bool PUBLISH_TIMESTAMP{true};
+    ChunkSenderData_t chunkSenderData{&m_memoryManager,
+                                      iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+                                      0U,
+                                      iox::mepoo::MemoryInfo(),
+                                      iox::DEFAULT_WAIT_FOR_CONSUMER_TIMEOUT,
+                                      PUBLISH_TIMESTAMP};
+    iox::popo::ChunkSender<ChunkSenderData_t> sut{&chunkSenderData};
+    ASSERT_FALSE(sut.tryAddQueue(&m_chunkQueueData).has_error());
+
+    const auto timestampBeforeSend = iox::mepoo::ChunkHeader::publishTimestampNow();
+    constexpr uint32_t NUMBER_OF_SENDS{2U};
+    for (uint32_t i = 0U; i < NUMBER_OF_SENDS; ++i)
+    {
+        auto maybeChunkHeader = sut.tryAllocate(
+            UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        sut.send(*maybeChunkHeader);
+    }
+    const auto timestampAfterSend = iox::mepoo::ChunkHeader::publishTimestampNow();
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    auto firstChunk = myQueue.tryPop();
+    auto secondChunk = myQueue.tryPop();
+    ASSERT_TRUE(firstChunk.has_value());
+    ASSERT_TRUE(secondChunk.has_value());
+    const auto firstTimestamp = firstChunk->getChunkHeader()->publishTimestamp();
+    const auto secondTimestamp = secondChunk->getChunkHeader()->publishTimestamp();
+    EXPECT_THAT(firstTimestamp, Ge(timestampBeforeSend));
+    EXPECT_THAT(secondTimestamp, Ge(firstTimestamp));
+    EXPECT_THAT(secondTimestamp, Le(timestampAfterSend));
+
+    sut.releaseAll();
+}
+
+TEST_F(ChunkSender_test, sendCountsSentChunksAndUserPayloadBytes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e7578f5b-fd8c-4fc1-b594-86e13e374b3b");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    constexpr uint64_t NUMBER_OF_SENDS{3U};
+    uint32_t chunkSize{0U};
+    for (uint64_t i = 0U; i < NUMBER_OF_SENDS; ++i)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(
+            UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        chunkSize = (*maybeChunkHeader)->chunkSize();
+        m_chunkSender.send(*maybeChunkHeader);
+    }
+
+    EXPECT_THAT(m_chunkSenderData.m_numberOfSentChunks.value(), Eq(NUMBER_OF_SENDS));
+    EXPECT_THAT(m_chunkSenderData.m_sentUserPayloadBytes.value(), Eq(NUMBER_OF_SENDS * sizeof(DummySample)));
+    EXPECT_THAT(m_chunkSenderData.m_lastSentChunkSize.load(), Eq(chunkSize));
+    EXPECT_THAT(m_chunkSenderData.m_numberOfLoanFailures.value(), Eq(0U));
+    EXPECT_THAT(m_chunkSenderData.m_numberOfLostChunks.value(), Eq(0U));
+}
+
+TEST_F(ChunkSender_test, failedAllocationIsCountedAsLoanFailure)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "44581ed5-5f8b-4c04-a4c3-f8d7d4a18dbd");
+    std::vector<iox::mepoo::ChunkHeader*> chunks;
+    for (size_t i = 0; i < iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY; i++)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(
+            UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        chunks.push_back(*maybeChunkHeader);
+    }
+
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_TRUE(maybeChunkHeader.has_error());
+
+    EXPECT_THAT(m_chunkSenderData.m_numberOfLoanFailures.value(), Eq(1U));
+    EXPECT_THAT(m_chunkSenderData.m_numberOfSentChunks.value(), Eq(0U));
+
+    for (auto chunk : chunks)
+    {
+        m_chunkSender.release(chunk);
+    }
+}
+
+TEST_F(ChunkSender_test, chunksDroppedFromFullQueueAreCountedAsLost)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c37da8f7-a930-48d6-b11e-9b82bffa32c3");
+    constexpr uint64_t QUEUE_CAPACITY{2U};
+    constexpr uint64_t NUMBER_OF_SENDS{5U};
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> queue(&m_chunkQueueData);
+    queue.setCapacity(QUEUE_CAPACITY);
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    for (uint64_t i = 0U; i < NUMBER_OF_SENDS; ++i)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(
+            UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        m_chunkSender.send(*maybeChunkHeader);
+    }
+
+    EXPECT_THAT(m_chunkSenderData.m_numberOfSentChunks.value(), Eq(NUMBER_OF_SENDS));
+    EXPECT_THAT(m_chunkSenderData.m_numberOfLostChunks.value(), Eq(NUMBER_OF_SENDS - QUEUE_CAPACITY));
+    EXPECT_THAT(m_chunkQueueData.m_numberOfLostChunks.load(), Eq(NUMBER_OF_SENDS - QUEUE_CAPACITY));
+}
+
 TEST_F(ChunkSender_test, sendTillRunningOutOfChunks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b951495a-e216-43ff-96a0-a530b7a6455b");
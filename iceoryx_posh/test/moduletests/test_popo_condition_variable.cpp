@@ -23,10 +23,12 @@
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "test.hpp"
 
+#include <array>
 #include <atomic>
 #include <memory>
 #include <thread>
 #include <type_traits>
+#include <vector>
 
 namespace
 {
@@ -92,6 +94,18 @@ TEST_F(ConditionVariable_test, NoNotifyResultsInNotBeingTriggered)
     EXPECT_FALSE(m_waiter.wasNotified());
 }
 
+TEST_F(ConditionVariable_test, NotifyWithoutSleepingListenerDoesNotPostSemaphore)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8b2f6c1d-3e47-4a95-b0d8-e6f1a2c3b4d5");
+    m_signaler.notify();
+
+    EXPECT_TRUE(m_waiter.wasNotified());
+    auto wasPosted = m_condVarData.m_semaphore->tryWait();
+    ASSERT_FALSE(wasPosted.has_error());
+    EXPECT_FALSE(wasPosted.value());
+    EXPECT_THAT(m_waiter.timedWait(1_ns).size(), Eq(1U));
+}
+
 TEST_F(ConditionVariable_test, WaitResetsAllNotificationsInWait)
 {
     ::testing::Test::RecordProperty("TEST_ID", "ebc9c42a-14e7-471c-a9df-9c5641b5767d");
@@ -135,9 +149,9 @@ TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstruction)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4e5f6dbc-84cc-468a-9d64-f5ed88012ebc");
     ConditionVariableData sut;
-    for (auto& notification : sut.m_activeNotifications)
+    for (Type_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; i++)
     {
-        EXPECT_THAT(notification, Eq(false));
+        EXPECT_THAT(sut.isNotificationActive(i), Eq(false));
     }
 }
 
@@ -150,9 +164,9 @@ TEST_F(ConditionVariable_test, CorrectRuntimeNameAfterConstructionWithRuntimeNam
 TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstructionWithRuntimeName)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4825e152-08e3-414e-a34f-d93d048f84b8");
-    for (auto& notification : m_condVarData.m_activeNotifications)
+    for (Type_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; i++)
     {
-        EXPECT_THAT(notification, Eq(false));
+        EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(false));
     }
 }
 
@@ -166,11 +180,11 @@ TEST_F(ConditionVariable_test, NotifyActivatesCorrectIndex)
     {
         if (i == EVENT_INDEX)
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i], Eq(true));
+            EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(true));
         }
         else
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i], Eq(false));
+            EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(false));
         }
     }
 }
@@ -215,6 +229,32 @@ TEST_F(ConditionVariable_test, TimedWaitReturnsMultipleNotifiedIndices)
     EXPECT_THAT(indices[1U], Eq(15U));
 }
 
+TEST_F(ConditionVariable_test, TimedWaitReturnsNotifiedIndicesAtNotificationWordBoundaries)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a3d5c7e9-1f2b-4c6d-8e0a-b2c4d6e8f0a1");
+    constexpr uint64_t WORD_WIDTH = ConditionVariableData::NOTIFICATION_WORD_WIDTH;
+    constexpr uint64_t LAST_INDEX = iox::MAX_NUMBER_OF_NOTIFIERS - 1U;
+    ConditionListener sut(m_condVarData);
+    ConditionNotifier(m_condVarData, LAST_INDEX).notify();
+    ConditionNotifier(m_condVarData, WORD_WIDTH - 1U).notify();
+    ConditionNotifier(m_condVarData, 0U).notify();
+    if (LAST_INDEX > WORD_WIDTH)
+    {
+        ConditionNotifier(m_condVarData, WORD_WIDTH).notify();
+    }
+
+    auto indices = sut.timedWait(iox::units::Duration::fromMilliseconds(100));
+
+    ASSERT_THAT(indices.size(), Eq(LAST_INDEX > WORD_WIDTH ? 4U : 3U));
+    EXPECT_THAT(indices.front(), Eq(0U));
+    EXPECT_THAT(indices[1U], Eq(WORD_WIDTH - 1U));
+    EXPECT_THAT(indices.back(), Eq(LAST_INDEX));
+    for (Type_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; i++)
+    {
+        EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(false));
+    }
+}
+
 TEST_F(ConditionVariable_test, TimedWaitReturnsAllNotifiedIndices)
 {
     ::testing::Test::RecordProperty("TEST_ID", "38ee654b-228a-4462-9614-2901cb5272aa");
@@ -420,9 +460,9 @@ TIMING_TEST_F(ConditionVariable_test, SecondWaitBlocksUntilNewNotification, Repe
         hasWaited.store(true, std::memory_order_relaxed);
         ASSERT_THAT(activeNotifications.size(), Eq(1U));
         EXPECT_THAT(activeNotifications[0], Eq(FIRST_EVENT_INDEX));
-        for (const auto& notification : m_condVarData.m_activeNotifications)
+        for (Type_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; i++)
         {
-            EXPECT_THAT(notification, Eq(false));
+            EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(false));
         }
     });
 
@@ -494,4 +534,146 @@ TEST_F(ConditionVariable_test, TimedWaitReturnsSortedListWhenTriggeredInReverseO
         *this, [this] { return m_waiter.timedWait(iox::units::Duration::fromSeconds(1)); });
 }
 
+WaitStrategy createWaitStrategy(const WaitMode mode)
+{
+    WaitStrategy waitStrategy;
+    waitStrategy.mode = mode;
+    return waitStrategy;
+}
+
+TEST_F(ConditionVariable_test, WaitWithSpinThenBlockReturnsNotificationFromOtherThread)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c2b8e4f1-6a3d-4e97-b5c0-8d1f2a3e4b56");
+    ConditionListener sut(m_condVarData, createWaitStrategy(WaitMode::SPIN_THEN_BLOCK));
+
+    Barrier isThreadStarted(1U);
+    std::thread notifier([&] {
+        isThreadStarted.notify();
+        ConditionNotifier(m_condVarData, 7U).notify();
+    });
+    isThreadStarted.wait();
+
+    auto activeNotifications = sut.wait();
+    notifier.join();
+
+    ASSERT_THAT(activeNotifications.size(), Eq(1U));
+    EXPECT_THAT(activeNotifications[0U], Eq(7U));
+}
+
+TEST_F(ConditionVariable_test, WaitWithSpinThenBlockBlocksAfterSpinPhase)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1e9d7c5b-3f2a-4b68-9c04-e7a5d3b1f289");
+    auto waitStrategy = createWaitStrategy(WaitMode::SPIN_THEN_BLOCK);
+    waitStrategy.spinIterations = 1U;
+    ConditionListener sut(m_condVarData, waitStrategy);
+
+    std::atomic_bool hasWaited{false};
+    std::thread waiter([&] {
+        auto activeNotifications = sut.wait();
+        hasWaited.store(true, std::memory_order_relaxed);
+        ASSERT_THAT(activeNotifications.size(), Eq(1U));
+        EXPECT_THAT(activeNotifications[0U], Eq(3U));
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_THAT(hasWaited, Eq(false));
+    ConditionNotifier(m_condVarData, 3U).notify();
+    waiter.join();
+    EXPECT_THAT(hasWaited, Eq(true));
+}
+
+TEST_F(ConditionVariable_test, WaitWithBusyPollReturnsNotificationFromOtherThread)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9a4f2e6c-8b1d-4c37-a5e9-0f3b7d2c6a14");
+    ConditionListener sut(m_condVarData, createWaitStrategy(WaitMode::BUSY_POLL));
+
+    std::thread waiter([&] {
+        auto activeNotifications = sut.wait();
+        ASSERT_THAT(activeNotifications.size(), Eq(1U));
+        EXPECT_THAT(activeNotifications[0U], Eq(11U));
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    ConditionNotifier(m_condVarData, 11U).notify();
+    waiter.join();
+}
+
+TEST_F(ConditionVariable_test, TimedWaitWithBusyPollReturnsEmptyVectorAfterTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5f8c1a3e-2d7b-4e96-8a40-c6e9b2d5f713");
+    ConditionListener sut(m_condVarData, createWaitStrategy(WaitMode::BUSY_POLL));
+
+    const auto start = std::chrono::steady_clock::now();
+    auto activeNotifications = sut.timedWait(10_ms);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_THAT(activeNotifications.empty(), Eq(true));
+    EXPECT_THAT(elapsed, Ge(std::chrono::milliseconds(10)));
+}
+
+TEST_F(ConditionVariable_test, BusyPollDoesNotLoseNotificationsWhichInterleaveWithTheCollection)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "22c654a9-4512-41b4-9dcb-59a31f6933c3");
+    constexpr uint64_t NUMBER_OF_NOTIFIERS{2U};
+    const auto testDuration = std::chrono::milliseconds(500);
+    ConditionListener sut(m_condVarData, createWaitStrategy(WaitMode::BUSY_POLL));
+
+    // every notifier waits until its notification was collected before it notifies again, a lost notification
+    // therefore lets the untimed wait spin forever and the watchdog terminates the test
+    std::array<std::atomic_bool, NUMBER_OF_NOTIFIERS> wasCollected{};
+    std::array<uint64_t, NUMBER_OF_NOTIFIERS> numberOfNotifications{};
+    std::atomic_bool isStopped{false};
+    std::vector<std::thread> notifiers;
+    for (uint64_t i = 0U; i < NUMBER_OF_NOTIFIERS; ++i)
+    {
+        notifiers.emplace_back([&, i] {
+            ConditionNotifier notifier(m_condVarData, i);
+            while (!isStopped.load(std::memory_order_relaxed))
+            {
+                wasCollected[i].store(false, std::memory_order_relaxed);
+                notifier.notify();
+                ++numberOfNotifications[i];
+                while (!wasCollected[i].load(std::memory_order_relaxed) && !isStopped.load(std::memory_order_relaxed))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::array<uint64_t, NUMBER_OF_NOTIFIERS> numberOfCollectedNotifications{};
+    const auto deadline = std::chrono::steady_clock::now() + testDuration;
+    while (std::chrono::steady_clock::now() < deadline)
+    {
+        for (const auto index : sut.wait())
+        {
+            ++numberOfCollectedNotifications[index];
+            wasCollected[index].store(true, std::memory_order_relaxed);
+        }
+    }
+    isStopped.store(true, std::memory_order_relaxed);
+
+    for (auto& notifier : notifiers)
+    {
+        notifier.join();
+    }
+    // the last notification of a notifier might not be collected when the test stops
+    for (uint64_t i = 0U; i < NUMBER_OF_NOTIFIERS; ++i)
+    {
+        EXPECT_THAT(numberOfNotifications[i] - numberOfCollectedNotifications[i], Le(1U));
+    }
+}
+
+TEST_F(ConditionVariable_test, DestroyWakesUpWaitWithBusyPoll)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d7e3b9a1-4c6f-4825-b0d3-a2f8e5c1b947");
+    ConditionListener sut(m_condVarData, createWaitStrategy(WaitMode::BUSY_POLL));
+
+    std::thread waiter([&] { EXPECT_THAT(sut.wait().empty(), Eq(true)); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    sut.destroy();
+    waiter.join();
+}
+
 } // namespace
@@ -0,0 +1,117 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
+#include "test.hpp"
+
+#include <limits>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+
+TEST(LatencyHistogram_test, DefaultConstructedHistogramIsEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6377c494-a258-4da6-af55-dc5d0d60d1a3");
+    LatencyHistogram sut;
+
+    EXPECT_THAT(sut.sampleCount(), Eq(0U));
+    EXPECT_THAT(sut.sumInNanoseconds(), Eq(0U));
+    EXPECT_THAT(sut.maxInNanoseconds(), Eq(0U));
+    for (uint32_t i = 0U; i < LatencyHistogram::NUMBER_OF_BUCKETS; ++i)
+    {
+        EXPECT_THAT(sut.bucket(i), Eq(0U));
+    }
+}
+
+TEST(LatencyHistogram_test, BucketIndexIsFloorOfLog2)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5116d068-52a9-4a63-b636-fcd4a47d0ecf");
+    EXPECT_THAT(LatencyHistogram::bucketIndex(0U), Eq(0U));
+    EXPECT_THAT(LatencyHistogram::bucketIndex(1U), Eq(0U));
+    EXPECT_THAT(LatencyHistogram::bucketIndex(2U), Eq(1U));
+    EXPECT_THAT(LatencyHistogram::bucketIndex(3U), Eq(1U));
+    EXPECT_THAT(LatencyHistogram::bucketIndex(4U), Eq(2U));
+    EXPECT_THAT(LatencyHistogram::bucketIndex(1023U), Eq(9U));
+    EXPECT_THAT(LatencyHistogram::bucketIndex(1024U), Eq(10U));
+}
+
+TEST(LatencyHistogram_test, LatenciesBeyondTheLastBucketAreCountedInTheLastBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9b391468-7076-4583-8415-0d1be9be45bc");
+    constexpr uint32_t LAST_BUCKET{LatencyHistogram::NUMBER_OF_BUCKETS - 1U};
+    EXPECT_THAT(LatencyHistogram::bucketIndex(1ULL << LAST_BUCKET), Eq(LAST_BUCKET));
+    EXPECT_THAT(LatencyHistogram::bucketIndex(std::numeric_limits<uint64_t>::max()), Eq(LAST_BUCKET));
+}
+
+TEST(LatencyHistogram_test, RecordUpdatesCountSumMaxAndBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d3dceeea-f3be-4601-a3af-3132e18ea3b0");
+    LatencyHistogram sut;
+
+    sut.record(1000U);
+    sut.record(3000U);
+    sut.record(1010U);
+
+    EXPECT_THAT(sut.sampleCount(), Eq(3U));
+    EXPECT_THAT(sut.sumInNanoseconds(), Eq(5010U));
+    EXPECT_THAT(sut.maxInNanoseconds(), Eq(3000U));
+    EXPECT_THAT(sut.bucket(LatencyHistogram::bucketIndex(1000U)), Eq(2U));
+    EXPECT_THAT(sut.bucket(LatencyHistogram::bucketIndex(3000U)), Eq(1U));
+}
+
+TEST(LatencyHistogram_test, SumOfAllBucketsEqualsSampleCount)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "097e942b-85e4-4b4e-928e-8b9d9ffdca92");
+    LatencyHistogram sut;
+    constexpr uint64_t NUMBER_OF_SAMPLES{100U};
+    for (uint64_t i = 0U; i < NUMBER_OF_SAMPLES; ++i)
+    {
+        sut.record(i * i * 1000U);
+    }
+
+    uint64_t sumOfBuckets{0U};
+    for (uint32_t i = 0U; i < LatencyHistogram::NUMBER_OF_BUCKETS; ++i)
+    {
+        sumOfBuckets += sut.bucket(i);
+    }
+    EXPECT_THAT(sumOfBuckets, Eq(NUMBER_OF_SAMPLES));
+    EXPECT_THAT(sut.sampleCount(), Eq(NUMBER_OF_SAMPLES));
+}
+
+TEST(LatencyHistogram_test, BucketWithOutOfRangeIndexReturnsZero)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1f1c77b7-6e19-47f9-92ef-d6d0a26ed15f");
+    LatencyHistogram sut;
+    sut.record(std::numeric_limits<uint64_t>::max());
+
+    EXPECT_THAT(sut.bucket(LatencyHistogram::NUMBER_OF_BUCKETS), Eq(0U));
+}
+
+TEST(LatencyHistogram_test, ZeroLatencyIsRecordedInFirstBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b03f55cf-7bf2-48a4-9f26-08e13b6cfe15");
+    LatencyHistogram sut;
+    sut.record(0U);
+
+    EXPECT_THAT(sut.sampleCount(), Eq(1U));
+    EXPECT_THAT(sut.bucket(0U), Eq(1U));
+    EXPECT_THAT(sut.maxInNanoseconds(), Eq(0U));
+}
+
+} // namespace
@@ -32,6 +32,8 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.nodeName = "hypnotoad";
     testOptions.offerOnCreate = false;
     testOptions.subscriberTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    testOptions.waitForConsumerTimeout = iox::units::Duration::fromMicroseconds(1337U);
+    testOptions.publishTimestamp = true;
 
     iox::popo::PublisherOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -46,6 +48,12 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
 
             EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Ne(defaultOptions.subscriberTooSlowPolicy));
             EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Eq(testOptions.subscriberTooSlowPolicy));
+
+            EXPECT_THAT(roundTripOptions.waitForConsumerTimeout, Ne(defaultOptions.waitForConsumerTimeout));
+            EXPECT_THAT(roundTripOptions.waitForConsumerTimeout, Eq(testOptions.waitForConsumerTimeout));
+
+            EXPECT_THAT(roundTripOptions.publishTimestamp, Ne(defaultOptions.publishTimestamp));
+            EXPECT_THAT(roundTripOptions.publishTimestamp, Eq(testOptions.publishTimestamp));
         })
         .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of PublisherOptions failed!"; });
 }
@@ -66,9 +74,13 @@ TEST(PublisherOptions_test, DeserializingInvalidSubscriberTooSlowPolicyFails)
     const iox::NodeName_t NODE_NAME{"harr-harr"};
     constexpr bool OFFER_ON_CREATE{true};
     constexpr std::underlying_type_t<iox::popo::ConsumerTooSlowPolicy> SUBSCRIBER_TOO_SLOW_POLICY{111};
+    constexpr uint64_t WAIT_FOR_CONSUMER_TIMEOUT_IN_NANOSECONDS{1000U};
 
-    const auto serialized =
-        iox::cxx::Serialization::create(HISTORY_CAPACITY, NODE_NAME, OFFER_ON_CREATE, SUBSCRIBER_TOO_SLOW_POLICY);
+    const auto serialized = iox::cxx::Serialization::create(HISTORY_CAPACITY,
+                                                            NODE_NAME,
+                                                            OFFER_ON_CREATE,
+                                                            SUBSCRIBER_TOO_SLOW_POLICY,
+                                                            WAIT_FOR_CONSUMER_TIMEOUT_IN_NANOSECONDS);
     iox::popo::PublisherOptions::deserialize(serialized)
         .and_then([&](auto&) { GTEST_FAIL() << "Deserialization is expected to fail!"; })
         .or_else([&](auto&) { GTEST_SUCCEED(); });
@@ -384,8 +384,13 @@ TEST_F(PoshRuntime_test, GetMiddlewarePublisherWithForbiddenServiceDescriptionsF
     const iox::capro::ServiceDescription serviceRegistry{
         iox::SERVICE_DISCOVERY_SERVICE_NAME, iox::SERVICE_DISCOVERY_INSTANCE_NAME, iox::SERVICE_DISCOVERY_EVENT_NAME};
 
+    const iox::capro::ServiceDescription serviceRegistryDelta{iox::SERVICE_DISCOVERY_SERVICE_NAME,
+                                                              iox::SERVICE_DISCOVERY_INSTANCE_NAME,
+                                                              iox::SERVICE_DISCOVERY_DELTA_EVENT_NAME};
+
     // Added by PortManager
     internalServices.push_back(serviceRegistry);
+    internalServices.push_back(serviceRegistryDelta);
     internalServices.push_back(iox::roudi::IntrospectionPortService);
     internalServices.push_back(iox::roudi::IntrospectionPortThroughputService);
     internalServices.push_back(iox::roudi::IntrospectionSubscriberPortChangingDataService);
@@ -863,6 +868,112 @@ TEST_F(PoshRuntime_test, GetMiddlewareServerWithInvalidNodeNameLeadsToErrorHandl
     EXPECT_THAT(detectedError.value(), Eq(iox::PoshError::POSH__RUNTIME_ROUDI_REQUEST_SERVER_INVALID_RESPONSE));
 }
 
+TEST_F(PoshRuntime_test, CreatePortsWithMixedBatchCreatesAllPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9da9afca-24fa-43d4-9925-d0ddd594989a");
+    iox::popo::ClientOptions clientOptions;
+    clientOptions.responseQueueCapacity = 7U;
+    clientOptions.nodeName = m_nodeName;
+    iox::popo::ServerOptions serverOptions;
+    serverOptions.requestQueueCapacity = 5U;
+    serverOptions.nodeName = m_nodeName;
+    const iox::runtime::PortConfigInfo portConfig{11U, 22U, 33U};
+
+    PortBatch batch;
+    const auto publisherIndex = batch.addPublisher({"batch", "publisher", "event"}).value();
+    const auto subscriberIndex = batch.addSubscriber({"batch", "subscriber", "event"}).value();
+    const auto clientIndex = batch.addClient({"batch", "client", "method"}, clientOptions, portConfig).value();
+    const auto serverIndex = batch.addServer({"batch", "server", "method"}, serverOptions, portConfig).value();
+
+    ASSERT_TRUE(m_runtime->createPorts(batch));
+
+    ASSERT_THAT(batch.getPublisher(publisherIndex), Ne(nullptr));
+    EXPECT_THAT(batch.getPublisher(publisherIndex)->m_serviceDescription,
+                Eq(iox::capro::ServiceDescription("batch", "publisher", "event")));
+    ASSERT_THAT(batch.getSubscriber(subscriberIndex), Ne(nullptr));
+    EXPECT_THAT(batch.getSubscriber(subscriberIndex)->m_serviceDescription,
+                Eq(iox::capro::ServiceDescription("batch", "subscriber", "event")));
+    checkClientInitialization(
+        batch.getClient(clientIndex), {"batch", "client", "method"}, clientOptions, portConfig.memoryInfo);
+    checkServerInitialization(
+        batch.getServer(serverIndex), {"batch", "server", "method"}, serverOptions, portConfig.memoryInfo);
+}
+
+TEST_F(PoshRuntime_test, CreatePortsReturnsNullptrForIndexOfOtherPortType)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a8590319-41a2-4a7f-911d-cc641ee5715e");
+    PortBatch batch;
+    const auto publisherIndex = batch.addPublisher({"batch", "publisher", "event"}).value();
+
+    ASSERT_TRUE(m_runtime->createPorts(batch));
+
+    EXPECT_THAT(batch.getSubscriber(publisherIndex), Eq(nullptr));
+    EXPECT_THAT(batch.getClient(publisherIndex), Eq(nullptr));
+    EXPECT_THAT(batch.getServer(publisherIndex), Eq(nullptr));
+    EXPECT_THAT(batch.getPublisher(publisherIndex + 1U), Eq(nullptr));
+}
+
+TEST_F(PoshRuntime_test, CreatePortsWithMoreRequestsThanFitIntoOneMessageCreatesAllPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9dbc4143-95c0-4cc3-b4b7-e7079393098a");
+    constexpr uint64_t NUMBER_OF_SUBSCRIBERS{100U};
+    const std::string longName(iox::capro::IdString_t::capacity(), 'x');
+    const iox::capro::IdString_t service{iox::cxx::TruncateToCapacity, longName};
+
+    PortBatch batch;
+    for (uint64_t i = 0U; i < NUMBER_OF_SUBSCRIBERS; ++i)
+    {
+        const iox::capro::IdString_t event{iox::cxx::TruncateToCapacity, std::to_string(i)};
+        ASSERT_FALSE(batch.addSubscriber({service, service, event}).has_error());
+    }
+
+    ASSERT_TRUE(m_runtime->createPorts(batch));
+
+    for (uint64_t i = 0U; i < NUMBER_OF_SUBSCRIBERS; ++i)
+    {
+        ASSERT_THAT(batch.getSubscriber(i), Ne(nullptr));
+        EXPECT_THAT(batch.getSubscriber(i)->m_serviceDescription.getEventIDString(),
+                    Eq(iox::capro::IdString_t(iox::cxx::TruncateToCapacity, std::to_string(i))));
+    }
+}
+
+TEST_F(PoshRuntime_test, CreatePortsWithForbiddenServiceDescriptionCreatesRemainingPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2989135c-e669-4b89-b88d-8aee655b30eb");
+    iox::cxx::optional<iox::PoshError> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&detectedError](const iox::PoshError error, const iox::ErrorLevel) { detectedError.emplace(error); });
+
+    PortBatch batch;
+    const auto forbiddenIndex = batch.addPublisher(iox::roudi::IntrospectionPortService).value();
+    const auto publisherIndex = batch.addPublisher({"batch", "publisher", "event"}).value();
+
+    EXPECT_FALSE(m_runtime->createPorts(batch));
+
+    EXPECT_THAT(batch.getPublisher(forbiddenIndex), Eq(nullptr));
+    EXPECT_THAT(batch.getPublisher(publisherIndex), Ne(nullptr));
+    ASSERT_THAT(detectedError.has_value(), Eq(true));
+    EXPECT_THAT(detectedError.value(), Eq(iox::PoshError::POSH__RUNTIME_SERVICE_DESCRIPTION_FORBIDDEN));
+}
+
+TEST_F(PoshRuntime_test, AddingMoreRequestsThanPortsPerBatchFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a7cdf603-6249-4095-8716-d07c51c966f6");
+    PortBatch batch;
+    for (uint64_t i = 0U; i < iox::MAX_PORTS_PER_BATCH; ++i)
+    {
+        auto index = batch.addPublisher({"batch", "publisher", "event"});
+        ASSERT_FALSE(index.has_error());
+        EXPECT_THAT(index.value(), Eq(i));
+    }
+
+    auto index = batch.addSubscriber({"batch", "subscriber", "event"});
+
+    ASSERT_TRUE(index.has_error());
+    EXPECT_THAT(index.get_error(), Eq(iox::runtime::PortBatchError::BATCH_FULL));
+    EXPECT_THAT(batch.size(), Eq(iox::MAX_PORTS_PER_BATCH));
+}
+
 TEST_F(PoshRuntime_test, GetMiddlewareConditionVariableIsSuccessful)
 {
     ::testing::Test::RecordProperty("TEST_ID", "f2ccdca8-53ec-46d8-a34e-f56f996f57e0");
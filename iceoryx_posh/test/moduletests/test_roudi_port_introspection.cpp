@@ -449,6 +449,119 @@ TEST_F(PortIntrospection_test, addAndRemoveSubscriber)
 }
 
 
+TEST_F(PortIntrospection_test, throughputDataIsCalculatedFromPublisherCounters)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2ebb3c7c-35f9-4702-9c77-2137eced71c2");
+    using Topic = iox::roudi::PortThroughputIntrospectionFieldTopic;
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    iox::capro::ServiceDescription service("Ferdinand", "der", "Stier");
+    iox::mepoo::MemoryManager memoryManager;
+    iox::popo::PublisherOptions publisherOptions;
+    const iox::RuntimeName_t runtimeName{"Rainer"};
+    iox::popo::PublisherPortData portData(service, runtimeName, &memoryManager, publisherOptions);
+    EXPECT_THAT(m_introspectionAccess.addPublisher(portData), Eq(true));
+
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(iox::cxx::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError>::create_value(
+            chunk.get()->chunkHeader())));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), sendChunk(_)).Times(2);
+
+    constexpr uint64_t NUMBER_OF_SENT_CHUNKS{10U};
+    constexpr uint64_t USER_PAYLOAD_SIZE{128U};
+    constexpr uint32_t CHUNK_SIZE{256U};
+    auto& senderData = portData.m_chunkSenderData;
+    senderData.m_numberOfSentChunks.add(NUMBER_OF_SENT_CHUNKS);
+    senderData.m_sentUserPayloadBytes.add(NUMBER_OF_SENT_CHUNKS * USER_PAYLOAD_SIZE);
+    senderData.m_lastSentChunkSize.store(CHUNK_SIZE);
+    senderData.m_numberOfLostChunks.add(3U);
+    senderData.m_numberOfLoanFailures.add(2U);
+
+    // the first sample only provides the baseline for the rates
+    m_introspectionAccess.sendThroughputData();
+    {
+        ASSERT_THAT(chunk->sample()->m_throughputList.size(), Eq(1U));
+        const auto& throughput = chunk->sample()->m_throughputList[0];
+        EXPECT_THAT(throughput.m_publisherPortID, Eq(static_cast<uint64_t>(portData.m_uniqueId)));
+        EXPECT_THAT(throughput.m_sampleSize, Eq(USER_PAYLOAD_SIZE));
+        EXPECT_THAT(throughput.m_chunkSize, Eq(CHUNK_SIZE));
+        EXPECT_THAT(throughput.m_numberOfSentSamples, Eq(NUMBER_OF_SENT_CHUNKS));
+        EXPECT_THAT(throughput.m_numberOfSentBytes, Eq(NUMBER_OF_SENT_CHUNKS * USER_PAYLOAD_SIZE));
+        EXPECT_THAT(throughput.m_numberOfLostSamples, Eq(3U));
+        EXPECT_THAT(throughput.m_numberOfLoanFailures, Eq(2U));
+        EXPECT_THAT(throughput.m_chunksPerMinute, Eq(0.0));
+        EXPECT_THAT(throughput.m_bytesPerSecond, Eq(0.0));
+        EXPECT_THAT(throughput.m_lastSendIntervalInNanoseconds, Eq(0U));
+    }
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+
+    senderData.m_numberOfSentChunks.add(NUMBER_OF_SENT_CHUNKS);
+    senderData.m_sentUserPayloadBytes.add(NUMBER_OF_SENT_CHUNKS * USER_PAYLOAD_SIZE);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    m_introspectionAccess.sendThroughputData();
+    {
+        ASSERT_THAT(chunk->sample()->m_throughputList.size(), Eq(1U));
+        const auto& throughput = chunk->sample()->m_throughputList[0];
+        EXPECT_THAT(throughput.m_numberOfSentSamples, Eq(2U * NUMBER_OF_SENT_CHUNKS));
+        EXPECT_THAT(throughput.m_chunksPerMinute, Gt(0.0));
+        const double expectedBytesPerSecond =
+            throughput.m_chunksPerMinute / 60.0 * static_cast<double>(USER_PAYLOAD_SIZE);
+        EXPECT_THAT(throughput.m_bytesPerSecond, DoubleNear(expectedBytesPerSecond, 1.0));
+        EXPECT_THAT(throughput.m_lastSendIntervalInNanoseconds, Ge(1000000U));
+    }
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+}
+
+TEST_F(PortIntrospection_test, RemovedPublisherIsReplacedByTheLastOneInThePortAndThroughputTopic)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bcd0704c-502d-4790-8ddd-71cef735b764");
+    using PortTopic = iox::roudi::PortIntrospectionFieldTopic;
+    using ThroughputTopic = iox::roudi::PortThroughputIntrospectionFieldTopic;
+    auto portChunk = std::unique_ptr<ChunkMock<PortTopic>>(new ChunkMock<PortTopic>);
+    auto throughputChunk = std::unique_ptr<ChunkMock<ThroughputTopic>>(new ChunkMock<ThroughputTopic>);
+
+    iox::mepoo::MemoryManager memoryManager;
+    iox::popo::PublisherOptions publisherOptions;
+    const iox::RuntimeName_t runtimeName{"Ruediger"};
+    iox::popo::PublisherPortData portData1({"Kaese", "Brot", "1"}, runtimeName, &memoryManager, publisherOptions);
+    iox::popo::PublisherPortData portData2({"Kaese", "Brot", "2"}, runtimeName, &memoryManager, publisherOptions);
+    iox::popo::PublisherPortData portData3({"Kaese", "Brot", "3"}, runtimeName, &memoryManager, publisherOptions);
+    EXPECT_THAT(m_introspectionAccess.addPublisher(portData1), Eq(true));
+    EXPECT_THAT(m_introspectionAccess.addPublisher(portData2), Eq(true));
+    EXPECT_THAT(m_introspectionAccess.addPublisher(portData3), Eq(true));
+
+    MockPublisherPortUser port1(&portData1);
+    EXPECT_CALL(port1, getUniqueID()).WillRepeatedly(Return(portData1.m_uniqueId));
+    EXPECT_THAT(m_introspectionAccess.removePublisher(port1), Eq(true));
+
+    EXPECT_CALL(m_introspectionAccess.getPublisherPort().value(), tryAllocateChunk(_, _, _, _))
+        .WillOnce(Return(iox::cxx::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError>::create_value(
+            portChunk.get()->chunkHeader())));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPort().value(), sendChunk(_)).Times(1);
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), tryAllocateChunk(_, _, _, _))
+        .WillOnce(Return(iox::cxx::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError>::create_value(
+            throughputChunk.get()->chunkHeader())));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), sendChunk(_)).Times(1);
+
+    m_introspectionAccess.sendPortData();
+    m_introspectionAccess.sendThroughputData();
+
+    const auto& publisherList = portChunk->sample()->m_publisherList;
+    const auto& throughputList = throughputChunk->sample()->m_throughputList;
+    ASSERT_THAT(publisherList.size(), Eq(2U));
+    ASSERT_THAT(throughputList.size(), Eq(2U));
+    EXPECT_THAT(publisherList[0].m_publisherPortID, Eq(static_cast<uint64_t>(portData3.m_uniqueId)));
+    EXPECT_THAT(publisherList[1].m_publisherPortID, Eq(static_cast<uint64_t>(portData2.m_uniqueId)));
+    for (uint64_t i = 0U; i < publisherList.size(); ++i)
+    {
+        EXPECT_THAT(throughputList[i].m_publisherPortID, Eq(publisherList[i].m_publisherPortID));
+    }
+
+    portChunk->sample()->~PortIntrospectionFieldTopic();
+    throughputChunk->sample()->~PortThroughputIntrospectionFieldTopic();
+}
+
 TEST_F(PortIntrospection_test, Thread)
 {
     ::testing::Test::RecordProperty("TEST_ID", "ae5b252d-0060-4bb7-a193-0c2ae0ebbb7a");
@@ -146,6 +146,112 @@ TEST_F(PortManager_test, DoDiscoveryWithSubscribersCreatedBeforeAndAfterCreation
     EXPECT_THAT(subscriber2.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
 }
 
+TEST_F(PortManager_test, DoDiscoveryForNotifiedPortsConnectsSubscriberAndPublisher)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "afa93498-8909-469b-97dd-7f87ace6f62f");
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), false};
+
+    SubscriberPortUser subscriber = createSubscriber(subscriberOptions);
+    subscriber.subscribe();
+    m_portManager->doDiscoveryForNotifiedPorts();
+
+    PublisherPortUser publisher = createPublisher(publisherOptions);
+    publisher.offer();
+    m_portManager->doDiscoveryForNotifiedPorts();
+
+    ASSERT_TRUE(publisher.hasSubscribers());
+    EXPECT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+}
+
+TEST_F(PortManager_test, DoDiscoveryForNotifiedPortsHandlesSubscriberDestruction)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a64967a0-4820-4ffe-8688-24822937f389");
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), true};
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), true};
+
+    PublisherPortUser publisher = createPublisher(publisherOptions);
+    SubscriberPortUser subscriber = createSubscriber(subscriberOptions);
+    ASSERT_TRUE(publisher.hasSubscribers());
+
+    subscriber.destroy();
+    m_portManager->doDiscoveryForNotifiedPorts();
+
+    EXPECT_FALSE(publisher.hasSubscribers());
+}
+
+TEST_F(PortManager_test, DestructionOfSubscriberIsDeferredUntilNoDeliveryCanUseItsQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "515a2a79-ab94-4fc7-a66c-001db7ec3868");
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), true};
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), true};
+    auto publisherData =
+        m_portManager
+            ->acquirePublisherPortData(
+                {"1", "1", "1"}, publisherOptions, "guiseppe", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value();
+    ASSERT_FALSE(
+        m_portManager->acquireSubscriberPortData({"1", "1", "1"}, subscriberOptions, "schlomo", PortConfigInfo())
+            .has_error());
+    PublisherPortUser publisher(publisherData);
+    ASSERT_TRUE(publisher.hasSubscribers());
+    auto portPool = m_roudiMemoryManager->portPool().value();
+    const auto numberOfSubscriberPorts = portPool->getSubscriberPortDataList().size();
+
+    // simulate a delivery which started before the unsubscription and did not finish yet
+    auto& distributorData = publisherData->m_chunkSenderData;
+    auto& activeDeliveries =
+        distributorData.m_activeLockFreeDeliveries[distributorData.m_lockFreeDeliveryEpoch.load() % 2U];
+    activeDeliveries.fetch_add(1U);
+
+    m_portManager->deletePortsOfProcess("schlomo");
+
+    EXPECT_FALSE(publisher.hasSubscribers());
+    EXPECT_THAT(portPool->getSubscriberPortDataList().size(), Eq(numberOfSubscriberPorts));
+    m_portManager->doDiscovery();
+    EXPECT_THAT(portPool->getSubscriberPortDataList().size(), Eq(numberOfSubscriberPorts));
+
+    activeDeliveries.fetch_sub(1U);
+    m_portManager->doDiscovery();
+
+    EXPECT_THAT(portPool->getSubscriberPortDataList().size(), Eq(numberOfSubscriberPorts - 1U));
+}
+
+TEST_F(PortManager_test, StateChangeOfPortNotifiesDiscoveryConditionVariable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "74e99db1-4ab8-493b-bcdc-fbcff89e1dac");
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+    ConditionListener listener(m_portManager->getDiscoveryConditionVariableData());
+
+    PublisherPortUser publisher = createPublisher(publisherOptions);
+    // discard the notifications from the cleanup of the RouDi internal ports in SetUp
+    IOX_DISCARD_RESULT(listener.timedWait(iox::units::Duration::fromMilliseconds(0U)));
+    ASSERT_FALSE(listener.wasNotified());
+
+    publisher.offer();
+
+    EXPECT_TRUE(listener.wasNotified());
+}
+
+TEST_F(PortManager_test, RepeatedStateChangesOfPortBeforeDiscoveryForNotifiedPortsResultInLatestState)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2be421ec-4d03-4d25-b6ee-6b774a5f01e8");
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), false};
+
+    PublisherPortUser publisher = createPublisher(publisherOptions);
+    publisher.offer();
+    publisher.stopOffer();
+    publisher.offer();
+
+    SubscriberPortUser subscriber = createSubscriber(subscriberOptions);
+    subscriber.subscribe();
+    m_portManager->doDiscoveryForNotifiedPorts();
+
+    EXPECT_TRUE(publisher.hasSubscribers());
+    EXPECT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+}
+
 TEST_F(PortManager_test, SubscribeOnCreateSubscribesWithoutDiscoveryLoopWhenPublisherAvailable)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5a94cf82-d1f6-4129-88ca-34344d94e04e");
@@ -392,6 +392,42 @@ TEST_F(PortManager_test,
     EXPECT_THAT(clientPortUser2.getConnectionState(), Eq(ConnectionState::CONNECTED));
 }
 
+TEST_F(PortManager_test, DoDiscoveryForNotifiedPortsWithClientResultsInConnectedWhenCallingConnect)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2717e092-a472-4d5b-8b8a-62b6660ffe65");
+    auto clientOptions = createTestClientOptions();
+    clientOptions.connectOnCreate = false;
+    auto serverOptions = createTestServerOptions();
+    serverOptions.offerOnCreate = true;
+
+    auto serverPortUser = createServer(serverOptions);
+    auto clientPortUser = createClient(clientOptions);
+
+    clientPortUser.connect();
+
+    m_portManager->doDiscoveryForNotifiedPorts();
+
+    EXPECT_THAT(clientPortUser.getConnectionState(), Eq(ConnectionState::CONNECTED));
+}
+
+TEST_F(PortManager_test, DoDiscoveryForNotifiedPortsWithClientConnectResultsInWaitForOfferWhenServerIsDestroyed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "128a10d7-c728-42a5-a7da-cf0ef45d2458");
+    auto clientOptions = createTestClientOptions();
+    clientOptions.connectOnCreate = true;
+    auto serverOptions = createTestServerOptions();
+    serverOptions.offerOnCreate = true;
+
+    auto serverPortUser = createServer(serverOptions);
+    auto clientPortUser = createClient(clientOptions);
+
+    serverPortUser.destroy();
+
+    m_portManager->doDiscoveryForNotifiedPorts();
+
+    EXPECT_THAT(clientPortUser.getConnectionState(), Eq(ConnectionState::WAIT_FOR_OFFER));
+}
+
 // END discovery tests
 
 // BEGIN forwarding to InterfacePort tests
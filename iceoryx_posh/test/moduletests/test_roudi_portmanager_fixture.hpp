@@ -20,6 +20,7 @@
 #include "iceoryx_hoofs/testing/watch_dog.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/capro/capro_message.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_port_user.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_user.hpp"
 #include "iceoryx_posh/internal/popo/ports/server_port_user.hpp"
@@ -76,6 +77,8 @@ class PortManager_test : public Test
     cxx::vector<iox::capro::ServiceDescription, NUMBER_OF_INTERNAL_PUBLISHERS> internalServices;
     const capro::ServiceDescription serviceRegistry{
         SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_EVENT_NAME};
+    const capro::ServiceDescription serviceRegistryDelta{
+        SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_DELTA_EVENT_NAME};
 
     void SetUp() override
     {
@@ -110,6 +113,7 @@ class PortManager_test : public Test
     void addInternalPublisherOfPortManagerToVector()
     {
         internalServices.push_back(serviceRegistry);
+        internalServices.push_back(serviceRegistryDelta);
         internalServices.push_back(IntrospectionPortService);
         internalServices.push_back(IntrospectionPortThroughputService);
         internalServices.push_back(IntrospectionSubscriberPortChangingDataService);
@@ -326,6 +326,36 @@ TEST_F(PortPool_test, RemovePublisherPortIsSuccessful)
     EXPECT_EQ(publisherPortDataList.size(), 0U);
 }
 
+TEST_F(PortPool_test, GetPublisherPortDataListWithServiceReturnsOnlyPortsWithThisServiceInPoolOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6a379ae3-abbc-4156-afab-37e26ad8e0c6");
+    const ServiceDescription otherService{"service2", "instance1", "event1"};
+    auto first = sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+    auto other = sut.addPublisherPort(otherService, &m_memoryManager, m_applicationName, m_publisherOptions);
+    auto second = sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+    ASSERT_FALSE(first.has_error() || other.has_error() || second.has_error());
+
+    auto publisherPortDataList = sut.getPublisherPortDataList(m_serviceDescription);
+
+    ASSERT_EQ(publisherPortDataList.size(), 2U);
+    EXPECT_EQ(publisherPortDataList[0], first.value());
+    EXPECT_EQ(publisherPortDataList[1], second.value());
+    ASSERT_EQ(sut.getPublisherPortDataList(otherService).size(), 1U);
+    EXPECT_EQ(sut.getPublisherPortDataList(otherService)[0], other.value());
+}
+
+TEST_F(PortPool_test, GetPublisherPortDataListWithServiceDoesNotContainRemovedPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e3101775-632d-4c45-9233-52689969128f");
+    auto publisherPort =
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+    ASSERT_FALSE(publisherPort.has_error());
+
+    sut.removePublisherPort(publisherPort.value());
+
+    EXPECT_EQ(sut.getPublisherPortDataList(m_serviceDescription).size(), 0U);
+}
+
 // END PublisherPort tests
 
 // BEGIN SubscriberPort tests
@@ -452,6 +482,31 @@ TEST_F(PortPool_test, RemoveSubscriberPortIsSuccessful)
     EXPECT_EQ(subscriberPortDataList.size(), 0U);
 }
 
+TEST_F(PortPool_test, GetSubscriberPortDataListWithServiceReturnsOnlyPortsWithThisService)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7685eb93-2499-46bd-a3c9-fdcc361e7383");
+    const ServiceDescription otherService{"service1", "instance2", "event1"};
+    auto subscriberPort = sut.addSubscriberPort(m_serviceDescription, m_applicationName, m_subscriberOptions);
+    ASSERT_FALSE(sut.addSubscriberPort(otherService, m_applicationName, m_subscriberOptions).has_error());
+    ASSERT_FALSE(subscriberPort.has_error());
+
+    auto subscriberPortDataList = sut.getSubscriberPortDataList(m_serviceDescription);
+
+    ASSERT_EQ(subscriberPortDataList.size(), 1U);
+    EXPECT_EQ(subscriberPortDataList[0], subscriberPort.value());
+}
+
+TEST_F(PortPool_test, GetSubscriberPortDataListWithServiceDoesNotContainRemovedPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ccc7a905-b638-48a4-a022-dc7452865f8e");
+    auto subscriberPort = sut.addSubscriberPort(m_serviceDescription, m_applicationName, m_subscriberOptions);
+    ASSERT_FALSE(subscriberPort.has_error());
+
+    sut.removeSubscriberPort(subscriberPort.value());
+
+    EXPECT_EQ(sut.getSubscriberPortDataList(m_serviceDescription).size(), 0U);
+}
+
 // END SubscriberPort tests
 
 // BEGIN ClientPort tests
@@ -560,6 +615,20 @@ TEST_F(PortPool_test, RemoveClientPortIsSuccessful)
     EXPECT_EQ(clientPortDataList.size(), 0U);
 }
 
+TEST_F(PortPool_test, GetClientPortDataListWithServiceReturnsOnlyPortsWithThisService)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e96783fd-98e2-40cf-a46b-1c8261dbd397");
+    cxx::vector<const popo::ClientPortData*, 3U> clientPorts;
+    ASSERT_TRUE(addClientPorts(3U, [&](const auto&, const auto&, const auto& clientPort) {
+        clientPorts.emplace_back(&clientPort);
+    }));
+
+    auto clientPortDataList = sut.getClientPortDataList(clientPorts[1]->m_serviceDescription);
+
+    ASSERT_EQ(clientPortDataList.size(), 1U);
+    EXPECT_EQ(clientPortDataList[0], clientPorts[1]);
+}
+
 // END ClientPort tests
 
 // BEGIN ServerPort tests
@@ -668,6 +737,20 @@ TEST_F(PortPool_test, RemoveServerPortIsSuccessful)
     EXPECT_EQ(serverPortDataList.size(), 0U);
 }
 
+TEST_F(PortPool_test, GetServerPortDataListWithServiceReturnsOnlyPortsWithThisService)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "52c9b1ea-b1c3-4476-a674-b91066b234a6");
+    cxx::vector<const popo::ServerPortData*, 3U> serverPorts;
+    ASSERT_TRUE(addServerPorts(3U, [&](const auto&, const auto&, const auto& serverPort) {
+        serverPorts.emplace_back(&serverPort);
+    }));
+
+    auto serverPortDataList = sut.getServerPortDataList(serverPorts[2]->m_serviceDescription);
+
+    ASSERT_EQ(serverPortDataList.size(), 1U);
+    EXPECT_EQ(serverPortDataList[0], serverPorts[2]);
+}
+
 // END ServerPort tests
 
 // BEGIN InterfacePort tests
@@ -0,0 +1,123 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/service_port_index.hpp"
+
+#include "test.hpp"
+
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+using iox::capro::ServiceDescription;
+
+class ServicePortIndex_test : public Test
+{
+  public:
+    template <uint64_t Capacity>
+    std::vector<uint64_t> candidates(const ServicePortIndex<Capacity>& index, const ServiceDescription& service)
+    {
+        std::vector<uint64_t> positions;
+        index.forEachCandidate(service, [&](const uint64_t position) { positions.push_back(position); });
+        return positions;
+    }
+
+    const ServiceDescription m_service{"Radar", "FrontLeft", "Objects"};
+    const ServiceDescription m_otherService{"Radar", "FrontRight", "Objects"};
+};
+
+TEST_F(ServicePortIndex_test, EmptyIndexHasNoCandidates)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3c7c854b-6316-4514-a8e4-7bf36a0f0c1f");
+    ServicePortIndex<8U> sut;
+
+    EXPECT_TRUE(candidates(sut, m_service).empty());
+}
+
+TEST_F(ServicePortIndex_test, AddedPositionsAreCandidatesInAscendingOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "eaee2379-68dd-4e65-bc48-54cc12c419ae");
+    ServicePortIndex<8U> sut;
+
+    sut.add(m_service, 5U);
+    sut.add(m_service, 1U);
+    sut.add(m_service, 3U);
+
+    EXPECT_THAT(candidates(sut, m_service), ElementsAre(1U, 3U, 5U));
+}
+
+TEST_F(ServicePortIndex_test, RemovedPositionIsNoCandidateAnymore)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "56b30fd7-49ce-4f50-95f2-b4ff3d02be4c");
+    ServicePortIndex<8U> sut;
+    sut.add(m_service, 1U);
+    sut.add(m_service, 3U);
+    sut.add(m_service, 5U);
+
+    sut.remove(m_service, 3U);
+
+    EXPECT_THAT(candidates(sut, m_service), ElementsAre(1U, 5U));
+}
+
+TEST_F(ServicePortIndex_test, RemovedPositionCanBeAddedAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9a362558-e5f8-45b9-8bf9-27c05f43420a");
+    ServicePortIndex<8U> sut;
+    sut.add(m_service, 2U);
+    sut.remove(m_service, 2U);
+
+    sut.add(m_otherService, 2U);
+
+    EXPECT_THAT(candidates(sut, m_service), Not(Contains(2U)));
+    EXPECT_THAT(candidates(sut, m_otherService), ElementsAre(2U));
+}
+
+TEST_F(ServicePortIndex_test, RemovingPositionWhichIsNotInTheIndexHasNoEffect)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1ac82b56-81ff-423c-a0dc-f193b50bc4b4");
+    ServicePortIndex<8U> sut;
+    sut.add(m_service, 4U);
+
+    sut.remove(m_service, 6U);
+    sut.remove(m_service, 8U);
+
+    EXPECT_THAT(candidates(sut, m_service), ElementsAre(4U));
+}
+
+TEST_F(ServicePortIndex_test, AddingPositionOutOfCapacityIsIgnored)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f9a21619-a4e2-4686-8db2-8213fe54428b");
+    ServicePortIndex<8U> sut;
+
+    sut.add(m_service, 8U);
+
+    EXPECT_TRUE(candidates(sut, m_service).empty());
+}
+
+TEST_F(ServicePortIndex_test, CollidingServicesShareTheCandidatesOfTheirBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3e0bd0b9-9392-41c1-b1bd-3f79eaed913e");
+    // with a capacity of one there is a single bucket and every service collides
+    ServicePortIndex<1U> sut;
+
+    sut.add(m_service, 0U);
+
+    EXPECT_THAT(candidates(sut, m_otherService), ElementsAre(0U));
+}
+
+} // namespace
@@ -23,6 +23,8 @@
 #include "test.hpp"
 
 #include <chrono>
+#include <functional>
+#include <memory>
 #include <random>
 #include <vector>
 
@@ -710,4 +712,125 @@ TYPED_TEST(ServiceRegistry_test, FindWithMixOfPublishersAndServersWorks)
     EXPECT_EQ(filtered[1].serviceDescription, service3);
 }
 
+TYPED_TEST(ServiceRegistry_test, ModificationsIncrementTheGeneration)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1d92980b-9e3e-4ca2-a2ac-e66a29a41b08");
+    iox::capro::ServiceDescription service("Lawyer", "Bob", "Saul");
+    EXPECT_THAT(this->sut->generation(), Eq(0U));
+
+    ASSERT_FALSE(this->sut.add(service).has_error());
+    EXPECT_THAT(this->sut->generation(), Eq(1U));
+    ASSERT_FALSE(this->sut.otherAdd(service).has_error());
+    EXPECT_THAT(this->sut->generation(), Eq(2U));
+    this->sut.remove(service);
+    EXPECT_THAT(this->sut->generation(), Eq(3U));
+    this->sut->purge(service);
+    EXPECT_THAT(this->sut->generation(), Eq(4U));
+}
+
+TYPED_TEST(ServiceRegistry_test, RemovingUnknownServiceDoesNotChangeTheGeneration)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7b072174-62b7-4114-a693-9813ffd18dab");
+    ASSERT_FALSE(this->sut.add(iox::capro::ServiceDescription("Lawyer", "Bob", "Saul")).has_error());
+
+    this->sut.remove(iox::capro::ServiceDescription("Lawyer", "Bob", "Kim"));
+    this->sut->purge(iox::capro::ServiceDescription("Lawyer", "Kim", "Saul"));
+
+    EXPECT_THAT(this->sut->generation(), Eq(1U));
+}
+
+TYPED_TEST(ServiceRegistry_test, DeltaOfUnknownServiceHasNoCounts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6f18f06e-31ac-4377-b2fe-88ed74826a5c");
+    iox::capro::ServiceDescription service("Lawyer", "Bob", "Saul");
+    ASSERT_FALSE(this->sut.add(service).has_error());
+    this->sut.remove(service);
+
+    auto delta = this->sut->deltaOf(service);
+
+    EXPECT_THAT(delta.generation, Eq(2U));
+    EXPECT_THAT(delta.entry.serviceDescription, Eq(service));
+    EXPECT_THAT(delta.entry.publisherCount, Eq(0U));
+    EXPECT_THAT(delta.entry.serverCount, Eq(0U));
+}
+
+TYPED_TEST(ServiceRegistry_test, ApplyingAllDeltasReproducesTheRegistry)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "98e1ce45-d377-47b5-a8b6-24333ee9252a");
+    std::unique_ptr<ServiceRegistry> copy{new ServiceRegistry};
+    iox::capro::ServiceDescription service1("a", "b", "c");
+    iox::capro::ServiceDescription service2("a", "b", "d");
+    iox::capro::ServiceDescription service3("x", "b", "c");
+
+    auto modifyAndApply = [&](const ServiceDescription& service, const std::function<void()>& modification) {
+        modification();
+        copy->apply(this->sut->deltaOf(service));
+    };
+    modifyAndApply(service1, [&] { ASSERT_FALSE(this->sut.add(service1).has_error()); });
+    modifyAndApply(service2, [&] { ASSERT_FALSE(this->sut.add(service2).has_error()); });
+    modifyAndApply(service2, [&] { ASSERT_FALSE(this->sut.otherAdd(service2).has_error()); });
+    modifyAndApply(service3, [&] { ASSERT_FALSE(this->sut.add(service3).has_error()); });
+    modifyAndApply(service1, [&] { this->sut.remove(service1); });
+    modifyAndApply(service2, [&] { this->sut.remove(service2); });
+
+    EXPECT_THAT(copy->generation(), Eq(this->sut->generation()));
+    SearchResult_t copiedEntries;
+    copy->forEach([&](const ServiceRegistry::ServiceDescriptionEntry& entry) { copiedEntries.push_back(entry); });
+    this->find(iox::capro::Wildcard, iox::capro::Wildcard, iox::capro::Wildcard);
+    ASSERT_THAT(copiedEntries.size(), Eq(2U));
+    ASSERT_THAT(this->searchResult.size(), Eq(2U));
+    for (uint64_t i = 0U; i < copiedEntries.size(); ++i)
+    {
+        EXPECT_THAT(copiedEntries[i].serviceDescription, Eq(this->searchResult[i].serviceDescription));
+        EXPECT_THAT(copiedEntries[i].publisherCount, Eq(this->searchResult[i].publisherCount));
+        EXPECT_THAT(copiedEntries[i].serverCount, Eq(this->searchResult[i].serverCount));
+    }
+}
+
+TYPED_TEST(ServiceRegistry_test, ExactSearchWorksAfterManyAddAndRemoveCycles)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bb69e52c-c550-435f-97d5-c6d86469e556");
+    // every cycle leaves deleted slots in the hash table which must not hide the entries added afterwards
+    constexpr uint64_t NUMBER_OF_CYCLES{4U};
+    for (uint64_t cycle = 0U; cycle < NUMBER_OF_CYCLES; ++cycle)
+    {
+        IdString_t instance(iox::cxx::TruncateToCapacity, iox::cxx::convert::toString(cycle));
+        for (uint64_t i = 0U; i < CAPACITY; ++i)
+        {
+            IdString_t event(iox::cxx::TruncateToCapacity, iox::cxx::convert::toString(i));
+            ASSERT_FALSE(this->sut.add(iox::capro::ServiceDescription("Foo", instance, event)).has_error());
+        }
+        for (uint64_t i = 0U; i < CAPACITY; ++i)
+        {
+            IdString_t event(iox::cxx::TruncateToCapacity, iox::cxx::convert::toString(i));
+            this->find(IdString_t("Foo"), instance, event);
+            ASSERT_THAT(this->searchResult.size(), Eq(1U));
+            this->sut.remove(this->searchResult[0].serviceDescription);
+        }
+        EXPECT_THAT(this->countServices(), Eq(0U));
+    }
+}
+
+TYPED_TEST(ServiceRegistry_test, SearchWithWildcardsReturnsOnlyMatchingEntriesOfCollidingBuckets)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "048eb5a6-7682-4cb0-962d-69266e734307");
+    // with more distinct strings than buckets some of them share a bucket of the index
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        IdString_t value(iox::cxx::TruncateToCapacity, iox::cxx::convert::toString(i));
+        ASSERT_FALSE(this->sut.add(iox::capro::ServiceDescription(value, value, value)).has_error());
+    }
+
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        IdString_t value(iox::cxx::TruncateToCapacity, iox::cxx::convert::toString(i));
+        this->find(iox::capro::Wildcard, value, iox::capro::Wildcard);
+        ASSERT_THAT(this->searchResult.size(), Eq(1U));
+        EXPECT_THAT(this->searchResult[0].serviceDescription.getEventIDString(), Eq(value));
+        this->find(iox::capro::Wildcard, iox::capro::Wildcard, value);
+        ASSERT_THAT(this->searchResult.size(), Eq(1U));
+        EXPECT_THAT(this->searchResult[0].serviceDescription.getServiceIDString(), Eq(value));
+    }
+}
+
 } // namespace
@@ -0,0 +1,272 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_interface_base.hpp"
+
+#include "test.hpp"
+
+#include <cstddef>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::runtime;
+
+class IpcBinaryMessage_test : public Test
+{
+  public:
+    capro::ServiceDescription m_service{"Radar", "FrontLeft", "Objects", {11U, 22U, 33U, 44U}, capro::Interfaces::DDS};
+    PortConfigInfo m_portConfigInfo{13U, 42U, 73U};
+
+    /// @brief overwrites a byte of the hex encoded request header at the beginning of the entry
+    static void setHeaderByte(std::string& entry, const uint64_t offset, const uint8_t value)
+    {
+        constexpr char HEX_DIGITS[] = "0123456789abcdef";
+        entry[2U * offset] = HEX_DIGITS[value >> 4U];
+        entry[2U * offset + 1U] = HEX_DIGITS[value & 0x0FU];
+    }
+};
+
+TEST_F(IpcBinaryMessage_test, PublisherRequestRoundTripRestoresAllValues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0e6cc071-3eab-4b51-a9c6-1062086553c6");
+    m_service.setLocal();
+    popo::PublisherOptions options;
+    options.historyCapacity = 7U;
+    options.nodeName = "Hypnotoad";
+    options.offerOnCreate = false;
+    options.subscriberTooSlowPolicy = popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    options.waitForConsumerTimeout = units::Duration::fromMicroseconds(1234U);
+    options.publishTimestamp = true;
+
+    auto request = IpcPublisherRequest::fromEntry(IpcPublisherRequest(m_service, options, m_portConfigInfo).toEntry());
+
+    ASSERT_FALSE(request.has_error());
+    EXPECT_THAT(request.value().serviceDescription(), Eq(m_service));
+    EXPECT_THAT(request.value().serviceDescription().getScope(), Eq(capro::Scope::LOCAL));
+    EXPECT_THAT(request.value().serviceDescription().getSourceInterface(), Eq(capro::Interfaces::DDS));
+    EXPECT_THAT(request.value().portConfigInfo(), Eq(m_portConfigInfo));
+    const auto restoredOptions = request.value().publisherOptions();
+    EXPECT_THAT(restoredOptions.historyCapacity, Eq(options.historyCapacity));
+    EXPECT_THAT(restoredOptions.nodeName, Eq(options.nodeName));
+    EXPECT_THAT(restoredOptions.offerOnCreate, Eq(options.offerOnCreate));
+    EXPECT_THAT(restoredOptions.subscriberTooSlowPolicy, Eq(options.subscriberTooSlowPolicy));
+    EXPECT_THAT(restoredOptions.waitForConsumerTimeout, Eq(options.waitForConsumerTimeout));
+    EXPECT_THAT(restoredOptions.publishTimestamp, Eq(options.publishTimestamp));
+}
+
+TEST_F(IpcBinaryMessage_test, SubscriberRequestRoundTripRestoresAllValues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2af5cd4b-a761-4a7c-bb44-782b6607367b");
+    popo::SubscriberOptions options;
+    options.queueCapacity = 5U;
+    options.historyRequest = 3U;
+    options.nodeName = "Nibbler";
+    options.subscribeOnCreate = false;
+    options.queueFullPolicy = popo::QueueFullPolicy::BLOCK_PRODUCER;
+    options.requiresPublisherHistorySupport = true;
+    options.recordLatency = true;
+
+    auto request =
+        IpcSubscriberRequest::fromEntry(IpcSubscriberRequest(m_service, options, m_portConfigInfo).toEntry());
+
+    ASSERT_FALSE(request.has_error());
+    EXPECT_THAT(request.value().serviceDescription(), Eq(m_service));
+    EXPECT_THAT(request.value().serviceDescription().getScope(), Eq(capro::Scope::WORLDWIDE));
+    EXPECT_THAT(request.value().portConfigInfo(), Eq(m_portConfigInfo));
+    const auto restoredOptions = request.value().subscriberOptions();
+    EXPECT_THAT(restoredOptions.queueCapacity, Eq(options.queueCapacity));
+    EXPECT_THAT(restoredOptions.historyRequest, Eq(options.historyRequest));
+    EXPECT_THAT(restoredOptions.nodeName, Eq(options.nodeName));
+    EXPECT_THAT(restoredOptions.subscribeOnCreate, Eq(options.subscribeOnCreate));
+    EXPECT_THAT(restoredOptions.queueFullPolicy, Eq(options.queueFullPolicy));
+    EXPECT_THAT(restoredOptions.requiresPublisherHistorySupport, Eq(options.requiresPublisherHistorySupport));
+    EXPECT_THAT(restoredOptions.recordLatency, Eq(options.recordLatency));
+}
+
+TEST_F(IpcBinaryMessage_test, ClientRequestRoundTripRestoresAllValues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "82525115-1157-4346-9934-6c980cf8995c");
+    popo::ClientOptions options;
+    options.responseQueueCapacity = 3U;
+    options.nodeName = "Zoidberg";
+    options.connectOnCreate = false;
+    options.responseQueueFullPolicy = popo::QueueFullPolicy::BLOCK_PRODUCER;
+    options.serverTooSlowPolicy = popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+
+    auto request = IpcClientRequest::fromEntry(IpcClientRequest(m_service, options, m_portConfigInfo).toEntry());
+
+    ASSERT_FALSE(request.has_error());
+    EXPECT_THAT(request.value().serviceDescription(), Eq(m_service));
+    EXPECT_THAT(request.value().portConfigInfo(), Eq(m_portConfigInfo));
+    EXPECT_THAT(request.value().clientOptions(), Eq(options));
+}
+
+TEST_F(IpcBinaryMessage_test, ServerRequestRoundTripRestoresAllValues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5a387e11-5c47-486c-b3cd-5d564f2052fb");
+    popo::ServerOptions options;
+    options.requestQueueCapacity = 9U;
+    options.nodeName = "Farnsworth";
+    options.offerOnCreate = false;
+    options.requestQueueFullPolicy = popo::QueueFullPolicy::BLOCK_PRODUCER;
+    options.clientTooSlowPolicy = popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+
+    auto request = IpcServerRequest::fromEntry(IpcServerRequest(m_service, options, m_portConfigInfo).toEntry());
+
+    ASSERT_FALSE(request.has_error());
+    EXPECT_THAT(request.value().serviceDescription(), Eq(m_service));
+    EXPECT_THAT(request.value().portConfigInfo(), Eq(m_portConfigInfo));
+    EXPECT_THAT(request.value().serverOptions(), Eq(options));
+}
+
+TEST_F(IpcBinaryMessage_test, BinaryRequestMessageTypeIsReadFromEntry)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "eba7b777-35c2-4dd0-a58f-162dbd6191d3");
+    auto publisherType = getBinaryRequestMessageType(IpcPublisherRequest(m_service, {}, m_portConfigInfo).toEntry());
+    auto subscriberType = getBinaryRequestMessageType(IpcSubscriberRequest(m_service, {}, m_portConfigInfo).toEntry());
+    auto clientType = getBinaryRequestMessageType(IpcClientRequest(m_service, {}, m_portConfigInfo).toEntry());
+    auto serverType = getBinaryRequestMessageType(IpcServerRequest(m_service, {}, m_portConfigInfo).toEntry());
+
+    ASSERT_FALSE(publisherType.has_error());
+    ASSERT_FALSE(subscriberType.has_error());
+    ASSERT_FALSE(clientType.has_error());
+    ASSERT_FALSE(serverType.has_error());
+    EXPECT_THAT(static_cast<IpcMessageType>(publisherType.value()), Eq(IpcMessageType::CREATE_PUBLISHER_BINARY));
+    EXPECT_THAT(static_cast<IpcMessageType>(subscriberType.value()), Eq(IpcMessageType::CREATE_SUBSCRIBER_BINARY));
+    EXPECT_THAT(static_cast<IpcMessageType>(clientType.value()), Eq(IpcMessageType::CREATE_CLIENT_BINARY));
+    EXPECT_THAT(static_cast<IpcMessageType>(serverType.value()), Eq(IpcMessageType::CREATE_SERVER_BINARY));
+}
+
+TEST_F(IpcBinaryMessage_test, BinaryRequestMessageTypeOfTooShortEntryFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "df95c657-0053-4610-b30c-ce9ebaf21121");
+    auto messageType = getBinaryRequestMessageType("00");
+
+    ASSERT_TRUE(messageType.has_error());
+    EXPECT_THAT(messageType.get_error(), Eq(IpcBinaryMessageError::INVALID_SIZE));
+}
+
+TEST_F(IpcBinaryMessage_test, RoundTripWithStringsOfMaximumLengthRestoresStrings)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e5c26736-290e-41c1-8d42-e4e191670f34");
+    const std::string maxIdString(capro::IdString_t::capacity(), 's');
+    const std::string maxNodeName(NodeName_t::capacity(), 'n');
+    capro::ServiceDescription service{capro::IdString_t(cxx::TruncateToCapacity, maxIdString),
+                                      capro::IdString_t(cxx::TruncateToCapacity, maxIdString),
+                                      capro::IdString_t(cxx::TruncateToCapacity, maxIdString)};
+    popo::PublisherOptions options;
+    options.nodeName = NodeName_t(cxx::TruncateToCapacity, maxNodeName);
+
+    auto request = IpcPublisherRequest::fromEntry(IpcPublisherRequest(service, options, {}).toEntry());
+
+    ASSERT_FALSE(request.has_error());
+    EXPECT_THAT(request.value().serviceDescription(), Eq(service));
+    EXPECT_THAT(request.value().publisherOptions().nodeName, Eq(options.nodeName));
+}
+
+TEST_F(IpcBinaryMessage_test, EntryCanBeTransportedWithinIpcMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6cb322b0-e946-47b0-bd1f-e636b75bdf8a");
+    IpcMessage sendBuffer;
+    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SUBSCRIBER_BINARY) << "app"
+               << IpcSubscriberRequest(m_service, {}, m_portConfigInfo).toEntry();
+    ASSERT_TRUE(sendBuffer.isValid());
+
+    IpcMessage receiveBuffer(sendBuffer.getMessage());
+
+    ASSERT_THAT(receiveBuffer.getNumberOfElements(), Eq(3U));
+    EXPECT_THAT(stringToIpcMessageType(receiveBuffer.getElementAtIndex(0).c_str()),
+                Eq(IpcMessageType::CREATE_SUBSCRIBER_BINARY));
+    auto request = IpcSubscriberRequest::fromEntry(receiveBuffer.getElementAtIndex(2));
+    ASSERT_FALSE(request.has_error());
+    EXPECT_THAT(request.value().serviceDescription(), Eq(m_service));
+}
+
+TEST_F(IpcBinaryMessage_test, EntryWithWrongSizeFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "10d12943-eb09-4982-9d75-d7d4cb46d0c4");
+    std::string entry = IpcPublisherRequest(m_service, {}, m_portConfigInfo).toEntry();
+    entry.pop_back();
+
+    auto request = IpcPublisherRequest::fromEntry(entry);
+
+    ASSERT_TRUE(request.has_error());
+    EXPECT_THAT(request.get_error(), Eq(IpcBinaryMessageError::INVALID_SIZE));
+}
+
+TEST_F(IpcBinaryMessage_test, SubscriberEntryIsNotAcceptedAsPublisherRequest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b1cd4440-cb2d-4286-ae36-c3adebace75e");
+    auto request = IpcPublisherRequest::fromEntry(IpcSubscriberRequest(m_service, {}, m_portConfigInfo).toEntry());
+
+    ASSERT_TRUE(request.has_error());
+    EXPECT_THAT(request.get_error(), Eq(IpcBinaryMessageError::INVALID_CONTENT));
+}
+
+TEST_F(IpcBinaryMessage_test, EntryWithNonHexCharacterInHeaderFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6086a874-98e2-424d-8764-a5c6874181ad");
+    std::string entry = IpcPublisherRequest(m_service, {}, m_portConfigInfo).toEntry();
+    entry[sizeof(IpcPublisherRequestHeader)] = 'x';
+
+    auto request = IpcPublisherRequest::fromEntry(entry);
+
+    ASSERT_TRUE(request.has_error());
+    EXPECT_THAT(request.get_error(), Eq(IpcBinaryMessageError::INVALID_ENCODING));
+}
+
+TEST_F(IpcBinaryMessage_test, EntryWithOtherProtocolVersionFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "45e5ae89-0971-4d09-a2ac-c610a9ce8355");
+    std::string entry = IpcSubscriberRequest(m_service, {}, m_portConfigInfo).toEntry();
+    setHeaderByte(entry, offsetof(IpcSubscriberRequestHeader, protocolVersion), 42U);
+
+    auto request = IpcSubscriberRequest::fromEntry(entry);
+
+    ASSERT_TRUE(request.has_error());
+    EXPECT_THAT(request.get_error(), Eq(IpcBinaryMessageError::PROTOCOL_VERSION_MISMATCH));
+}
+
+TEST_F(IpcBinaryMessage_test, EntryWithOutOfRangePolicyFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6f519671-ec28-436a-ad5f-8ee2db935d35");
+    std::string entry = IpcPublisherRequest(m_service, {}, m_portConfigInfo).toEntry();
+    setHeaderByte(entry, offsetof(IpcPublisherRequestHeader, subscriberTooSlowPolicy), 42U);
+
+    auto request = IpcPublisherRequest::fromEntry(entry);
+
+    ASSERT_TRUE(request.has_error());
+    EXPECT_THAT(request.get_error(), Eq(IpcBinaryMessageError::INVALID_CONTENT));
+}
+
+TEST_F(IpcBinaryMessage_test, EntryWithStringLengthExceedingTheEntryFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d121b735-a2bc-498a-84fe-754c161b5815");
+    std::string entry = IpcSubscriberRequest(m_service, {}, m_portConfigInfo).toEntry();
+    setHeaderByte(entry,
+                  offsetof(IpcSubscriberRequestHeader, service) + offsetof(IpcServiceDescriptionHeader, eventLength),
+                  static_cast<uint8_t>(capro::IdString_t::capacity()));
+
+    auto request = IpcSubscriberRequest::fromEntry(entry);
+
+    ASSERT_TRUE(request.has_error());
+    EXPECT_THAT(request.get_error(), Eq(IpcBinaryMessageError::INVALID_SIZE));
+}
+
+} // namespace
@@ -0,0 +1,143 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/attributes.hpp"
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_interface_base.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_posh/testing/roudi_environment/roudi_environment.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+
+using namespace iox;
+
+/// half of the ports are publishers, the other half are subscribers
+constexpr uint64_t NUMBER_OF_PORTS{1000U};
+
+capro::ServiceDescription serviceForPort(const uint64_t index)
+{
+    return {"PortCreation",
+            capro::IdString_t(cxx::TruncateToCapacity, cxx::convert::toString(index)),
+            "Benchmark",
+            {1U, 2U, 3U, 4U}};
+}
+
+template <typename Function>
+std::chrono::microseconds measure(Function&& f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+}
+
+/// @brief what the runtime and RouDi do with a comma separated CREATE_PUBLISHER request
+void textRequestRoundTrip(const capro::ServiceDescription& service, const popo::PublisherOptions& options)
+{
+    runtime::IpcMessage request;
+    request << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PUBLISHER) << "benchmark"
+            << static_cast<cxx::Serialization>(service).toString() << options.serialize().toString()
+            << static_cast<cxx::Serialization>(runtime::PortConfigInfo()).toString();
+
+    runtime::IpcMessage received(request.getMessage());
+    auto decodedService = capro::ServiceDescription::deserialize(cxx::Serialization(received.getElementAtIndex(2)));
+    auto decodedOptions = popo::PublisherOptions::deserialize(cxx::Serialization(received.getElementAtIndex(3)));
+    runtime::PortConfigInfo decodedPortConfigInfo(cxx::Serialization(received.getElementAtIndex(4)));
+    if (decodedService.has_error() || decodedOptions.has_error() || !(decodedService.value() == service))
+    {
+        std::cerr << "text request round trip failed" << std::endl;
+    }
+}
+
+/// @brief what the runtime and RouDi do with a fixed-layout CREATE_PUBLISHER_BINARY request
+void binaryRequestRoundTrip(const capro::ServiceDescription& service, const popo::PublisherOptions& options)
+{
+    runtime::IpcMessage request;
+    request << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PUBLISHER_BINARY) << "benchmark"
+            << runtime::IpcPublisherRequest(service, options, runtime::PortConfigInfo()).toEntry();
+
+    runtime::IpcMessage received(request.getMessage());
+    auto decoded = runtime::IpcPublisherRequest::fromEntry(received.getElementAtIndex(2));
+    if (decoded.has_error() || !(decoded.value().serviceDescription() == service))
+    {
+        std::cerr << "binary request round trip failed" << std::endl;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    // the port pool is not large enough for both variants, therefore the batch variant is selected by an argument
+    const bool useBatch = argc > 1 && std::string(argv[1]) == "--batch";
+
+    popo::PublisherOptions options;
+    options.nodeName = "benchmark";
+
+    const auto textDuration = measure([&] {
+        for (uint64_t i = 0U; i < NUMBER_OF_PORTS; ++i)
+        {
+            textRequestRoundTrip(serviceForPort(i), options);
+        }
+    });
+    const auto binaryDuration = measure([&] {
+        for (uint64_t i = 0U; i < NUMBER_OF_PORTS; ++i)
+        {
+            binaryRequestRoundTrip(serviceForPort(i), options);
+        }
+    });
+
+    std::cout << "encoding and decoding of " << NUMBER_OF_PORTS << " port requests" << std::endl;
+    std::cout << "  text   : " << textDuration.count() << " us" << std::endl;
+    std::cout << "  binary : " << binaryDuration.count() << " us" << std::endl;
+
+    roudi::RouDiEnvironment roudiEnv;
+    auto& runtime = runtime::PoshRuntime::initRuntime("iox-bm-port-creation");
+
+    const auto startupDuration = measure([&] {
+        if (useBatch)
+        {
+            // every iteration adds a publisher and a subscriber, the batch capacity is not exceeded
+            constexpr uint64_t ITERATIONS_PER_BATCH{MAX_PORTS_PER_BATCH / 2U};
+            for (uint64_t first = 0U; first < NUMBER_OF_PORTS / 2U; first += ITERATIONS_PER_BATCH)
+            {
+                runtime::PortBatch batch;
+                for (uint64_t i = first; i < std::min(first + ITERATIONS_PER_BATCH, NUMBER_OF_PORTS / 2U); ++i)
+                {
+                    IOX_DISCARD_RESULT(batch.addPublisher(serviceForPort(i)));
+                    IOX_DISCARD_RESULT(batch.addSubscriber(serviceForPort(i)));
+                }
+                if (!runtime.createPorts(batch))
+                {
+                    std::cerr << "batched port creation failed" << std::endl;
+                }
+            }
+            return;
+        }
+
+        for (uint64_t i = 0U; i < NUMBER_OF_PORTS / 2U; ++i)
+        {
+            runtime.getMiddlewarePublisher(serviceForPort(i));
+            runtime.getMiddlewareSubscriber(serviceForPort(i));
+        }
+    });
+
+    std::cout << "creation of " << NUMBER_OF_PORTS << " ports via RouDi with " << (useBatch ? "batched" : "single")
+              << " requests: " << startupDuration.count() << " us" << std::endl;
+
+    return 0;
+}
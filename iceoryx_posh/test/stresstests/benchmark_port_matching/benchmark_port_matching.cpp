@@ -0,0 +1,103 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
+#include "iceoryx_posh/internal/roudi/port_manager.hpp"
+#include "iceoryx_posh/roudi/memory/iceoryx_roudi_memory_manager.hpp"
+
+#include <chrono>
+#include <iostream>
+
+using namespace iox;
+
+/// leaves room for the publishers of the RouDi introspection
+constexpr uint64_t NUMBER_OF_SERVICES{MAX_PUBLISHERS - 32U};
+constexpr uint64_t SUBSCRIBERS_PER_SERVICE{2U};
+constexpr uint64_t NUMBER_OF_RESTARTS{10U};
+
+static_assert(NUMBER_OF_SERVICES * SUBSCRIBERS_PER_SERVICE <= MAX_SUBSCRIBERS, "not enough subscriber ports");
+
+capro::ServiceDescription serviceForIndex(const uint64_t index)
+{
+    return {"PortMatching", capro::IdString_t(cxx::TruncateToCapacity, cxx::convert::toString(index)), "Benchmark"};
+}
+
+int main()
+{
+    auto config = RouDiConfig_t().setDefaults();
+    roudi::IceOryxRouDiMemoryManager roudiMemoryManager(config);
+    if (roudiMemoryManager.createAndAnnounceMemory().has_error())
+    {
+        std::cerr << "could not create the shared memory" << std::endl;
+        return 1;
+    }
+    roudi::PortManager portManager(&roudiMemoryManager);
+
+    auto user = posix::PosixUser::getUserOfCurrentProcess();
+    auto segmentInfo = roudiMemoryManager.segmentManager().value()->getSegmentInformationWithWriteAccessForUser(user);
+    auto& memoryManager = segmentInfo.m_memoryManager.value().get();
+
+    // the subscribers stay alive while the application with the publishers restarts
+    popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.nodeName = "subscriber";
+    for (uint64_t i = 0U; i < NUMBER_OF_SERVICES * SUBSCRIBERS_PER_SERVICE; ++i)
+    {
+        if (portManager.acquireSubscriberPortData(serviceForIndex(i % NUMBER_OF_SERVICES),
+                                                  subscriberOptions,
+                                                  "iox-bm-subscriber",
+                                                  runtime::PortConfigInfo())
+                .has_error())
+        {
+            std::cerr << "could not create subscriber " << i << std::endl;
+            return 1;
+        }
+    }
+
+    popo::PublisherOptions publisherOptions;
+    publisherOptions.nodeName = "publisher";
+    std::chrono::microseconds totalDuration{0};
+    for (uint64_t restart = 0U; restart < NUMBER_OF_RESTARTS; ++restart)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        // every OFFER connects the matching subscribers, the removal of the process sends a STOP_OFFER to them
+        for (uint64_t i = 0U; i < NUMBER_OF_SERVICES; ++i)
+        {
+            if (portManager
+                    .acquirePublisherPortData(serviceForIndex(i),
+                                              publisherOptions,
+                                              "iox-bm-publisher",
+                                              &memoryManager,
+                                              runtime::PortConfigInfo())
+                    .has_error())
+            {
+                std::cerr << "could not create publisher " << i << std::endl;
+                return 1;
+            }
+        }
+        portManager.deletePortsOfProcess("iox-bm-publisher");
+        totalDuration +=
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    }
+
+    portManager.stopPortIntrospection();
+
+    std::cout << "restart of an application with " << NUMBER_OF_SERVICES << " publishers and "
+              << NUMBER_OF_SERVICES * SUBSCRIBERS_PER_SERVICE << " matching subscribers: "
+              << totalDuration.count() / NUMBER_OF_RESTARTS << " us" << std::endl;
+
+    return 0;
+}
@@ -73,6 +73,7 @@ class PoshRuntimeMock : public iox::runtime::PoshRuntime
                  const iox::popo::ServerOptions&,
                  const iox::runtime::PortConfigInfo&),
                 (noexcept, override));
+    MOCK_METHOD(bool, createPorts, (iox::runtime::PortBatch&), (noexcept, override));
     MOCK_METHOD(iox::popo::InterfacePortData*,
                 getMiddlewareInterface,
                 (const iox::capro::Interfaces, const iox::NodeName_t&),
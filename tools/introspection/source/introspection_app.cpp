@@ -307,13 +307,13 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     constexpr int32_t eventWidth{21};
     constexpr int32_t runtimeNameWidth{23};
     constexpr int32_t nodeNameWidth{23};
-    // uncomment once this information is needed
-    // constexpr int32_t sampleSizeWidth{12};
-    // constexpr int32_t chunkSizeWidth{12};
-    // constexpr int32_t chunksWidth{12};
-    // constexpr int32_t intervalWidth{19};
+    constexpr int32_t sampleSizeWidth{12};
+    constexpr int32_t chunkSizeWidth{12};
+    constexpr int32_t chunksWidth{12};
+    constexpr int32_t intervalWidth{19};
     constexpr int32_t subscriptionStateWidth{14};
     // constexpr int32_t fifoWidth{17};    // uncomment once this information is needed
+    constexpr int32_t latencyWidth{17};
     constexpr int32_t scopeWidth{12};
     constexpr int32_t interfaceSourceWidth{8};
 
@@ -324,11 +324,10 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     wprintw(pad, " %*s |", eventWidth, "Event");
     wprintw(pad, " %*s |", runtimeNameWidth, "Process");
     wprintw(pad, " %*s |", nodeNameWidth, "Node");
-    // uncomment once this information is needed
-    // wprintw(pad, " %*s |", sampleSizeWidth, "Sample Size");
-    // wprintw(pad, " %*s |", chunkSizeWidth, "Chunk Size");
-    // wprintw(pad, " %*s |", chunksWidth, "Chunks");
-    // wprintw(pad, " %*s |", intervalWidth, "Last Send Interval");
+    wprintw(pad, " %*s |", sampleSizeWidth, "Sample Size");
+    wprintw(pad, " %*s |", chunkSizeWidth, "Chunk Size");
+    wprintw(pad, " %*s |", chunksWidth, "Chunks");
+    wprintw(pad, " %*s |", intervalWidth, "Send Interval");
     wprintw(pad, " %*s\n", interfaceSourceWidth, "Src. Itf.");
 
     wprintw(pad, " %*s |", serviceWidth, "");
@@ -336,14 +335,14 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     wprintw(pad, " %*s |", eventWidth, "");
     wprintw(pad, " %*s |", runtimeNameWidth, "");
     wprintw(pad, " %*s |", nodeNameWidth, "");
-    // uncomment once this information is needed
-    // wprintw(pad, " %*s |", sampleSizeWidth, "[Byte]");
-    // wprintw(pad, " %*s |", chunkSizeWidth, "[Byte]");
-    // wprintw(pad, " %*s |", chunksWidth, "[/Minute]");
-    // wprintw(pad, " %*s |", intervalWidth, "[Milliseconds]");
+    wprintw(pad, " %*s |", sampleSizeWidth, "[Byte]");
+    wprintw(pad, " %*s |", chunkSizeWidth, "[Byte]");
+    wprintw(pad, " %*s |", chunksWidth, "[/Minute]");
+    wprintw(pad, " %*s |", intervalWidth, "[Milliseconds]");
     wprintw(pad, " %*s\n", interfaceSourceWidth, "");
 
     wprintw(pad, "---------------------------------------------------------------------------------------------------");
+    wprintw(pad, "-------------------------------------------------------------------");
     wprintw(pad, "--------------------------------\n");
 
     bool needsLineBreak{false};
@@ -381,11 +380,16 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
 
     for (auto& publisherPort : publisherPortData)
     {
-        // uncomment once this information is needed
-        // std::string m_sampleSize{"n/a"};
-        // std::string m_chunkSize{"n/a"};
-        // std::string m_chunksPerMinute{"n/a"};
-        // std::string sendInterval{"n/a"};
+        constexpr double NANOSECONDS_PER_MILLISECOND{1000000.0};
+        const auto& throughput = *publisherPort.throughputData;
+        const std::string sampleSize{std::to_string(throughput.m_sampleSize)};
+        const std::string chunkSize{std::to_string(throughput.m_chunkSize)};
+        const std::string chunksPerMinute{std::to_string(static_cast<uint64_t>(throughput.m_chunksPerMinute))};
+        const std::string sendInterval{
+            (throughput.m_lastSendIntervalInNanoseconds == 0U)
+                ? "n/a"
+                : std::to_string(static_cast<double>(throughput.m_lastSendIntervalInNanoseconds)
+                                 / NANOSECONDS_PER_MILLISECOND)};
 
         currentLine = 0;
         do
@@ -396,11 +400,10 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
             wprintw(pad, " %s |", printEntry(eventWidth, publisherPort.portData->m_caproEventMethodID).c_str());
             wprintw(pad, " %s |", printEntry(runtimeNameWidth, publisherPort.portData->m_name).c_str());
             wprintw(pad, " %s |", printEntry(nodeNameWidth, publisherPort.portData->m_node).c_str());
-            // uncomment once this information is needed
-            // wprintw(pad, " %s |", printEntry(sampleSizeWidth, m_sampleSize).c_str());
-            // wprintw(pad, " %s |", printEntry(chunkSizeWidth, m_chunkSize).c_str());
-            // wprintw(pad, " %s |", printEntry(chunksWidth, m_chunksPerMinute).c_str());
-            // wprintw(pad, " %s |", printEntry(intervalWidth, sendInterval).c_str());
+            wprintw(pad, " %s |", printEntry(sampleSizeWidth, sampleSize).c_str());
+            wprintw(pad, " %s |", printEntry(chunkSizeWidth, chunkSize).c_str());
+            wprintw(pad, " %s |", printEntry(chunksWidth, chunksPerMinute).c_str());
+            wprintw(pad, " %s |", printEntry(intervalWidth, sendInterval).c_str());
             wprintw(
                 pad,
                 " %s\n",
@@ -424,6 +427,7 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     wprintw(pad, " %*s |", nodeNameWidth, "Node");
     wprintw(pad, " %*s |", subscriptionStateWidth, "Subscription");
     // wprintw(pad, " %*s |", fifoWidth, "FiFo"); // uncomment once this information is needed
+    wprintw(pad, " %*s |", latencyWidth, "Latency [us]");
     wprintw(pad, " %*s\n", scopeWidth, "Propagation");
 
     wprintw(pad, " %*s |", serviceWidth, "");
@@ -433,10 +437,21 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     wprintw(pad, " %*s |", nodeNameWidth, "");
     wprintw(pad, " %*s |", subscriptionStateWidth, "State");
     // wprintw(pad, " %*s |", fifoWidth, "size / capacity"); // uncomment once this information is needed
+    wprintw(pad, " %*s |", latencyWidth, "avg / max");
     wprintw(pad, " %*s\n", scopeWidth, "scope");
 
     wprintw(pad, "---------------------------------------------------------------------------------------------------");
-    wprintw(pad, "---------------------------------------------------\n");
+    wprintw(pad, "---------------------------------------------------------------------\n");
+
+    auto latencyToString = [](const SubscriberPortChangingData& data) -> std::pair<std::string, std::string> {
+        if (!data.latencyRecordingEnabled || data.latencySampleCount == 0U)
+        {
+            return {"n/a", "n/a"};
+        }
+        constexpr uint64_t NANOSECONDS_PER_MICROSECOND{1000U};
+        return {std::to_string(data.latencySumInNanoseconds / data.latencySampleCount / NANOSECONDS_PER_MICROSECOND),
+                std::to_string(data.maxLatencyInNanoseconds / NANOSECONDS_PER_MICROSECOND)};
+    };
 
     auto subscriptionStateToString = [](iox::SubscribeState subState) -> std::string {
         switch (subState)
@@ -472,6 +487,18 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
                     printEntry(subscriptionStateWidth,
                                subscriptionStateToString(subscriber.subscriberPortChangingData->subscriptionState))
                         .c_str());
+            if (currentLine == 0)
+            {
+                auto latency = latencyToString(*subscriber.subscriberPortChangingData);
+                wprintw(pad,
+                        " %s / %s |",
+                        printEntry(((latencyWidth / 2) - 1), latency.first).c_str(),
+                        printEntry(((latencyWidth / 2) - 1), latency.second).c_str());
+            }
+            else
+            {
+                wprintw(pad, " %*s |", latencyWidth, "");
+            }
             // uncomment once this information is needed
             // if (currentLine == 0)
             //{
@@ -503,6 +530,7 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
         wprintw(pad, " %*s |", nodeNameWidth, "");
         wprintw(pad, " %*s |", subscriptionStateWidth, "");
         // wprintw(pad, " %*s |", fifoWidth, ""); // uncomment once this information is needed
+        wprintw(pad, " %*s |", latencyWidth, "");
         wprintw(pad, " %*s", scopeWidth, "");
         wprintw(pad, "\n");
     }